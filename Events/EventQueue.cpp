@@ -1,5 +1,5 @@
 #include "EventQueue.hpp"
-#include "Collections/Array.hpp"
+#include "System/Collections/MpmcQueue.hpp"
 #include "System/Console/Console.hpp"
 
 // ------------------------------------------------------------
@@ -9,13 +9,11 @@
 static constexpr u32 EVENT_QUEUE_CAPACITY = 1024;
 
 // ------------------------------------------------------------
-// Internal storage (ST, pointer-based, no slicing)
+// Internal storage (pointer-based, no slicing). Lock-free MPMC:
+// producer threads may push while the main loop polls.
 // ------------------------------------------------------------
 
-static Array<Event*> g_buffer(EVENT_QUEUE_CAPACITY);
-static u32 g_head = 0;
-static u32 g_tail = 0;
-static u32 g_count = 0;
+static MpmcQueue<Event*> g_queue(EVENT_QUEUE_CAPACITY);
 
 // ------------------------------------------------------------
 // Public API
@@ -27,36 +25,18 @@ void EventQueue::Push(Event* e) noexcept
         return;
 
     // Drop event if full (engine-style behavior)
-    if (g_count == EVENT_QUEUE_CAPACITY)
-    {
+    if (!g_queue.TryPush(e))
         delete e; // ownership da fila
-        return;
-    }
-
-    g_buffer[g_tail] = e;
-    g_tail = (g_tail + 1) % EVENT_QUEUE_CAPACITY;
-    ++g_count;
 }
 
 Boolean EventQueue::Poll(Event*& out) noexcept
 {
-    if (g_count == 0)
-        return false;
-
-    out = g_buffer[g_head];
-    g_head = (g_head + 1) % EVENT_QUEUE_CAPACITY;
-    --g_count;
-    return true;
+    return g_queue.TryPop(out);
 }
 
 void EventQueue::Clear() noexcept
 {
-    while (g_count > 0)
-    {
-        delete g_buffer[g_head];
-        g_head = (g_head + 1) % EVENT_QUEUE_CAPACITY;
-        --g_count;
-    }
-
-    g_head = g_tail = 0;
+    Event* e;
+    while (g_queue.TryPop(e))
+        delete e;
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Memory.hpp"
+#include "Arena.hpp"
+
+// ==============================================================
+//  Container allocators
+//  - Hand out raw, uninitialized storage; containers construct and
+//    destroy elements themselves (Memory::Construct / Memory::Destroy)
+//  - Required members:
+//        Pointer Allocate(u64 bytes, u32 alignment) noexcept;
+//        void    Deallocate(Pointer p, u64 bytes) noexcept;
+//        Boolean TryResize(Pointer p, u64 oldBytes, u64 newBytes) noexcept;
+//        Allocator SelectOnCopy() const noexcept;   // allocator for copies
+//        Boolean   IsMovable() const noexcept;      // a move may hand the
+//                                                   // buffer to another container
+//  - Allocate returns null on failure; containers throw "out of memory"
+// ==============================================================
+
+namespace Memory
+{
+    // Framework heap (Memory::Alloc/Free). Stateless.
+    // Alignment beyond 16 bytes is not supported.
+    class HeapAllocator
+    {
+    public:
+
+        inline Pointer Allocate(u64 bytes, u32 alignment) noexcept
+        {
+            return Alloc(bytes);
+        }
+
+        inline void Deallocate(Pointer p, u64 bytes) noexcept
+        {
+            Free(p);
+        }
+
+        // Succeeds while the block's size class still has room
+        inline Boolean TryResize(Pointer p, u64 oldBytes, u64 newBytes) noexcept
+        {
+            return p && newBytes <= GetAllocationCapacity(p) && !Realloc(p, newBytes).IsNull();
+        }
+
+        inline HeapAllocator SelectOnCopy() const noexcept { return HeapAllocator(); }
+
+        inline Boolean IsMovable() const noexcept { return true; }
+
+        inline Arena* GetArena() const noexcept { return nullptr; }
+    };
+
+    // Allocates from an Arena; Deallocate is a no-op and the memory is
+    // reclaimed when the arena is reset. Copies stay in the same arena.
+    class ArenaAllocator
+    {
+    public:
+
+        explicit ArenaAllocator(Arena& arena) noexcept : _arena(&arena) {}
+
+        inline Pointer Allocate(u64 bytes, u32 alignment) noexcept
+        {
+            return _arena->Allocate(bytes, alignment);
+        }
+
+        inline void Deallocate(Pointer p, u64 bytes) noexcept {}
+
+        inline Boolean TryResize(Pointer p, u64 oldBytes, u64 newBytes) noexcept
+        {
+            return _arena->TryResize(p, oldBytes, newBytes);
+        }
+
+        inline ArenaAllocator SelectOnCopy() const noexcept { return *this; }
+
+        inline Boolean IsMovable() const noexcept { return true; }
+
+        inline Arena* GetArena() const noexcept { return _arena; }
+
+    private:
+
+        Arena* _arena;
+    };
+
+    // Caller-owned inline storage a list starts in (SmallList). The first
+    // request that fits is served from it; anything else, or any request
+    // while it is in use, goes to the heap.
+    class InlineBuffer
+    {
+    public:
+
+        InlineBuffer(Pointer storage, u64 bytes) noexcept
+            : _storage(storage), _bytes(bytes), _inUse(false) {}
+
+        InlineBuffer(const InlineBuffer&) = delete;
+        InlineBuffer& operator=(const InlineBuffer&) = delete;
+
+        inline Pointer Allocate(u64 bytes) noexcept
+        {
+            if (!_inUse && bytes <= _bytes)
+            {
+                _inUse = true;
+                return _storage;
+            }
+            return Alloc(bytes);
+        }
+
+        inline void Deallocate(Pointer p) noexcept
+        {
+            if (Owns(p))
+                _inUse = false;
+            else
+                Free(p);
+        }
+
+        inline Boolean TryResize(Pointer p, u64 oldBytes, u64 newBytes) noexcept
+        {
+            if (Owns(p))
+                return newBytes <= _bytes;
+            return HeapAllocator().TryResize(p, oldBytes, newBytes);
+        }
+
+        inline Boolean Owns(const Pointer p) const noexcept
+        {
+            return p.Get() == _storage.Get();
+        }
+
+    private:
+
+        Pointer _storage;
+        u64 _bytes;
+        bool _inUse;
+    };
+
+    // Default for the collections: the heap, unless bound to an arena
+    // (scratch lists) or to inline storage (SmallList). Copies of a bound
+    // container go to the heap, so they can safely outlive the arena mark
+    // or the inline storage. Moves keep an arena binding (see List's move
+    // assignment for the exception); inline storage never moves, only the
+    // elements in it. One tagged word keeps List at its old size.
+    class DefaultAllocator
+    {
+    public:
+
+        constexpr DefaultAllocator() noexcept : _source(0) {}
+        explicit DefaultAllocator(Arena& arena) noexcept : _source((uintptr_t)&arena) {}
+        explicit DefaultAllocator(InlineBuffer& buffer) noexcept : _source((uintptr_t)&buffer | InlineTag) {}
+
+        inline Pointer Allocate(u64 bytes, u32 alignment) noexcept
+        {
+            if (_source == 0)
+                return Alloc(bytes);
+            if (_source & InlineTag)
+                return Inline()->Allocate(bytes);
+            return GetArena()->Allocate(bytes, alignment);
+        }
+
+        inline void Deallocate(Pointer p, u64 bytes) noexcept
+        {
+            if (_source == 0)
+                Free(p);
+            else if (_source & InlineTag)
+                Inline()->Deallocate(p);
+        }
+
+        inline Boolean TryResize(Pointer p, u64 oldBytes, u64 newBytes) noexcept
+        {
+            if (_source == 0)
+                return HeapAllocator().TryResize(p, oldBytes, newBytes);
+            if (_source & InlineTag)
+                return Inline()->TryResize(p, oldBytes, newBytes);
+            return GetArena()->TryResize(p, oldBytes, newBytes);
+        }
+
+        inline DefaultAllocator SelectOnCopy() const noexcept { return DefaultAllocator(); }
+
+        // Inline storage belongs to the object holding it
+        inline Boolean IsMovable() const noexcept { return (_source & InlineTag) == 0; }
+
+        inline Arena* GetArena() const noexcept
+        {
+            return (_source & InlineTag) ? nullptr : reinterpret_cast<Arena*>(_source);
+        }
+
+    private:
+
+        static constexpr uintptr_t InlineTag = 1;
+
+        inline InlineBuffer* Inline() const noexcept
+        {
+            return reinterpret_cast<InlineBuffer*>(_source & ~InlineTag);
+        }
+
+        uintptr_t _source;
+    };
+}
\ No newline at end of file
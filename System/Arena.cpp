@@ -0,0 +1,182 @@
+#include "Arena.hpp"
+
+namespace Memory
+{
+    Arena::Arena(u64 chunkSize) noexcept
+        : _current(nullptr)
+        , _spare(nullptr)
+        , _chunkSize(chunkSize)
+    {
+    }
+
+    Arena::~Arena() noexcept
+    {
+        Release();
+    }
+
+    Arena::Chunk* Arena::new_chunk(uint64_t minUsable) noexcept
+    {
+        // reuse a spare chunk that is large enough
+        Chunk** link = &_spare;
+        for (Chunk* c = _spare; c; c = c->prev)
+        {
+            if (c->capacity >= minUsable)
+            {
+                *link = c->prev;
+                c->used = 0;
+                return c;
+            }
+            link = &c->prev;
+        }
+
+        const uint64_t pageSize = PageSize();
+        uint64_t bytes = minUsable + sizeof(Chunk);
+        if (bytes < _chunkSize) bytes = _chunkSize;
+        uint64_t pages = (bytes + pageSize - 1) / pageSize;
+
+        Chunk* c = static_cast<Chunk*>(AllocPages(pages).Get());
+        if (!c) return nullptr;
+
+        c->prev = nullptr;
+        c->pages = pages;
+        c->capacity = pages * pageSize - sizeof(Chunk);
+        c->used = 0;
+        return c;
+    }
+
+    void Arena::free_chunks(Chunk* c) noexcept
+    {
+        while (c)
+        {
+            Chunk* prev = c->prev;
+            FreePages(Pointer(c), c->pages);
+            c = prev;
+        }
+    }
+
+    Pointer Arena::Allocate(u64 size, u32 alignment) noexcept
+    {
+        const uint64_t n = size;
+        const uint64_t align = (uint32_t)alignment;
+
+        if (_current)
+        {
+            uint64_t base = (uint64_t)(uintptr_t)chunk_data(_current);
+            uint64_t start = ((base + _current->used + align - 1) & ~(align - 1)) - base;
+
+            if (start + n <= _current->capacity)
+            {
+                _current->used = start + n;
+                return Pointer(chunk_data(_current) + start);
+            }
+        }
+
+        // chunk data is page + header aligned; reserve slack for larger alignments
+        Chunk* c = new_chunk(n + (align > 16 ? align : 0));
+        if (!c) return Pointer();
+
+        c->prev = _current;
+        _current = c;
+
+        uint64_t base = (uint64_t)(uintptr_t)chunk_data(c);
+        uint64_t start = ((base + align - 1) & ~(align - 1)) - base;
+        c->used = start + n;
+        return Pointer(chunk_data(c) + start);
+    }
+
+    Boolean Arena::TryResize(Pointer p, u64 oldSize, u64 newSize) noexcept
+    {
+        if (!_current || !p) return false;
+
+        unsigned char* data = chunk_data(_current);
+        unsigned char* block = static_cast<unsigned char*>(p.Get());
+        const uint64_t oldN = oldSize;
+        const uint64_t newN = newSize;
+
+        if (block + oldN != data + _current->used)
+            return false;
+
+        uint64_t start = (uint64_t)(block - data);
+        if (start + newN > _current->capacity)
+            return false;
+
+        _current->used = start + newN;
+        return true;
+    }
+
+    Arena::Marker Arena::Mark() const noexcept
+    {
+        return Marker{ _current, _current ? _current->used : 0 };
+    }
+
+    void Arena::Reset(const Marker& marker) noexcept
+    {
+        // chunks opened after the mark become spares
+        while (_current && _current != marker.Chunk)
+        {
+            Chunk* c = _current;
+            _current = c->prev;
+            c->prev = _spare;
+            _spare = c;
+        }
+
+        if (_current)
+            _current->used = marker.Offset;
+    }
+
+    void Arena::Reset() noexcept
+    {
+        Reset(Marker{ nullptr, 0 });
+    }
+
+    void Arena::Release() noexcept
+    {
+        free_chunks(_current);
+        free_chunks(_spare);
+        _current = nullptr;
+        _spare = nullptr;
+    }
+
+    u64 Arena::GetBytesUsed() const noexcept
+    {
+        uint64_t total = 0;
+        for (Chunk* c = _current; c; c = c->prev)
+            total += c->used;
+        return total;
+    }
+
+    u64 Arena::GetBytesReserved() const noexcept
+    {
+        uint64_t total = 0;
+        for (Chunk* c = _current; c; c = c->prev)
+            total += c->capacity;
+        for (Chunk* c = _spare; c; c = c->prev)
+            total += c->capacity;
+        return total;
+    }
+
+    // ------------------------------------------------------------
+    // Scratch arenas
+    // ------------------------------------------------------------
+
+    namespace
+    {
+        thread_local Arena t_scratch[2];
+    }
+
+    Arena& GetScratchArena(const Arena* conflict) noexcept
+    {
+        return (&t_scratch[0] != conflict) ? t_scratch[0] : t_scratch[1];
+    }
+
+    ScratchScope::ScratchScope(const Arena* conflict) noexcept
+        : _arena(GetScratchArena(conflict))
+        , _mark(_arena.Mark())
+    {
+    }
+
+    ScratchScope::~ScratchScope() noexcept
+    {
+        _arena.Reset(_mark);
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Memory.hpp"
+
+namespace Memory
+{
+    // ------------------------------------------------------------
+    // Arena - linear (bump) allocator
+    // ------------------------------------------------------------
+    // Memory comes from AllocPages in chunks and is handed out by
+    // bumping an offset. There is no per-allocation free: callers take
+    // a Mark() and later Reset() to it, which releases everything
+    // allocated after the mark at once. Chunks emptied by a reset are
+    // kept for reuse until Release() or destruction.
+    //
+    // Objects placed in an arena are NOT destroyed by Reset(); whoever
+    // constructs them must destroy them (List<T> does so).
+
+    class Arena final
+    {
+    public:
+
+        static constexpr u64 DefaultChunkSize = 64 * 1024;
+
+        struct Marker
+        {
+            const void* Chunk;
+            uint64_t Offset;
+        };
+
+        explicit Arena(u64 chunkSize = DefaultChunkSize) noexcept;
+        ~Arena() noexcept;
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // Returns null only if the OS refuses more pages. alignment must be a power of two.
+        Pointer Allocate(u64 size, u32 alignment = 16) noexcept;
+
+        template<typename T>
+        inline T* AllocateArray(u64 count) noexcept
+        {
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)).Get());
+        }
+
+        // Grows (or shrinks) the most recent allocation in place.
+        // Fails if p is not the last block or the chunk has no room left.
+        Boolean TryResize(Pointer p, u64 oldSize, u64 newSize) noexcept;
+
+        Marker Mark() const noexcept;
+        void Reset(const Marker& marker) noexcept;
+        void Reset() noexcept;
+
+        // Returns every chunk (including spares) to the OS
+        void Release() noexcept;
+
+        u64 GetBytesUsed() const noexcept;
+        u64 GetBytesReserved() const noexcept;
+
+    private:
+
+        struct Chunk
+        {
+            Chunk* prev;
+            uint64_t pages;
+            uint64_t capacity;   // usable bytes after the header
+            uint64_t used;
+        };
+
+        Chunk* new_chunk(uint64_t minUsable) noexcept;
+        static void free_chunks(Chunk* c) noexcept;
+
+        static inline unsigned char* chunk_data(Chunk* c) noexcept
+        {
+            return reinterpret_cast<unsigned char*>(c) + sizeof(Chunk);
+        }
+
+        Chunk* _current;
+        Chunk* _spare;
+        uint64_t _chunkSize;
+    };
+
+    // ------------------------------------------------------------
+    // Scratch arenas
+    // ------------------------------------------------------------
+    // Each thread owns two scratch arenas for short-lived buffers
+    // (decoded codepoints, grapheme boundaries, temporary folds).
+    // A ScratchScope marks one on entry and resets it on exit, so
+    // scopes nest naturally:
+    //
+    //     Memory::ScratchScope scratch;
+    //     List<CodePoint> cps(scratch.GetArena());
+    //
+    // A function that fills a caller-provided List must pass that list's
+    // arena as 'conflict': the scope then uses the other scratch arena,
+    // otherwise growing the caller's list inside the scope would place
+    // it in memory the scope is about to reset.
+
+    class ScratchScope final
+    {
+    public:
+
+        explicit ScratchScope(const Arena* conflict = nullptr) noexcept;
+        ~ScratchScope() noexcept;
+
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+
+        inline Arena& GetArena() noexcept { return _arena; }
+
+    private:
+
+        Arena& _arena;
+        Arena::Marker _mark;
+    };
+
+    Arena& GetScratchArena(const Arena* conflict = nullptr) noexcept;
+}
@@ -14,6 +14,19 @@ CPUInfo::CPUID::CPUID(u32 funcId, u32 subFuncId) {
 #endif
 }
 
+// XCR0: which register state the OS saves on a context switch.
+// Only valid when CPUID reports OSXSAVE.
+static uint64_t ReadXCR0() noexcept
+{
+#ifdef _WIN32
+	return (uint64_t)_xgetbv(0);
+#else
+	uint32_t eax, edx;
+	asm volatile("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0u));
+	return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
 CPUInfo::CPUInfo()
 {
 	// Get vendor name EAX=0
@@ -31,13 +44,22 @@ CPUInfo::CPUInfo()
 	mIsSSE3 = cpuID1.ECX() & SSE3_POS;
 	mIsSSE41 = cpuID1.ECX() & SSE41_POS;
 	mIsSSE42 = cpuID1.ECX() & SSE41_POS;
-	mIsAVX = cpuID1.ECX() & AVX_POS;
-	mIsF16C = cpuID1.ECX() & F16C_POS;
-	mIsFMA3 = cpuID1.ECX() & FMA3_POS;
+	mIsAES = cpuID1.ECX() & AES_POS;
+	// AVX instructions fault unless the OS saves the YMM (and for AVX-512
+	// the ZMM and mask) registers, whatever the CPU supports
+	const uint64_t xcr0 = Boolean(cpuID1.ECX() & OSXSAVE_POS) ? ReadXCR0() : 0;
+	const Boolean osSavesYMM = (xcr0 & XCR0_YMM) == XCR0_YMM;
+	const Boolean osSavesZMM = (xcr0 & XCR0_ZMM) == XCR0_ZMM;
+	mIsAVX = osSavesYMM && Boolean(cpuID1.ECX() & AVX_POS);
+	mIsF16C = osSavesYMM && Boolean(cpuID1.ECX() & F16C_POS);
+	mIsFMA3 = osSavesYMM && Boolean(cpuID1.ECX() & FMA3_POS);
 	// Get AVX2 instructions availability
-	CPUID cpuID7(7, 0);
-	mIsAVX2 = cpuID7.EBX() & AVX2_POS;
-	mIsAVX512F = cpuID7.EBX() & AVX512F_POS;
+	if (HFS >= 7)
+	{
+		CPUID cpuID7(7, 0);
+		mIsAVX2 = osSavesYMM && Boolean(cpuID7.EBX() & AVX2_POS);
+		mIsAVX512F = osSavesZMM && Boolean(cpuID7.EBX() & AVX512F_POS);
+	}
 
 	String vendorIdUppercase = mVendorId.ToUpper();
 
@@ -43,6 +43,7 @@ public:
 	inline constexpr Boolean HaveAVX() const noexcept  { return mIsAVX; }
 	inline constexpr Boolean HaveAVX2() const noexcept  { return mIsAVX2; }
 	inline constexpr Boolean HaveAVX512F() const noexcept  { return mIsAVX512F; }
+	inline constexpr Boolean HaveAES() const noexcept  { return mIsAES; }
 
 private:
 
@@ -57,6 +58,10 @@ private:
 	static constexpr u32 FMA3_POS = 1u << 12;
 	static constexpr u32 AVX512F_POS = 1u << 15; // Bit 16
 	static constexpr u32 F16C_POS = 1u << 29;
+	static constexpr u32 AES_POS = 1u << 25;
+	static constexpr u32 OSXSAVE_POS = 1u << 27;
+	static constexpr uint64_t XCR0_YMM = 0x06;   // SSE and AVX state
+	static constexpr uint64_t XCR0_ZMM = 0xE6;   // plus opmask and both ZMM halves
 	static constexpr u32 LVL_NUM = 0x000000FF;
 	static constexpr u32 LVL_TYPE = 0x0000FF00;
 	static constexpr u32 LVL_CORES = 0x0000FFFF;
@@ -78,4 +83,5 @@ private:
 	Boolean mIsAVX512F = false;
 	Boolean mIsF16C = false;
 	Boolean mIsFMA3 = false;
+	Boolean mIsAES = false;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "System/Types.hpp"
+#include "System/Allocator.hpp"
 
 // Simple Array<T> with .NET-like semantics (fixed-length array).
 // - No use of std::*
@@ -8,11 +9,13 @@
 // - Iterators are raw pointers
 // - Reverse iterator implemented locally
 // - No Add/Remove/Insert methods (handled by List<T> later)
+// - Storage comes from Allocator; elements are placement-constructed
 
-template<typename T>
+template<typename T, typename Allocator = Memory::DefaultAllocator>
 class Array {
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using size_type = u64;
     using pointer = value_type*;
     using const_pointer = const value_type*;
@@ -24,33 +27,56 @@ public:
 private:
     pointer m_data;
     size_type m_size;
+    Allocator m_alloc;
 
-    // Helper: default-construct N elements into raw storage allocated by new T[N]
-    static pointer allocate_and_default_construct(size_type n) {
+    pointer allocate(size_type n) {
+        pointer p = static_cast<pointer>(m_alloc.Allocate(n * sizeof(value_type), alignof(value_type)).Get());
+        if (!p) throw "out of memory";
+        return p;
+    }
+
+    // Helper: value-initialize N elements in fresh storage (T())
+    pointer allocate_and_default_construct(size_type n) {
         if (n == 0) return nullptr;
-        pointer p = new value_type[n](); // note the parentheses -> value-initialize elements
+        pointer p = allocate(n);
+        for (size_type i = 0; i < n; ++i) Memory::Construct<value_type>(Pointer(p + i));
         return p;
     }
 
-    // Helper: allocate and copy-construct from source (safe basic)
-    static pointer allocate_and_copy(const_pointer src, size_type n) {
+    // Helper: allocate and copy-construct from source
+    pointer allocate_and_copy(const_pointer src, size_type n) {
         if (n == 0) return nullptr;
-        pointer p = new value_type[n];
-        for (size_type i = 0; i < n; ++i) {
-            p[i] = src[i]; // copy-assign into default-constructed slot
-        }
+        pointer p = allocate(n);
+        for (size_type i = 0; i < n; ++i) Memory::Construct<value_type>(Pointer(p + i), src[i]);
         return p;
     }
 
+    void release() noexcept {
+        if (!m_data) return;
+        if constexpr (!is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < m_size; ++i) Memory::Destroy(m_data + i);
+        }
+        m_alloc.Deallocate(Pointer(m_data), m_size * sizeof(value_type));
+    }
+
 public:
     // Default ctor -> empty array
     Array() noexcept
-        : m_data(nullptr), m_size(0) {
+        : m_data(nullptr), m_size(0), m_alloc() {
     }
 
     // Construct with length; elements value-initialized (T())
     explicit Array(size_type length)
-        : m_data(nullptr), m_size(length) {
+        : m_data(nullptr), m_size(length), m_alloc() {
+        if (length == 0) {
+            m_data = nullptr;
+            return;
+        }
+        m_data = allocate_and_default_construct(length);
+    }
+
+    Array(size_type length, const Allocator& allocator)
+        : m_data(nullptr), m_size(length), m_alloc(allocator) {
         if (length == 0) {
             m_data = nullptr;
             return;
@@ -60,7 +86,7 @@ public:
 
     // Construct from raw buffer (copies elements)
     Array(const_pointer src, size_type length)
-        : m_data(nullptr), m_size(length) {
+        : m_data(nullptr), m_size(length), m_alloc() {
         if (length == 0) {
             m_data = nullptr;
             return;
@@ -70,7 +96,7 @@ public:
 
     // Copy constructor (deep copy)
     Array(const Array& other)
-        : m_data(nullptr), m_size(other.m_size) {
+        : m_data(nullptr), m_size(other.m_size), m_alloc(other.m_alloc.SelectOnCopy()) {
         if (other.m_size == 0) {
             m_data = nullptr;
             return;
@@ -80,7 +106,7 @@ public:
 
     // Move constructor (steal resources)
     Array(Array&& other) noexcept
-        : m_data(other.m_data), m_size(other.m_size) {
+        : m_data(other.m_data), m_size(other.m_size), m_alloc(other.m_alloc) {
         other.m_data = nullptr;
         other.m_size = 0;
     }
@@ -88,7 +114,7 @@ public:
     // Destructor
     ~Array() noexcept {
         if (m_data) {
-            delete[] m_data;
+            release();
             m_data = nullptr;
             m_size = 0;
         }
@@ -105,9 +131,10 @@ public:
     // Move assignment
     Array& operator=(Array&& other) noexcept {
         if (&other == this) return *this;
-        if (m_data) delete[] m_data;
+        release();
         m_data = other.m_data;
         m_size = other.m_size;
+        m_alloc = other.m_alloc;
         other.m_data = nullptr;
         other.m_size = 0;
         return *this;
@@ -126,12 +153,15 @@ public:
         m_size = other.m_size;
         other.m_data = tdata;
         other.m_size = tsize;
+        Allocator talloc = m_alloc;
+        m_alloc = other.m_alloc;
+        other.m_alloc = talloc;
     }
 
     template<typename... Args>
-    static Array<T> Create(Args&&... args) {
+    static Array<T, Allocator> Create(Args&&... args) {
         constexpr size_type N = sizeof...(Args);
-        Array<T> r(N);
+        Array<T, Allocator> r(N);
         T values[] = { T(static_cast<Args&&>(args))... };
         for (size_type i = 0; i < N; ++i) r[i] = values[i];
         return r;
@@ -254,10 +284,10 @@ public:
     }
 
     // IndicesOf: returns an Array<size_type> with matching indices
-    Array<size_type> IndicesOf(const_reference v) const {
+    Array<size_type, Allocator> IndicesOf(const_reference v) const {
         // first pass count
         size_type c = Count(v);
-        Array<size_type> result(c);
+        Array<size_type, Allocator> result(c, m_alloc.SelectOnCopy());
         size_type j = 0;
         for (size_type i = 0; i < m_size; ++i) {
             if (m_data[i] == v) {
@@ -334,7 +364,7 @@ public:
         if (newSize == 0) {
             return Array(); // empty
         }
-        Array r(newSize);
+        Array r(newSize, a.m_alloc.SelectOnCopy());
         size_type toCopy = (a.m_size < newSize) ? a.m_size : newSize;
         for (size_type i = 0; i < toCopy; ++i) r.m_data[i] = a.m_data[i];
         // remaining slots already default-initialized in constructor
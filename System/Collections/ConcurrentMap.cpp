@@ -0,0 +1,18 @@
+#include "ConcurrentMap.hpp"
+#include "System/CPUInfo.hpp"
+
+u32 ConcurrentMapShardHint() noexcept
+{
+	static const uint32_t hint = []() noexcept
+	{
+		int32_t cpus = (int32_t)CPUInfo().LogicalCPUs();
+		uint64_t wanted = (uint64_t)(cpus > 0 ? cpus : 1) * 4;
+
+		uint32_t count = 1;
+		while (count < wanted && count < (uint32_t)CONCURRENT_MAP_MAX_SHARDS)
+			count <<= 1;
+		return count;
+	}();
+
+	return hint;
+}
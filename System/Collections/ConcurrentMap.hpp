@@ -0,0 +1,346 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Memory.hpp"
+#include "System/Collections/Dictionary.hpp"
+#include "System/Collections/List.hpp"
+#include "System/Threading/Interlocked.hpp"
+#include "System/Threading/ReaderWriterSpinLock.hpp"
+
+// ==============================================================
+//  ConcurrentMap<K, V> - thread-safe Map split into shards
+//  - The key hash picks a shard; each shard is a Map guarded by
+//    its own ReaderWriterSpinLock, so unrelated keys rarely contend
+//  - Keys and values trivially copyable: reads are optimistic.
+//    A per-shard version (seqlock) is bumped around every write;
+//    readers probe without locking and retry if it moved. A shard
+//    that outgrows its table publishes a new one and keeps the old
+//    one alive until destruction (at most ~2x the live table size)
+//  - Other types: readers share the shard's read lock
+//  - Values are returned by copy; nothing points into a shard
+//    after its lock is released
+// ==============================================================
+
+static constexpr u32 CONCURRENT_MAP_MAX_SHARDS = 256;
+
+// Shard count hint: four shards per logical CPU (CPUInfo::LogicalCPUs),
+// rounded up to a power of two. CPUInfo is queried once.
+u32 ConcurrentMapShardHint() noexcept;
+
+template<typename K, typename V>
+class ConcurrentMap
+{
+public:
+
+    explicit ConcurrentMap(u32 shardCount = ConcurrentMapShardHint())
+    {
+        uint32_t count = 1;
+        uint32_t bits = 0;
+        while (count < (uint32_t)shardCount && count < (uint32_t)CONCURRENT_MAP_MAX_SHARDS)
+        {
+            count <<= 1;
+            ++bits;
+        }
+
+        _shardCount = count;
+        _shardShift = 32 - bits;
+
+        _block = Memory::Alloc(sizeof(Shard) * count + alignof(Shard));
+        if (_block.IsNull())
+            throw "out of memory";
+
+        _shards = static_cast<Shard*>(Memory::AlignForward(_block, alignof(Shard)).Get());
+        for (uint32_t i = 0; i < count; ++i)
+            Memory::Construct<Shard>(Pointer(&_shards[i]));
+    }
+
+    ConcurrentMap(const ConcurrentMap&) = delete;
+    ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+
+    ~ConcurrentMap()
+    {
+        for (uint32_t i = 0; i < _shardCount; ++i)
+            Memory::Destroy(&_shards[i]);
+        Memory::Free(_block);
+    }
+
+    Boolean TryGetValue(const K& key, V& value) const
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        if constexpr (k_optimistic)
+        {
+            bool found;
+            if (TryReadOptimistic(shard, key, hash, value, found))
+                return found;
+        }
+
+        ReadLockScope scope(shard.lock);
+        const V* found = shard.map->FindWithHash(key, hash);
+        if (found == nullptr)
+            return false;
+
+        value = *found;
+        return true;
+    }
+
+    Boolean Contains(const K& key) const
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        if constexpr (k_optimistic)
+        {
+            V ignored;
+            bool found;
+            if (TryReadOptimistic(shard, key, hash, ignored, found))
+                return found;
+        }
+
+        ReadLockScope scope(shard.lock);
+        return shard.map->FindWithHash(key, hash) != nullptr;
+    }
+
+    // Adds the key or overwrites its value.
+    Boolean Insert(const K& key, const V& value)
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        WriteLockScope scope(shard.lock);
+        GrowIfNeeded(shard);
+        BeginWrite(shard);
+        shard.map->InsertWithHash(key, value, hash);
+        EndWrite(shard);
+        return true;
+    }
+
+    // Adds the key only if absent; false if it was already there.
+    Boolean TryAdd(const K& key, const V& value)
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        WriteLockScope scope(shard.lock);
+        if (shard.map->FindWithHash(key, hash) != nullptr)
+            return false;
+
+        GrowIfNeeded(shard);
+        BeginWrite(shard);
+        shard.map->InsertWithHash(key, value, hash);
+        EndWrite(shard);
+        return true;
+    }
+
+    // Returns the value for key, calling factory(key) to create it when
+    // absent. The factory runs under the shard's write lock, so it is called
+    // at most once per key; keep it short.
+    template<typename F>
+    V GetOrAdd(const K& key, F&& factory)
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        if constexpr (k_optimistic)
+        {
+            V value;
+            bool found;
+            if (TryReadOptimistic(shard, key, hash, value, found) && found)
+                return value;
+        }
+        else
+        {
+            ReadLockScope scope(shard.lock);
+            if (const V* found = shard.map->FindWithHash(key, hash))
+                return *found;
+        }
+
+        WriteLockScope scope(shard.lock);
+        if (const V* found = shard.map->FindWithHash(key, hash))
+            return *found;
+
+        V value = factory(key);
+        GrowIfNeeded(shard);
+        BeginWrite(shard);
+        shard.map->InsertWithHash(key, value, hash);
+        EndWrite(shard);
+        return value;
+    }
+
+    Boolean Remove(const K& key)
+    {
+        const u32 hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        WriteLockScope scope(shard.lock);
+        BeginWrite(shard);
+        Boolean removed = shard.map->Remove(key);
+        EndWrite(shard);
+        return removed;
+    }
+
+    // Sum of the shard counts; shards are read one after another, so under
+    // concurrent writes this is not a single point-in-time snapshot.
+    u64 Count() const
+    {
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < _shardCount; ++i)
+        {
+            ReadLockScope scope(_shards[i].lock);
+            total += (uint64_t)_shards[i].map->Count();
+        }
+        return total;
+    }
+
+    void Clear()
+    {
+        for (uint32_t i = 0; i < _shardCount; ++i)
+        {
+            Shard& shard = _shards[i];
+            WriteLockScope scope(shard.lock);
+            BeginWrite(shard);
+            shard.map->Clear();
+            EndWrite(shard);
+        }
+    }
+
+    // visit(const K&, const V&) for every entry, one shard at a time under its
+    // read lock. The visitor must not call back into this map.
+    template<typename F>
+    void ForEach(F&& visit) const
+    {
+        for (uint32_t i = 0; i < _shardCount; ++i)
+        {
+            ReadLockScope scope(_shards[i].lock);
+            for (auto pair : *_shards[i].map)
+                visit(static_cast<const K&>(pair.key), static_cast<const V&>(pair.value));
+        }
+    }
+
+    u32 ShardCount() const noexcept
+    {
+        return _shardCount;
+    }
+
+private:
+
+    // Optimistic readers copy keys and values out of memory a writer may be
+    // changing; only types where a torn copy is harmless (and discarded) qualify.
+    static constexpr bool k_optimistic = is_trivially_copyable_v<K> && is_trivially_copyable_v<V>;
+    static constexpr uint32_t k_optimistic_attempts = 4;
+
+    using Table = Map<K, V>;
+
+    struct alignas(64) Shard
+    {
+        Shard()
+            : version(0)
+            , map(NewTable(0))
+        {
+        }
+
+        ~Shard()
+        {
+            DeleteTable(map);
+            for (uint64_t i = 0; i < retired.Count(); ++i)
+                DeleteTable(retired[i]);
+        }
+
+        ReaderWriterSpinLock lock;
+        volatile uint32_t version;   // odd while a writer is mutating the table
+        Table* volatile map;
+        List<Table*> retired;        // outgrown tables optimistic readers may still hold
+    };
+
+    static Table* NewTable(u64 count)
+    {
+        Pointer memory = Memory::Alloc(sizeof(Table));
+        if (memory.IsNull())
+            throw "out of memory";
+
+        Table* table = Memory::Construct<Table>(memory);
+        table->Reserve(count);
+        return table;
+    }
+
+    static void DeleteTable(Table* table) noexcept
+    {
+        Memory::Destroy(table);
+        Memory::Free(Pointer(table));
+    }
+
+    inline Shard& ShardFor(u32 hash) const noexcept
+    {
+        // top bits: the Map inside uses the low bits for its tags
+        return _shards[(uint64_t)(uint32_t)hash >> _shardShift];
+    }
+
+    // Returns false when writers kept interfering; the caller then locks.
+    bool TryReadOptimistic(const Shard& shard, const K& key, u32 hash, V& value, bool& found) const
+    {
+        alignas(V) unsigned char copy[sizeof(V)];
+
+        for (uint32_t attempt = 0; attempt < k_optimistic_attempts; ++attempt)
+        {
+            const uint32_t before = Volatile::Read(&shard.version);
+            if (before & 1)
+            {
+                Interlocked::SpinWait();
+                continue;
+            }
+
+            const Table* table = Volatile::Read(&shard.map);
+            const V* hit = table->FindWithHash(key, hash);
+            if (hit != nullptr)
+                Memory::Copy(Pointer(copy), Pointer(hit), sizeof(V));
+
+            Interlocked::AcquireFence();
+            if (Volatile::ReadRelaxed(&shard.version) == before)
+            {
+                if (hit != nullptr)
+                    Memory::Copy(Pointer(&value), Pointer(copy), sizeof(V));
+                found = hit != nullptr;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // With optimistic readers a table must never rehash in place (readers may be
+    // inside its arrays), so a full table is replaced by a larger copy instead.
+    void GrowIfNeeded(Shard& shard)
+    {
+        if constexpr (k_optimistic)
+        {
+            Table* current = shard.map;
+            if (!current->IsAtLoadLimit())
+                return;
+
+            Table* grown = NewTable(current->Count() + 1);
+            for (auto pair : *current)
+                grown->Insert(pair.key, pair.value);
+
+            shard.retired.Add(current);
+            Volatile::Write(&shard.map, grown);
+        }
+    }
+
+    inline void BeginWrite(Shard& shard) noexcept
+    {
+        if constexpr (k_optimistic)
+            Interlocked::Increment(&shard.version);
+    }
+
+    inline void EndWrite(Shard& shard) noexcept
+    {
+        if constexpr (k_optimistic)
+            Interlocked::Increment(&shard.version);
+    }
+
+    Pointer  _block;
+    Shard*   _shards;
+    uint32_t _shardCount;
+    uint32_t _shardShift;
+};
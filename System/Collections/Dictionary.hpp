@@ -1,94 +1,98 @@
 #pragma once
 
-#include "System/Types.hpp"
-#include "System/Memory.hpp"
-#include "System/Types/Fundamentals/Hash.hpp"
+#include "System/Collections/HashTable.hpp"
 
-static constexpr u64 MAP_INITIAL_CAPACITY = 16;
-static constexpr f32 MAP_MAX_LOAD = 0.70f;
+// ==============================================================
+//  Map<K, V> - hash map on the shared HashTable core
+//  - Lookups accept hash_lookup_view<K> (StringView for String)
+//    and a precomputed hash (FindWithHash / InsertWithHash)
+// ==============================================================
 
 template<typename K, typename V>
-class Map
+class Map : public HashTable<K, V>
 {
+    using Base = HashTable<K, V>;
+    using LookupView = typename Base::LookupView;
+
+    template<typename Q>
+    static constexpr bool is_lookup_v = Base::template is_lookup_v<Q>;
+
 public:
 
-    Map()
-        : _capacity(MAP_INITIAL_CAPACITY)
-        , _count(0)
+    Map() noexcept = default;
+
+    Boolean Insert(const K& key, const V& value)
     {
-        _entries = static_cast<Entry*>(Memory::Alloc(sizeof(Entry) * _capacity).Get());
-        for (uint64_t i = 0; i < _capacity; ++i)
-            _entries[i].occupied = false;
+        return InsertWithHash(key, value, Hash(key));
     }
 
-    ~Map()
+    // `hash` must be Hash(key): callers that probe several maps with the
+    // same key hash it once.
+    Boolean InsertWithHash(const K& key, const V& value, u32 hash)
     {
-        Clear();
-        Memory::Free(static_cast<Pointer>(_entries));
+        uint64_t slot;
+        if (this->Locate(hash, key, slot))
+        {
+            this->_values[slot] = value; // overwrite
+            return true;
+        }
+
+        if (this->GrowForInsert())
+            this->Locate(hash, key, slot);
+
+        this->Place(slot, hash, key, value);
+        return true;
     }
 
-    void Clear()
+    V* Find(const K& key)
     {
-        for (uint64_t i = 0; i < _capacity; ++i)
-            _entries[i].occupied = false;
-        _count = 0;
+        return FindWithHash(key, Hash(key));
     }
 
-    Boolean Insert(const K& key, const V& value)
+    const V* Find(const K& key) const
     {
-        if ((_count + 1) > (u64)(_capacity * MAP_MAX_LOAD))
-            Rehash(_capacity * 2);
-
-        u32 hash = Hash(key);
-
-        for (uint64_t i = 0; i < _capacity; ++i)
-        {
-            uint64_t idx = Probe(hash, i);
-            Entry& e = _entries[idx];
-
-            if (!e.occupied || e.tombstone)
-            {
-                e.key = key;
-                e.value = value;
-                e.hash = hash;
-                e.occupied = true;
-                e.tombstone = false;
-                ++_count;
-                return true;
-            }
-
-            if (e.hash == hash && e.key == key)
-            {
-                e.value = value; // overwrite
-                return true;
-            }
-        }
-
-        return false;
+        return const_cast<Map*>(this)->Find(key);
     }
 
-    V* Find(const K& key)
+    // Lookup through the key's borrowed view (hash_lookup_view<K>), e.g.
+    // a StringView or const char* for String keys: no temporary K is built.
+    template<typename Q> requires is_lookup_v<Q>
+    V* Find(const Q& key)
     {
-        u32 hash = Hash(key);
+        const LookupView view(key);
+        return FindWithHash(view, Hash(view));
+    }
 
-        for (uint64_t i = 0; i < _capacity; ++i)
-        {
-            uint64_t idx = Probe(hash, i);
-            Entry& e = _entries[idx];
+    template<typename Q> requires is_lookup_v<Q>
+    const V* Find(const Q& key) const
+    {
+        return const_cast<Map*>(this)->Find(key);
+    }
 
-            if (!e.occupied)
-                return nullptr;
+    // `hash` must be Hash(key) (for a view, the hash of the view).
+    V* FindWithHash(const K& key, u32 hash)
+    {
+        uint64_t slot;
+        return this->Locate(hash, key, slot) ? &this->_values[slot] : nullptr;
+    }
 
-            if (!e.tombstone && e.hash == hash && e.key == key)
-                return &e.value;
-        }
+    const V* FindWithHash(const K& key, u32 hash) const
+    {
+        return const_cast<Map*>(this)->FindWithHash(key, hash);
+    }
 
-        return nullptr;
+    template<typename Q> requires is_lookup_v<Q>
+    V* FindWithHash(const Q& key, u32 hash)
+    {
+        const LookupView view(key);
+        uint64_t slot;
+        return this->Locate(hash, view, slot) ? &this->_values[slot] : nullptr;
     }
 
-    const V* Find(const K& key) const
+    template<typename Q> requires is_lookup_v<Q>
+    const V* FindWithHash(const Q& key, u32 hash) const
     {
-        return const_cast<Map*>(this)->Find(key);
+        return const_cast<Map*>(this)->FindWithHash(key, hash);
     }
 
 
@@ -108,32 +112,20 @@ public:
         return Find(key) != nullptr;
     }
 
-    Boolean Remove(const K& key)
+    template<typename Q> requires is_lookup_v<Q>
+    Boolean Contains(const Q& key) const
     {
-        UInt32 hash = Hash(key);
-
-        for (uint64_t i = 0; i < _capacity; ++i)
-        {
-            uint64_t idx = Probe(hash, i);
-            Entry& e = _entries[idx];
-
-            if (!e.occupied)
-                return false;
-
-            if (!e.tombstone && e.hash == hash && e.key == key)
-            {
-                e.tombstone = true;
-                --_count;
-                return true;
-            }
-        }
-
-        return false;
+        return Find(key) != nullptr;
     }
 
-    u64 Count() const noexcept
+    Boolean Remove(const K& key)
     {
-        return _count;
+        uint64_t slot;
+        if (!this->Locate(Hash(key), key, slot))
+            return false;
+
+        this->RemoveAt(slot);
+        return true;
     }
 
     struct Pair
@@ -165,20 +157,14 @@ public:
 
         Pair operator*()
         {
-            Entry& e = _map->_entries[_index];
-            return { e.key, e.value };
+            return { _map->_keys[_index], _map->_values[_index] };
         }
 
     private:
         void SkipInvalid()
         {
-            while (_index < _map->_capacity)
-            {
-                Entry& e = _map->_entries[_index];
-                if (e.occupied && !e.tombstone)
-                    break;
+            while (_index < _map->_capacity && !_map->IsFull(_index))
                 ++_index;
-            }
         }
 
         Map* _map;
@@ -192,47 +178,6 @@ public:
 
     Iterator end()
     {
-        return Iterator(this, _capacity);
-    }
-
-private:
-
-    void Rehash(u64 newCapacity)
-    {
-        Entry* oldEntries = _entries;
-        u64 oldCap = _capacity;
-
-        _entries = static_cast<Entry*>(Memory::Alloc(sizeof(Entry) * newCapacity).Get());
-        _capacity = newCapacity;
-        _count = 0;
-
-        for (uint64_t i = 0; i < _capacity; ++i)
-            _entries[i].occupied = false;
-
-        for (uint64_t i = 0; i < oldCap; ++i)
-        {
-            if (oldEntries[i].occupied && !oldEntries[i].tombstone)
-                Insert(oldEntries[i].key, oldEntries[i].value);
-        }
-
-        Memory::Free(static_cast<Pointer>(oldEntries));
-    }
-
-    u64 Probe(u32 hash, u64 i) const
-    {
-        return (hash + i) % _capacity;
+        return Iterator(this, this->_capacity);
     }
-
-    struct Entry
-    {
-        K key;
-        V value;
-        u32 hash;
-        Boolean occupied;
-        Boolean tombstone;
-    };
-
-    Entry* _entries;
-    u64   _capacity;
-    u64   _count;
-};
\ No newline at end of file
+};
@@ -0,0 +1,9 @@
+#include "HashGroup.hpp"
+#include "System/CPUInfo.hpp"
+
+namespace HashGroup
+{
+	// Tables touched during static initialization run before this is set and
+	// read it as false; both paths read the same control bytes, so that is safe.
+	const bool UseSSE2 = CPUInfo().HaveSSE2();
+}
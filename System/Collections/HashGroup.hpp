@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PHOENIX_HASHGROUP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==============================================================
+//  HashGroup - control byte matching for the open addressing
+//  tables (Map, and the sets built on it).
+//  - One control byte per slot: Empty (0x80) or the 7 bit H2 tag
+//  - A group is 16 consecutive control bytes, matched in one step
+//  - Results are 16 bit masks, bit i = slot (group start + i)
+//  - SSE2 is used when the CPU reports it (HashGroup::UseSSE2),
+//    otherwise two 64 bit SWAR words per group
+// ==============================================================
+
+namespace HashGroup
+{
+	static constexpr uint32_t Width = 16;
+	static constexpr uint8_t Empty = 0x80;
+
+	// Resolved once at startup from CPUInfo::HaveSSE2.
+	extern const bool UseSSE2;
+
+	// The 7 bit tag stored in the control byte of a full slot.
+	inline constexpr uint8_t H2(uint64_t mixed) noexcept
+	{
+		return (uint8_t)(mixed & 0x7F);
+	}
+
+	inline uint32_t LowestBit(uint32_t mask) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return (uint32_t)index;
+#else
+		return (uint32_t)__builtin_ctz(mask);
+#endif
+	}
+
+	namespace Detail
+	{
+		static constexpr uint64_t Lsb = 0x0101010101010101ull;
+		static constexpr uint64_t Msb = 0x8080808080808080ull;
+
+		inline uint64_t Load64(const uint8_t* p) noexcept
+		{
+			uint64_t v;
+#if defined(_MSC_VER) && !defined(__clang__)
+			v = *(const uint64_t __unaligned*)p;
+#else
+			__builtin_memcpy(&v, p, sizeof(v));
+#endif
+			return v;
+		}
+
+		// Gathers the high bit of each byte into an 8 bit mask (byte i -> bit i).
+		inline uint32_t PackHighBits(uint64_t word) noexcept
+		{
+			return (uint32_t)((((word & Msb) >> 7) * 0x0102040810204080ull) >> 56);
+		}
+
+		// Bytes equal to h2 get their high bit set. A borrow can flag the byte
+		// after a true match as well; callers verify candidates, so that is harmless.
+		inline uint32_t MatchWord(uint64_t word, uint8_t h2) noexcept
+		{
+			uint64_t x = word ^ (Lsb * h2);
+			return PackHighBits((x - Lsb) & ~x & Msb);
+		}
+
+		inline uint32_t MatchScalar(const uint8_t* ctrl, uint8_t h2) noexcept
+		{
+			return MatchWord(Load64(ctrl), h2) | (MatchWord(Load64(ctrl + 8), h2) << 8);
+		}
+
+		inline uint32_t MatchEmptyScalar(const uint8_t* ctrl) noexcept
+		{
+			return PackHighBits(Load64(ctrl)) | (PackHighBits(Load64(ctrl + 8)) << 8);
+		}
+
+#if defined(PHOENIX_HASHGROUP_SSE2)
+		inline uint32_t MatchSSE2(const uint8_t* ctrl, uint8_t h2) noexcept
+		{
+			__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+		}
+
+		inline uint32_t MatchEmptySSE2(const uint8_t* ctrl) noexcept
+		{
+			// Empty is the only control value with the high bit set
+			return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+		}
+#endif
+	}
+
+	// Slots in the group whose tag equals h2 (may contain false positives on the scalar path).
+	inline uint32_t Match(const uint8_t* ctrl, uint8_t h2) noexcept
+	{
+#if defined(PHOENIX_HASHGROUP_SSE2)
+		if (UseSSE2)
+			return Detail::MatchSSE2(ctrl, h2);
+#endif
+		return Detail::MatchScalar(ctrl, h2);
+	}
+
+	// Slots in the group that are empty (exact).
+	inline uint32_t MatchEmpty(const uint8_t* ctrl) noexcept
+	{
+#if defined(PHOENIX_HASHGROUP_SSE2)
+		if (UseSSE2)
+			return Detail::MatchEmptySSE2(ctrl);
+#endif
+		return Detail::MatchEmptyScalar(ctrl);
+	}
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "System/Collections/HashTable.hpp"
+
+// ==============================================================
+//  HashSet<T> - set of unique values on the shared HashTable
+//  core (same hashing, probing and growth as Map, no value array)
+//  - Lookups accept hash_lookup_view<T> (StringView for String)
+// ==============================================================
+
+template<typename T>
+class HashSet : public HashTable<T, HashTableNoValue>
+{
+    using Base = HashTable<T, HashTableNoValue>;
+    using LookupView = typename Base::LookupView;
+
+    template<typename Q>
+    static constexpr bool is_lookup_v = Base::template is_lookup_v<Q>;
+
+public:
+
+    HashSet() noexcept = default;
+
+    // Returns false if the value was already present.
+    Boolean Add(const T& value)
+    {
+        return AddWithHash(value, Hash(value));
+    }
+
+    // `hash` must be Hash(value).
+    Boolean AddWithHash(const T& value, u32 hash)
+    {
+        uint64_t slot;
+        if (this->Locate(hash, value, slot))
+            return false;
+
+        if (this->GrowForInsert())
+            this->Locate(hash, value, slot);
+
+        this->Place(slot, hash, value);
+        return true;
+    }
+
+    Boolean Contains(const T& value) const
+    {
+        uint64_t slot;
+        return this->Locate(Hash(value), value, slot);
+    }
+
+    template<typename Q> requires is_lookup_v<Q>
+    Boolean Contains(const Q& value) const
+    {
+        const LookupView view(value);
+        uint64_t slot;
+        return this->Locate(Hash(view), view, slot);
+    }
+
+    // `hash` must be Hash(value) (for a view, the hash of the view).
+    template<typename Q>
+    Boolean ContainsWithHash(const Q& value, u32 hash) const
+    {
+        uint64_t slot;
+        if constexpr (is_lookup_v<Q>)
+            return this->Locate(hash, LookupView(value), slot);
+        else
+            return this->Locate(hash, static_cast<const T&>(value), slot);
+    }
+
+    // The stored element equal to `value` (canonicalising lookups), or nullptr.
+    // `hash` must be Hash(value) (for a view, the hash of the view).
+    template<typename Q>
+    const T* FindWithHash(const Q& value, u32 hash) const
+    {
+        uint64_t slot;
+        bool found;
+        if constexpr (is_lookup_v<Q>)
+            found = this->Locate(hash, LookupView(value), slot);
+        else
+            found = this->Locate(hash, static_cast<const T&>(value), slot);
+        return found ? &this->_keys[slot] : nullptr;
+    }
+
+    Boolean Remove(const T& value)
+    {
+        uint64_t slot;
+        if (!this->Locate(Hash(value), value, slot))
+            return false;
+
+        this->RemoveAt(slot);
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Set operations (in place)
+    // ------------------------------------------------------------
+
+    void UnionWith(const HashSet& other)
+    {
+        this->Reserve(this->_count + other._count);
+        for (uint64_t i = 0; i < other._capacity; ++i)
+            if (other.IsFull(i))
+                AddWithHash(other._keys[i], other._hashes[i]);
+    }
+
+    void IntersectWith(const HashSet& other)
+    {
+        uint64_t i = 0;
+        while (i < this->_capacity)
+        {
+            uint64_t slot;
+            if (this->IsFull(i) && !other.Locate(this->_hashes[i], this->_keys[i], slot))
+                this->RemoveAt(i); // an entry may shift into i: look at it again
+            else
+                ++i;
+        }
+    }
+
+    void ExceptWith(const HashSet& other)
+    {
+        // walking other while removing from it would skip shifted entries
+        if (&other == this)
+        {
+            this->Clear();
+            return;
+        }
+
+        for (uint64_t i = 0; i < other._capacity; ++i)
+        {
+            uint64_t slot;
+            if (other.IsFull(i) && this->Locate(other._hashes[i], other._keys[i], slot))
+                this->RemoveAt(slot);
+        }
+    }
+
+    Boolean IsSubsetOf(const HashSet& other) const
+    {
+        if (this->_count > other._count)
+            return false;
+
+        for (uint64_t i = 0; i < this->_capacity; ++i)
+        {
+            uint64_t slot;
+            if (this->IsFull(i) && !other.Locate(this->_hashes[i], this->_keys[i], slot))
+                return false;
+        }
+        return true;
+    }
+
+    Boolean Overlaps(const HashSet& other) const
+    {
+        const HashSet& small = this->_count <= other._count ? *this : other;
+        const HashSet& large = this->_count <= other._count ? other : *this;
+
+        for (uint64_t i = 0; i < small._capacity; ++i)
+        {
+            uint64_t slot;
+            if (small.IsFull(i) && large.Locate(small._hashes[i], small._keys[i], slot))
+                return true;
+        }
+        return false;
+    }
+
+    class Iterator
+    {
+    public:
+        Iterator(const HashSet* set, u64 index)
+            : _set(set), _index(index)
+        {
+            SkipInvalid();
+        }
+
+        Iterator& operator++()
+        {
+            ++_index;
+            SkipInvalid();
+            return *this;
+        }
+
+        Boolean operator!=(const Iterator& other) const
+        {
+            return _index != other._index;
+        }
+
+        const T& operator*() const
+        {
+            return _set->_keys[_index];
+        }
+
+    private:
+        void SkipInvalid()
+        {
+            while (_index < _set->_capacity && !_set->IsFull(_index))
+                ++_index;
+        }
+
+        const HashSet* _set;
+        u64 _index;
+    };
+
+    Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(this, this->_capacity);
+    }
+};
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Memory.hpp"
+#include "System/Types/Fundamentals/Hash.hpp"
+#include "System/Collections/HashGroup.hpp"
+
+// ==============================================================
+//  HashTable<K, V> - open addressing core shared by Map and
+//  HashSet (Swiss table layout)
+//  - Power of two capacity, slot = high bits of the mixed hash
+//  - One control byte per slot (Empty or a 7 bit tag), probed
+//    16 at a time through HashGroup
+//  - Control bytes, hashes, keys and values live in separate
+//    arrays of one allocation; lookups touch keys only on a tag hit.
+//    V = HashTableNoValue (sets) allocates no value array
+//  - Linear probing with backward shift deletion: no tombstones,
+//    so probe chains never degrade after many removals
+//  - Nothing is allocated until the first insert
+// ==============================================================
+
+static constexpr u64 MAP_INITIAL_CAPACITY = 16;
+static constexpr f32 MAP_MAX_LOAD = 0.75f;
+
+// Value type of a table that only stores keys.
+struct HashTableNoValue {};
+
+template<typename K, typename V>
+class HashTable
+{
+public:
+
+    u64 Count() const noexcept
+    {
+        return _count;
+    }
+
+    u64 Capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    // Grows once so that `count` entries fit without further rehashing.
+    void Reserve(u64 count)
+    {
+        if (count == 0)
+            return;
+
+        uint64_t capacity = _capacity != 0 ? _capacity : MAP_INITIAL_CAPACITY;
+        while (MaxLoad(capacity) < count)
+            capacity *= 2;
+        if (capacity != _capacity)
+            Rehash(capacity);
+    }
+
+    // True when the next insert of a new key would rehash (and move every entry).
+    Boolean IsAtLoadLimit() const noexcept
+    {
+        return (_count + 1) > MaxLoad(_capacity);
+    }
+
+    void Clear()
+    {
+        for (uint64_t i = 0; i < _capacity; ++i)
+        {
+            if (IsFull(i))
+            {
+                DestroySlot(i);
+                SetCtrl(i, HashGroup::Empty);
+            }
+        }
+        _count = 0;
+    }
+
+protected:
+
+    static constexpr bool k_has_values = !is_same_v<V, HashTableNoValue>;
+
+    using LookupView = typename hash_lookup_view<K>::type;
+
+    template<typename Q>
+    static constexpr bool is_lookup_v = !is_same_v<LookupView, K> && !is_same_v<Q, K>
+        && is_convertible<const Q&, LookupView>::value;
+
+    HashTable() noexcept = default;
+
+    HashTable(const HashTable& other)
+    {
+        if (other._count == 0)
+            return;
+
+        Allocate(other._capacity);
+        for (uint64_t i = 0; i < other._capacity; ++i)
+        {
+            if (!other.IsFull(i))
+                continue;
+
+            if constexpr (k_has_values)
+                PlaceNew(other._hashes[i], other._keys[i], other._values[i]);
+            else
+                PlaceNew(other._hashes[i], other._keys[i]);
+        }
+    }
+
+    HashTable(HashTable&& other) noexcept
+    {
+        Swap(other);
+    }
+
+    HashTable& operator=(const HashTable& other)
+    {
+        if (this != &other)
+        {
+            HashTable copy(other);
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    HashTable& operator=(HashTable&& other) noexcept
+    {
+        if (this != &other)
+            Swap(other);
+        return *this;
+    }
+
+    ~HashTable()
+    {
+        Clear();
+        Memory::Free(Pointer(_ctrl));
+    }
+
+    inline bool IsFull(uint64_t slot) const noexcept
+    {
+        return _ctrl[slot] != HashGroup::Empty;
+    }
+
+    // Returns true with the key's slot, or false with the slot where it would
+    // be inserted (unspecified while nothing is allocated). Q is K or its view.
+    template<typename Q>
+    bool Locate(uint32_t hash, const Q& key, uint64_t& slot) const
+    {
+        if (_capacity == 0)
+            return false;
+
+        const uint64_t mask = _capacity - 1;
+        const uint8_t h2 = HashGroup::H2(Mix(hash));
+        uint64_t pos = Home(hash);
+
+        for (;;)
+        {
+            const uint8_t* group = _ctrl + pos;
+
+            for (uint32_t m = HashGroup::Match(group, h2); m != 0; m &= m - 1)
+            {
+                uint64_t i = (pos + HashGroup::LowestBit(m)) & mask;
+                if (_ctrl[i] == h2 && _hashes[i] == hash && _keys[i] == key)
+                {
+                    slot = i;
+                    return true;
+                }
+            }
+
+            // Without tombstones the first empty slot ends the probe run
+            if (uint32_t empty = HashGroup::MatchEmpty(group); empty != 0)
+            {
+                slot = (pos + HashGroup::LowestBit(empty)) & mask;
+                return false;
+            }
+
+            pos = (pos + HashGroup::Width) & mask;
+        }
+    }
+
+    // Grows ahead of an insert. Returns true if the table was rebuilt, in which
+    // case a slot from an earlier Locate is stale.
+    bool GrowForInsert()
+    {
+        if (!IsAtLoadLimit())
+            return false;
+
+        Rehash(_capacity != 0 ? _capacity * 2 : MAP_INITIAL_CAPACITY);
+        return true;
+    }
+
+    template<typename KA, typename... VA>
+    void Place(uint64_t slot, uint32_t hash, KA&& key, VA&&... value)
+    {
+        Memory::Construct<K>(Pointer(&_keys[slot]), static_cast<KA&&>(key));
+        if constexpr (k_has_values)
+            Memory::Construct<V>(Pointer(&_values[slot]), static_cast<VA&&>(value)...);
+        _hashes[slot] = hash;
+        SetCtrl(slot, HashGroup::H2(Mix(hash)));
+        ++_count;
+    }
+
+    // Insert of a key known to be absent into a table with room (copy and rehash)
+    template<typename KA, typename... VA>
+    void PlaceNew(uint32_t hash, KA&& key, VA&&... value)
+    {
+        Place(FindEmpty(hash), hash, static_cast<KA&&>(key), static_cast<VA&&>(value)...);
+    }
+
+    void RemoveAt(uint64_t slot)
+    {
+        DestroySlot(slot);
+        --_count;
+
+        // Backward shift: pull every following entry of the run that may
+        // live at the hole (its home is not between the hole and itself).
+        const uint64_t mask = _capacity - 1;
+        uint64_t hole = slot;
+        uint64_t next = (hole + 1) & mask;
+
+        while (IsFull(next))
+        {
+            uint64_t home = Home(_hashes[next]);
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                Memory::Construct<K>(Pointer(&_keys[hole]), static_cast<K&&>(_keys[next]));
+                if constexpr (k_has_values)
+                    Memory::Construct<V>(Pointer(&_values[hole]), static_cast<V&&>(_values[next]));
+                DestroySlot(next);
+                _hashes[hole] = _hashes[next];
+                SetCtrl(hole, _ctrl[next]);
+                hole = next;
+            }
+            next = (next + 1) & mask;
+        }
+
+        SetCtrl(hole, HashGroup::Empty);
+    }
+
+    uint8_t*  _ctrl = nullptr;
+    uint32_t* _hashes = nullptr;
+    K*        _keys = nullptr;
+    V*        _values = nullptr;
+    uint64_t  _capacity = 0;
+    uint64_t  _count = 0;
+    uint32_t  _shift = 64;
+
+private:
+
+    static constexpr uint64_t MaxLoad(uint64_t capacity) noexcept
+    {
+        return (uint64_t)(capacity * MAP_MAX_LOAD);
+    }
+
+    // Fibonacci mix: spreads the 32 bit hash over 64 bits so the slot can come
+    // from the high bits and the tag from the low ones.
+    static inline uint64_t Mix(uint32_t hash) noexcept
+    {
+        return (uint64_t)hash * 0x9E3779B97F4A7C15ull;
+    }
+
+    inline uint64_t Home(uint32_t hash) const noexcept
+    {
+        return Mix(hash) >> _shift;
+    }
+
+    // The first Width - 1 control bytes are mirrored past the end so a group
+    // load at any slot reads contiguous memory.
+    inline void SetCtrl(uint64_t slot, uint8_t value) noexcept
+    {
+        _ctrl[slot] = value;
+        if (slot < HashGroup::Width - 1)
+            _ctrl[_capacity + slot] = value;
+    }
+
+    uint64_t FindEmpty(uint32_t hash) const noexcept
+    {
+        const uint64_t mask = _capacity - 1;
+        uint64_t pos = Home(hash);
+
+        for (;;)
+        {
+            if (uint32_t empty = HashGroup::MatchEmpty(_ctrl + pos); empty != 0)
+                return (pos + HashGroup::LowestBit(empty)) & mask;
+            pos = (pos + HashGroup::Width) & mask;
+        }
+    }
+
+    void DestroySlot(uint64_t slot) noexcept
+    {
+        Memory::Destroy(&_keys[slot]);
+        if constexpr (k_has_values)
+            Memory::Destroy(&_values[slot]);
+    }
+
+    // One block: [ctrl: capacity + Width][hashes][keys][values]
+    void Allocate(uint64_t capacity)
+    {
+        const uint64_t hashesAt = Memory::AlignForward(capacity + HashGroup::Width, alignof(uint32_t));
+        const uint64_t keysAt = Memory::AlignForward(hashesAt + capacity * sizeof(uint32_t), alignof(K));
+        const uint64_t valuesAt = Memory::AlignForward(keysAt + capacity * sizeof(K), alignof(V));
+        const uint64_t total = k_has_values ? valuesAt + capacity * sizeof(V) : keysAt + capacity * sizeof(K);
+
+        uint8_t* block = static_cast<uint8_t*>(Memory::Alloc(total).Get());
+        if (block == nullptr)
+            throw "out of memory";
+
+        Memory::Fill(Pointer(block), HashGroup::Empty, (uint32_t)(capacity + HashGroup::Width));
+
+        _ctrl = block;
+        _hashes = reinterpret_cast<uint32_t*>(block + hashesAt);
+        _keys = reinterpret_cast<K*>(block + keysAt);
+        _values = k_has_values ? reinterpret_cast<V*>(block + valuesAt) : nullptr;
+        _capacity = capacity;
+        _count = 0;
+
+        uint32_t bits = 0;
+        while ((1ull << bits) < capacity)
+            ++bits;
+        _shift = 64 - bits;
+    }
+
+    void Rehash(u64 newCapacity)
+    {
+        uint8_t* oldCtrl = _ctrl;
+        uint32_t* oldHashes = _hashes;
+        K* oldKeys = _keys;
+        V* oldValues = _values;
+        uint64_t oldCap = _capacity;
+
+        Allocate(newCapacity);
+
+        for (uint64_t i = 0; i < oldCap; ++i)
+        {
+            if (oldCtrl[i] == HashGroup::Empty)
+                continue;
+
+            if constexpr (k_has_values)
+            {
+                PlaceNew(oldHashes[i], static_cast<K&&>(oldKeys[i]), static_cast<V&&>(oldValues[i]));
+                Memory::Destroy(&oldValues[i]);
+            }
+            else
+            {
+                PlaceNew(oldHashes[i], static_cast<K&&>(oldKeys[i]));
+            }
+            Memory::Destroy(&oldKeys[i]);
+        }
+
+        Memory::Free(Pointer(oldCtrl));
+    }
+
+    void Swap(HashTable& other) noexcept
+    {
+        uint8_t* ctrl = _ctrl; _ctrl = other._ctrl; other._ctrl = ctrl;
+        uint32_t* hashes = _hashes; _hashes = other._hashes; other._hashes = hashes;
+        K* keys = _keys; _keys = other._keys; other._keys = keys;
+        V* values = _values; _values = other._values; other._values = values;
+        uint64_t capacity = _capacity; _capacity = other._capacity; other._capacity = capacity;
+        uint64_t count = _count; _count = other._count; other._count = count;
+        uint32_t shift = _shift; _shift = other._shift; other._shift = shift;
+    }
+};
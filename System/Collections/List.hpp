@@ -2,13 +2,17 @@
 
 #include "Array.hpp"
 #include "System/Types.hpp"
+#include "System/Allocator.hpp"
 
 // This List<T> is a dynamic-array (vector-like) container implemented without std::.
+// Storage is raw memory from Allocator; only [0, Count()) holds live objects,
+// so T does not need a default constructor and growth moves elements.
 
-template<typename T>
+template<typename T, typename Allocator = Memory::DefaultAllocator>
 class List {
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using size_type = u64;
     using pointer = value_type*;
     using const_pointer = const value_type*;
@@ -21,21 +25,54 @@ private:
     pointer m_data;
     size_type m_size;
     size_type m_capacity;
+    Allocator m_alloc;
 
     static constexpr size_type k_default_capacity = 4;
 
-    // allocate n objects, value-initialized
-    static pointer allocate(size_type n) {
+    // U derives from this List. A forwarded lvalue makes U a reference,
+    // which never matches, so copies from a derived list still compile
+    template<typename U>
+    struct is_derived_list
+    {
+        static constexpr bool value = !is_same<U, List>::value && is_convertible<U*, List*>::value;
+    };
+
+    // elements can be shifted/relocated with memmove (see is_trivially_relocatable)
+    static constexpr bool k_relocatable = is_trivially_relocatable_v<value_type>;
+
+    // raw storage for n objects (nothing constructed)
+    pointer allocate(size_type n) {
         if (n == 0) return nullptr;
-        // value-initialize so primitives become zero
-        return new value_type[n]();
+        pointer p = static_cast<pointer>(m_alloc.Allocate(n * sizeof(value_type), alignof(value_type)).Get());
+        if (!p) throw "out of memory";
+        return p;
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+        if (p) m_alloc.Deallocate(Pointer(p), n * sizeof(value_type));
     }
 
-    // allocate and copy existing elements via assignment
-    static pointer allocate_and_copy(const_pointer src, size_type n) {
+    void destroy_range(size_type from, size_type to) noexcept {
+        if constexpr (!is_trivially_destructible<value_type>::value) {
+            for (size_type i = from; i < to; ++i) Memory::Destroy(m_data + i);
+        }
+    }
+
+    // copy-construct n elements from src into raw slots at dst
+    static void copy_construct(pointer dst, const_pointer src, size_type n) {
+        if constexpr (is_trivially_copyable_v<value_type>) {
+            if (n) Memory::Copy(Pointer(dst), Pointer(src), n * sizeof(value_type));
+        }
+        else {
+            for (size_type i = 0; i < n; ++i) Memory::Construct<value_type>(Pointer(dst + i), src[i]);
+        }
+    }
+
+    // allocate and copy-construct n elements from src
+    pointer allocate_and_copy(const_pointer src, size_type n) {
         if (n == 0) return nullptr;
-        pointer p = new value_type[n]();
-        for (size_type i = 0; i < n; ++i) p[i] = src[i];
+        pointer p = allocate(n);
+        copy_construct(p, src, n);
         return p;
     }
 
@@ -51,78 +88,174 @@ private:
         reserve_internal(newCap);
     }
 
-    // internal reserve: allocate new buffer of newCap and copy existing elements
+    // internal reserve: move live elements into a buffer of newCap (newCap >= m_size)
     void reserve_internal(size_type newCap) {
         if (newCap == m_capacity) return;
 
-        pointer newBuf = nullptr;
-        if (newCap > 0) {
-            newBuf = new value_type[newCap](); // default-constructed (not value-initialized)
-            // copy existing elements
-            for (size_type i = 0; i < m_size; ++i) newBuf[i] = m_data[i];
-            // if new slots should be zeroed, user can call ClearRange or rely on default constructor
+        // grow in place when the allocator can (arena tail, heap size-class slack)
+        if (m_data && newCap > m_capacity &&
+            m_alloc.TryResize(Pointer(m_data), m_capacity * sizeof(value_type), newCap * sizeof(value_type))) {
+            m_capacity = newCap;
+            return;
+        }
+
+        pointer newBuf = allocate(newCap);
+        if constexpr (k_relocatable) {
+            if (m_size) Memory::Copy(Pointer(newBuf), Pointer(m_data), m_size * sizeof(value_type));
+        }
+        else {
+            for (size_type i = 0; i < m_size; ++i) {
+                Memory::Construct<value_type>(Pointer(newBuf + i), static_cast<value_type&&>(m_data[i]));
+            }
+            destroy_range(0, m_size);
         }
 
         // release old buffer
-        if (m_data) delete[] m_data;
+        deallocate(m_data, m_capacity);
         m_data = newBuf;
         m_capacity = newCap;
     }
 
+    // make room for count elements at index: tail is moved up, leaving the
+    // gap [index, index + count). Returns the bound below which gap slots
+    // still hold live (moved-from) objects; slots from there on are raw.
+    size_type open_gap(size_type index, size_type count) {
+        size_type needed = m_size + count;
+        if (needed > m_capacity) grow_to_at_least(needed);
+        if constexpr (k_relocatable) {
+            if (index < m_size)
+                Memory::Move(Pointer(m_data + index + count), Pointer(m_data + index), (m_size - index) * sizeof(value_type));
+            return index;
+        }
+        for (size_type i = m_size; i > index; --i) {
+            size_type dst = i - 1 + count;
+            if (dst >= m_size) Memory::Construct<value_type>(Pointer(m_data + dst), static_cast<value_type&&>(m_data[i - 1]));
+            else m_data[dst] = static_cast<value_type&&>(m_data[i - 1]);
+        }
+        return m_size;
+    }
+
+    // close [index, index + count) after those elements were destroyed or moved out
+    void close_gap(size_type index, size_type count) noexcept {
+        if constexpr (k_relocatable) {
+            destroy_range(index, index + count);
+            if (index + count < m_size)
+                Memory::Move(Pointer(m_data + index), Pointer(m_data + index + count), (m_size - index - count) * sizeof(value_type));
+        }
+        else {
+            for (size_type i = index + count; i < m_size; ++i) m_data[i - count] = static_cast<value_type&&>(m_data[i]);
+            destroy_range(m_size - count, m_size);
+        }
+        m_size -= count;
+    }
+
+    // move other's elements into this (empty) list's storage; other keeps
+    // its buffer, emptied
+    void move_elements_from(List& other) {
+        if (m_capacity < other.m_size) reserve_internal(other.m_size);
+        if constexpr (k_relocatable) {
+            if (other.m_size) Memory::Copy(Pointer(m_data), Pointer(other.m_data), other.m_size * sizeof(value_type));
+        }
+        else {
+            for (size_type i = 0; i < other.m_size; ++i) {
+                Memory::Construct<value_type>(Pointer(m_data + i), static_cast<value_type&&>(other.m_data[i]));
+            }
+            other.destroy_range(0, other.m_size);
+        }
+        m_size = other.m_size;
+        other.m_size = 0;
+    }
+
+    // store into a slot that may be live (below oldSize) or raw
+    template<typename U>
+    void put(size_type idx, size_type oldSize, U&& value) {
+        if (idx < oldSize) m_data[idx] = static_cast<U&&>(value);
+        else Memory::Construct<value_type>(Pointer(m_data + idx), static_cast<U&&>(value));
+    }
+
 public:
     // --- constructors / destructor ---
     List() noexcept
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc() {
+    }
+
+    explicit List(const Allocator& allocator) noexcept
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(allocator) {
     }
 
     explicit List(size_type capacity)
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc() {
+        if (capacity > 0) {
+            m_data = allocate(capacity);
+            m_capacity = capacity;
+        }
+    }
+
+    List(size_type capacity, const Allocator& allocator)
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(allocator) {
         if (capacity > 0) {
             m_data = allocate(capacity);
             m_capacity = capacity;
         }
     }
 
+    // arena-backed list for transient work (see Memory::ScratchScope);
+    // must not outlive the arena mark it was created under
+    explicit List(Memory::Arena& arena, size_type capacity = 0)
+        requires(is_constructible<Allocator, Memory::Arena&>::value)
+        : List(capacity, Allocator(arena)) {
+    }
+
     // construct with count copies of value
     List(size_type count, const_reference value)
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc() {
         if (count == 0) return;
         m_data = allocate(count);
         m_capacity = count;
-        for (size_type i = 0; i < count; ++i) m_data[i] = value;
+        for (size_type i = 0; i < count; ++i) Memory::Construct<value_type>(Pointer(m_data + i), value);
         m_size = count;
     }
 
     // construct from raw buffer (copy)
     List(const_pointer src, size_type length)
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc() {
         if (length == 0) return;
         m_data = allocate_and_copy(src, length);
         m_capacity = length;
         m_size = length;
     }
 
-    // copy constructor
+    // copy constructor (allocator chosen by Allocator::SelectOnCopy)
     List(const List& other)
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(other.m_alloc.SelectOnCopy()) {
         if (other.m_size == 0) return;
         m_data = allocate_and_copy(other.m_data, other.m_size);
         m_size = other.m_size;
         m_capacity = other.m_size;
     }
 
-    // move constructor
+    // move constructor: takes other's buffer and allocator (an arena binding
+    // comes along), unless the buffer is storage other owns (a SmallList
+    // reached through List&); then the elements move to the heap
     List(List&& other) noexcept
-        : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity) {
-        other.m_data = nullptr;
-        other.m_size = 0;
-        other.m_capacity = 0;
+        : m_data(nullptr), m_size(0), m_capacity(0),
+          m_alloc(other.m_alloc.IsMovable() ? other.m_alloc : other.m_alloc.SelectOnCopy()) {
+        if (other.m_alloc.IsMovable()) take_storage(other);
+        else move_elements_from(other);
     }
 
+    // A derived list (SmallList) may keep its elements in storage it owns;
+    // moving one into a plain List would leave the List pointing into it.
+    // Copies are fine: they go through SelectOnCopy
+    template<typename U>
+        requires(is_derived_list<U>::value)
+    List(U&& other) = delete;
+
     // destructor
     ~List() noexcept {
         if (m_data) {
-            delete[] m_data;
+            destroy_range(0, m_size);
+            deallocate(m_data, m_capacity);
             m_data = nullptr;
         }
         m_size = 0;
@@ -137,31 +270,52 @@ public:
         return *this;
     }
 
-    // move assignment
+    // move assignment: takes other's buffer and allocator, except that
+    // inline storage never leaves its owner and an arena binding never
+    // reaches a list that was not arena-bound (a member assigned from a
+    // scratch list would point into memory Arena::Reset reclaims). In
+    // those cases the elements move into this list's own storage.
     List& operator=(List&& other) noexcept {
         if (&other == this) return *this;
-        if (m_data) delete[] m_data;
-        m_data = other.m_data;
-        m_size = other.m_size;
-        m_capacity = other.m_capacity;
-        other.m_data = nullptr;
-        other.m_size = 0;
-        other.m_capacity = 0;
+        if (other.m_alloc.IsMovable() && (m_alloc.GetArena() != nullptr || other.m_alloc.GetArena() == nullptr)) {
+            take_storage(other);
+            m_alloc = other.m_alloc;
+        }
+        else {
+            destroy_range(0, m_size);
+            m_size = 0;
+            move_elements_from(other);
+        }
         return *this;
     }
 
+    template<typename U>
+        requires(is_derived_list<U>::value)
+    List& operator=(U&& other) = delete;
+
     // swap
     void Swap(List& other) noexcept {
         pointer td = m_data; m_data = other.m_data; other.m_data = td;
         size_type ts = m_size; m_size = other.m_size; other.m_size = ts;
         size_type tc = m_capacity; m_capacity = other.m_capacity; other.m_capacity = tc;
+        Allocator ta = m_alloc; m_alloc = other.m_alloc; other.m_alloc = ta;
     }
 
+    // swapping with a derived list would hand its owned storage over too
+    template<typename U>
+        requires(is_derived_list<U>::value)
+    void Swap(U& other) = delete;
+
     // --- capacity / size ---
     inline constexpr size_type Count() const noexcept { return m_size; }
     inline constexpr size_type Capacity() const noexcept { return m_capacity; }
     inline constexpr Boolean IsEmpty() const noexcept { return m_size == 0; }
 
+    inline const Allocator& GetAllocator() const noexcept { return m_alloc; }
+
+    // arena the storage comes from, or null for the heap
+    inline Memory::Arena* GetArena() const noexcept { return m_alloc.GetArena(); }
+
     // Ensure there is room for at least min_capacity elements
     void EnsureCapacity(size_type min_capacity) {
         if (min_capacity <= m_capacity) return;
@@ -181,7 +335,10 @@ public:
 
         // value-initialize novos elementos
         for (size_type i = m_size; i < newSize; ++i)
-            m_data[i] = value_type();
+            Memory::Construct<value_type>(Pointer(m_data + i));
+
+        if (newSize < m_size)
+            destroy_range(newSize, m_size);
 
         m_size = newSize;
     }
@@ -190,7 +347,7 @@ public:
     void ShrinkToFit() {
         if (m_capacity == m_size) return;
         if (m_size == 0) {
-            if (m_data) { delete[] m_data; m_data = nullptr; m_capacity = 0; }
+            if (m_data) { deallocate(m_data, m_capacity); m_data = nullptr; m_capacity = 0; }
             return;
         }
         reserve_internal(m_size);
@@ -234,22 +391,32 @@ public:
 
     // append
     void Add(const_reference value) {
-        if (m_size + 1 > m_capacity) grow_to_at_least(m_size + 1);
-        m_data[m_size++] = value;
+        if (m_size + 1 > m_capacity) {
+            // value may live in this list: copy it before the buffer moves
+            value_type tmp(value);
+            grow_to_at_least(m_size + 1);
+            Memory::Construct<value_type>(Pointer(m_data + m_size), static_cast<value_type&&>(tmp));
+        }
+        else {
+            Memory::Construct<value_type>(Pointer(m_data + m_size), value);
+        }
+        ++m_size;
     }
 
     // append (move)
     void Add(value_type&& value) {
         if (m_size + 1 > m_capacity) grow_to_at_least(m_size + 1);
-        m_data[m_size++] = static_cast<value_type&&>(value);
+        Memory::Construct<value_type>(Pointer(m_data + m_size), static_cast<value_type&&>(value));
+        ++m_size;
     }
 
     // append range from another List
     void AddRange(const List& other) {
         if (other.m_size == 0) return;
+        if (&other == this) { List tmp(other); AddRange(tmp); return; }
         size_type needed = m_size + other.m_size;
         if (needed > m_capacity) grow_to_at_least(needed);
-        for (size_type i = 0; i < other.m_size; ++i) m_data[m_size + i] = other.m_data[i];
+        copy_construct(m_data + m_size, other.m_data, other.m_size);
         m_size = needed;
     }
 
@@ -258,26 +425,25 @@ public:
         if (length == 0) return;
         size_type needed = m_size + length;
         if (needed > m_capacity) grow_to_at_least(needed);
-        for (size_type i = 0; i < length; ++i) m_data[m_size + i] = src[i];
+        copy_construct(m_data + m_size, src, length);
         m_size = needed;
     }
 
     template<typename... Args>
-    static List<T> Create(Args&&... args) {
+    static List Create(Args&&... args) {
         constexpr size_type N = sizeof...(Args);
-        List<T> r(N);
+        List<T, Allocator> r(N);
         T values[] = { T(static_cast<Args&&>(args))... };
-        for (size_type i = 0; i < N; ++i) r[i] = values[i];
+        for (size_type i = 0; i < N; ++i) r.Add(static_cast<T&&>(values[i]));
         return r;
     }
 
     // insert at index (0..m_size). Insert at m_size == push back
     void Insert(size_type index, const_reference value) {
         if (index > m_size) throw "index out of range";
-        if (m_size + 1 > m_capacity) grow_to_at_least(m_size + 1);
-        // shift right
-        for (size_type i = m_size; i > index; --i) m_data[i] = m_data[i - 1];
-        m_data[index] = value;
+        value_type tmp(value); // value may live in this list
+        size_type live = open_gap(index, 1);
+        put(index, live, static_cast<value_type&&>(tmp));
         ++m_size;
     }
 
@@ -285,13 +451,18 @@ public:
     void InsertRange(size_type index, const List& other) {
         if (index > m_size) throw "index out of range";
         if (other.m_size == 0) return;
-        size_type needed = m_size + other.m_size;
-        if (needed > m_capacity) grow_to_at_least(needed);
+        if (&other == this) { List tmp(other); InsertRange(index, tmp); return; }
+        size_type count = other.m_size;
         // move tail
-        for (size_type i = m_size; i > index; --i) m_data[i + other.m_size - 1] = m_data[i - 1];
+        size_type live = open_gap(index, count);
         // copy new
-        for (size_type j = 0; j < other.m_size; ++j) m_data[index + j] = other.m_data[j];
-        m_size = needed;
+        if constexpr (is_trivially_copyable_v<value_type>) {
+            Memory::Copy(Pointer(m_data + index), Pointer(other.m_data), count * sizeof(value_type));
+        }
+        else {
+            for (size_type j = 0; j < count; ++j) put(index + j, live, other.m_data[j]);
+        }
+        m_size += count;
     }
 
     // remove the first occurrence; returns true if removed
@@ -305,9 +476,8 @@ public:
     // remove at index and return removed value
     value_type RemoveAt(size_type index) {
         if (index >= m_size) throw "index out of range";
-        value_type removed = m_data[index];
-        for (size_type i = index + 1; i < m_size; ++i) m_data[i - 1] = m_data[i];
-        --m_size;
+        value_type removed(static_cast<value_type&&>(m_data[index]));
+        close_gap(index, 1);
         return removed;
     }
 
@@ -316,18 +486,19 @@ public:
         if (count == 0) return;
         if (index >= m_size) throw "index out of range";
         if (index + count > m_size) throw "range out of bounds";
-        for (size_type i = index + count; i < m_size; ++i) m_data[i - count] = m_data[i];
-        m_size -= count;
+        close_gap(index, count);
     }
 
     // clear (does not release capacity)
     void Clear() noexcept {
-        for (size_type i = 0; i < m_size; ++i) m_data[i] = value_type();
+        destroy_range(0, m_size);
         m_size = 0;
     }
 
-    // fast clear (does not initialize elements)
+    // fast clear: same as Clear, kept for callers that reuse a buffer in a loop
+    // (no per-element work at all for trivially destructible T)
     void FastClear() noexcept {
+        destroy_range(0, m_size);
         m_size = 0;
     }
 
@@ -360,9 +531,9 @@ public:
     // convert to an Array-like dynamic buffer
     // returns a new List-managed buffer copy
     List ToListCopy() const {
-        List r;
+        List r(m_alloc.SelectOnCopy());
         if (m_size == 0) return r;
-        r.m_data = allocate_and_copy(m_data, m_size);
+        r.m_data = r.allocate_and_copy(m_data, m_size);
         r.m_size = m_size;
         r.m_capacity = m_size;
         return r;
@@ -391,6 +562,20 @@ public:
     const_iterator cbegin() const noexcept { return m_data; }
     const_iterator cend() const noexcept { return m_data + m_size; }
 
+protected:
+    // releases this list's storage and takes other's buffer as is; each list
+    // keeps its allocator, so both must free to the heap (SmallList moves)
+    void take_storage(List& other) noexcept {
+        destroy_range(0, m_size);
+        deallocate(m_data, m_capacity);
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
 private:
     // helper: indexOf that returns max-size if not found
     size_type IndexOfNoThrow(const_reference v) const noexcept {
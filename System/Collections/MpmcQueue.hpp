@@ -0,0 +1,183 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Memory.hpp"
+#include "System/Threading/Interlocked.hpp"
+
+// ==============================================================
+//  MpmcQueue<T> - bounded multi-producer / multi-consumer queue
+//  (Vyukov's sequence-numbered ring)
+//  - Any number of threads push and pop; no locks. A thread claims
+//    a position with one CAS on the shared enqueue (dequeue) index,
+//    then works on that cell alone
+//  - Each cell carries a sequence number saying whose turn it is:
+//    == pos       free for the producer of position pos
+//    == pos + 1   filled, for the consumer of position pos
+//    the consumer then sets it to pos + capacity (next lap)
+//  - Capacity is fixed (rounded up to a power of two); a full
+//    queue refuses pushes
+//  - TryPushN / TryPopN claim a run of consecutive ready cells with
+//    a single CAS and return how many elements moved (possibly
+//    fewer than asked). FIFO holds per producer
+// ==============================================================
+
+template<typename T>
+class MpmcQueue
+{
+public:
+
+    explicit MpmcQueue(u32 capacity)
+        : _enqueuePos(0)
+        , _dequeuePos(0)
+    {
+        uint64_t count = 2;
+        while (count < (uint64_t)capacity)
+            count <<= 1;
+
+        _cells = static_cast<Cell*>(Memory::Alloc(sizeof(Cell) * count).Get());
+        if (_cells == nullptr)
+            throw "out of memory";
+
+        for (uint64_t i = 0; i < count; ++i)
+            _cells[i].sequence = i;
+        _mask = count - 1;
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    ~MpmcQueue()
+    {
+        for (uint64_t pos = _dequeuePos; pos != _enqueuePos; ++pos)
+            Memory::Destroy(_cells[pos & _mask].Item());
+        Memory::Free(Pointer(_cells));
+    }
+
+    Boolean TryPush(const T& value)
+    {
+        return TryPushN(&value, 1) == 1;
+    }
+
+    Boolean TryPush(T&& value)
+    {
+        uint64_t pos;
+        if (Claim(_enqueuePos, 0, 1, pos) == 0)
+            return false;
+
+        Cell& cell = _cells[pos & _mask];
+        Memory::Construct<T>(Pointer(cell.Item()), static_cast<T&&>(value));
+        Volatile::Write(&cell.sequence, pos + 1);
+        return true;
+    }
+
+    // Copies up to count elements; returns how many fit.
+    u32 TryPushN(const T* values, u32 count)
+    {
+        uint64_t pos;
+        const uint64_t n = Claim(_enqueuePos, 0, count, pos);
+
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            Cell& cell = _cells[(pos + i) & _mask];
+            Memory::Construct<T>(Pointer(cell.Item()), values[i]);
+            Volatile::Write(&cell.sequence, pos + i + 1);
+        }
+        return (uint32_t)n;
+    }
+
+    Boolean TryPop(T& value)
+    {
+        return TryPopN(&value, 1) == 1;
+    }
+
+    // Moves up to count elements into values; returns how many there were.
+    u32 TryPopN(T* values, u32 count)
+    {
+        uint64_t pos;
+        const uint64_t n = Claim(_dequeuePos, 1, count, pos);
+
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            Cell& cell = _cells[(pos + i) & _mask];
+            T* item = cell.Item();
+            values[i] = static_cast<T&&>(*item);
+            Memory::Destroy(item);
+            Volatile::Write(&cell.sequence, pos + i + _mask + 1);
+        }
+        return (uint32_t)n;
+    }
+
+    // Snapshot; only exact while no thread is pushing or popping.
+    u64 Count() const noexcept
+    {
+        const uint64_t dequeued = Volatile::Read(&_dequeuePos);
+        const uint64_t enqueued = Volatile::Read(&_enqueuePos);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    u64 Capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+private:
+
+    struct Cell
+    {
+        volatile uint64_t sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        inline T* Item() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    // Claims up to wanted consecutive positions of index whose cells read
+    // pos + lag (producers: lag 0, consumers: lag 1). Returns how many were
+    // claimed (0: full / empty) and the first one in pos.
+    uint64_t Claim(volatile uint64_t& index, uint64_t lag, uint64_t wanted, uint64_t& pos) noexcept
+    {
+        if (wanted == 0)
+            return 0;
+
+        uint64_t current = Volatile::ReadRelaxed(&index);
+        for (;;)
+        {
+            uint64_t ready = 0;
+            while (ready < wanted)
+            {
+                const uint64_t expected = current + ready;
+                const uint64_t sequence = Volatile::Read(&_cells[expected & _mask].sequence);
+                if (sequence != expected + lag)
+                    break;
+                ++ready;
+            }
+
+            if (ready != 0)
+            {
+                // a cell that read ready stays ready until its position is claimed
+                const uint64_t seen = Interlocked::CompareExchange(&index, current + ready, current);
+                if (seen == current)
+                {
+                    pos = current;
+                    return ready;
+                }
+                current = seen;
+                continue;
+            }
+
+            // the first cell is a lap behind: full (producers) or empty (consumers)
+            const uint64_t sequence = Volatile::Read(&_cells[current & _mask].sequence);
+            if ((int64_t)(sequence - (current + lag)) < 0)
+                return 0;
+
+            // another thread claimed it meanwhile
+            current = Volatile::ReadRelaxed(&index);
+        }
+    }
+
+    // read-only after construction
+    Cell*    _cells;
+    uint64_t _mask;
+
+    alignas(64) volatile uint64_t _enqueuePos;
+    alignas(64) volatile uint64_t _dequeuePos;
+};
@@ -2,11 +2,16 @@
 
 #include "Array.hpp"
 #include "System/Types.hpp"
+#include "System/Allocator.hpp"
 
-template<typename T>
+// Circular-buffer queue. Storage comes from Allocator; only the Size slots
+// starting at Head hold live objects.
+
+template<typename T, typename Allocator = Memory::DefaultAllocator>
 class Queue {
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using reference = T&;
     using const_reference = const T&;
     using size_type = u64;
@@ -19,13 +24,26 @@ private:
     size_type Capacity;
     size_type Head;
     size_type Tail;
+    Allocator Alloc;
 
     static constexpr size_type k_default_capacity = 4;
 
-    // Value-initializing allocator
-    static pointer allocate(size_type cap) {
+    // Raw storage (nothing constructed)
+    pointer allocate(size_type cap) {
         if (cap == 0) return nullptr;
-        return new value_type[cap](); // value-init = zero for primitives
+        pointer p = static_cast<pointer>(Alloc.Allocate(cap * sizeof(value_type), alignof(value_type)).Get());
+        if (!p) throw "out of memory";
+        return p;
+    }
+
+    // Destroys the live elements and returns the buffer
+    void release() noexcept {
+        if (!Data) return;
+        if constexpr (!is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < Size; ++i)
+                Memory::Destroy(Data + (Head + i) % Capacity);
+        }
+        Alloc.Deallocate(Pointer(Data), Capacity * sizeof(value_type));
     }
 
     // Expande a capacidade usando regra de crescimento tipo List<T> / .NET Queue
@@ -33,11 +51,22 @@ private:
         size_type newCap = (Capacity == 0) ? k_default_capacity : Capacity * 2;
         pointer newBuf = allocate(newCap);
 
-        // copiar dados na ordem lógica atual
-        for (size_type i = 0; i < Size; ++i)
-            newBuf[i] = Data[(Head + i) % Capacity];
+        // mover dados na ordem lógica atual
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            // no máximo dois trechos contíguos: [Head, Capacity) e [0, Tail)
+            size_type first = (Capacity - Head < Size) ? Capacity - Head : Size;
+            if (first) Memory::Copy(Pointer(newBuf), Pointer(Data + Head), first * sizeof(value_type));
+            if (Size > first) Memory::Copy(Pointer(newBuf + first), Pointer(Data), (Size - first) * sizeof(value_type));
+        }
+        else {
+            for (size_type i = 0; i < Size; ++i) {
+                pointer src = Data + (Head + i) % Capacity;
+                Memory::Construct<value_type>(Pointer(newBuf + i), static_cast<value_type&&>(*src));
+                Memory::Destroy(src);
+            }
+        }
 
-        delete[] Data;
+        if (Data) Alloc.Deallocate(Pointer(Data), Capacity * sizeof(value_type));
 
         Data = newBuf;
         Capacity = newCap;
@@ -55,15 +84,26 @@ public:
         Size(0),
         Capacity(0),
         Head(0),
-        Tail(0) {
+        Tail(0),
+        Alloc() {
+    }
+
+    explicit Queue(const Allocator& allocator) noexcept :
+        Data(nullptr),
+        Size(0),
+        Capacity(0),
+        Head(0),
+        Tail(0),
+        Alloc(allocator) {
     }
 
-    explicit Queue(size_type initialCapacity) :
+    explicit Queue(size_type initialCapacity, const Allocator& allocator = Allocator()) :
         Data(nullptr),
         Size(0),
         Capacity(initialCapacity),
         Head(0),
-        Tail(0)
+        Tail(0),
+        Alloc(allocator)
     {
         if (initialCapacity > 0)
             Data = allocate(initialCapacity);
@@ -74,12 +114,13 @@ public:
         Size(other.Size),
         Capacity(other.Capacity),
         Head(0),
-        Tail(other.Size)
+        Tail(other.Capacity == 0 ? 0 : other.Size % other.Capacity),
+        Alloc(other.Alloc.SelectOnCopy())
     {
         if (Capacity > 0) {
             Data = allocate(Capacity);
             for (size_type i = 0; i < Size; ++i)
-                Data[i] = other.Data[(other.Head + i) % other.Capacity];
+                Memory::Construct<value_type>(Pointer(Data + i), other.Data[(other.Head + i) % other.Capacity]);
         }
     }
 
@@ -88,7 +129,8 @@ public:
         Size(other.Size),
         Capacity(other.Capacity),
         Head(other.Head),
-        Tail(other.Tail)
+        Tail(other.Tail),
+        Alloc(other.Alloc)
     {
         other.Data = nullptr;
         other.Size = 0;
@@ -98,7 +140,7 @@ public:
     }
 
     ~Queue() {
-        if (Data) delete[] Data;
+        release();
     }
 
     Queue& operator=(const Queue& other) {
@@ -111,13 +153,14 @@ public:
     Queue& operator=(Queue&& other) noexcept {
         if (&other == this) return *this;
 
-        if (Data) delete[] Data;
+        release();
 
         Data = other.Data;
         Size = other.Size;
         Capacity = other.Capacity;
         Head = other.Head;
         Tail = other.Tail;
+        Alloc = other.Alloc;
 
         other.Data = nullptr;
         other.Size = 0;
@@ -143,7 +186,16 @@ public:
         if (Size == Capacity) grow();
         if (Capacity == 0) grow();
 
-        Data[Tail] = value;
+        Memory::Construct<value_type>(Pointer(Data + Tail), value);
+        Tail = (Tail + 1) % Capacity;
+        ++Size;
+    }
+
+    void Enqueue(value_type&& value) {
+        if (Size == Capacity) grow();
+        if (Capacity == 0) grow();
+
+        Memory::Construct<value_type>(Pointer(Data + Tail), static_cast<value_type&&>(value));
         Tail = (Tail + 1) % Capacity;
         ++Size;
     }
@@ -151,7 +203,8 @@ public:
     value_type Dequeue() {
         if (IsEmpty()) throw "Queue is empty";
 
-        value_type out = Data[Head];
+        value_type out(static_cast<value_type&&>(Data[Head]));
+        Memory::Destroy(Data + Head);
         Head = (Head + 1) % Capacity;
         --Size;
         return out;
@@ -170,6 +223,10 @@ public:
     }
 
     void Clear() noexcept {
+        if constexpr (!is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < Size; ++i)
+                Memory::Destroy(Data + (Head + i) % Capacity);
+        }
         Size = 0;
         Head = 0;
         Tail = 0;
@@ -189,13 +246,12 @@ public:
     // Swapping
     // ------------------------------------------------------------
     void Swap(Queue& other) noexcept {
-        using std::swap;
-
-        swap(Data, other.Data);
-        swap(Size, other.Size);
-        swap(Capacity, other.Capacity);
-        swap(Head, other.Head);
-        swap(Tail, other.Tail);
+        pointer td = Data; Data = other.Data; other.Data = td;
+        size_type ts = Size; Size = other.Size; other.Size = ts;
+        size_type tc = Capacity; Capacity = other.Capacity; other.Capacity = tc;
+        size_type th = Head; Head = other.Head; other.Head = th;
+        size_type tt = Tail; Tail = other.Tail; other.Tail = tt;
+        Allocator ta = Alloc; Alloc = other.Alloc; other.Alloc = ta;
     }
 
     // ------------------------------------------------------------
@@ -215,9 +271,9 @@ public:
     }
 
     template<typename... Args>
-    static Queue<T> Create(Args&&... args) {
+    static Queue<T, Allocator> Create(Args&&... args) {
         constexpr size_type N = sizeof...(Args);
-        Queue<T> r(N);
+        Queue<T, Allocator> r(N);
         T values[] = { T(static_cast<Args&&>(args))... };
         for (size_type i = 0; i < N; ++i) r.Enqueue(values[i])
             ;
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "System/Collections/List.hpp"
+
+// ==============================================================
+//  SmallList<T, N> - List<T> with room for N elements inline
+//  - The first N elements live inside the object; only growing
+//    past N allocates (everything then moves to the heap and grows
+//    like any List). Shrinking back to N or less returns inline
+//  - It IS a List<T>: every member, and every function taking a
+//    List<T>&, works unchanged (case mapping outputs, char sets)
+//  - Copies made through List<T> go to the heap. Moving a SmallList
+//    into a List, or swapping it with any list, does not compile:
+//    the inline storage stays with this object. Moved from through a
+//    List<T>&, its elements go to the heap and the buffer stays here
+//  - Moving a spilled SmallList steals its heap buffer; an inline
+//    one moves its elements
+// ==============================================================
+
+// Inline storage; a base class so it is built before, and destroyed after, the List
+template<typename T, uint32_t N>
+struct SmallListStorage
+{
+    alignas(T) unsigned char inlineElements[sizeof(T) * N];
+    Memory::InlineBuffer inlineBuffer{ Pointer(inlineElements), sizeof(T) * N };
+};
+
+template<typename T, uint32_t N = 8>
+class SmallList : private SmallListStorage<T, N>, public List<T>
+{
+    static_assert(N > 0, "SmallList needs at least one inline element");
+
+    using Storage = SmallListStorage<T, N>;
+    using Base = List<T>;
+
+public:
+
+    using size_type = typename Base::size_type;
+
+    static constexpr size_type InlineCapacity = N;
+
+    SmallList() noexcept
+        : Base(Memory::DefaultAllocator(Storage::inlineBuffer))
+    {
+        Base::Reserve(N);
+    }
+
+    explicit SmallList(size_type capacity)
+        : SmallList()
+    {
+        Base::Reserve(capacity);
+    }
+
+    SmallList(size_type count, const T& value)
+        : SmallList()
+    {
+        Base::Reserve(count);
+        for (size_type i = 0; i < count; ++i)
+            Base::Add(value);
+    }
+
+    SmallList(const T* src, size_type length)
+        : SmallList()
+    {
+        Base::AddRange(src, length);
+    }
+
+    explicit SmallList(const Base& other)
+        : SmallList()
+    {
+        Base::AddRange(other);
+    }
+
+    SmallList(const SmallList& other)
+        : SmallList()
+    {
+        Base::AddRange(other);
+    }
+
+    SmallList(SmallList&& other) noexcept
+        : SmallList()
+    {
+        MoveFrom(other);
+    }
+
+    // Assignments keep this list's storage (and its inline buffer).
+    SmallList& operator=(const Base& other)
+    {
+        if (&other != static_cast<const Base*>(this))
+        {
+            Base::Clear();
+            Base::AddRange(other);
+        }
+        return *this;
+    }
+
+    SmallList& operator=(const SmallList& other)
+    {
+        return *this = static_cast<const Base&>(other);
+    }
+
+    SmallList& operator=(SmallList&& other) noexcept
+    {
+        if (&other != this)
+        {
+            Base::Clear();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    // Would exchange the inline buffers' pointers along with the elements
+    void Swap(Base& other) = delete;
+
+    // True while no heap storage is held
+    inline Boolean IsInline() const noexcept
+    {
+        return Base::Data() == nullptr || Storage::inlineBuffer.Owns(Pointer(Base::Data()));
+    }
+
+private:
+
+    // this list is empty on entry
+    void MoveFrom(SmallList& other) noexcept
+    {
+        if (other.IsInline())
+        {
+            for (size_type i = 0; i < other.Count(); ++i)
+                Base::Add(static_cast<T&&>(other.Data()[i]));
+            other.Clear();
+            return;
+        }
+
+        // a spilled list's inline buffer is free, so other can start over in it
+        Base::take_storage(other);
+        other.Reserve(N);
+    }
+};
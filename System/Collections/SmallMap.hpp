@@ -0,0 +1,316 @@
+#pragma once
+
+#include "System/Collections/Dictionary.hpp"
+
+// ==============================================================
+//  SmallMap<K, V, N> - map that keeps up to N entries inline
+//  - Inline entries carry a 7 bit hash tag; the 16 tag bytes are
+//    matched in one HashGroup step (SSE2 / SWAR), then keys compared
+//  - No allocation until entry N + 1, which moves everything into
+//    a Map (and stays there until Clear)
+//  - Removal swaps the last inline entry into the hole: iteration
+//    order is not insertion order
+// ==============================================================
+
+template<typename K, typename V, uint32_t N = 8>
+class SmallMap
+{
+    static_assert(N >= 1 && N <= HashGroup::Width, "SmallMap keeps between 1 and 16 entries inline");
+
+    using LookupView = typename hash_lookup_view<K>::type;
+
+    template<typename Q>
+    static constexpr bool is_lookup_v = !is_same_v<LookupView, K> && !is_same_v<Q, K>
+        && is_convertible<const Q&, LookupView>::value;
+
+public:
+
+    using Pair = typename Map<K, V>::Pair;
+
+    SmallMap() noexcept
+        : _count(0)
+        , _spilled(false)
+    {
+        Memory::Fill(Pointer(_tags), HashGroup::Empty, HashGroup::Width);
+    }
+
+    SmallMap(const SmallMap& other)
+        : SmallMap()
+    {
+        CopyFrom(other);
+    }
+
+    SmallMap(SmallMap&& other) noexcept
+        : SmallMap()
+    {
+        MoveFrom(other);
+    }
+
+    SmallMap& operator=(const SmallMap& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    SmallMap& operator=(SmallMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallMap()
+    {
+        ClearInline();
+    }
+
+    Boolean Insert(const K& key, const V& value)
+    {
+        const u32 hash = Hash(key);
+        if (_spilled)
+            return _spill.InsertWithHash(key, value, hash);
+
+        const uint8_t tag = HashGroup::H2(hash);
+        int32_t index = FindInline(tag, key);
+        if (index >= 0)
+        {
+            ValueAt(index) = value; // overwrite
+            return true;
+        }
+
+        if (_count == N)
+        {
+            Spill();
+            return _spill.InsertWithHash(key, value, hash);
+        }
+
+        Memory::Construct<K>(Pointer(&KeyAt(_count)), key);
+        Memory::Construct<V>(Pointer(&ValueAt(_count)), value);
+        _tags[_count++] = tag;
+        return true;
+    }
+
+    V* Find(const K& key)
+    {
+        if (_spilled)
+            return _spill.Find(key);
+
+        int32_t index = FindInline(HashGroup::H2(Hash(key)), key);
+        return index >= 0 ? &ValueAt(index) : nullptr;
+    }
+
+    const V* Find(const K& key) const
+    {
+        return const_cast<SmallMap*>(this)->Find(key);
+    }
+
+    template<typename Q> requires is_lookup_v<Q>
+    V* Find(const Q& key)
+    {
+        const LookupView view(key);
+        if (_spilled)
+            return _spill.Find(view);
+
+        int32_t index = FindInline(HashGroup::H2(Hash(view)), view);
+        return index >= 0 ? &ValueAt(index) : nullptr;
+    }
+
+    template<typename Q> requires is_lookup_v<Q>
+    const V* Find(const Q& key) const
+    {
+        return const_cast<SmallMap*>(this)->Find(key);
+    }
+
+    Boolean Contains(const K& key) const
+    {
+        return Find(key) != nullptr;
+    }
+
+    template<typename Q> requires is_lookup_v<Q>
+    Boolean Contains(const Q& key) const
+    {
+        return Find(key) != nullptr;
+    }
+
+    Boolean Remove(const K& key)
+    {
+        if (_spilled)
+            return _spill.Remove(key);
+
+        int32_t index = FindInline(HashGroup::H2(Hash(key)), key);
+        if (index < 0)
+            return false;
+
+        const uint32_t last = _count - 1;
+        Memory::Destroy(&KeyAt(index));
+        Memory::Destroy(&ValueAt(index));
+
+        if ((uint32_t)index != last)
+        {
+            Memory::Construct<K>(Pointer(&KeyAt(index)), static_cast<K&&>(KeyAt(last)));
+            Memory::Construct<V>(Pointer(&ValueAt(index)), static_cast<V&&>(ValueAt(last)));
+            Memory::Destroy(&KeyAt(last));
+            Memory::Destroy(&ValueAt(last));
+            _tags[index] = _tags[last];
+        }
+
+        _tags[last] = HashGroup::Empty;
+        --_count;
+        return true;
+    }
+
+    u64 Count() const noexcept
+    {
+        return _spilled ? (uint64_t)_spill.Count() : _count;
+    }
+
+    // True while the entries live inside the object (no heap allocation).
+    Boolean IsInline() const noexcept
+    {
+        return !_spilled;
+    }
+
+    void Clear()
+    {
+        ClearInline();
+        if (_spilled)
+        {
+            _spill = Map<K, V>();
+            _spilled = false;
+        }
+    }
+
+    class Iterator
+    {
+    public:
+        Iterator(SmallMap* map, u64 index, typename Map<K, V>::Iterator spill)
+            : _map(map), _index(index), _spill(spill)
+        {
+        }
+
+        Iterator& operator++()
+        {
+            if (_map->_spilled) ++_spill;
+            else ++_index;
+            return *this;
+        }
+
+        Boolean operator!=(const Iterator& other) const
+        {
+            return _map->_spilled ? (_spill != other._spill) : Boolean(_index != other._index);
+        }
+
+        Pair operator*()
+        {
+            if (_map->_spilled)
+                return *_spill;
+            return { _map->KeyAt((uint32_t)_index), _map->ValueAt((uint32_t)_index) };
+        }
+
+    private:
+        SmallMap* _map;
+        u64 _index;
+        typename Map<K, V>::Iterator _spill;
+    };
+
+    Iterator begin()
+    {
+        return Iterator(this, 0, _spill.begin());
+    }
+
+    Iterator end()
+    {
+        return Iterator(this, _count, _spill.end());
+    }
+
+private:
+
+    inline K& KeyAt(uint32_t i) noexcept { return reinterpret_cast<K*>(_keys)[i]; }
+    inline const K& KeyAt(uint32_t i) const noexcept { return reinterpret_cast<const K*>(_keys)[i]; }
+    inline V& ValueAt(uint32_t i) noexcept { return reinterpret_cast<V*>(_values)[i]; }
+
+    template<typename Q>
+    int32_t FindInline(uint8_t tag, const Q& key) const
+    {
+        for (uint32_t m = HashGroup::Match(_tags, tag); m != 0; m &= m - 1)
+        {
+            uint32_t i = HashGroup::LowestBit(m);
+            if (_tags[i] == tag && KeyAt(i) == key)
+                return (int32_t)i;
+        }
+        return -1;
+    }
+
+    void Spill()
+    {
+        _spill.Reserve(N + 1);
+        for (uint32_t i = 0; i < _count; ++i)
+            _spill.Insert(KeyAt(i), ValueAt(i));
+
+        ClearInline();
+        _spilled = true;
+    }
+
+    void ClearInline() noexcept
+    {
+        for (uint32_t i = 0; i < _count; ++i)
+        {
+            Memory::Destroy(&KeyAt(i));
+            Memory::Destroy(&ValueAt(i));
+            _tags[i] = HashGroup::Empty;
+        }
+        _count = 0;
+    }
+
+    void CopyFrom(const SmallMap& other)
+    {
+        if (other._spilled)
+        {
+            _spill = other._spill;
+            _spilled = true;
+            return;
+        }
+
+        for (uint32_t i = 0; i < other._count; ++i)
+        {
+            Memory::Construct<K>(Pointer(&KeyAt(i)), other.KeyAt(i));
+            Memory::Construct<V>(Pointer(&ValueAt(i)), const_cast<SmallMap&>(other).ValueAt(i));
+            _tags[i] = other._tags[i];
+        }
+        _count = other._count;
+    }
+
+    void MoveFrom(SmallMap& other) noexcept
+    {
+        if (other._spilled)
+        {
+            _spill = static_cast<Map<K, V>&&>(other._spill);
+            _spilled = true;
+            other._spilled = false;
+            return;
+        }
+
+        for (uint32_t i = 0; i < other._count; ++i)
+        {
+            Memory::Construct<K>(Pointer(&KeyAt(i)), static_cast<K&&>(other.KeyAt(i)));
+            Memory::Construct<V>(Pointer(&ValueAt(i)), static_cast<V&&>(other.ValueAt(i)));
+            _tags[i] = other._tags[i];
+        }
+        _count = other._count;
+        other.ClearInline();
+    }
+
+    uint8_t _tags[HashGroup::Width];
+    alignas(K) unsigned char _keys[sizeof(K) * N];
+    alignas(V) unsigned char _values[sizeof(V) * N];
+    uint32_t _count;          // inline entries (0 once spilled)
+    bool _spilled;
+    Map<K, V> _spill;
+};
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "System/Collections/HashSet.hpp"
+
+// ==============================================================
+//  SmallSet<T, N> - set that keeps up to N values inline
+//  - Inline values carry a 7 bit hash tag; the 16 tag bytes are
+//    matched in one HashGroup step (SSE2 / SWAR), then values compared
+//  - No allocation until value N + 1, which moves everything into
+//    a HashSet (and stays there until Clear)
+//  - Removal swaps the last inline value into the hole
+// ==============================================================
+
+template<typename T, uint32_t N = 8>
+class SmallSet
+{
+    static_assert(N >= 1 && N <= HashGroup::Width, "SmallSet keeps between 1 and 16 values inline");
+
+    using LookupView = typename hash_lookup_view<T>::type;
+
+    template<typename Q>
+    static constexpr bool is_lookup_v = !is_same_v<LookupView, T> && !is_same_v<Q, T>
+        && is_convertible<const Q&, LookupView>::value;
+
+public:
+
+    SmallSet() noexcept
+        : _count(0)
+        , _spilled(false)
+    {
+        Memory::Fill(Pointer(_tags), HashGroup::Empty, HashGroup::Width);
+    }
+
+    SmallSet(const SmallSet& other)
+        : SmallSet()
+    {
+        CopyFrom(other);
+    }
+
+    SmallSet(SmallSet&& other) noexcept
+        : SmallSet()
+    {
+        MoveFrom(other);
+    }
+
+    SmallSet& operator=(const SmallSet& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    SmallSet& operator=(SmallSet&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallSet()
+    {
+        ClearInline();
+    }
+
+    // Returns false if the value was already present.
+    Boolean Add(const T& value)
+    {
+        const u32 hash = Hash(value);
+        if (_spilled)
+            return _spill.AddWithHash(value, hash);
+
+        const uint8_t tag = HashGroup::H2(hash);
+        if (FindInline(tag, value) >= 0)
+            return false;
+
+        if (_count == N)
+        {
+            Spill();
+            return _spill.AddWithHash(value, hash);
+        }
+
+        Memory::Construct<T>(Pointer(&At(_count)), value);
+        _tags[_count++] = tag;
+        return true;
+    }
+
+    Boolean Contains(const T& value) const
+    {
+        if (_spilled)
+            return _spill.Contains(value);
+        return FindInline(HashGroup::H2(Hash(value)), value) >= 0;
+    }
+
+    template<typename Q> requires is_lookup_v<Q>
+    Boolean Contains(const Q& value) const
+    {
+        const LookupView view(value);
+        if (_spilled)
+            return _spill.Contains(view);
+        return FindInline(HashGroup::H2(Hash(view)), view) >= 0;
+    }
+
+    Boolean Remove(const T& value)
+    {
+        if (_spilled)
+            return _spill.Remove(value);
+
+        int32_t index = FindInline(HashGroup::H2(Hash(value)), value);
+        if (index < 0)
+            return false;
+
+        const uint32_t last = _count - 1;
+        Memory::Destroy(&At(index));
+
+        if ((uint32_t)index != last)
+        {
+            Memory::Construct<T>(Pointer(&At(index)), static_cast<T&&>(At(last)));
+            Memory::Destroy(&At(last));
+            _tags[index] = _tags[last];
+        }
+
+        _tags[last] = HashGroup::Empty;
+        --_count;
+        return true;
+    }
+
+    u64 Count() const noexcept
+    {
+        return _spilled ? (uint64_t)_spill.Count() : _count;
+    }
+
+    // True while the values live inside the object (no heap allocation).
+    Boolean IsInline() const noexcept
+    {
+        return !_spilled;
+    }
+
+    void Clear()
+    {
+        ClearInline();
+        if (_spilled)
+        {
+            _spill = HashSet<T>();
+            _spilled = false;
+        }
+    }
+
+    class Iterator
+    {
+    public:
+        Iterator(const SmallSet* set, u64 index, typename HashSet<T>::Iterator spill)
+            : _set(set), _index(index), _spill(spill)
+        {
+        }
+
+        Iterator& operator++()
+        {
+            if (_set->_spilled) ++_spill;
+            else ++_index;
+            return *this;
+        }
+
+        Boolean operator!=(const Iterator& other) const
+        {
+            return _set->_spilled ? (_spill != other._spill) : Boolean(_index != other._index);
+        }
+
+        const T& operator*() const
+        {
+            return _set->_spilled ? *_spill : _set->At((uint32_t)_index);
+        }
+
+    private:
+        const SmallSet* _set;
+        u64 _index;
+        typename HashSet<T>::Iterator _spill;
+    };
+
+    Iterator begin() const
+    {
+        return Iterator(this, 0, _spill.begin());
+    }
+
+    Iterator end() const
+    {
+        return Iterator(this, _count, _spill.end());
+    }
+
+private:
+
+    inline T& At(uint32_t i) noexcept { return reinterpret_cast<T*>(_values)[i]; }
+    inline const T& At(uint32_t i) const noexcept { return reinterpret_cast<const T*>(_values)[i]; }
+
+    template<typename Q>
+    int32_t FindInline(uint8_t tag, const Q& value) const
+    {
+        for (uint32_t m = HashGroup::Match(_tags, tag); m != 0; m &= m - 1)
+        {
+            uint32_t i = HashGroup::LowestBit(m);
+            if (_tags[i] == tag && At(i) == value)
+                return (int32_t)i;
+        }
+        return -1;
+    }
+
+    void Spill()
+    {
+        _spill.Reserve(N + 1);
+        for (uint32_t i = 0; i < _count; ++i)
+            _spill.Add(At(i));
+
+        ClearInline();
+        _spilled = true;
+    }
+
+    void ClearInline() noexcept
+    {
+        for (uint32_t i = 0; i < _count; ++i)
+        {
+            Memory::Destroy(&At(i));
+            _tags[i] = HashGroup::Empty;
+        }
+        _count = 0;
+    }
+
+    void CopyFrom(const SmallSet& other)
+    {
+        if (other._spilled)
+        {
+            _spill = other._spill;
+            _spilled = true;
+            return;
+        }
+
+        for (uint32_t i = 0; i < other._count; ++i)
+        {
+            Memory::Construct<T>(Pointer(&At(i)), other.At(i));
+            _tags[i] = other._tags[i];
+        }
+        _count = other._count;
+    }
+
+    void MoveFrom(SmallSet& other) noexcept
+    {
+        if (other._spilled)
+        {
+            _spill = static_cast<HashSet<T>&&>(other._spill);
+            _spilled = true;
+            other._spilled = false;
+            return;
+        }
+
+        for (uint32_t i = 0; i < other._count; ++i)
+        {
+            Memory::Construct<T>(Pointer(&At(i)), static_cast<T&&>(other.At(i)));
+            _tags[i] = other._tags[i];
+        }
+        _count = other._count;
+        other.ClearInline();
+    }
+
+    uint8_t _tags[HashGroup::Width];
+    alignas(T) unsigned char _values[sizeof(T) * N];
+    uint32_t _count;          // inline values (0 once spilled)
+    bool _spilled;
+    HashSet<T> _spill;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Memory.hpp"
+#include "System/Threading/Interlocked.hpp"
+
+// ==============================================================
+//  SpscRing<T> - bounded single-producer / single-consumer ring
+//  - Exactly one thread pushes and one thread pops; neither locks
+//  - Capacity is fixed at construction (rounded up to a power of
+//    two); a full ring refuses pushes instead of growing
+//  - Head and tail sit on their own cache lines, and each side keeps
+//    a private copy of the other's index, so the shared line is only
+//    read again when the ring looks full (or empty)
+//  - TryPushN / TryPopN move a whole batch behind one index update
+//    and return how many elements made it
+// ==============================================================
+
+template<typename T>
+class SpscRing
+{
+public:
+
+    explicit SpscRing(u32 capacity)
+        : _head(0)
+        , _cachedTail(0)
+        , _tail(0)
+        , _cachedHead(0)
+    {
+        uint64_t count = 2;
+        while (count < (uint64_t)capacity)
+            count <<= 1;
+
+        _items = static_cast<T*>(Memory::Alloc(sizeof(T) * count).Get());
+        if (_items == nullptr)
+            throw "out of memory";
+        _mask = count - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    ~SpscRing()
+    {
+        for (uint64_t i = _head; i != _tail; ++i)
+            Memory::Destroy(&_items[i & _mask]);
+        Memory::Free(Pointer(_items));
+    }
+
+    // --- producer side ---
+
+    Boolean TryPush(const T& value)
+    {
+        return TryPushWith([&](T* slot) { Memory::Construct<T>(Pointer(slot), value); });
+    }
+
+    Boolean TryPush(T&& value)
+    {
+        return TryPushWith([&](T* slot) { Memory::Construct<T>(Pointer(slot), static_cast<T&&>(value)); });
+    }
+
+    // Copies up to count elements; returns how many fit.
+    u32 TryPushN(const T* values, u32 count)
+    {
+        const uint64_t tail = Volatile::ReadRelaxed(&_tail);
+        const uint64_t n = Room(tail, count);
+
+        for (uint64_t i = 0; i < n; ++i)
+            Memory::Construct<T>(Pointer(&_items[(tail + i) & _mask]), values[i]);
+
+        if (n != 0)
+            Volatile::Write(&_tail, tail + n);
+        return (uint32_t)n;
+    }
+
+    // --- consumer side ---
+
+    Boolean TryPop(T& value)
+    {
+        return TryPopN(&value, 1) == 1;
+    }
+
+    // Moves up to count elements into values; returns how many there were.
+    u32 TryPopN(T* values, u32 count)
+    {
+        const uint64_t head = Volatile::ReadRelaxed(&_head);
+        const uint64_t n = Available(head, count);
+
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            T& item = _items[(head + i) & _mask];
+            values[i] = static_cast<T&&>(item);
+            Memory::Destroy(&item);
+        }
+
+        if (n != 0)
+            Volatile::Write(&_head, head + n);
+        return (uint32_t)n;
+    }
+
+    // --- either side ---
+
+    // Exact only while the other side is idle.
+    u64 Count() const noexcept
+    {
+        return Volatile::Read(&_tail) - Volatile::Read(&_head);
+    }
+
+    u64 Capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+private:
+
+    template<typename F>
+    Boolean TryPushWith(F&& construct)
+    {
+        const uint64_t tail = Volatile::ReadRelaxed(&_tail);
+        if (Room(tail, 1) == 0)
+            return false;
+
+        construct(&_items[tail & _mask]);
+        Volatile::Write(&_tail, tail + 1);
+        return true;
+    }
+
+    // producer: free slots, up to wanted (re-reads the head only when short)
+    inline uint64_t Room(uint64_t tail, uint64_t wanted) noexcept
+    {
+        uint64_t room = Capacity() - (tail - _cachedHead);
+        if (room < wanted)
+        {
+            _cachedHead = Volatile::Read(&_head);
+            room = Capacity() - (tail - _cachedHead);
+        }
+        return room < wanted ? room : wanted;
+    }
+
+    // consumer: filled slots, up to wanted (re-reads the tail only when short)
+    inline uint64_t Available(uint64_t head, uint64_t wanted) noexcept
+    {
+        uint64_t available = _cachedTail - head;
+        if (available < wanted)
+        {
+            _cachedTail = Volatile::Read(&_tail);
+            available = _cachedTail - head;
+        }
+        return available < wanted ? available : wanted;
+    }
+
+    // read-only after construction
+    T*       _items;
+    uint64_t _mask;
+
+    // consumer line
+    alignas(64) volatile uint64_t _head;
+    uint64_t _cachedTail;
+
+    // producer line
+    alignas(64) volatile uint64_t _tail;
+    uint64_t _cachedHead;
+};
@@ -2,16 +2,19 @@
 
 #include "Array.hpp"
 #include "System/Types.hpp"
+#include "System/Allocator.hpp"
 
 // ================================================================
 //  Stack<T> - Dynamic Array Based
+//  Storage comes from Allocator; only [0, Size) holds live objects
 // ================================================================
 
-template<typename T>
+template<typename T, typename Allocator = Memory::DefaultAllocator>
 class Stack {
 
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using reference = T&;
     using const_reference = const T&;
     using size_type = u64;
@@ -23,15 +26,31 @@ private:
     pointer Data;
     size_type Size;
     size_type Capacity;
+    Allocator Alloc;
 
     static constexpr size_type k_default_capacity = 4;
 
     // ------------------------------------------------------------
-    // Allocador interno (value-init)
+    // Allocador interno (memória crua, nada é construído)
     // ------------------------------------------------------------
-    static pointer allocate(size_type cap) {
+    pointer allocate(size_type cap) {
         if (cap == 0) return nullptr;
-        return new value_type[cap](); // value-init
+        pointer p = static_cast<pointer>(Alloc.Allocate(cap * sizeof(value_type), alignof(value_type)).Get());
+        if (!p) throw "out of memory";
+        return p;
+    }
+
+    void destroy_all() noexcept {
+        if constexpr (!is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < Size; ++i)
+                Memory::Destroy(Data + i);
+        }
+    }
+
+    void release() noexcept {
+        if (!Data) return;
+        destroy_all();
+        Alloc.Deallocate(Pointer(Data), Capacity * sizeof(value_type));
     }
 
     // ------------------------------------------------------------
@@ -39,13 +58,26 @@ private:
     // ------------------------------------------------------------
     void grow() {
         size_type newCap = (Capacity == 0) ? k_default_capacity : Capacity * 2;
+
+        // Tenta crescer no lugar (arena / folga da size class)
+        if (Data && Alloc.TryResize(Pointer(Data), Capacity * sizeof(value_type), newCap * sizeof(value_type))) {
+            Capacity = newCap;
+            return;
+        }
+
         pointer newBuf = allocate(newCap);
 
-        // Copiar elementos atuais
-        for (size_type i = 0; i < Size; ++i)
-            newBuf[i] = Data[i];
+        // Mover elementos atuais (memcpy quando o tipo é realocável)
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            if (Size) Memory::Copy(Pointer(newBuf), Pointer(Data), Size * sizeof(value_type));
+            if (Data) Alloc.Deallocate(Pointer(Data), Capacity * sizeof(value_type));
+        }
+        else {
+            for (size_type i = 0; i < Size; ++i)
+                Memory::Construct<value_type>(Pointer(newBuf + i), static_cast<value_type&&>(Data[i]));
+            release();
+        }
 
-        delete[] Data;
         Data = newBuf;
         Capacity = newCap;
     }
@@ -58,14 +90,24 @@ public:
     Stack() noexcept :
         Data(nullptr),
         Size(0),
-        Capacity(0)
+        Capacity(0),
+        Alloc()
     {
     }
 
-    explicit Stack(size_type initialCapacity) :
+    explicit Stack(const Allocator& allocator) noexcept :
         Data(nullptr),
         Size(0),
-        Capacity(initialCapacity)
+        Capacity(0),
+        Alloc(allocator)
+    {
+    }
+
+    explicit Stack(size_type initialCapacity, const Allocator& allocator = Allocator()) :
+        Data(nullptr),
+        Size(0),
+        Capacity(initialCapacity),
+        Alloc(allocator)
     {
         if (initialCapacity > 0)
             Data = allocate(initialCapacity);
@@ -74,19 +116,21 @@ public:
     Stack(const Stack& other) :
         Data(nullptr),
         Size(other.Size),
-        Capacity(other.Capacity)
+        Capacity(other.Capacity),
+        Alloc(other.Alloc.SelectOnCopy())
     {
         if (Capacity > 0) {
             Data = allocate(Capacity);
             for (size_type i = 0; i < Size; ++i)
-                Data[i] = other.Data[i];
+                Memory::Construct<value_type>(Pointer(Data + i), other.Data[i]);
         }
     }
 
     Stack(Stack&& other) noexcept :
         Data(other.Data),
         Size(other.Size),
-        Capacity(other.Capacity)
+        Capacity(other.Capacity),
+        Alloc(other.Alloc)
     {
         other.Data = nullptr;
         other.Size = 0;
@@ -97,7 +141,7 @@ public:
     // Destrutor
     // ------------------------------------------------------------
     ~Stack() {
-        if (Data) delete[] Data;
+        release();
     }
 
     // ------------------------------------------------------------
@@ -114,11 +158,12 @@ public:
     Stack& operator=(Stack&& other) noexcept {
         if (&other == this) return *this;
 
-        if (Data) delete[] Data;
+        release();
 
         Data = other.Data;
         Size = other.Size;
         Capacity = other.Capacity;
+        Alloc = other.Alloc;
 
         other.Data = nullptr;
         other.Size = 0;
@@ -148,17 +193,14 @@ public:
 
     static Stack From(const_pointer src, size_type length) {
         Stack s(length);
-        s.Size = length;
         for (size_type i = 0; i < length; ++i)
-            s.Data[i] = src[i];
+            Memory::Construct<value_type>(Pointer(s.Data + i), src[i]);
+        s.Size = length;
         return s;
     }
 
     static Stack From(const Array<T>& array) {
-        Stack s(array.GetLength());
-        size_type i = 0;
-        for (auto& v : array) s.Data[i++] = v;
-        return s;
+        return From(array.GetData(), array.GetLength());
     }
 
     // ------------------------------------------------------------
@@ -174,9 +216,23 @@ public:
     }
 
     void Push(const_reference value) {
+        if (Size == Capacity) {
+            // value may live in this stack: copy it before the buffer moves
+            value_type tmp(value);
+            grow();
+            Memory::Construct<value_type>(Pointer(Data + Size), static_cast<value_type&&>(tmp));
+        }
+        else {
+            Memory::Construct<value_type>(Pointer(Data + Size), value);
+        }
+        ++Size;
+    }
+
+    void Push(value_type&& value) {
         if (Size == Capacity)
             grow();
-        Data[Size++] = value;
+        Memory::Construct<value_type>(Pointer(Data + Size), static_cast<value_type&&>(value));
+        ++Size;
     }
 
     value_type Pop() {
@@ -184,7 +240,9 @@ public:
             throw "Stack is empty";
 
         --Size;
-        return Data[Size];
+        value_type out(static_cast<value_type&&>(Data[Size]));
+        Memory::Destroy(Data + Size);
+        return out;
     }
 
     value_type Peek() const {
@@ -201,29 +259,28 @@ public:
     }
 
     void Clear() noexcept {
+        destroy_all();
         Size = 0;
-        // opcional:
-        // for (size_type i = 0; i < Capacity; ++i) Data[i] = value_type();
     }
 
     Array<value_type> ToArray() const {
-        Array<value_type> a(Size);
-        for (size_type i = 0; i < Size; ++i)
-            a[i] = Data[i];
-        return a;
+        return Array<value_type>(Data, Size);
     }
 
     void Swap(Stack& other) noexcept {
         auto tmpData = Data;
         auto tmpSize = Size;
         auto tmpCap = Capacity;
+        auto tmpAlloc = Alloc;
 
         Data = other.Data;
         Size = other.Size;
         Capacity = other.Capacity;
+        Alloc = other.Alloc;
 
         other.Data = tmpData;
         other.Size = tmpSize;
         other.Capacity = tmpCap;
+        other.Alloc = tmpAlloc;
     }
 };
\ No newline at end of file
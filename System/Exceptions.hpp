@@ -168,6 +168,16 @@ public:
 };
 
 
+// ================================================
+// OverflowException
+// ================================================
+class OverflowException : public Exception
+{
+public:
+	using Exception::Exception;
+};
+
+
 // ================================================
 // IOException
 // ================================================
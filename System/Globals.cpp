@@ -3,6 +3,7 @@
 namespace Phoenix
 {
     uint64_t GLOBAL_HASH_SEED = 0;
+    StringHashAlgorithm STRING_HASH_ALGORITHM = StringHashAlgorithm::Marvin32;
 
 #ifdef _WIN32
     bool IsWin32NetworkInitialized = false;
@@ -6,6 +6,17 @@ namespace Phoenix
 {
 	extern uint64_t GLOBAL_HASH_SEED;
 
+	// The function String and StringView hash with. Both are keyed by
+	// GLOBAL_HASH_SEED. Pick one before anything is hashed: blocks cache
+	// their hash and StringPool keeps the ones it interned.
+	enum class StringHashAlgorithm : uint8_t
+	{
+		Marvin32,   // 4 bytes per round, 32-bit state
+		Wide        // 32 bytes per round, 64-bit (AES-NI when the CPU has it)
+	};
+
+	extern StringHashAlgorithm STRING_HASH_ALGORITHM;
+
 #ifdef _WIN32
 	extern bool IsWin32NetworkInitialized;
 #endif
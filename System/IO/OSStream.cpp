@@ -8,6 +8,7 @@
 #else
 #include <unistd.h>
 #include <errno.h>
+#include <sys/uio.h>
 #endif
 
 OSStream::size_type OSStream::Read(Byte* buffer, size_type count) noexcept 
@@ -93,6 +94,48 @@ OSStream::size_type OSStream::Write(const Byte* buffer, size_type count) noexcep
 #endif
 }
 
+OSStream::size_type OSStream::WriteSegments(const Segment* segments, size_type count) noexcept {
+#if defined(_WIN32) || defined(_WIN64)
+    // CRT descriptors have no gather write
+    return Stream::WriteSegments(segments, count);
+#else
+    // writev takes a batch of buffers per call and may stop part way
+    // through one: the next batch starts from there
+    constexpr int Batch = 64;
+    iovec iov[Batch];
+
+    uint64_t written = 0;
+    uint64_t next = 0;
+    uint64_t skip = 0;      // bytes of segments[next] already written
+
+    while (next < count)
+    {
+        int n = 0;
+        for (uint64_t k = next; k < count && n < Batch; ++k, ++n)
+        {
+            const uint64_t from = k == next ? skip : 0;
+            iov[n].iov_base = const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(segments[k].Data)) + from;
+            iov[n].iov_len = (uint64_t)segments[k].Count - from;
+        }
+
+        ssize_t w = ::writev(FD, iov, n);
+        if (w <= 0) break;
+        written += (uint64_t)w;
+
+        uint64_t left = (uint64_t)w;
+        while (next < count && left >= (uint64_t)segments[next].Count - skip)
+        {
+            left -= (uint64_t)segments[next].Count - skip;
+            skip = 0;
+            ++next;
+        }
+        skip += left;
+    }
+
+    return static_cast<size_type>(written);
+#endif
+}
+
 void OSStream::Flush() noexcept {
     // Nothing required for raw file descriptors
 }
\ No newline at end of file
@@ -20,6 +20,7 @@ public:
 
     virtual size_type Read(Byte* buffer, size_type count) noexcept override;
     virtual size_type Write(const Byte* buffer, size_type count) noexcept override;
+    virtual size_type WriteSegments(const Segment* segments, size_type count) noexcept override;
     virtual void Flush() noexcept override;
 
     virtual bool CanRead() const noexcept override { return true; }
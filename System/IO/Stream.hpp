@@ -15,6 +15,29 @@ public:
     // Write count bytes from buffer. Return number of bytes written.
     virtual size_type Write(const Byte* buffer, size_type count) noexcept = 0;
 
+    // One buffer of a gather write
+    struct Segment
+    {
+        const Byte* Data;
+        size_type Count;
+    };
+
+    // Write the segments in order, as one Write each unless the stream can
+    // take them in one call. Return number of bytes written; stops at the
+    // first short write.
+    virtual size_type WriteSegments(const Segment* segments, size_type count) noexcept
+    {
+        size_type written = 0;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            const size_type n = Write(segments[i].Data, segments[i].Count);
+            written += n;
+            if (n < segments[i].Count)
+                break;
+        }
+        return written;
+    }
+
     // Flush underlying stream
     virtual void Flush() noexcept = 0;
 
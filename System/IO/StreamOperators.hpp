@@ -2,12 +2,23 @@
 #include "TextWriter.hpp"
 
 #include "System/Types.hpp"
+#include "System/Text/NumberFormat.hpp"
 
 #include <cstdio>
 #include <cstring>
 
 namespace StreamOperators {
 
+    // Digits on the stack, then one write: no allocation, no locale
+    template <typename T>
+    inline TextWriter& WriteNumber(TextWriter& w, T v) noexcept {
+        Char buf[NumberFormat::MaxChars];
+        u32 n;
+        NumberFormat::TryFormat(v, buf, NumberFormat::MaxChars, n);
+        w.WriteBytes(reinterpret_cast<const char*>(buf), n);
+        return w;
+    }
+
     template <typename T>
     inline enable_if_t<
         is_base_of_v<Object<T>, T>,
@@ -47,17 +58,11 @@ namespace StreamOperators {
     //  int8_t e uint8_t devem ser tratados como inteiros, NÃO como char
     // -----------------------------------------------------------------------------
     inline TextWriter& operator<<(TextWriter& w, uint8_t v) noexcept {
-        char buf[8];
-        int n = std::snprintf(buf, sizeof(buf), "%u", (unsigned)v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (uint32_t)v);
     }
 
     inline TextWriter& operator<<(TextWriter& w, int8_t v) noexcept {
-        char buf[8];
-        int n = std::snprintf(buf, sizeof(buf), "%d", (int)v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (int32_t)v);
     }
 
     // -----------------------------------------------------------------------------
@@ -75,11 +80,7 @@ namespace StreamOperators {
     //  Byte
     // -----------------------------------------------------------------------------
     inline TextWriter& operator<<(TextWriter& w, const Byte& b) noexcept {
-        unsigned v = static_cast<unsigned char>(b);
-        char buf[8];
-        int n = std::snprintf(buf, sizeof(buf), "%u", v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (uint32_t)static_cast<unsigned char>(b));
     }
 
     // -----------------------------------------------------------------------------
@@ -121,51 +122,31 @@ namespace StreamOperators {
     //  Unsigned Wrappers (UInt16, UInt32, UInt64)
     // -----------------------------------------------------------------------------
     inline TextWriter& operator<<(TextWriter& w, const UInt16& v) noexcept {
-        uint16_t value = static_cast<uint16_t>(v);
-        char buf[16];
-        int n = std::snprintf(buf, sizeof(buf), "%u", static_cast<unsigned>(value));
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (uint32_t)static_cast<uint16_t>(v));
     }
 
     inline TextWriter& operator<<(TextWriter& w, const UInt32& v) noexcept {
-        uint32_t value = static_cast<uint32_t>(v);
-        char buf[32];
-        int n = std::snprintf(buf, sizeof(buf), "%u", static_cast<unsigned long>(value));
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, static_cast<uint32_t>(v));
     }
 
     inline TextWriter& operator<<(TextWriter& w, const UInt64& v) noexcept {
-        uint64_t value = static_cast<uint64_t>(v);
-        char buf[32];
-        int n = std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(value));
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, static_cast<uint64_t>(v));
     }
 
     // -----------------------------------------------------------------------------
-    //  float / double / long double
+    //  float / double / long double (dígitos mais curtos que voltam ao mesmo valor;
+    //  long double sai com a precisão de double)
     // -----------------------------------------------------------------------------
     inline TextWriter& operator<<(TextWriter& w, float v) noexcept {
-        char buf[64];
-        int n = std::snprintf(buf, sizeof(buf), "%g", (double)v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, v);
     }
 
     inline TextWriter& operator<<(TextWriter& w, double v) noexcept {
-        char buf[64];
-        int n = std::snprintf(buf, sizeof(buf), "%g", v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, v);
     }
 
     inline TextWriter& operator<<(TextWriter& w, long double v) noexcept {
-        char buf[128];
-        int n = std::snprintf(buf, sizeof(buf), "%Lg", v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (double)v);
     }
 
     // -----------------------------------------------------------------------------
@@ -180,10 +161,7 @@ namespace StreamOperators {
         TextWriter&
     >
         operator<<(TextWriter& w, T v) noexcept {
-        char buf[64];
-        int n = std::snprintf(buf, sizeof(buf), "%lld", (long long)v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (int64_t)v);
     }
 
     template<typename T>
@@ -195,10 +173,7 @@ namespace StreamOperators {
         TextWriter&
     >
         operator<<(TextWriter& w, T v) noexcept {
-        char buf[64];
-        int n = std::snprintf(buf, sizeof(buf), "%llu", (unsigned long long)v);
-        if (n > 0) w.WriteBytes(buf, n);
-        return w;
+        return WriteNumber(w, (uint64_t)v);
     }
 
     // -----------------------------------------------------------------------------
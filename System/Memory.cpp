@@ -1,4 +1,5 @@
 #include "Memory.hpp"
+#include "System/Threading/SpinLock.hpp"
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -12,34 +13,372 @@
 #include <intrin.h>
 #endif
 
-namespace Memory 
+namespace
 {
-    Pointer Alloc(u64 size) noexcept
+    // ------------------------------------------------------------
+    // Heap layout
+    // ------------------------------------------------------------
+
+    constexpr uint32_t HEADER_SIZE = 16;
+    constexpr uint32_t SIZE_CLASS_COUNT = 40;
+    constexpr uint32_t LARGE_CLASS = 0xFFFFFFFFu;
+    constexpr uint64_t MAX_SMALL_BLOCK = 32768;   // header included
+    constexpr uint64_t SPAN_BYTES = 64 * 1024;
+    constexpr uint32_t MAX_BATCH = 64;
+
+    struct BlockHeader
     {
-#if defined(_WIN32)
-        return Pointer(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+        uint64_t size;        // requested size
+        uint32_t sizeClass;   // index in the class table or LARGE_CLASS
+        uint32_t pageCount;   // pages backing a large block (0 for small)
+    };
+
+    static_assert(sizeof(BlockHeader) == HEADER_SIZE);
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    // 16..128 in steps of 16, then four classes per power of two up to 32 KiB:
+    // 160 192 224 256 | 320 384 448 512 | ... | 20480 24576 28672 32768
+    constexpr uint32_t ClassBlockSize(uint32_t idx) noexcept
+    {
+        if (idx < 8)
+            return (idx + 1) * 16;
+
+        uint32_t group = (idx - 8) / 4;
+        uint32_t step = (idx - 8) % 4;
+        uint32_t base = 128u << group;
+        return base + (step + 1) * (base / 4);
+    }
+
+    static_assert(ClassBlockSize(SIZE_CLASS_COUNT - 1) == MAX_SMALL_BLOCK);
+
+    inline uint32_t FloorLog2(uint64_t v) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long idx;
+        _BitScanReverse64(&idx, v);
+        return (uint32_t)idx;
 #else
-        Pointer p = Pointer(mmap(nullPointer, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-        return (p.Get() == MAP_FAILED) ? nullPointer : p;
+        return 63u - (uint32_t)__builtin_clzll(v);
 #endif
     }
 
+    // blockSize includes the header; must be in [1, MAX_SMALL_BLOCK]
+    inline uint32_t SizeToClass(uint64_t blockSize) noexcept
+    {
+        if (blockSize <= 128)
+            return (uint32_t)((blockSize + 15) / 16) - 1;
+
+        uint64_t v = blockSize - 1;
+        uint32_t log = FloorLog2(v);
+        uint64_t base = 1ull << log;
+        return 8 + (log - 7) * 4 + (uint32_t)((v - base) / (base / 4));
+    }
+
+    inline uint32_t BatchCount(uint32_t cls) noexcept
+    {
+        uint64_t n = SPAN_BYTES / ClassBlockSize(cls);
+        if (n < 2) n = 2;
+        if (n > MAX_BATCH) n = MAX_BATCH;
+        return (uint32_t)n;
+    }
+
+    inline uint64_t CachedPageSize() noexcept
+    {
+        static const uint64_t size = Memory::PageSize();
+        return size;
+    }
+
+    // ------------------------------------------------------------
+    // Central lists (shared, spinlocked) and thread caches
+    // ------------------------------------------------------------
+
+    struct CentralList
+    {
+        SpinLock lock;
+        FreeBlock* head = nullptr;
+        uint32_t count = 0;
+    };
+
+    CentralList g_central[SIZE_CLASS_COUNT];
+
+    void CentralPush(uint32_t cls, FreeBlock* first, FreeBlock* last, uint32_t n) noexcept
+    {
+        CentralList& c = g_central[cls];
+        SpinLockScope scope(c.lock);
+        last->next = c.head;
+        c.head = first;
+        c.count += n;
+    }
+
+    // Pops up to 'want' blocks; returns the chain and stores its length in 'got'
+    FreeBlock* CentralPop(uint32_t cls, uint32_t want, uint32_t& got) noexcept
+    {
+        CentralList& c = g_central[cls];
+        SpinLockScope scope(c.lock);
+
+        FreeBlock* first = c.head;
+        FreeBlock* last = nullptr;
+        got = 0;
+
+        for (FreeBlock* b = first; b && got < want; b = b->next)
+        {
+            last = b;
+            ++got;
+        }
+
+        if (!last)
+            return nullptr;
+
+        c.head = last->next;
+        c.count -= got;
+        last->next = nullptr;
+        return first;
+    }
+
+    // Carves a fresh span into blocks of class 'cls'
+    FreeBlock* CarveSpan(uint32_t cls, uint32_t& got) noexcept
+    {
+        const uint64_t blockSize = ClassBlockSize(cls);
+        const uint64_t pageSize = CachedPageSize();
+
+        uint64_t spanBytes = blockSize * 4 > SPAN_BYTES ? blockSize * 4 : SPAN_BYTES;
+        uint64_t pages = (spanBytes + pageSize - 1) / pageSize;
+        spanBytes = pages * pageSize;
+
+        unsigned char* base = static_cast<unsigned char*>(Memory::AllocPages(pages).Get());
+        if (!base)
+        {
+            got = 0;
+            return nullptr;
+        }
+
+        uint64_t n = spanBytes / blockSize;
+        for (uint64_t i = 0; i + 1 < n; ++i)
+            reinterpret_cast<FreeBlock*>(base + i * blockSize)->next = reinterpret_cast<FreeBlock*>(base + (i + 1) * blockSize);
+        reinterpret_cast<FreeBlock*>(base + (n - 1) * blockSize)->next = nullptr;
+
+        got = (uint32_t)n;
+        return reinterpret_cast<FreeBlock*>(base);
+    }
+
+    struct ThreadCache
+    {
+        FreeBlock* heads[SIZE_CLASS_COUNT] = {};
+        uint32_t counts[SIZE_CLASS_COUNT] = {};
+
+        ~ThreadCache() noexcept;
+    };
+
+    thread_local ThreadCache t_cache;
+    thread_local bool t_cacheDestroyed = false;
+    thread_local uint64_t t_allocationCount = 0;
+
+    // Hands the first 'n' cached blocks of a class back to the central list
+    void ReleaseToCentral(ThreadCache& tc, uint32_t cls, uint32_t n) noexcept
+    {
+        FreeBlock* first = tc.heads[cls];
+        FreeBlock* last = first;
+        for (uint32_t i = 1; i < n; ++i)
+            last = last->next;
+
+        tc.heads[cls] = last->next;
+        tc.counts[cls] -= n;
+        CentralPush(cls, first, last, n);
+    }
+
+    ThreadCache::~ThreadCache() noexcept
+    {
+        for (uint32_t cls = 0; cls < SIZE_CLASS_COUNT; ++cls)
+        {
+            if (counts[cls] > 0)
+                ReleaseToCentral(*this, cls, counts[cls]);
+        }
+        t_cacheDestroyed = true;
+    }
+
+    void* AllocSmall(uint32_t cls) noexcept
+    {
+        if (t_cacheDestroyed)
+        {
+            // thread is shutting down: bypass the cache
+            uint32_t got = 0;
+            FreeBlock* b = CentralPop(cls, 1, got);
+            if (!b)
+            {
+                b = CarveSpan(cls, got);
+                if (b && got > 1)
+                {
+                    FreeBlock* last = b->next;
+                    while (last->next) last = last->next;
+                    CentralPush(cls, b->next, last, got - 1);
+                }
+            }
+            return b;
+        }
+
+        ThreadCache& tc = t_cache;
+        FreeBlock* b = tc.heads[cls];
+
+        if (!b)
+        {
+            uint32_t got = 0;
+            b = CentralPop(cls, BatchCount(cls), got);
+            if (!b)
+                b = CarveSpan(cls, got);
+            if (!b)
+                return nullptr;
+
+            tc.heads[cls] = b;
+            tc.counts[cls] = got;
+        }
+
+        tc.heads[cls] = b->next;
+        --tc.counts[cls];
+        return b;
+    }
+
+    void FreeSmall(void* block, uint32_t cls) noexcept
+    {
+        FreeBlock* b = static_cast<FreeBlock*>(block);
+
+        if (t_cacheDestroyed)
+        {
+            b->next = nullptr;
+            CentralPush(cls, b, b, 1);
+            return;
+        }
+
+        ThreadCache& tc = t_cache;
+        b->next = tc.heads[cls];
+        tc.heads[cls] = b;
+
+        // keep at most two batches per class locally, return one when exceeded
+        uint32_t batch = BatchCount(cls);
+        if (++tc.counts[cls] > batch * 2)
+            ReleaseToCentral(tc, cls, batch);
+    }
+
+    inline BlockHeader* HeaderOf(const Pointer p) noexcept
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(p.Get()) - HEADER_SIZE);
+    }
+
+    inline uint64_t CapacityOf(const BlockHeader* h) noexcept
+    {
+        if (h->sizeClass == LARGE_CLASS)
+            return h->pageCount * CachedPageSize() - HEADER_SIZE;
+        return ClassBlockSize(h->sizeClass) - HEADER_SIZE;
+    }
+}
+
+namespace Memory 
+{
+    Pointer Alloc(u64 size) noexcept
+    {
+        uint64_t n = size;
+        if (n == 0) n = 1;
+
+        const uint64_t blockSize = n + HEADER_SIZE;
+        BlockHeader* h;
+
+        if (blockSize <= MAX_SMALL_BLOCK)
+        {
+            uint32_t cls = SizeToClass(blockSize);
+            h = static_cast<BlockHeader*>(AllocSmall(cls));
+            if (!h) return Pointer();
+
+            h->sizeClass = cls;
+            h->pageCount = 0;
+        }
+        else
+        {
+            const uint64_t pageSize = CachedPageSize();
+            uint64_t pages = (blockSize + pageSize - 1) / pageSize;
+
+            h = static_cast<BlockHeader*>(AllocPages(pages).Get());
+            if (!h) return Pointer();
+
+            h->sizeClass = LARGE_CLASS;
+            h->pageCount = (uint32_t)pages;
+        }
+
+        h->size = size;
+        ++t_allocationCount;
+        return Pointer(reinterpret_cast<unsigned char*>(h) + HEADER_SIZE);
+    }
+
+    Pointer AllocZeroed(u64 size) noexcept
+    {
+        Pointer p = Alloc(size);
+        if (p && size > 0)
+        {
+            // fresh large blocks come from the OS already zeroed
+            if (HeaderOf(p)->sizeClass != LARGE_CLASS)
+                Fill(p, 0, (u32)size);
+        }
+        return p;
+    }
+
+    Pointer Realloc(Pointer p, u64 newSize) noexcept
+    {
+        if (!p)
+            return Alloc(newSize);
+
+        BlockHeader* h = HeaderOf(p);
+        const uint64_t want = newSize;
+
+        // grow or shrink in place while the block still fits
+        if (want <= CapacityOf(h))
+        {
+            h->size = want;
+            return p;
+        }
+
+        Pointer n = Alloc(newSize);
+        if (!n)
+            return Pointer();
+
+        uint64_t keep = h->size < want ? h->size : want;
+        Copy(n, p, keep);
+        Free(p);
+        return n;
+    }
+
     void Free(Pointer p) noexcept
     {
-#if defined(_WIN32)
-        VirtualFree(p.Get(), 0, MEM_RELEASE);
-#else
-        // size não é necessário para munmap se você guardar em header interno
-        munmap(p, 0); // você vai substituir isso quando criar seu allocator
-#endif
+        if (!p) return;
+
+        BlockHeader* h = HeaderOf(p);
+
+        if (h->sizeClass == LARGE_CLASS)
+            FreePages(Pointer(h), h->pageCount);
+        else
+            FreeSmall(h, h->sizeClass);
     }
 
-    inline void Zero(Pointer p, u32 size) noexcept
+    u64 GetAllocationSize(const Pointer p) noexcept
     {
-#if defined(__clang__)
-        __builtin_memset_inline(Pointer, 0, size);
-#elif defined(__GNUC__)
-        __builtin_memset(Pointer, 0, size);
+        return p ? HeaderOf(p)->size : 0;
+    }
+
+    u64 GetAllocationCapacity(const Pointer p) noexcept
+    {
+        return p ? CapacityOf(HeaderOf(p)) : 0;
+    }
+
+    u64 GetThreadAllocationCount() noexcept
+    {
+        return t_allocationCount;
+    }
+
+    void Zero(Pointer p, u32 size) noexcept
+    {
+#if defined(__clang__) || defined(__GNUC__)
+        __builtin_memset(p.Get(), 0, size);
 #elif defined(_MSC_VER)
         __stosb(reinterpret_cast<unsigned char*>(p.Get()), 0, size);
 #else
@@ -52,10 +391,10 @@ namespace Memory
     // ------------------------------------------------------------
     // Copy memory
     // ------------------------------------------------------------
-    void Copy(Pointer dst, const Pointer src, u32 size) noexcept
+    void Copy(Pointer dst, const Pointer src, u64 size) noexcept
     {
 #if defined(__clang__) || defined(__GNUC__)
-        __builtin_memcpy(dst, src, size);
+        __builtin_memcpy(dst.Get(), src.Get(), size);
 #elif defined(_MSC_VER)
         __movsb(
             reinterpret_cast<unsigned char*>(dst.Get()),
@@ -63,26 +402,37 @@ namespace Memory
             size
         );
 #else
-        unsigned char* d = static_cast<unsigned char*>(dst);
-        const unsigned char* s = static_cast<const unsigned char*>(src);
-        for (uint32_t i = 0; i < size; ++i)
+        unsigned char* d = static_cast<unsigned char*>(dst.Get());
+        const unsigned char* s = static_cast<const unsigned char*>(src.Get());
+        for (uint64_t i = 0; i < size; ++i)
             d[i] = s[i];
 #endif
     }
 
-    void Move(Pointer dst, const Pointer src, u32 size) noexcept
+    void Move(Pointer dst, const Pointer src, u64 size) noexcept
     {
 #if defined(__clang__) || defined(__GNUC__)
-        __builtin_memmove(dst, src, size);
+        __builtin_memmove(dst.Get(), src.Get(), size);
 #else
-        Copy(dst, src, size);
+        // overlap-safe: copy backwards when the destination is above the source
+        unsigned char* d = static_cast<unsigned char*>(dst.Get());
+        const unsigned char* s = static_cast<const unsigned char*>(src.Get());
+        const uint64_t n = size;
+        if (d == s || n == 0) return;
+        if (d < s || d >= s + n)
+        {
+            Copy(dst, src, size);
+            return;
+        }
+        for (uint64_t i = n; i > 0; --i)
+            d[i - 1] = s[i - 1];
 #endif
     }
 
     i32 Compare(const Pointer a, const Pointer b, u32 size) noexcept
     {
 #if defined(__clang__) || defined(__GNUC__)
-        return __builtin_memcmp(a, b, size);
+        return __builtin_memcmp(a.Get(), b.Get(), size);
 #else
         const unsigned char* x = (const unsigned char*)a.Get();
         const unsigned char* y = (const unsigned char*)b.Get();
@@ -95,7 +445,7 @@ namespace Memory
     void Fill(Pointer dst, u8 value, u32 size) noexcept
     {
 #if defined(__clang__) || defined(__GNUC__)
-        __builtin_memset(dst, value, size);
+        __builtin_memset(dst.Get(), value, size);
 #else
         unsigned char* p = (unsigned char*)dst.Get();
         for (uint32_t i = 0; i < size; ++i) p[i] = value;
@@ -120,12 +470,12 @@ namespace Memory
 #if defined(_WIN32)
         return Pointer(VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
 #else
-        void* p = mmap(nullPointer, size,
+        void* p = mmap(nullptr, size,
             PROT_READ | PROT_WRITE,
             MAP_PRIVATE | MAP_ANONYMOUS,
             -1, 0);
 
-        return (p == MAP_FAILED) ? Pointer(nullPointer) : Pointer(p);
+        return (p == MAP_FAILED) ? Pointer() : Pointer(p);
 #endif
     }
 
@@ -2,29 +2,45 @@
 
 #include "System/Types.hpp"
 
+#include <new>
+
 namespace Memory
 {
     void Zero(Pointer p, u32 size) noexcept;
 
-    void Copy(Pointer p, const Pointer src, u32 size) noexcept;
+    void Copy(Pointer p, const Pointer src, u64 size) noexcept;
+
+    // ------------------------------------------------------------
+    // General purpose heap
+    // ------------------------------------------------------------
+    // Blocks up to MaxSmallAllocation come from thread-local size-class
+    // free lists refilled in spans; larger ones go straight to AllocPages.
+    // Each block is preceded by a 16-byte header holding its size, so
+    // Free/Realloc only need the pointer. Returned memory is 16-byte
+    // aligned and NOT zeroed (use AllocZeroed).
+
+    static constexpr u64 MaxSmallAllocation = 32768 - 16;
 
     Pointer Alloc(u64 size) noexcept;
 
+    Pointer AllocZeroed(u64 size) noexcept;
+
+    Pointer Realloc(Pointer p, u64 newSize) noexcept;
+
     void Free(Pointer p) noexcept;
 
-    static Pointer Realloc(Pointer p, u64 newSize) noexcept
-    {
-        Pointer n = Alloc(newSize);
-        if (p)
-        {
-            // aqui você pode armazenar size no header futuramente
-            Copy(n, p, newSize);
-            Free(p);
-        }
-        return n;
-    }
+    // Requested size recorded in the block header (0 for null)
+    u64 GetAllocationSize(const Pointer p) noexcept;
+
+    // Bytes usable in place before Realloc has to move the block
+    u64 GetAllocationCapacity(const Pointer p) noexcept;
+
+    // Blocks handed out by Alloc on the calling thread so far (AllocZeroed and
+    // moving Reallocs included). Diff two readings to count the allocations
+    // of a piece of code; other threads do not disturb it.
+    u64 GetThreadAllocationCount() noexcept;
 
-    void Move(Pointer dst, const Pointer src, u32 size) noexcept;
+    void Move(Pointer dst, const Pointer src, u64 size) noexcept;
 
     i32 Compare(const Pointer a, const Pointer b, u32 size) noexcept;
 
@@ -52,7 +68,7 @@ namespace Memory
     template<typename T, typename... Args>
     static inline T* Construct(Pointer memory, Args&&... args) noexcept
     {
-        return new (memory) T(static_cast<Args&&>(args)...);
+        return ::new (memory.Get()) T(static_cast<Args&&>(args)...);
     }
 
     template<typename T>
@@ -87,11 +87,37 @@ struct is_trivially_copyable
     : bool_constant<__is_trivially_copyable(T)> {
 };
 
+template<typename T>
+inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+
 template<typename T>
 struct is_trivially_destructible
     : bool_constant<__is_trivially_destructible(T)> {
 };
 
+template<typename T>
+inline constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
+
+// ---------------------------------------------------------------------
+//  is_trivially_relocatable
+//  Moving the object's bytes to a new address and forgetting the old
+//  ones (no destructor) is equivalent to move-construct + destroy.
+//  Containers then shift/grow with Memory::Move/Copy instead of
+//  per-element moves. Implied by trivially copyable; other types opt in:
+//
+//      template<> struct is_trivially_relocatable<MyType> : true_type {};
+//
+//  Only opt in types that hold no pointer into themselves.
+// ---------------------------------------------------------------------
+
+template<typename T>
+struct is_trivially_relocatable
+    : bool_constant<__is_trivially_copyable(T)> {
+};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 template<typename T>
 struct is_standard_layout
     : bool_constant<__is_standard_layout(T)> {
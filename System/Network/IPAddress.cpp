@@ -69,8 +69,13 @@ IPAddress IPAddress::FromIPv6(const Byte bytes[16]) noexcept
     return ip;
 }
 
-Boolean IPAddress::TryParse(const String& text, IPAddress& out) noexcept
+Boolean IPAddress::TryParse(const StringView& text, IPAddress& out) noexcept
 {
+    // Bytes, not characters: every valid address is ASCII, and anything
+    // else fails on its first byte
+    const char* p = text.GetData();
+    const uint32_t length = text.GetByteCount();
+
     // ------------------------------------------------------------
     // Tentativa IPv4
     // ------------------------------------------------------------
@@ -80,9 +85,9 @@ Boolean IPAddress::TryParse(const String& text, IPAddress& out) noexcept
         uint32_t value = 0;
         Boolean hasDigit = false;
 
-        for (UInt32 i = 0; i < text.GetLength(); ++i)
+        for (uint32_t i = 0; i < length; ++i)
         {
-            Char c = text[i];
+            const char c = p[i];
 
             if (c >= '0' && c <= '9')
             {
@@ -130,9 +135,18 @@ ipv4_fail:
         uint32_t value = 0;
         uint32_t digits = 0;
 
-        for (uint32_t i = 0; i <= text.GetLength(); ++i)
+        // "::" at the very start: its first ':' has no word before it
+        uint32_t start = 0;
+        if (length >= 2 && p[0] == ':' && p[1] == ':')
+        {
+            compressIndex = 0;
+            start = 2;
+        }
+
+        for (uint32_t i = start; i <= length; ++i)
         {
-            char c = (i < text.GetLength()) ? text[i] : (Char)':';
+            const Boolean atEnd = i == length;
+            const char c = atEnd ? ':' : p[i];
 
             if ((c >= '0' && c <= '9') ||
                 (c >= 'a' && c <= 'f') ||
@@ -151,8 +165,17 @@ ipv4_fail:
             {
                 if (digits == 0)
                 {
-                    if (compressIndex >= 0)
-                        return false; // "::" twice
+                    // an empty word: the end right after "::", or the
+                    // second ':' of "::"
+                    if (atEnd)
+                    {
+                        if (compressIndex != wordCount || i == 0)
+                            return false;
+                        break;
+                    }
+
+                    if (compressIndex >= 0 || i == 0 || p[i - 1] != ':')
+                        return false; // "::" twice, or a lone leading ':'
 
                     compressIndex = wordCount;
                 }
@@ -164,6 +187,10 @@ ipv4_fail:
                     words[wordCount++] = static_cast<uint16_t>(value);
                     value = 0;
                     digits = 0;
+
+                    // a trailing single ':' leaves an empty last word
+                    if (!atEnd && i + 1 == length)
+                        return false;
                 }
             }
             else
@@ -172,16 +199,11 @@ ipv4_fail:
             }
         }
 
-        if (digits > 0)
+        if (compressIndex >= 0)
         {
             if (wordCount >= 8)
                 return false;
 
-            words[wordCount++] = static_cast<uint16_t>(value);
-        }
-
-        if (compressIndex >= 0)
-        {
             int32_t missing = 8 - wordCount;
 
             for (int32_t i = wordCount - 1; i >= compressIndex; --i)
@@ -3,7 +3,7 @@
 #include "System/Types/Primitives/Byte.hpp"
 #include "System/Collections/Array.hpp"
 
-class String;
+class StringView;
 
 class IPAddress
 {
@@ -25,7 +25,7 @@ public:
     static IPAddress FromIPv4(Byte a, Byte b, Byte c, Byte d) noexcept;
     static IPAddress FromIPv6(const Byte bytes[16]) noexcept;
 
-    static Boolean TryParse(const String& text, IPAddress& out) noexcept;
+    static Boolean TryParse(const StringView& text, IPAddress& out) noexcept;
 
     inline constexpr Family GetFamily() const noexcept { return _family; }
     const Byte* GetBytes() const noexcept;
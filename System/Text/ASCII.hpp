@@ -4,17 +4,14 @@
 #include <cstring>
 
 #include "System/Types.hpp"
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/TextSearch.hpp"
 
 namespace ASCII
 {
 	static inline bool IsAllASCII(const Char* p, uint32_t len) noexcept
 	{
-		for (uint32_t i = 0; i < len; ++i)
-		{
-			if (p[i] & 0x80)
-				return false;
-		}
-		return true;
+		return TextKernels::IsASCII(p, len);
 	}
 
 	static inline constexpr Char ToLower(Char c) noexcept
@@ -83,29 +80,17 @@ namespace ASCII
 		return 0;
 	}
 
+	static inline const uint8_t* Bytes(const Char* p) noexcept
+	{
+		return reinterpret_cast<const uint8_t*>(p);
+	}
+
 	static inline uint32_t CountOccurrences(const Char* hay, uint32_t H,
 		const Char* ned, uint32_t N) noexcept
 	{
 		if (N == 0 || N > H) return 0;
 
-		uint32_t count = 0;
-
-		for (uint32_t i = 0; i + N <= H; )
-		{
-			bool match = true;
-
-			for (uint32_t j = 0; j < N; ++j)
-			{
-				Char a = hay[i + j];
-				Char b = ned[j];
-				if (a != b) { match = false; break; }
-			}
-
-			if (match) { ++count; i += N; }
-			else { ++i; }
-		}
-
-		return count;
+		return (uint32_t)TextSearch::Searcher(Bytes(ned), N).Count(Bytes(hay), H);
 	}
 
 	static inline uint32_t CountOccurrencesIgnoreCase(const Char* hay, uint32_t H, const Char* ned, uint32_t N) noexcept
@@ -151,25 +136,8 @@ namespace ASCII
 
 	static inline const Char* Find(const Char* hay, uint32_t H, const Char* ned, uint32_t N) noexcept
 	{
-		if (N == 0) return hay;
-		if (N > H) return nullptr;
-
-		for (uint32_t i = 0; i + N <= H; ++i)
-		{
-			bool ok = true;
-
-			for (uint32_t j = 0; j < N; ++j)
-			{
-				Char a = hay[i + j];
-				Char b = ned[j];
-
-				if (a != b) { ok = false; break; }
-			}
-
-			if (ok) return hay + i;
-		}
-
-		return nullptr;
+		const int64_t at = TextSearch::IndexOf(Bytes(hay), H, Bytes(ned), N);
+		return at < 0 ? nullptr : hay + at;
 	}
 
 	static inline const Char* FindIgnoreCase(const Char* hay, uint32_t H, const Char* ned, uint32_t N) noexcept
@@ -198,16 +166,9 @@ namespace ASCII
 	static inline int64_t IndexOf(const Char* hay, uint32_t H, const Char* ned, uint32_t N, uint32_t startIndex) noexcept
 	{
 		if (N == 0) return static_cast<int64_t>(startIndex);
-		if (N > H) return -1;
 		if (startIndex >= H) return -1;
 
-		// Clamp loop bound
-		uint32_t upper = H - N;
-		for (uint32_t i = startIndex; i <= upper; ++i)
-		{
-			if (Equals(hay + i, ned, N)) return static_cast<int64_t>(i);
-		}
-		return -1;
+		return TextSearch::IndexOf(Bytes(hay), H, Bytes(ned), N, startIndex);
 	}
 
 	static inline int64_t LastIndexOf(const Char* hay, uint32_t H, const Char* ned, uint32_t N, uint32_t startIndex) noexcept
@@ -223,49 +184,38 @@ namespace ASCII
 		if (N > H) return -1;
 		if (H == 0) return -1;
 
-		uint32_t s = (startIndex < H ? startIndex : (H - 1));
-
-		for (int64_t i = static_cast<int64_t>(s); i >= 0; --i)
-		{
-			uint32_t ui = static_cast<uint32_t>(i);
-			if (ui + N > H) continue;
-			if (Equals(hay + ui, ned, N)) return static_cast<int64_t>(ui);
-		}
-		return -1;
+		// matches starting at or before s end by s + N
+		uint64_t s = (startIndex < H ? startIndex : (H - 1));
+		uint64_t window = (s + N < H ? s + N : H);
+		return TextSearch::LastIndexOf(Bytes(hay), window, Bytes(ned), N);
 	}
 
+	// dst holds H + count * (N - O) bytes (count from CountOccurrences)
 	static inline void ReplaceOrdinal(const Char* src, uint32_t H, const Char* oldv, uint32_t O, const Char* newv, uint32_t N, Char* dst) noexcept
 	{
 		uint32_t i = 0, w = 0;
-
-		while (i < H)
+		if (O == 0)
 		{
-			bool match = true;
-
-			if (i + O <= H)
-			{
-				for (uint32_t j = 0; j < O; ++j)
-				{
-					if (src[i + j] != oldv[j])
-					{
-						match = false; break;
-					}
-				}
-			}
-			else match = false;
+			while (i < H)
+				dst[w++] = src[i++];
+			return;
+		}
 
-			if (match)
-			{
-				for (uint32_t k = 0; k < N; ++k)
-					dst[w++] = newv[k];
+		TextSearch::Searcher searcher(Bytes(oldv), O);
 
-				i += O;
-			}
-			else
-			{
+		for (int64_t at = searcher.IndexOfUTF8(Bytes(src), H, 0); at >= 0; at = searcher.IndexOfUTF8(Bytes(src), H, i))
+		{
+			while (i < (uint32_t)at)
 				dst[w++] = src[i++];
-			}
+
+			for (uint32_t k = 0; k < N; ++k)
+				dst[w++] = newv[k];
+
+			i += O;
 		}
+
+		while (i < H)
+			dst[w++] = src[i++];
 	}
 
 	static inline void ReplaceIgnoreCase(const Char* src, uint32_t H, const Char* oldv, uint32_t O, const Char* newv, uint32_t N, Char* dst) noexcept
@@ -128,6 +128,11 @@ struct UTF8Encoding
 		::UTF8::Decode(bytes, byteCount, outCodePoints);
 	}
 
+	static inline bool IsValid(const Char* bytes, uint32_t byteCount) noexcept
+	{
+		return ::UTF8::IsValid(bytes, byteCount);
+	}
+
 	// codepoints → bytes
 	static uint32_t Encode(const List<CodePoint>& codePoints, Char* outBytes) noexcept
 	{
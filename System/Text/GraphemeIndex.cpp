@@ -0,0 +1,55 @@
+#include "GraphemeIndex.hpp"
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/UTF8Iterators.hpp"
+
+namespace UTF8
+{
+	GraphemeIndex::GraphemeIndex(const Char* bytes, uint32_t length)
+		: _checkpoints(length / (Stride * 2) + 1), _length(length), _wellFormed(TextKernels::IsValidUTF8(bytes, length))
+	{
+		for (GraphemeIterator it(bytes, length); !it.IsEnd(); ++it)
+		{
+			if (_graphemes % Stride == 0)
+				_checkpoints.Add(Checkpoint{ it.ByteOffset(), _codePoints });
+
+			// clusters never split a sequence, so decoding one on its own
+			// reads the same code points as decoding the whole buffer
+			const uint32_t end = it.ByteOffset() + it.ByteLength();
+			for (CodePointIterator cp(bytes, end, it.ByteOffset()); !cp.IsEnd(); ++cp)
+				++_codePoints;
+
+			++_graphemes;
+		}
+	}
+
+	uint32_t GraphemeIndex::ForCodePoint(uint32_t cpIndex) const noexcept
+	{
+		// code point counts grow with the checkpoints: last one <= cpIndex
+		uint32_t lo = 0;
+		uint32_t hi = GetCheckpointCount();
+		while (hi - lo > 1)
+		{
+			const uint32_t mid = lo + (hi - lo) / 2;
+			if (_checkpoints[mid].CodePoints <= cpIndex)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	uint32_t GraphemeIndex::ForByte(uint32_t byteOffset) const noexcept
+	{
+		uint32_t lo = 0;
+		uint32_t hi = GetCheckpointCount();
+		while (hi - lo > 1)
+		{
+			const uint32_t mid = lo + (hi - lo) / 2;
+			if (_checkpoints[mid].ByteOffset <= byteOffset)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+}
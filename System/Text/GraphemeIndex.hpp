@@ -0,0 +1,67 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Collections/List.hpp"
+
+// ==============================================================
+//  GraphemeIndex - sparse offsets into a UTF-8 buffer
+//  - One checkpoint every Stride grapheme clusters: the byte offset
+//    where that cluster starts and how many code points precede it
+//  - Random access by cluster, code point or byte position jumps to
+//    the nearest checkpoint and walks at most one stride from there
+//    (UTF8Iterators), instead of decoding from byte 0
+//  - Built once, read only afterwards: safe to share between threads
+//  - String keeps one per heap block, built the first time a large
+//    non-ASCII string is indexed into
+// ==============================================================
+
+namespace UTF8
+{
+	class GraphemeIndex
+	{
+	public:
+
+		static constexpr uint32_t Stride = 64;
+
+		struct Checkpoint
+		{
+			uint32_t ByteOffset;     // cluster (index * Stride) starts here
+			uint32_t CodePoints;     // code points before ByteOffset
+		};
+
+		GraphemeIndex(const Char* bytes, uint32_t length);
+
+		inline uint32_t GetByteCount() const noexcept { return _length; }
+		inline uint32_t GetGraphemeCount() const noexcept { return _graphemes; }
+		inline uint32_t GetCodePointCount() const noexcept { return _codePoints; }
+
+		// Well-formed UTF-8: code points are then one per sequence, which is
+		// what byte offset lookups by code point (String) rely on
+		inline bool IsWellFormed() const noexcept { return _wellFormed; }
+
+		// Checkpoint i covers cluster i * Stride
+		inline uint32_t GetCheckpointCount() const noexcept { return (uint32_t)_checkpoints.Count(); }
+		inline const Checkpoint& GetCheckpoint(uint32_t i) const noexcept { return _checkpoints[i]; }
+
+		// The last checkpoint at or before the given cluster / code point / byte.
+		// Returns its position in the checkpoint list (0 when the index is empty
+		// and the walk starts from the beginning).
+		inline uint32_t ForGrapheme(uint32_t gcIndex) const noexcept
+		{
+			const uint32_t i = gcIndex / Stride;
+			const uint32_t count = GetCheckpointCount();
+			return i < count ? i : (count == 0 ? 0 : count - 1);
+		}
+
+		uint32_t ForCodePoint(uint32_t cpIndex) const noexcept;
+		uint32_t ForByte(uint32_t byteOffset) const noexcept;
+
+	private:
+
+		List<Checkpoint> _checkpoints;
+		uint32_t _length = 0;
+		uint32_t _graphemes = 0;
+		uint32_t _codePoints = 0;
+		bool _wellFormed = false;
+	};
+}
@@ -0,0 +1,623 @@
+#include "NumberFormat.hpp"
+#include "NumberFormat_tables.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#define PHOENIX_NUMBERFORMAT_UMUL128 1
+#endif
+
+namespace NumberFormat
+{
+	namespace
+	{
+		using namespace NumberFormatTables;
+
+		// "00".."99", two characters per entry
+		constexpr char DigitPairs[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		inline uint32_t DigitCount(uint64_t v) noexcept
+		{
+			uint32_t n = 1;
+			for (;;)
+			{
+				if (v < 10) return n;
+				if (v < 100) return n + 1;
+				if (v < 1000) return n + 2;
+				if (v < 10000) return n + 3;
+				v /= 10000u;
+				n += 4;
+			}
+		}
+
+		// Writes exactly count digits of v, ending at out + count
+		inline void WriteDigits(char* out, uint64_t v, uint32_t count) noexcept
+		{
+			char* p = out + count;
+			while (v >= 100)
+			{
+				const uint32_t pair = (uint32_t)(v % 100) * 2;
+				v /= 100;
+				p -= 2;
+				p[0] = DigitPairs[pair];
+				p[1] = DigitPairs[pair + 1];
+			}
+			if (v >= 10)
+			{
+				p -= 2;
+				p[0] = DigitPairs[v * 2];
+				p[1] = DigitPairs[v * 2 + 1];
+			}
+			else
+			{
+				*--p = (char)('0' + v);
+			}
+		}
+
+		// The IEEE bits of a float or double
+		template<typename Bits, typename Float>
+		inline Bits BitsOf(Float value) noexcept
+		{
+			static_assert(sizeof(Bits) == sizeof(Float));
+#if defined(_MSC_VER) && !defined(__clang__)
+			return *reinterpret_cast<const Bits*>(&value);
+#else
+			Bits bits;
+			__builtin_memcpy(&bits, &value, sizeof(bits));
+			return bits;
+#endif
+		}
+
+		inline Boolean FormatUnsigned(uint64_t v, bool negative, Char* dst, u32 capacity, u32& written) noexcept
+		{
+			const uint32_t digits = DigitCount(v);
+			const uint32_t total = digits + (negative ? 1u : 0u);
+			if (total > (uint32_t)capacity)
+			{
+				written = 0u;
+				return false;
+			}
+
+			char* out = reinterpret_cast<char*>(dst);
+			if (negative)
+				*out++ = '-';
+			WriteDigits(out, v, digits);
+			written = total;
+			return true;
+		}
+
+		inline Boolean Emit(const char* text, uint32_t count, Char* dst, u32 capacity, u32& written) noexcept
+		{
+			if (count > (uint32_t)capacity)
+			{
+				written = 0u;
+				return false;
+			}
+
+			char* out = reinterpret_cast<char*>(dst);
+			for (uint32_t i = 0; i < count; ++i)
+				out[i] = text[i];
+			written = count;
+			return true;
+		}
+
+		// ----------------------------------------------------------
+		// Ryu (Ulf Adams, "Ryu: Fast Float-to-String Conversion",
+		// PLDI 2018): the interval of decimals that round to the
+		// value is computed exactly with precomputed powers of five,
+		// and digits are dropped while both ends still differ
+		// ----------------------------------------------------------
+
+		constexpr int32_t DOUBLE_MANTISSA_BITS = 52;
+		constexpr int32_t DOUBLE_EXPONENT_BITS = 11;
+		constexpr int32_t DOUBLE_BIAS = 1023;
+		constexpr int32_t DOUBLE_POW5_INV_BITCOUNT = 125;
+		constexpr int32_t DOUBLE_POW5_BITCOUNT = 125;
+
+		constexpr int32_t FLOAT_MANTISSA_BITS = 23;
+		constexpr int32_t FLOAT_EXPONENT_BITS = 8;
+		constexpr int32_t FLOAT_BIAS = 127;
+		constexpr int32_t FLOAT_POW5_INV_BITCOUNT = 59;
+		constexpr int32_t FLOAT_POW5_BITCOUNT = 61;
+
+		// ceil(log2(5^e)) for e in [1, 3528], 1 for e == 0
+		inline int32_t Pow5Bits(int32_t e) noexcept
+		{
+			return (int32_t)(((uint32_t)e * 1217359u) >> 19) + 1;
+		}
+
+		// floor(log10(2^e)) for e in [0, 1650]
+		inline uint32_t Log10Pow2(int32_t e) noexcept
+		{
+			return ((uint32_t)e * 78913u) >> 18;
+		}
+
+		// floor(log10(5^e)) for e in [0, 2620]
+		inline uint32_t Log10Pow5(int32_t e) noexcept
+		{
+			return ((uint32_t)e * 732923u) >> 20;
+		}
+
+		inline uint32_t Pow5Factor(uint64_t v) noexcept
+		{
+			uint32_t count = 0;
+			while (v % 5 == 0)
+			{
+				v /= 5;
+				++count;
+			}
+			return count;
+		}
+
+		inline bool MultipleOfPowerOf5(uint64_t v, uint32_t p) noexcept
+		{
+			return Pow5Factor(v) >= p;
+		}
+
+		inline bool MultipleOfPowerOf2(uint64_t v, uint32_t p) noexcept
+		{
+			return (v & ((1ull << p) - 1)) == 0;
+		}
+
+		// (m * (hi:lo)) >> j, for j in [64, 128)
+		inline uint64_t MulShift64(uint64_t m, const uint64_t* mul, int32_t j) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 b0 = (unsigned __int128)m * mul[0];
+			const unsigned __int128 b2 = (unsigned __int128)m * mul[1];
+			return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+#else
+			uint64_t high0, high2;
+#if defined(PHOENIX_NUMBERFORMAT_UMUL128)
+			_umul128(m, mul[0], &high0);
+			const uint64_t low2 = _umul128(m, mul[1], &high2);
+#else
+			const uint64_t mLo = (uint32_t)m, mHi = m >> 32;
+			auto mul64 = [&](uint64_t b, uint64_t& high) noexcept -> uint64_t
+			{
+				const uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+				const uint64_t ll = mLo * bLo, lh = mLo * bHi, hl = mHi * bLo, hh = mHi * bHi;
+				const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+				high = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+				return (mid << 32) | (uint32_t)ll;
+			};
+			mul64(mul[0], high0);
+			const uint64_t low2 = mul64(mul[1], high2);
+#endif
+			const uint64_t sum = high0 + low2;
+			if (sum < high0)
+				++high2;
+			const uint32_t dist = (uint32_t)(j - 64);
+			return (high2 << (64 - dist)) | (sum >> dist);
+#endif
+		}
+
+		inline uint32_t MulShift32(uint32_t m, uint64_t factor, int32_t shift) noexcept
+		{
+			const uint64_t bits0 = (uint64_t)m * (uint32_t)factor;
+			const uint64_t bits1 = (uint64_t)m * (factor >> 32);
+			return (uint32_t)(((bits0 >> 32) + bits1) >> (shift - 32));
+		}
+
+		struct Decimal
+		{
+			uint64_t Digits;    // no trailing zeros beyond the shortest
+			int32_t Exponent;   // value = Digits * 10^Exponent
+		};
+
+		Decimal ShortestDouble(uint64_t ieeeMantissa, uint32_t ieeeExponent) noexcept
+		{
+			int32_t e2;
+			uint64_t m2;
+			if (ieeeExponent == 0)
+			{
+				e2 = 1 - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+				m2 = ieeeMantissa;
+			}
+			else
+			{
+				e2 = (int32_t)ieeeExponent - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+				m2 = (1ull << DOUBLE_MANTISSA_BITS) | ieeeMantissa;
+			}
+			const bool acceptBounds = (m2 & 1) == 0;
+
+			// the value and its two neighbours' halfway points, times 4
+			const uint64_t mv = 4 * m2;
+			const uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+
+			uint64_t vr, vp, vm;
+			int32_t e10;
+			bool vmIsTrailingZeros = false;
+			bool vrIsTrailingZeros = false;
+			if (e2 >= 0)
+			{
+				const uint32_t q = Log10Pow2(e2) - (e2 > 3);
+				e10 = (int32_t)q;
+				const int32_t k = DOUBLE_POW5_INV_BITCOUNT + Pow5Bits((int32_t)q) - 1;
+				const int32_t i = -e2 + (int32_t)q + k;
+				vr = MulShift64(4 * m2, DOUBLE_POW5_INV_SPLIT[q], i);
+				vp = MulShift64(4 * m2 + 2, DOUBLE_POW5_INV_SPLIT[q], i);
+				vm = MulShift64(4 * m2 - 1 - mmShift, DOUBLE_POW5_INV_SPLIT[q], i);
+				if (q <= 21)
+				{
+					// only one of mp, mv and mm can be a multiple of 5
+					if (mv % 5 == 0)
+						vrIsTrailingZeros = MultipleOfPowerOf5(mv, q);
+					else if (acceptBounds)
+						vmIsTrailingZeros = MultipleOfPowerOf5(mv - 1 - mmShift, q);
+					else
+						vp -= MultipleOfPowerOf5(mv + 2, q);
+				}
+			}
+			else
+			{
+				const uint32_t q = Log10Pow5(-e2) - (-e2 > 1);
+				e10 = (int32_t)q + e2;
+				const int32_t i = -e2 - (int32_t)q;
+				const int32_t k = Pow5Bits(i) - DOUBLE_POW5_BITCOUNT;
+				const int32_t j = (int32_t)q - k;
+				vr = MulShift64(4 * m2, DOUBLE_POW5_SPLIT[i], j);
+				vp = MulShift64(4 * m2 + 2, DOUBLE_POW5_SPLIT[i], j);
+				vm = MulShift64(4 * m2 - 1 - mmShift, DOUBLE_POW5_SPLIT[i], j);
+				if (q <= 1)
+				{
+					// mv has at least q trailing zero bits, so vr has q trailing decimal zeros
+					vrIsTrailingZeros = true;
+					if (acceptBounds)
+						vmIsTrailingZeros = mmShift == 1;
+					else
+						--vp;
+				}
+				else if (q < 63)
+				{
+					vrIsTrailingZeros = MultipleOfPowerOf2(mv, q);
+				}
+			}
+
+			int32_t removed = 0;
+			uint32_t lastRemovedDigit = 0;
+			uint64_t output;
+			if (vmIsTrailingZeros || vrIsTrailingZeros)
+			{
+				// rare: exact ties need every removed digit
+				while (vp / 10 > vm / 10)
+				{
+					vmIsTrailingZeros &= vm % 10 == 0;
+					vrIsTrailingZeros &= lastRemovedDigit == 0;
+					lastRemovedDigit = (uint32_t)(vr % 10);
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				if (vmIsTrailingZeros)
+				{
+					while (vm % 10 == 0)
+					{
+						vrIsTrailingZeros &= lastRemovedDigit == 0;
+						lastRemovedDigit = (uint32_t)(vr % 10);
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+				}
+				// exactly halfway: round to even
+				if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+					lastRemovedDigit = 4;
+				output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+			}
+			else
+			{
+				// common: only the last removed digit matters
+				bool roundUp = false;
+				if (vp / 100 > vm / 100)
+				{
+					roundUp = vr % 100 >= 50;
+					vr /= 100;
+					vp /= 100;
+					vm /= 100;
+					removed += 2;
+				}
+				while (vp / 10 > vm / 10)
+				{
+					roundUp = vr % 10 >= 5;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				output = vr + (vr == vm || roundUp);
+			}
+
+			return Decimal{ output, e10 + removed };
+		}
+
+		Decimal ShortestFloat(uint32_t ieeeMantissa, uint32_t ieeeExponent) noexcept
+		{
+			int32_t e2;
+			uint32_t m2;
+			if (ieeeExponent == 0)
+			{
+				e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+				m2 = ieeeMantissa;
+			}
+			else
+			{
+				e2 = (int32_t)ieeeExponent - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+				m2 = (1u << FLOAT_MANTISSA_BITS) | ieeeMantissa;
+			}
+			const bool acceptBounds = (m2 & 1) == 0;
+
+			const uint32_t mv = 4 * m2;
+			const uint32_t mp = 4 * m2 + 2;
+			const uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+			const uint32_t mm = 4 * m2 - 1 - mmShift;
+
+			uint32_t vr, vp, vm;
+			int32_t e10;
+			bool vmIsTrailingZeros = false;
+			bool vrIsTrailingZeros = false;
+			uint32_t lastRemovedDigit = 0;
+			if (e2 >= 0)
+			{
+				const uint32_t q = Log10Pow2(e2);
+				e10 = (int32_t)q;
+				const int32_t k = FLOAT_POW5_INV_BITCOUNT + Pow5Bits((int32_t)q) - 1;
+				const int32_t i = -e2 + (int32_t)q + k;
+				vr = MulShift32(mv, FLOAT_POW5_INV_SPLIT[q], i);
+				vp = MulShift32(mp, FLOAT_POW5_INV_SPLIT[q], i);
+				vm = MulShift32(mm, FLOAT_POW5_INV_SPLIT[q], i);
+				if (q != 0 && (vp - 1) / 10 <= vm / 10)
+				{
+					// the loop below removes nothing: compute the digit it would have
+					const int32_t l = FLOAT_POW5_INV_BITCOUNT + Pow5Bits((int32_t)(q - 1)) - 1;
+					lastRemovedDigit = MulShift32(mv, FLOAT_POW5_INV_SPLIT[q - 1], -e2 + (int32_t)q - 1 + l) % 10;
+				}
+				if (q <= 9)
+				{
+					if (mv % 5 == 0)
+						vrIsTrailingZeros = MultipleOfPowerOf5(mv, q);
+					else if (acceptBounds)
+						vmIsTrailingZeros = MultipleOfPowerOf5(mm, q);
+					else
+						vp -= MultipleOfPowerOf5(mp, q);
+				}
+			}
+			else
+			{
+				const uint32_t q = Log10Pow5(-e2);
+				e10 = (int32_t)q + e2;
+				const int32_t i = -e2 - (int32_t)q;
+				const int32_t k = Pow5Bits(i) - FLOAT_POW5_BITCOUNT;
+				int32_t j = (int32_t)q - k;
+				vr = MulShift32(mv, FLOAT_POW5_SPLIT[i], j);
+				vp = MulShift32(mp, FLOAT_POW5_SPLIT[i], j);
+				vm = MulShift32(mm, FLOAT_POW5_SPLIT[i], j);
+				if (q != 0 && (vp - 1) / 10 <= vm / 10)
+				{
+					j = (int32_t)q - 1 - (Pow5Bits(i + 1) - FLOAT_POW5_BITCOUNT);
+					lastRemovedDigit = MulShift32(mv, FLOAT_POW5_SPLIT[i + 1], j) % 10;
+				}
+				if (q <= 1)
+				{
+					vrIsTrailingZeros = true;
+					if (acceptBounds)
+						vmIsTrailingZeros = mmShift == 1;
+					else
+						--vp;
+				}
+				else if (q < 31)
+				{
+					vrIsTrailingZeros = MultipleOfPowerOf2(mv, q - 1);
+				}
+			}
+
+			int32_t removed = 0;
+			uint32_t output;
+			if (vmIsTrailingZeros || vrIsTrailingZeros)
+			{
+				while (vp / 10 > vm / 10)
+				{
+					vmIsTrailingZeros &= vm % 10 == 0;
+					vrIsTrailingZeros &= lastRemovedDigit == 0;
+					lastRemovedDigit = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				if (vmIsTrailingZeros)
+				{
+					while (vm % 10 == 0)
+					{
+						vrIsTrailingZeros &= lastRemovedDigit == 0;
+						lastRemovedDigit = vr % 10;
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+				}
+				if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+					lastRemovedDigit = 4;
+				output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+			}
+			else
+			{
+				while (vp / 10 > vm / 10)
+				{
+					lastRemovedDigit = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				output = vr + (vr == vm || lastRemovedDigit >= 5);
+			}
+
+			return Decimal{ output, e10 + removed };
+		}
+
+		// Lays out the digits: fixed while the exponent of the first
+		// digit is in [-5, 15), d.dddE+XX otherwise
+		uint32_t Layout(char* out, bool negative, Decimal d) noexcept
+		{
+			char* const start = out;
+			if (negative)
+				*out++ = '-';
+
+			const uint32_t count = DigitCount(d.Digits);
+			const int32_t sciExp = d.Exponent + (int32_t)count - 1;
+
+			if (sciExp >= -5 && sciExp < 15)
+			{
+				if (d.Exponent >= 0)
+				{
+					// 1500: the digits, then zeros
+					WriteDigits(out, d.Digits, count);
+					out += count;
+					for (int32_t i = 0; i < d.Exponent; ++i)
+						*out++ = '0';
+				}
+				else if (sciExp >= 0)
+				{
+					// 12.5: the point inside the digits
+					const uint32_t whole = (uint32_t)sciExp + 1;
+					WriteDigits(out + 1, d.Digits, count);
+					for (uint32_t i = 0; i < whole; ++i)
+						out[i] = out[i + 1];
+					out[whole] = '.';
+					out += count + 1;
+				}
+				else
+				{
+					// 0.00125: zeros, then the digits
+					*out++ = '0';
+					*out++ = '.';
+					for (int32_t i = -1; i > sciExp; --i)
+						*out++ = '0';
+					WriteDigits(out, d.Digits, count);
+					out += count;
+				}
+			}
+			else
+			{
+				WriteDigits(out + 1, d.Digits, count);
+				out[0] = out[1];
+				if (count > 1)
+				{
+					out[1] = '.';
+					out += count + 1;
+				}
+				else
+				{
+					out += 1;
+				}
+
+				*out++ = 'E';
+				uint32_t e;
+				if (sciExp < 0)
+				{
+					*out++ = '-';
+					e = (uint32_t)-sciExp;
+				}
+				else
+				{
+					*out++ = '+';
+					e = (uint32_t)sciExp;
+				}
+				// at least two exponent digits: E+07
+				if (e < 10)
+					*out++ = '0';
+				const uint32_t digits = DigitCount(e);
+				WriteDigits(out, e, digits);
+				out += digits;
+			}
+
+			return (uint32_t)(out - start);
+		}
+
+		uint32_t Special(char* out, bool negative, bool nan, bool zero) noexcept
+		{
+			const char* text = nan ? "NaN" : zero ? (negative ? "-0" : "0") : (negative ? "-Infinity" : "Infinity");
+			uint32_t n = 0;
+			while (text[n])
+			{
+				out[n] = text[n];
+				++n;
+			}
+			return n;
+		}
+	}
+
+	Boolean TryFormat(int32_t value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		// 0 - (unsigned) keeps INT32_MIN defined
+		const bool negative = value < 0;
+		const uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+		return FormatUnsigned(magnitude, negative, dst, capacity, written);
+	}
+
+	Boolean TryFormat(uint32_t value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		return FormatUnsigned(value, false, dst, capacity, written);
+	}
+
+	Boolean TryFormat(int64_t value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		const bool negative = value < 0;
+		const uint64_t magnitude = negative ? 0ull - (uint64_t)value : (uint64_t)value;
+		return FormatUnsigned(magnitude, negative, dst, capacity, written);
+	}
+
+	Boolean TryFormat(uint64_t value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		return FormatUnsigned(value, false, dst, capacity, written);
+	}
+
+	Boolean TryFormat(float value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		const uint32_t bits = BitsOf<uint32_t>(value);
+
+		const bool negative = (bits >> 31) != 0;
+		const uint32_t ieeeMantissa = bits & ((1u << FLOAT_MANTISSA_BITS) - 1);
+		const uint32_t ieeeExponent = (bits >> FLOAT_MANTISSA_BITS) & ((1u << FLOAT_EXPONENT_BITS) - 1);
+
+		char text[MaxSingleChars];
+		uint32_t n;
+		if (ieeeExponent == ((1u << FLOAT_EXPONENT_BITS) - 1) || (ieeeExponent == 0 && ieeeMantissa == 0))
+			n = Special(text, negative, ieeeExponent != 0 && ieeeMantissa != 0, ieeeExponent == 0);
+		else
+			n = Layout(text, negative, ShortestFloat(ieeeMantissa, ieeeExponent));
+
+		return Emit(text, n, dst, capacity, written);
+	}
+
+	Boolean TryFormat(double value, Char* dst, u32 capacity, u32& written) noexcept
+	{
+		const uint64_t bits = BitsOf<uint64_t>(value);
+
+		const bool negative = (bits >> 63) != 0;
+		const uint64_t ieeeMantissa = bits & ((1ull << DOUBLE_MANTISSA_BITS) - 1);
+		const uint32_t ieeeExponent = (uint32_t)(bits >> DOUBLE_MANTISSA_BITS) & ((1u << DOUBLE_EXPONENT_BITS) - 1);
+
+		char text[MaxDoubleChars];
+		uint32_t n;
+		if (ieeeExponent == ((1u << DOUBLE_EXPONENT_BITS) - 1) || (ieeeExponent == 0 && ieeeMantissa == 0))
+			n = Special(text, negative, ieeeExponent != 0 && ieeeMantissa != 0, ieeeExponent == 0);
+		else
+			n = Layout(text, negative, ShortestDouble(ieeeMantissa, ieeeExponent));
+
+		return Emit(text, n, dst, capacity, written);
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "System/Types.hpp"
+
+// ==============================================================
+//  NumberFormat - numbers to text, without snprintf
+//  - Integers: two digits per step from a table of the pairs
+//    "00".."99", written back to front once the digit count is
+//    known
+//  - Floating point: the shortest digits that read back as the
+//    same value (Ryu, Adams 2018): 0.1 is "0.1", not the %.17g
+//    "0.10000000000000001", and unlike %g nothing is lost
+//  - Floating point text is fixed notation while the decimal
+//    exponent is in [-5, 15), scientific ("1.5E+20", "1E-07")
+//    outside it. NaN, Infinity and -Infinity are spelled out, and
+//    the sign of -0 is kept
+//  - TryFormat writes into a caller buffer (a stack array, the
+//    free room of a StringBuilder): no allocation, no locale, no
+//    terminator. False, with nothing written, if the text does not
+//    fit in capacity; Max*Chars always does
+// ==============================================================
+
+namespace NumberFormat
+{
+	constexpr u32 MaxInt32Chars = 11;     // -2147483648
+	constexpr u32 MaxUInt32Chars = 10;    // 4294967295
+	constexpr u32 MaxInt64Chars = 20;     // -9223372036854775808
+	constexpr u32 MaxUInt64Chars = 20;    // 18446744073709551615
+	constexpr u32 MaxSingleChars = 16;    // -0.0000123456789
+	constexpr u32 MaxDoubleChars = 24;    // -0.000012345678901234567
+
+	// Enough for any value of any type
+	constexpr u32 MaxChars = 24;
+
+	Boolean TryFormat(int32_t value, Char* dst, u32 capacity, u32& written) noexcept;
+	Boolean TryFormat(uint32_t value, Char* dst, u32 capacity, u32& written) noexcept;
+	Boolean TryFormat(int64_t value, Char* dst, u32 capacity, u32& written) noexcept;
+	Boolean TryFormat(uint64_t value, Char* dst, u32 capacity, u32& written) noexcept;
+	Boolean TryFormat(float value, Char* dst, u32 capacity, u32& written) noexcept;
+	Boolean TryFormat(double value, Char* dst, u32 capacity, u32& written) noexcept;
+}
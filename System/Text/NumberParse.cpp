@@ -0,0 +1,686 @@
+#include "NumberParse.hpp"
+#include "NumberParse_tables.hpp"
+#include "System/Exceptions.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace NumberParse
+{
+	namespace
+	{
+		using namespace NumberParseTables;
+
+		inline bool IsWhiteSpace(uint8_t c) noexcept
+		{
+			return c == ' ' || (c >= '\t' && c <= '\r');
+		}
+
+		inline bool IsDigit(uint8_t c) noexcept
+		{
+			return (uint8_t)(c - '0') < 10;
+		}
+
+		inline uint64_t Load64(const uint8_t* p) noexcept
+		{
+			uint64_t v;
+#if defined(_MSC_VER) && !defined(__clang__)
+			v = *(const uint64_t __unaligned*)p;
+#else
+			__builtin_memcpy(&v, p, sizeof(v));
+#endif
+			return v;
+		}
+
+		// ----------------------------------------------------------
+		// Eight digits at a time. The bytes are loaded little-endian,
+		// so the first digit is the lowest byte
+		// ----------------------------------------------------------
+
+		// Every byte is '0'..'9': the high nibble is 3, and adding 6
+		// does not carry out of the low one
+		inline bool IsEightDigits(uint64_t v) noexcept
+		{
+			return ((v & 0xF0F0F0F0F0F0F0F0ull) |
+				(((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+		}
+
+		// Digit pairs, then groups of four, then all eight
+		inline uint32_t EightDigits(uint64_t v) noexcept
+		{
+			constexpr uint64_t Mask = 0x000000FF000000FFull;
+			constexpr uint64_t Mul1 = 0x000F424000000064ull;   // 100 + (1000000 << 32)
+			constexpr uint64_t Mul2 = 0x0000271000000001ull;   // 1 + (10000 << 32)
+			v -= 0x3030303030303030ull;
+			v = (v * 10) + (v >> 8);
+			v = (((v & Mask) * Mul1) + (((v >> 16) & Mask) * Mul2)) >> 32;
+			return (uint32_t)v;
+		}
+
+		inline const uint8_t* SkipDigits(const uint8_t* p, const uint8_t* end) noexcept
+		{
+			while (end - p >= 8 && IsEightDigits(Load64(p)))
+				p += 8;
+			while (p < end && IsDigit(*p))
+				++p;
+			return p;
+		}
+
+		inline const uint8_t* SkipWhiteSpace(const uint8_t* p, const uint8_t* end) noexcept
+		{
+			while (p < end && IsWhiteSpace(*p))
+				++p;
+			return p;
+		}
+
+		// ----------------------------------------------------------
+		// Integers
+		// ----------------------------------------------------------
+
+		// [white][sign]digits[white], as a magnitude no larger than
+		// limit (which depends on the sign)
+		Status ParseInteger(const char* text, u32 length, uint64_t positiveLimit, uint64_t negativeLimit,
+			uint64_t& magnitude, bool& negative) noexcept
+		{
+			const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+			const uint8_t* const end = p + (uint32_t)length;
+
+			p = SkipWhiteSpace(p, end);
+			negative = false;
+			if (p < end && (*p == '-' || *p == '+'))
+			{
+				negative = *p == '-';
+				++p;
+			}
+
+			const uint8_t* digits = p;
+			const uint8_t* const digitsEnd = SkipDigits(p, end);
+			if (digits == digitsEnd || SkipWhiteSpace(digitsEnd, end) != end)
+				return Status::Invalid;
+
+			while (digitsEnd - digits >= 8 && Load64(digits) == 0x3030303030303030ull)
+				digits += 8;
+			while (digits < digitsEnd && *digits == '0')
+				++digits;
+
+			const uint64_t count = (uint64_t)(digitsEnd - digits);
+			if (count > 20)
+				return Status::Overflow;
+
+			// 19 digits always fit in 64 bits; only a twentieth can overflow
+			const uint8_t* const safeEnd = count == 20 ? digitsEnd - 1 : digitsEnd;
+			uint64_t v = 0;
+			while (safeEnd - digits >= 8)
+			{
+				v = v * 100000000u + EightDigits(Load64(digits));
+				digits += 8;
+			}
+			while (digits < safeEnd)
+				v = v * 10 + (uint32_t)(*digits++ - '0');
+
+			if (digits < digitsEnd)
+			{
+				const uint32_t d = (uint32_t)(*digits - '0');
+				if (v > (~0ull - d) / 10)
+					return Status::Overflow;
+				v = v * 10 + d;
+			}
+
+			if (v > (negative ? negativeLimit : positiveLimit))
+				return Status::Overflow;
+
+			magnitude = v;
+			return Status::Ok;
+		}
+
+		template<typename T>
+		inline Status ParseSigned(const char* text, u32 length, T& value) noexcept
+		{
+			constexpr uint64_t Max = (1ull << (sizeof(T) * 8 - 1)) - 1;
+
+			uint64_t magnitude;
+			bool negative;
+			const Status status = ParseInteger(text, length, Max, Max + 1, magnitude, negative);
+			if (status == Status::Ok)
+				value = negative ? (T)(0ull - magnitude) : (T)magnitude;
+			return status;
+		}
+
+		template<typename T>
+		inline Status ParseUnsigned(const char* text, u32 length, T& value) noexcept
+		{
+			constexpr uint64_t Max = sizeof(T) == 8 ? ~0ull : (1ull << (sizeof(T) * 8)) - 1;
+
+			uint64_t magnitude;
+			bool negative;
+			const Status status = ParseInteger(text, length, Max, 0, magnitude, negative);
+			if (status == Status::Ok)
+				value = (T)magnitude;
+			return status;
+		}
+
+		// ----------------------------------------------------------
+		// Floating point
+		// ----------------------------------------------------------
+
+		struct DoubleFormat
+		{
+			using Bits = uint64_t;
+			using Float = double;
+			static constexpr int32_t MantissaBits = 52;
+			static constexpr int32_t MinimumExponent = -1023;
+			static constexpr int32_t InfinitePower = 0x7FF;
+			static constexpr int64_t SmallestPowerOfTen = -342;   // below: 0 for any 19 digits
+			static constexpr int64_t LargestPowerOfTen = 308;     // above: infinity
+			static constexpr int64_t MinExponentRoundToEven = -4;
+			static constexpr int64_t MaxExponentRoundToEven = 23;
+			static constexpr int64_t MaxExactPowerOfTen = 22;     // 10^22 is the largest exact double
+		};
+
+		struct FloatFormat
+		{
+			using Bits = uint32_t;
+			using Float = float;
+			static constexpr int32_t MantissaBits = 23;
+			static constexpr int32_t MinimumExponent = -127;
+			static constexpr int32_t InfinitePower = 0xFF;
+			static constexpr int64_t SmallestPowerOfTen = -64;
+			static constexpr int64_t LargestPowerOfTen = 38;
+			static constexpr int64_t MinExponentRoundToEven = -17;
+			static constexpr int64_t MaxExponentRoundToEven = 10;
+			static constexpr int64_t MaxExactPowerOfTen = 10;
+		};
+
+		constexpr double ExactPowersOfTen[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		constexpr float ExactPowersOfTenF[] = {
+			1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+		};
+
+		inline int32_t LeadingZeros(uint64_t v) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanReverse64(&index, v);
+			return 63 - (int32_t)index;
+#else
+			return __builtin_clzll(v);
+#endif
+		}
+
+		// a * b as high:low
+		inline uint64_t Multiply(uint64_t a, uint64_t b, uint64_t& high) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 r = (unsigned __int128)a * b;
+			high = (uint64_t)(r >> 64);
+			return (uint64_t)r;
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+			return _umul128(a, b, &high);
+#else
+			const uint64_t aLo = (uint32_t)a, aHi = a >> 32;
+			const uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+			const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+			const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+			high = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+			return (mid << 32) | (uint32_t)ll;
+#endif
+		}
+
+		// A binary floating point value as its biased exponent field
+		// and its stored mantissa bits
+		struct Binary
+		{
+			uint64_t Mantissa;
+			int32_t Power2;
+
+			inline bool operator==(const Binary& other) const noexcept
+			{
+				return Mantissa == other.Mantissa && Power2 == other.Power2;
+			}
+		};
+
+		// Eisel-Lemire (Lemire, "Number Parsing at a Gigabyte per
+		// Second", 2021): w * 10^q rounded to the format, from the
+		// high bits of w times a 128-bit 5^q. Exact for any w; the
+		// caller handles a w that dropped digits.
+		template<typename Format>
+		Binary ComputeFloat(int64_t q, uint64_t w) noexcept
+		{
+			if (w == 0 || q < Format::SmallestPowerOfTen)
+				return Binary{ 0, 0 };
+			if (q > Format::LargestPowerOfTen)
+				return Binary{ 0, Format::InfinitePower };
+
+			const int32_t lz = LeadingZeros(w);
+			w <<= lz;
+
+			// the low half of 5^q is only needed when the bits kept
+			// from the high product could still change
+			const uint64_t* pow5 = POW5_128[q - DoubleFormat::SmallestPowerOfTen];
+			constexpr uint64_t PrecisionMask = ~0ull >> (Format::MantissaBits + 3);
+			uint64_t high;
+			uint64_t low = Multiply(w, pow5[0], high);
+			if ((high & PrecisionMask) == PrecisionMask)
+			{
+				uint64_t secondHigh;
+				Multiply(w, pow5[1], secondHigh);
+				low += secondHigh;
+				if (secondHigh > low)
+					++high;
+			}
+
+			const int32_t upperBit = (int32_t)(high >> 63);
+			const int32_t shift = upperBit + 64 - Format::MantissaBits - 3;
+			uint64_t mantissa = high >> shift;
+
+			// floor(log2(10^q)) + 63
+			const int32_t power = (int32_t)(((152170 + 65536) * (int32_t)q) >> 16) + 63;
+			int32_t power2 = power + upperBit - lz - Format::MinimumExponent;
+
+			if (power2 <= 0)
+			{
+				// subnormal
+				if (-power2 + 1 >= 64)
+					return Binary{ 0, 0 };
+				mantissa >>= -power2 + 1;
+				mantissa += mantissa & 1;
+				mantissa >>= 1;
+				power2 = mantissa < (1ull << Format::MantissaBits) ? 0 : 1;
+				return Binary{ mantissa & ((1ull << Format::MantissaBits) - 1), power2 };
+			}
+
+			// exactly halfway: round to even instead of up
+			if (low <= 1 && q >= Format::MinExponentRoundToEven && q <= Format::MaxExponentRoundToEven &&
+				(mantissa & 3) == 1 && (mantissa << shift) == high)
+			{
+				mantissa &= ~1ull;
+			}
+
+			mantissa += mantissa & 1;
+			mantissa >>= 1;
+			if (mantissa >= (2ull << Format::MantissaBits))
+			{
+				mantissa = 1ull << Format::MantissaBits;
+				++power2;
+			}
+			mantissa &= ~(1ull << Format::MantissaBits);
+
+			if (power2 >= Format::InfinitePower)
+				return Binary{ 0, Format::InfinitePower };
+			return Binary{ mantissa, power2 };
+		}
+
+		// The digits of a decimal: the integer part and the fraction
+		// part, value = (int digits, frac digits) * 10^Exponent10
+		struct DecimalText
+		{
+			const uint8_t* IntBegin;
+			const uint8_t* IntEnd;
+			const uint8_t* FracBegin;
+			const uint8_t* FracEnd;
+			int64_t Exponent10;
+		};
+
+		// Unsigned big integer, 32-bit limbs, least significant first.
+		// Only for the inputs Eisel-Lemire leaves undecided
+		class BigInt
+		{
+		public:
+
+			// 800 digits times 5^1125 with room to shift
+			static constexpr uint32_t MaxLimbs = 256;
+
+			void Set(uint64_t v) noexcept
+			{
+				_limbs[0] = (uint32_t)v;
+				_limbs[1] = (uint32_t)(v >> 32);
+				_count = _limbs[1] ? 2 : (_limbs[0] ? 1 : 0);
+			}
+
+			void MulAdd(uint32_t mul, uint32_t add) noexcept
+			{
+				uint64_t carry = add;
+				for (uint32_t i = 0; i < _count; ++i)
+				{
+					const uint64_t v = (uint64_t)_limbs[i] * mul + carry;
+					_limbs[i] = (uint32_t)v;
+					carry = v >> 32;
+				}
+				if (carry != 0 && _count < MaxLimbs)
+					_limbs[_count++] = (uint32_t)carry;
+			}
+
+			void MulPow5(uint64_t e) noexcept
+			{
+				constexpr uint32_t Pow5_13 = 1220703125u;   // the largest power of 5 in 32 bits
+				for (; e >= 13; e -= 13)
+					MulAdd(Pow5_13, 0);
+				uint32_t rest = 1;
+				for (; e != 0; --e)
+					rest *= 5;
+				if (rest != 1)
+					MulAdd(rest, 0);
+			}
+
+			void ShiftLeft(uint64_t bits) noexcept
+			{
+				if (_count == 0)
+					return;
+
+				const uint32_t words = (uint32_t)(bits / 32);
+				const uint32_t rest = (uint32_t)(bits % 32);
+				if (_count + words + 1 > MaxLimbs)
+					return;
+
+				if (rest != 0)
+				{
+					_limbs[_count] = 0;
+					for (uint32_t i = _count; i > 0; --i)
+						_limbs[i] = (_limbs[i] << rest) | (_limbs[i - 1] >> (32 - rest));
+					_limbs[0] <<= rest;
+					if (_limbs[_count] != 0)
+						++_count;
+				}
+				if (words != 0)
+				{
+					for (uint32_t i = _count; i > 0; --i)
+						_limbs[i - 1 + words] = _limbs[i - 1];
+					for (uint32_t i = 0; i < words; ++i)
+						_limbs[i] = 0;
+					_count += words;
+				}
+			}
+
+			int32_t Compare(const BigInt& other) const noexcept
+			{
+				if (_count != other._count)
+					return _count < other._count ? -1 : 1;
+				for (uint32_t i = _count; i > 0; --i)
+				{
+					if (_limbs[i - 1] != other._limbs[i - 1])
+						return _limbs[i - 1] < other._limbs[i - 1] ? -1 : 1;
+				}
+				return 0;
+			}
+
+		private:
+
+			uint32_t _limbs[MaxLimbs + 1];
+			uint32_t _count = 0;
+		};
+
+		// Sign of (the decimal) - (2m + 1) * 2^(e - 1), the point halfway
+		// between m * 2^e and the next value up
+		int32_t CompareWithHalfway(const DecimalText& text, uint64_t m, int32_t e) noexcept
+		{
+			// enough digits to tell any halfway point apart; past them
+			// only whether one is not zero matters
+			constexpr uint32_t MaxDigits = 800;
+
+			BigInt digits;
+			digits.Set(0);
+			uint32_t kept = 0;
+			uint32_t chunk = 0;
+			uint32_t chunkDigits = 0;
+			int64_t dropped = 0;
+			bool sticky = false;
+
+			auto take = [&](const uint8_t* p, const uint8_t* end) noexcept
+			{
+				for (; p < end; ++p)
+				{
+					const uint32_t d = (uint32_t)(*p - '0');
+					if (kept == 0 && d == 0)
+						continue;
+					if (kept == MaxDigits)
+					{
+						sticky |= d != 0;
+						++dropped;
+						continue;
+					}
+					chunk = chunk * 10 + d;
+					++kept;
+					if (++chunkDigits == 9)
+					{
+						digits.MulAdd(1000000000u, chunk);
+						chunk = 0;
+						chunkDigits = 0;
+					}
+				}
+			};
+			take(text.IntBegin, text.IntEnd);
+			take(text.FracBegin, text.FracEnd);
+			if (chunkDigits != 0)
+			{
+				uint32_t scale = 1;
+				for (uint32_t i = 0; i < chunkDigits; ++i)
+					scale *= 10;
+				digits.MulAdd(scale, chunk);
+			}
+
+			// digits * 10^exp10 against halfway * 2^(e - 1): powers of
+			// five on one side, then the two powers of two matched
+			const int64_t exp10 = text.Exponent10 + dropped;
+			BigInt halfway;
+			halfway.Set(2 * m + 1);
+			if (exp10 >= 0)
+				digits.MulPow5((uint64_t)exp10);
+			else
+				halfway.MulPow5((uint64_t)-exp10);
+
+			const int64_t digitsPow2 = exp10;
+			const int64_t halfwayPow2 = (int64_t)e - 1;
+			if (digitsPow2 > halfwayPow2)
+				digits.ShiftLeft((uint64_t)(digitsPow2 - halfwayPow2));
+			else
+				halfway.ShiftLeft((uint64_t)(halfwayPow2 - digitsPow2));
+
+			const int32_t order = digits.Compare(halfway);
+			return order == 0 && sticky ? 1 : order;
+		}
+
+		inline bool EqualsNoCase(const uint8_t* p, const uint8_t* end, const char* word) noexcept
+		{
+			for (; *word; ++word, ++p)
+			{
+				if (p == end || (*p | 0x20) != (uint8_t)*word)
+					return false;
+			}
+			return p == end;
+		}
+
+		template<typename Format>
+		inline typename Format::Float FromBits(typename Format::Bits bits) noexcept
+		{
+			static_assert(sizeof(typename Format::Bits) == sizeof(typename Format::Float));
+#if defined(_MSC_VER) && !defined(__clang__)
+			return *reinterpret_cast<const typename Format::Float*>(&bits);
+#else
+			typename Format::Float value;
+			__builtin_memcpy(&value, &bits, sizeof(value));
+			return value;
+#endif
+		}
+
+		template<typename Format>
+		Status ParseFloat(const char* text, u32 length, typename Format::Float& value) noexcept
+		{
+			using Bits = typename Format::Bits;
+			using Float = typename Format::Float;
+			constexpr Bits SignBit = (Bits)1 << (sizeof(Bits) * 8 - 1);
+
+			const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+			const uint8_t* const end = p + (uint32_t)length;
+
+			p = SkipWhiteSpace(p, end);
+			bool negative = false;
+			if (p < end && (*p == '-' || *p == '+'))
+			{
+				negative = *p == '-';
+				++p;
+			}
+			const Bits sign = negative ? SignBit : 0;
+
+			DecimalText decimal;
+			decimal.IntBegin = p;
+			decimal.IntEnd = p = SkipDigits(p, end);
+			decimal.FracBegin = decimal.FracEnd = p;
+			if (p < end && *p == '.')
+			{
+				decimal.FracBegin = ++p;
+				decimal.FracEnd = p = SkipDigits(p, end);
+			}
+
+			if (decimal.IntBegin == decimal.IntEnd && decimal.FracBegin == decimal.FracEnd)
+			{
+				// no digits: NaN or Infinity, or nothing
+				const uint8_t* word = decimal.IntBegin;
+				const uint8_t* wordEnd = word;
+				while (wordEnd < end && !IsWhiteSpace(*wordEnd))
+					++wordEnd;
+				if (SkipWhiteSpace(wordEnd, end) != end)
+					return Status::Invalid;
+
+				constexpr Bits ExponentMask = (Bits)Format::InfinitePower << Format::MantissaBits;
+				if (EqualsNoCase(word, wordEnd, "nan"))
+					value = FromBits<Format>(sign | ExponentMask | ((Bits)1 << (Format::MantissaBits - 1)));
+				else if (EqualsNoCase(word, wordEnd, "infinity"))
+					value = FromBits<Format>(sign | ExponentMask);
+				else
+					return Status::Invalid;
+				return Status::Ok;
+			}
+
+			int64_t exponent = 0;
+			if (p < end && (*p | 0x20) == 'e')
+			{
+				++p;
+				bool negativeExponent = false;
+				if (p < end && (*p == '-' || *p == '+'))
+				{
+					negativeExponent = *p == '-';
+					++p;
+				}
+				if (p == end || !IsDigit(*p))
+					return Status::Invalid;
+
+				// far past any finite or nonzero value; saturate
+				for (; p < end && IsDigit(*p); ++p)
+				{
+					if (exponent < 0x10000000)
+						exponent = exponent * 10 + (*p - '0');
+				}
+				if (negativeExponent)
+					exponent = -exponent;
+			}
+
+			if (SkipWhiteSpace(p, end) != end)
+				return Status::Invalid;
+
+			decimal.Exponent10 = exponent - (decimal.FracEnd - decimal.FracBegin);
+
+			// the first 19 significant digits; the rest only scale it,
+			// and whether one of them is not zero makes it inexact
+			uint64_t w = 0;
+			uint32_t taken = 0;
+			int64_t dropped = 0;
+			bool truncated = false;
+			auto take = [&](const uint8_t* a, const uint8_t* b) noexcept
+			{
+				if (taken == 0)
+				{
+					while (b - a >= 8 && Load64(a) == 0x3030303030303030ull)
+						a += 8;
+					while (a < b && *a == '0')
+						++a;
+				}
+				while (taken + 8 <= 19 && b - a >= 8)
+				{
+					w = w * 100000000u + EightDigits(Load64(a));
+					a += 8;
+					taken += 8;
+				}
+				while (a < b && taken < 19)
+				{
+					w = w * 10 + (uint32_t)(*a++ - '0');
+					++taken;
+				}
+				dropped += b - a;
+				for (; a < b && !truncated; ++a)
+					truncated = *a != '0';
+			};
+			take(decimal.IntBegin, decimal.IntEnd);
+			take(decimal.FracBegin, decimal.FracEnd);
+
+			const int64_t q = decimal.Exponent10 + dropped;
+
+			if (w == 0)
+			{
+				value = FromBits<Format>(sign);
+				return Status::Ok;
+			}
+
+			// Clinger: w and 10^q both exact, so one rounding
+			if (!truncated && q >= -Format::MaxExactPowerOfTen && q <= Format::MaxExactPowerOfTen &&
+				w <= (1ull << (Format::MantissaBits + 1)))
+			{
+				Float f = (Float)w;
+				if constexpr (sizeof(Float) == sizeof(double))
+					f = q < 0 ? f / ExactPowersOfTen[-q] : f * ExactPowersOfTen[q];
+				else
+					f = q < 0 ? f / ExactPowersOfTenF[-q] : f * ExactPowersOfTenF[q];
+				value = negative ? -f : f;
+				return Status::Ok;
+			}
+
+			Binary result = ComputeFloat<Format>(q, w);
+			if (truncated)
+			{
+				// the value is in [w, w + 1) * 10^q: if both ends round
+				// alike that is the answer, otherwise the halfway point
+				// between the two decides
+				const Binary above = ComputeFloat<Format>(q, w + 1);
+				if (!(above == result))
+				{
+					const uint64_t m = result.Power2 == 0 ? result.Mantissa : result.Mantissa | (1ull << Format::MantissaBits);
+					const int32_t e = (result.Power2 == 0 ? 1 : result.Power2) + Format::MinimumExponent - Format::MantissaBits;
+					const int32_t order = CompareWithHalfway(decimal, m, e);
+					if (order > 0 || (order == 0 && (m & 1) != 0))
+					{
+						// one up; a full mantissa carries into the exponent
+						const Bits bits = (Bits)(result.Mantissa | ((uint64_t)result.Power2 << Format::MantissaBits)) + 1;
+						value = FromBits<Format>(sign | bits);
+						return Status::Ok;
+					}
+				}
+			}
+
+			value = FromBits<Format>(sign | (Bits)(result.Mantissa | ((uint64_t)result.Power2 << Format::MantissaBits)));
+			return Status::Ok;
+		}
+	}
+
+	Status Parse(const char* text, u32 length, int8_t& value) noexcept { return ParseSigned(text, length, value); }
+	Status Parse(const char* text, u32 length, uint8_t& value) noexcept { return ParseUnsigned(text, length, value); }
+	Status Parse(const char* text, u32 length, int16_t& value) noexcept { return ParseSigned(text, length, value); }
+	Status Parse(const char* text, u32 length, uint16_t& value) noexcept { return ParseUnsigned(text, length, value); }
+	Status Parse(const char* text, u32 length, int32_t& value) noexcept { return ParseSigned(text, length, value); }
+	Status Parse(const char* text, u32 length, uint32_t& value) noexcept { return ParseUnsigned(text, length, value); }
+	Status Parse(const char* text, u32 length, int64_t& value) noexcept { return ParseSigned(text, length, value); }
+	Status Parse(const char* text, u32 length, uint64_t& value) noexcept { return ParseUnsigned(text, length, value); }
+	Status Parse(const char* text, u32 length, float& value) noexcept { return ParseFloat<FloatFormat>(text, length, value); }
+	Status Parse(const char* text, u32 length, double& value) noexcept { return ParseFloat<DoubleFormat>(text, length, value); }
+
+	void ThrowIfFailed(Status status)
+	{
+		if (status == Status::Invalid)
+			throw FormatException(String("Input string was not in a correct format."));
+		if (status == Status::Overflow)
+			throw OverflowException(String("Value was either too large or too small for the type."));
+	}
+}
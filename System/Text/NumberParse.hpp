@@ -0,0 +1,47 @@
+#pragma once
+
+#include "System/Types.hpp"
+
+// ==============================================================
+//  NumberParse - text to numbers, straight from bytes
+//  - The whole text is the number: white space (tab..CR, space)
+//    around it, an optional sign, digits. Anything else is
+//    Invalid. Leading zeros are fine
+//  - Digit runs are checked and converted eight at a time: one
+//    64-bit load, three multiplies (SWAR)
+//  - Integers: Overflow when the value is outside the type;
+//    "-0" is zero for unsigned types too
+//  - Floating point: [digits][.digits][e|E[sign]digits], and NaN
+//    and Infinity in any case. Correctly rounded (nearest, ties to
+//    even): short values are one exact multiply or divide, the
+//    rest Eisel-Lemire with a 128-bit power of five, and the rare
+//    input it cannot settle (more than 19 significant digits close
+//    to a halfway point) is compared exactly with big integers.
+//    Out of range becomes +-Infinity or +-0, never Overflow
+//  - No locale: the decimal point is always '.'
+// ==============================================================
+
+namespace NumberParse
+{
+	enum class Status : uint8_t
+	{
+		Ok,
+		Invalid,    // not a number of that kind
+		Overflow    // a number, outside the range of the type
+	};
+
+	Status Parse(const char* text, u32 length, int8_t& value) noexcept;
+	Status Parse(const char* text, u32 length, uint8_t& value) noexcept;
+	Status Parse(const char* text, u32 length, int16_t& value) noexcept;
+	Status Parse(const char* text, u32 length, uint16_t& value) noexcept;
+	Status Parse(const char* text, u32 length, int32_t& value) noexcept;
+	Status Parse(const char* text, u32 length, uint32_t& value) noexcept;
+	Status Parse(const char* text, u32 length, int64_t& value) noexcept;
+	Status Parse(const char* text, u32 length, uint64_t& value) noexcept;
+	Status Parse(const char* text, u32 length, float& value) noexcept;
+	Status Parse(const char* text, u32 length, double& value) noexcept;
+
+	// For the wrappers' Parse: FormatException for Invalid,
+	// OverflowException for Overflow
+	void ThrowIfFailed(Status status);
+}
@@ -2,6 +2,11 @@
 
 #include "System/Text/UTF8.hpp"
 #include "System/String.hpp"
+#include "System/Arena.hpp"
+#include "System/Text/NumberFormat.hpp"
+
+#include <cstdarg>
+#include <cstdio>
 
 StringBuilder::StringBuilder() noexcept
 {
@@ -10,22 +15,79 @@ StringBuilder::StringBuilder() noexcept
 
 StringBuilder::StringBuilder(size_type capacity) noexcept
 {
-	_buffer.Reserve(capacity);
+	_buffer.reserve(capacity);
+}
+
+StringBuilder::StringBuilder(StringBuilderMode mode, size_type chunkSize) noexcept
+{
+	if (mode == StringBuilderMode::Chunked)
+		_chunkSize = chunkSize != 0 ? chunkSize : DefaultChunkSize;
+}
+
+StringBuilder::StringBuilder(Memory::Arena& arena, size_type chunkSize) noexcept
+	: _arena(&arena), _chunkSize(chunkSize != 0 ? chunkSize : DefaultChunkSize)
+{
+
+}
+
+StringBuilder::StringBuilder(const StringBuilder& other) noexcept
+{
+	copy_from(other);
+}
+
+StringBuilder::StringBuilder(StringBuilder&& other) noexcept
+{
+	move_from(other);
+}
+
+StringBuilder& StringBuilder::operator=(const StringBuilder& other) noexcept
+{
+	if (this != &other)
+	{
+		free_chunks();
+		copy_from(other);
+	}
+	return *this;
+}
+
+StringBuilder& StringBuilder::operator=(StringBuilder&& other) noexcept
+{
+	if (this != &other)
+	{
+		free_chunks();
+		move_from(other);
+	}
+	return *this;
+}
+
+StringBuilder::~StringBuilder() noexcept
+{
+	free_chunks();
 }
 
 void StringBuilder::Clear() noexcept
 {
-	_buffer.FastClear();
+	if (_chunkSize == 0)
+	{
+		_buffer.clear_keep_capacity();
+		return;
+	}
+
+	for (Chunk* c = _head; c; c = c->next)
+		c->used = 0;
+	_tail = _head;
+	_length = 0;
 }
 
 void StringBuilder::Reserve(size_type capacity) noexcept
 {
-	_buffer.Reserve(capacity);
+	if (_chunkSize == 0)
+		_buffer.reserve(capacity);
 }
 
 StringBuilder& StringBuilder::Append(Char c) noexcept
 {
-	_buffer.Add(c);
+	append(&c, 1);
 	return *this;
 }
 
@@ -35,8 +97,7 @@ StringBuilder& StringBuilder::Append(CodePoint cp) noexcept
 		return *this;
 
 	UTF8::UTF8EncodeResult enc = UTF8::encode_utf8(cp);
-	for (auto i = 0; i < enc.Length; ++i)
-		_buffer.Add(Char(enc.Bytes[i]));
+	append(enc.Bytes, (uint32_t)enc.Length);
 
 	return *this;
 }
@@ -46,25 +107,17 @@ StringBuilder& StringBuilder::Append(const char* cstr) noexcept
 	if (!cstr)
 		return *this;
 
-	while (*cstr)
-	{
-		_buffer.Add(Char(static_cast<unsigned char>(*cstr)));
-		++cstr;
-	}
+	uint32_t len = 0;
+	while (cstr[len])
+		++len;
+
+	append(reinterpret_cast<const Char*>(cstr), len);
 	return *this;
 }
 
 StringBuilder& StringBuilder::Append(const String& s) noexcept
 {
-	UInt32 len = s.GetByteCount();
-	if (len == 0)
-		return *this;
-
-	const Char* p = static_cast<const Char*>(s);
-
-	_buffer.EnsureCapacity(_buffer.Count() + len);
-	_buffer.AddRange(p, len);
-
+	append(s.data(), s._byteLength);
 	return *this;
 }
 
@@ -73,38 +126,276 @@ StringBuilder& StringBuilder::Append(const unsigned char* bytes, size_type len)
 	if (!bytes || len == 0)
 		return *this;
 
-	_buffer.EnsureCapacity(_buffer.Count() + len);
-
-	for (size_t i = 0; i < len; ++i)
-		_buffer.Add(Char(bytes[i]));
-
+	append(reinterpret_cast<const Char*>(bytes), len);
 	return *this;
 }
 
 StringBuilder& StringBuilder::AppendLine() noexcept
 {
-	_buffer.Add(Char('\n'));
-	return *this;
+	return Append(Char('\n'));
 }
 
 StringBuilder& StringBuilder::AppendLine(const String& s) noexcept
 {
 	Append(s);
-	_buffer.Add(Char('\n'));
-	return *this;
+	return Append(Char('\n'));
 }
 
 StringBuilder& StringBuilder::AppendLine(const char* cstr) noexcept
 {
 	Append(cstr);
-	_buffer.Add(Char('\n'));
+	return Append(Char('\n'));
+}
+
+StringBuilder& StringBuilder::AppendFormatted(int64_t value) noexcept
+{
+	append_number(value);
+	return *this;
+}
+
+StringBuilder& StringBuilder::AppendFormatted(uint64_t value) noexcept
+{
+	append_number(value);
+	return *this;
+}
+
+StringBuilder& StringBuilder::AppendFormatted(float value) noexcept
+{
+	append_number(value);
+	return *this;
+}
+
+StringBuilder& StringBuilder::AppendFormatted(double value) noexcept
+{
+	append_number(value);
+	return *this;
+}
+
+// Formats on the stack; only text longer than the stack buffer is
+// formatted a second time, into a heap buffer of the size the first
+// pass reported
+StringBuilder& StringBuilder::AppendFormatted(const char* format, ...) noexcept
+{
+	if (!format)
+		return *this;
+
+	char buf[256];
+
+	va_list args;
+	va_start(args, format);
+	va_list again;
+	va_copy(again, args);
+	const int n = vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+
+	if (n >= 0 && n < (int)sizeof(buf))
+		append(reinterpret_cast<const Char*>(buf), (size_type)n);
+	else if (n > 0)
+	{
+		char* big = new char[(size_t)n + 1];
+		vsnprintf(big, (size_t)n + 1, format, again);
+		append(reinterpret_cast<const Char*>(big), (size_type)n);
+		delete[] big;
+	}
+
+	va_end(again);
 	return *this;
 }
 
+UInt64 StringBuilder::WriteTo(Stream& stream) const noexcept
+{
+	if (_chunkSize == 0)
+	{
+		const uint64_t length = _buffer.GetByteCount();
+		const Byte* bytes = reinterpret_cast<const Byte*>(_buffer.data());
+
+		uint64_t written = 0;
+		while (written < length)
+		{
+			const uint64_t n = stream.Write(bytes + written, length - written);
+			if (n == 0)
+				break;
+			written += n;
+		}
+		return written;
+	}
+
+	// a batch of chunks per call, the same pieces the builder holds; a
+	// short write resumes part way through a chunk
+	constexpr uint32_t Batch = 64;
+	Stream::Segment segments[Batch];
+
+	uint64_t written = 0;
+	const Chunk* c = _head;
+	uint64_t skip = 0;      // bytes of c already written
+	while (c && c->used != 0)
+	{
+		uint32_t n = 0;
+		for (const Chunk* k = c; k && k->used != 0 && n < Batch; k = k->next, ++n)
+		{
+			const uint64_t from = k == c ? skip : 0;
+			segments[n] = Stream::Segment{ reinterpret_cast<const Byte*>(k->data() + from), k->used - from };
+		}
+
+		uint64_t w = stream.WriteSegments(segments, n);
+		if (w == 0)
+			break;
+		written += w;
+
+		while (c && c->used != 0 && w >= c->used - skip)
+		{
+			w -= c->used - skip;
+			skip = 0;
+			c = c->next;
+		}
+		skip += w;
+	}
+	return written;
+}
+
+// Contiguous: short text goes inline; anything longer is the builder's
+// own block, spare room included. Chunked: one copy into a block of the
+// exact size.
 String StringBuilder::ToString() const noexcept
 {
-	if (_buffer.IsEmpty())
+	if (IsEmpty())
 		return String::Empty();
 
-	return String(_buffer.Data(), _buffer.Count());
+	if (_chunkSize != 0)
+	{
+		String out;
+		out.reserve(_length);
+		for (const Chunk* c = _head; c && c->used != 0; c = c->next)
+			out.append(c->data(), c->used);
+		return out;
+	}
+
+	if (_buffer._byteLength <= String::SSO_CAPACITY)
+		return String(_buffer.data(), _buffer._byteLength);
+
+	return _buffer;
+}
+
+// Fills the chunk being written, then moves on to the next one; text is
+// never moved once written
+void StringBuilder::append_chunked(const Char* bytes, size_type len) noexcept
+{
+	while (len != 0)
+	{
+		if ((!_tail || _tail->used == _tail->capacity) && !next_chunk())
+			return;
+
+		size_type n = _tail->capacity - _tail->used;
+		if (n > len)
+			n = len;
+
+		Memory::Copy(Pointer(_tail->data() + _tail->used), Pointer(bytes), n);
+		_tail->used += n;
+		_length += n;
+		bytes += n;
+		len -= n;
+	}
+}
+
+// Digits go straight into the room after the text; only when there is
+// too little (the block must grow anyway, or the number straddles two
+// chunks) are they formatted on the stack and appended
+template<typename T>
+void StringBuilder::append_number(T value) noexcept
+{
+	u32 written = 0u;
+	if (_chunkSize == 0)
+	{
+		uint32_t room;
+		Char* end = _buffer.spare_room(room);
+		if (end && NumberFormat::TryFormat(value, end, room, written))
+		{
+			_buffer.commit_ascii(written);
+			return;
+		}
+	}
+	else if (_tail && NumberFormat::TryFormat(value, _tail->data() + _tail->used, (u32)(_tail->capacity - _tail->used), written))
+	{
+		_tail->used += (uint32_t)written;
+		_length += (uint32_t)written;
+		return;
+	}
+
+	Char buf[NumberFormat::MaxChars];
+	NumberFormat::TryFormat(value, buf, NumberFormat::MaxChars, written);
+	append(buf, (uint32_t)written);
+}
+
+// The empty chunk after the tail (left by Clear), or a new one
+bool StringBuilder::next_chunk() noexcept
+{
+	if (_tail && _tail->next)
+	{
+		_tail = _tail->next;
+		return true;
+	}
+
+	const uint64_t size = sizeof(Chunk) + (uint64_t)_chunkSize;
+	void* memory = _arena
+		? _arena->Allocate(size, alignof(Chunk)).Get()
+		: static_cast<void*>(new unsigned char[size]);
+	if (!memory)
+		return false;
+
+	Chunk* chunk = static_cast<Chunk*>(memory);
+	chunk->next = nullptr;
+	chunk->used = 0;
+	chunk->capacity = _chunkSize;
+
+	if (_tail)
+		_tail->next = chunk;
+	else
+		_head = chunk;
+	_tail = chunk;
+	return true;
+}
+
+// Arena chunks are left to the arena
+void StringBuilder::free_chunks() noexcept
+{
+	if (!_arena)
+	{
+		Chunk* c = _head;
+		while (c)
+		{
+			Chunk* next = c->next;
+			delete[] reinterpret_cast<unsigned char*>(c);
+			c = next;
+		}
+	}
+
+	_head = nullptr;
+	_tail = nullptr;
+	_length = 0;
+}
+
+// A copy has the same mode and arena; a contiguous one shares the block
+// until either side appends
+void StringBuilder::copy_from(const StringBuilder& other) noexcept
+{
+	_buffer = other._buffer;
+	_arena = other._arena;
+	_chunkSize = other._chunkSize;
+
+	for (const Chunk* c = other._head; c && c->used != 0; c = c->next)
+		append_chunked(c->data(), c->used);
+}
+
+void StringBuilder::move_from(StringBuilder& other) noexcept
+{
+	_buffer = static_cast<String&&>(other._buffer);
+	_head = other._head;
+	_tail = other._tail;
+	_arena = other._arena;
+	_chunkSize = other._chunkSize;
+	_length = other._length;
+
+	other._head = nullptr;
+	other._tail = nullptr;
+	other._length = 0;
 }
\ No newline at end of file
@@ -1,21 +1,53 @@
 #pragma once
 
 #include "System/Types.hpp"
-#include "System/Collections/List.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/IO/Stream.hpp"
+
+namespace Memory { class Arena; }
+
+enum class StringBuilderMode : uint8_t
+{
+	// One String block with room to grow: ToString shares that block
+	// instead of copying it, and the next append after it moves to a new
+	// block (the String handed out never changes).
+	Contiguous,
+
+	// A list of fixed size chunks, from the heap or an arena: growing never
+	// copies what is written, WriteTo streams the chunks as they are, and
+	// only ToString puts the text in one block.
+	Chunked
+};
 
 class StringBuilder : public Object<StringBuilder>
 {
 public:
 	using size_type = u32;
 
+	static constexpr size_type DefaultChunkSize = 64 * 1024;
+
 	StringBuilder() noexcept;
 	explicit StringBuilder(size_type capacity) noexcept;
+	explicit StringBuilder(StringBuilderMode mode, size_type chunkSize = DefaultChunkSize) noexcept;
+
+	// Chunked, with the chunks taken from arena; they go back to it when
+	// the arena is reset, not when the builder is destroyed
+	explicit StringBuilder(Memory::Arena& arena, size_type chunkSize = DefaultChunkSize) noexcept;
 
+	StringBuilder(const StringBuilder& other) noexcept;
+	StringBuilder(StringBuilder&& other) noexcept;
+	StringBuilder& operator=(const StringBuilder& other) noexcept;
+	StringBuilder& operator=(StringBuilder&& other) noexcept;
+	~StringBuilder() noexcept;
+
+	// Empties the builder, keeping its block or chunks for reuse
 	void Clear() noexcept;
+	// Contiguous only; a chunked builder takes a chunk at a time
 	void Reserve(size_type capacity) noexcept;
 
-	inline size_type GetByteCount() const noexcept { return _buffer.Count(); }
-	inline Boolean IsEmpty() const noexcept { return _buffer.IsEmpty(); }
+	inline StringBuilderMode GetMode() const noexcept { return _chunkSize != 0 ? StringBuilderMode::Chunked : StringBuilderMode::Contiguous; }
+	inline size_type GetByteCount() const noexcept { return _chunkSize != 0 ? _length : (size_type)_buffer.GetByteCount(); }
+	inline Boolean IsEmpty() const noexcept { return GetByteCount() == 0; }
 
 	StringBuilder& Append(Char c) noexcept;
 	StringBuilder& Append(CodePoint cp) noexcept;
@@ -26,6 +58,36 @@ public:
 	StringBuilder& AppendLine(const String& s) noexcept;
 	StringBuilder& AppendLine(const char* cstr) noexcept;
 
+	// Numbers formatted straight into the builder's free room, no String
+	// in between; the text is NumberFormat's (shortest round trip for
+	// floating point)
+	StringBuilder& AppendFormatted(int64_t value) noexcept;
+	StringBuilder& AppendFormatted(uint64_t value) noexcept;
+	StringBuilder& AppendFormatted(double value) noexcept;
+
+	template<typename T>
+	inline enable_if_t<is_integral_v<T> && is_signed_v<T>, StringBuilder&> AppendFormatted(T value) noexcept
+	{
+		return AppendFormatted(static_cast<int64_t>(value));
+	}
+
+	template<typename T>
+	inline enable_if_t<is_unsigned_v<T>, StringBuilder&> AppendFormatted(T value) noexcept
+	{
+		return AppendFormatted(static_cast<uint64_t>(value));
+	}
+
+	StringBuilder& AppendFormatted(float value) noexcept;
+
+	// printf style format
+	StringBuilder& AppendFormatted(const char* format, ...) noexcept;
+
+	// Writes the text to stream as it is held: one write for a contiguous
+	// builder, gather writes over the chunks of a chunked one. Short writes
+	// are resumed; returns the number of bytes written, GetByteCount()
+	// unless the stream stopped taking any.
+	UInt64 WriteTo(Stream& stream) const noexcept;
+
 	String ToString() const noexcept;
 
 	friend inline StringBuilder& operator<<(StringBuilder& sb, const String& s) noexcept
@@ -61,5 +123,36 @@ public:
 
 private:
 
-	List<Char> _buffer;
+	// Header of a chunk; capacity bytes of text follow it
+	struct Chunk
+	{
+		Chunk* next;
+		size_type used;
+		size_type capacity;
+
+		inline Char* data() noexcept { return reinterpret_cast<Char*>(this + 1); }
+		inline const Char* data() const noexcept { return reinterpret_cast<const Char*>(this + 1); }
+	};
+
+	String _buffer;                      // Contiguous
+	Chunk* _head = nullptr;              // Chunked: every chunk, in order
+	Chunk* _tail = nullptr;              // the chunk written to; those after it are empty
+	Memory::Arena* _arena = nullptr;     // chunks come from here when set
+	size_type _chunkSize = 0;            // 0 when contiguous
+	size_type _length = 0;               // bytes in the chunks
+
+	inline void append(const Char* bytes, size_type len) noexcept
+	{
+		if (_chunkSize != 0)
+			append_chunked(bytes, len);
+		else
+			_buffer.append(bytes, len);
+	}
+
+	void append_chunked(const Char* bytes, size_type len) noexcept;
+	template<typename T> void append_number(T value) noexcept;
+	bool next_chunk() noexcept;
+	void free_chunks() noexcept;
+	void copy_from(const StringBuilder& other) noexcept;
+	void move_from(StringBuilder& other) noexcept;
 };
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "StringPool.hpp"
+#include "System/Collections/HashSet.hpp"
+#include "System/Threading/Interlocked.hpp"
+#include "System/Threading/ReaderWriterSpinLock.hpp"
+
+namespace
+{
+	constexpr uint32_t ShardCount = 64;     // power of two, picked by the top hash bits
+	constexpr uint32_t ShardShift = 26;
+
+	struct alignas(64) Shard
+	{
+		ReaderWriterSpinLock lock;
+		HashSet<String> strings;
+	};
+
+	struct Pool
+	{
+		Shard shards[ShardCount];
+
+		volatile uint64_t strings = 0;
+		volatile uint64_t lookups = 0;
+		volatile uint64_t hits = 0;
+		volatile uint64_t bytesStored = 0;
+		volatile uint64_t bytesSaved = 0;
+	};
+
+	Pool& Instance() noexcept
+	{
+		static Pool pool;
+		return pool;
+	}
+
+	inline Shard& ShardFor(Pool& pool, uint32_t hash) noexcept
+	{
+		// top bits: the HashSet inside uses the low bits for its tags
+		return pool.shards[hash >> ShardShift];
+	}
+}
+
+String StringPool::Intern(const String& value)
+{
+	if (value.IsInterned())
+	{
+		Pool& pool = Instance();
+		Interlocked::AddRelaxed(&pool.lookups, (uint64_t)1);
+		Interlocked::AddRelaxed(&pool.hits, (uint64_t)1);
+		return value;
+	}
+
+	return Intern(StringView(value));
+}
+
+String StringPool::Intern(StringView value)
+{
+	if (value.IsEmpty())
+		return String::Empty();
+
+	Pool& pool = Instance();
+	Interlocked::AddRelaxed(&pool.lookups, (uint64_t)1);
+
+	const uint32_t hash = value.GetHashCode();
+	Shard& shard = ShardFor(pool, hash);
+
+	// a duplicate copy of these bytes would be a heap block of this size
+	const uint32_t length = value.GetByteCount();
+	const uint64_t duplicate = length > String::SSO_CAPACITY ? String::block_size(length) : 0;
+
+	{
+		ReadLockScope scope(shard.lock);
+		if (const String* found = shard.strings.FindWithHash(value, hash))
+		{
+			Interlocked::AddRelaxed(&pool.hits, (uint64_t)1);
+			Interlocked::AddRelaxed(&pool.bytesSaved, duplicate);
+			return *found;
+		}
+	}
+
+	WriteLockScope scope(shard.lock);
+	if (const String* found = shard.strings.FindWithHash(value, hash))
+	{
+		Interlocked::AddRelaxed(&pool.hits, (uint64_t)1);
+		Interlocked::AddRelaxed(&pool.bytesSaved, duplicate);
+		return *found;
+	}
+
+	String canonical = String::make_interned(reinterpret_cast<const Char*>(value.GetData()), length, hash);
+	shard.strings.AddWithHash(canonical, hash);
+
+	Interlocked::AddRelaxed(&pool.strings, (uint64_t)1);
+	Interlocked::AddRelaxed(&pool.bytesStored, String::block_size(length));
+	return canonical;
+}
+
+Boolean StringPool::TryGet(StringView value, String& canonical) noexcept
+{
+	if (value.IsEmpty())
+		return false;
+
+	const uint32_t hash = value.GetHashCode();
+	Shard& shard = ShardFor(Instance(), hash);
+
+	ReadLockScope scope(shard.lock);
+	const String* found = shard.strings.FindWithHash(value, hash);
+	if (found == nullptr)
+		return false;
+
+	canonical = *found;
+	return true;
+}
+
+StringPool::Statistics StringPool::GetStatistics() noexcept
+{
+	Pool& pool = Instance();
+
+	Statistics stats;
+	stats.Strings = Volatile::ReadRelaxed(&pool.strings);
+	stats.Lookups = Volatile::ReadRelaxed(&pool.lookups);
+	stats.Hits = Volatile::ReadRelaxed(&pool.hits);
+	stats.BytesStored = Volatile::ReadRelaxed(&pool.bytesStored);
+	stats.BytesSaved = Volatile::ReadRelaxed(&pool.bytesSaved);
+	return stats;
+}
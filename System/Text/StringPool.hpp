@@ -0,0 +1,46 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ==============================================================
+//  StringPool - process wide intern table (atom table)
+//  - Intern returns the canonical String for a byte sequence: one
+//    immortal heap block per distinct value, shared by every caller,
+//    with its hash cached in the block
+//  - Canonical strings compare by block address (String::Equals,
+//    Compare, Map / HashSet lookups) and hash without reading their
+//    bytes; see String::IsInterned
+//  - Thread-safe: the table is split into shards by hash, each a
+//    HashSet<String> under its own ReaderWriterSpinLock; a hit only
+//    takes the shard's read lock
+//  - Entries are never removed: canonical strings live until exit
+// ==============================================================
+
+class StringPool
+{
+public:
+
+	struct Statistics
+	{
+		u64 Strings;        // distinct canonical strings
+		u64 Lookups;        // Intern calls
+		u64 Hits;           // calls answered with an existing canonical string
+		u64 BytesStored;    // heap bytes held by the canonical blocks
+		u64 BytesSaved;     // heap bytes of the duplicate copies hits made unnecessary
+	};
+
+	StringPool() = delete;
+
+	static String Intern(const String& value);
+	static String Intern(StringView value);
+	static inline String Intern(const char* value) { return Intern(StringView(value)); }
+
+	// The canonical string for these bytes if they were interned; adds nothing.
+	static Boolean TryGet(StringView value, String& canonical) noexcept;
+
+	// Counters are updated without a common lock: a snapshot taken while other
+	// threads intern may be off by the calls in flight.
+	static Statistics GetStatistics() noexcept;
+};
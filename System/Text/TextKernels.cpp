@@ -0,0 +1,710 @@
+#include "TextKernels.hpp"
+#include "System/CPUInfo.hpp"
+#include "System/Threading/Interlocked.hpp"
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PHOENIX_TEXTKERNELS_SIMD 1
+#include <immintrin.h>
+#endif
+
+// MSVC compiles AVX2 intrinsics anywhere; GCC and Clang want them in functions
+// built for that target. Either way they only run once CPUInfo said yes, which
+// also needs the OS to save the YMM registers (OSXSAVE and XCR0).
+#if defined(__GNUC__) || defined(__clang__)
+#define PHOENIX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PHOENIX_TARGET_AVX2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace TextKernels
+{
+	namespace
+	{
+		constexpr uint64_t Lsb = 0x0101010101010101ull;
+		constexpr uint64_t Msb = 0x8080808080808080ull;
+
+		inline uint64_t Load64(const uint8_t* p) noexcept
+		{
+			uint64_t v;
+#if defined(_MSC_VER) && !defined(__clang__)
+			v = *(const uint64_t __unaligned*)p;
+#else
+			__builtin_memcpy(&v, p, sizeof(v));
+#endif
+			return v;
+		}
+
+		inline bool IsContinuation(uint8_t b) noexcept
+		{
+			return (b & 0xC0) == 0x80;
+		}
+
+		// Bit positions in the match masks below (mask != 0)
+		inline uint32_t LowestBit(uint64_t mask) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return (uint32_t)index;
+#else
+			return (uint32_t)__builtin_ctzll(mask);
+#endif
+		}
+
+		inline uint32_t HighestBit(uint64_t mask) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanReverse64(&index, mask);
+			return (uint32_t)index;
+#else
+			return 63u - (uint32_t)__builtin_clzll(mask);
+#endif
+		}
+
+		// Length of the well-formed sequence starting at p, 0 if there is none.
+		// The second byte ranges are the ones of RFC 3629, table 3-7.
+		inline uint64_t SequenceLength(const uint8_t* p, uint64_t available) noexcept
+		{
+			const uint8_t b0 = p[0];
+			if (b0 < 0x80)
+				return 1;
+
+			// continuation, overlong 2 byte lead (C0, C1), beyond U+10FFFF (F5..FF)
+			if (b0 < 0xC2 || b0 > 0xF4)
+				return 0;
+
+			if (b0 < 0xE0)
+				return available >= 2 && IsContinuation(p[1]) ? 2 : 0;
+
+			if (available < 3)
+				return 0;
+
+			uint8_t low = 0x80;
+			uint8_t high = 0xBF;
+			switch (b0)
+			{
+			case 0xE0: low = 0xA0; break;   // overlong
+			case 0xED: high = 0x9F; break;  // surrogates
+			case 0xF0: low = 0x90; break;   // overlong
+			case 0xF4: high = 0x8F; break;  // beyond U+10FFFF
+			default: break;
+			}
+
+			if (p[1] < low || p[1] > high || !IsContinuation(p[2]))
+				return 0;
+
+			if (b0 < 0xF0)
+				return 3;
+
+			return available >= 4 && IsContinuation(p[3]) ? 4 : 0;
+		}
+
+		// Walks sequence by sequence; skipASCII(p, i, len) may jump over a run of
+		// ASCII bytes starting at the sequence boundary i.
+		template<typename SkipASCII>
+		inline bool ValidateSequences(const uint8_t* p, uint64_t len, SkipASCII&& skipASCII) noexcept
+		{
+			uint64_t i = 0;
+			while (i < len)
+			{
+				i = skipASCII(p, i, len);
+				if (i >= len)
+					break;
+
+				const uint64_t n = SequenceLength(p + i, len - i);
+				if (n == 0)
+					return false;
+				i += n;
+			}
+			return true;
+		}
+
+		// --- scalar: 8 bytes per word ---
+
+		bool IsASCIIScalar(const uint8_t* p, uint64_t len) noexcept
+		{
+			uint64_t i = 0;
+			for (; i + 32 <= len; i += 32)
+			{
+				if ((Load64(p + i) | Load64(p + i + 8) | Load64(p + i + 16) | Load64(p + i + 24)) & Msb)
+					return false;
+			}
+			for (; i + 8 <= len; i += 8)
+			{
+				if (Load64(p + i) & Msb)
+					return false;
+			}
+			for (; i < len; ++i)
+			{
+				if (p[i] & 0x80)
+					return false;
+			}
+			return true;
+		}
+
+		bool IsValidUTF8Scalar(const uint8_t* p, uint64_t len) noexcept
+		{
+			return ValidateSequences(p, len, [](const uint8_t* bytes, uint64_t i, uint64_t n) noexcept
+			{
+				while (i + 8 <= n && (Load64(bytes + i) & Msb) == 0)
+					i += 8;
+				return i;
+			});
+		}
+
+		// Continuation bytes (10xxxxxx) in a word: bit 7 set, bit 6 clear.
+		inline uint64_t CountContinuations(uint64_t word) noexcept
+		{
+			const uint64_t marks = word & ~(word << 1) & Msb;
+			return ((marks >> 7) * Lsb) >> 56;
+		}
+
+		uint64_t CountCodePointsScalar(const uint8_t* p, uint64_t len) noexcept
+		{
+			uint64_t continuations = 0;
+			uint64_t i = 0;
+			for (; i + 8 <= len; i += 8)
+				continuations += CountContinuations(Load64(p + i));
+			for (; i < len; ++i)
+				continuations += IsContinuation(p[i]) ? 1 : 0;
+			return len - continuations;
+		}
+
+		// 0x80 in each byte of the word that is zero. Exact: the add cannot
+		// carry from one byte into the next, unlike the (w - Lsb) & ~w trick.
+		inline uint64_t ZeroBytes(uint64_t word) noexcept
+		{
+			constexpr uint64_t Low7 = 0x7F7F7F7F7F7F7F7Full;
+			return ~(((word & Low7) + Low7) | word | Low7);
+		}
+
+		// Byte order: bit 8k + 7 of the mask is byte k (little endian loads)
+		uint64_t FindPairScalar(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const uint64_t end = len - distance;
+			const uint64_t a = first * Lsb;
+			const uint64_t b = second * Lsb;
+
+			uint64_t i = 0;
+			for (; i + 8 <= end; i += 8)
+			{
+				const uint64_t hits = ZeroBytes(Load64(p + i) ^ a) & ZeroBytes(Load64(p + i + distance) ^ b);
+				if (hits != 0)
+					return i + LowestBit(hits) / 8;
+			}
+			for (; i < end; ++i)
+			{
+				if (p[i] == first && p[i + distance] == second)
+					return i;
+			}
+			return len;
+		}
+
+		uint64_t FindPairLastScalar(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const uint64_t a = first * Lsb;
+			const uint64_t b = second * Lsb;
+
+			uint64_t i = len - distance;
+			while (i >= 8)
+			{
+				i -= 8;
+				const uint64_t hits = ZeroBytes(Load64(p + i) ^ a) & ZeroBytes(Load64(p + i + distance) ^ b);
+				if (hits != 0)
+					return i + HighestBit(hits) / 8;
+			}
+			while (i > 0)
+			{
+				--i;
+				if (p[i] == first && p[i + distance] == second)
+					return i;
+			}
+			return len;
+		}
+
+		// The vector versions finish (or start) with the scalar one on the
+		// candidates that do not fill a vector; end is one past the last one.
+		inline uint64_t FinishPair(const uint8_t* p, uint64_t len, uint64_t i, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			const uint64_t r = FindPairScalar(p + i, len - i, first, second, distance);
+			return r == len - i ? len : i + r;
+		}
+
+		inline uint64_t FinishPairLast(const uint8_t* p, uint64_t len, uint64_t end, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			const uint64_t r = FindPairLastScalar(p, end + distance, first, second, distance);
+			return r == end + distance ? len : r;
+		}
+
+		// A table lookup per byte: a 256-bit set has no SWAR shortcut
+		uint64_t FindAnyScalar(const uint8_t* p, uint64_t len, const ByteSetTable& set) noexcept
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= len; i += 4)
+			{
+				if (Contains(set, p[i])) return i;
+				if (Contains(set, p[i + 1])) return i + 1;
+				if (Contains(set, p[i + 2])) return i + 2;
+				if (Contains(set, p[i + 3])) return i + 3;
+			}
+			for (; i < len; ++i)
+			{
+				if (Contains(set, p[i]))
+					return i;
+			}
+			return len;
+		}
+
+		uint64_t FindAnyLastScalar(const uint8_t* p, uint64_t len, const ByteSetTable& set) noexcept
+		{
+			uint64_t i = len;
+			while (i > 0)
+			{
+				--i;
+				if (Contains(set, p[i]))
+					return i;
+			}
+			return len;
+		}
+
+		const Kernels ScalarKernels = { Level::Scalar, &IsASCIIScalar, &IsValidUTF8Scalar, &CountCodePointsScalar, &FindPairScalar, &FindPairLastScalar, &FindAnyScalar, &FindAnyLastScalar };
+
+#if defined(PHOENIX_TEXTKERNELS_SIMD)
+
+		// --- SSE2: 16 bytes per vector ---
+
+		bool IsASCIISSE2(const uint8_t* p, uint64_t len) noexcept
+		{
+			uint64_t i = 0;
+			for (; i + 64 <= len; i += 64)
+			{
+				const __m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(p + i)), _mm_loadu_si128((const __m128i*)(p + i + 16)));
+				const __m128i b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(p + i + 32)), _mm_loadu_si128((const __m128i*)(p + i + 48)));
+				if (_mm_movemask_epi8(_mm_or_si128(a, b)) != 0)
+					return false;
+			}
+			for (; i + 16 <= len; i += 16)
+			{
+				if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(p + i))) != 0)
+					return false;
+			}
+			return IsASCIIScalar(p + i, len - i);
+		}
+
+		// SSE2 has no byte shuffle for the table lookups of the AVX2 validator,
+		// so it skips ASCII runs 16 bytes at a time and checks the rest per sequence.
+		bool IsValidUTF8SSE2(const uint8_t* p, uint64_t len) noexcept
+		{
+			return ValidateSequences(p, len, [](const uint8_t* bytes, uint64_t i, uint64_t n) noexcept
+			{
+				while (i + 16 <= n && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(bytes + i))) == 0)
+					i += 16;
+				return i;
+			});
+		}
+
+		uint64_t CountCodePointsSSE2(const uint8_t* p, uint64_t len) noexcept
+		{
+			// signed compare: 0x80..0xBF are the bytes below (int8_t)0xC0
+			const __m128i limit = _mm_set1_epi8((char)0xC0);
+			const __m128i zero = _mm_setzero_si128();
+
+			uint64_t continuations = 0;
+			uint64_t i = 0;
+			while (i + 16 <= len)
+			{
+				// per byte counters, flushed before they can wrap
+				__m128i counts = zero;
+				for (uint32_t round = 0; round < 255 && i + 16 <= len; ++round, i += 16)
+					counts = _mm_sub_epi8(counts, _mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(p + i)), limit));
+
+				const __m128i sums = _mm_sad_epu8(counts, zero);
+				continuations += (uint64_t)(uint32_t)_mm_cvtsi128_si32(sums) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+			}
+			return (i - continuations) + CountCodePointsScalar(p + i, len - i);
+		}
+
+		uint64_t FindPairSSE2(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const uint64_t end = len - distance;
+			const __m128i a = _mm_set1_epi8((char)first);
+			const __m128i b = _mm_set1_epi8((char)second);
+
+			uint64_t i = 0;
+			for (; i + 16 <= end; i += 16)
+			{
+				const __m128i x = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i)), a);
+				const __m128i y = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i + distance)), b);
+				const uint32_t hits = (uint32_t)_mm_movemask_epi8(_mm_and_si128(x, y));
+				if (hits != 0)
+					return i + LowestBit(hits);
+			}
+			return FinishPair(p, len, i, first, second, distance);
+		}
+
+		uint64_t FindPairLastSSE2(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const __m128i a = _mm_set1_epi8((char)first);
+			const __m128i b = _mm_set1_epi8((char)second);
+
+			uint64_t i = len - distance;
+			while (i >= 16)
+			{
+				i -= 16;
+				const __m128i x = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i)), a);
+				const __m128i y = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i + distance)), b);
+				const uint32_t hits = (uint32_t)_mm_movemask_epi8(_mm_and_si128(x, y));
+				if (hits != 0)
+					return i + HighestBit(hits);
+			}
+			return FinishPairLast(p, len, i, first, second, distance);
+		}
+
+		// The set lookup needs a byte shuffle (SSSE3), which SSE2 does not have
+		const Kernels SSE2Kernels = { Level::SSE2, &IsASCIISSE2, &IsValidUTF8SSE2, &CountCodePointsSSE2, &FindPairSSE2, &FindPairLastSSE2, &FindAnyScalar, &FindAnyLastScalar };
+
+		// --- AVX2: 32 bytes per vector ---
+
+		PHOENIX_TARGET_AVX2 bool IsASCIIAVX2(const uint8_t* p, uint64_t len) noexcept
+		{
+			uint64_t i = 0;
+			for (; i + 128 <= len; i += 128)
+			{
+				const __m256i a = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(p + i)), _mm256_loadu_si256((const __m256i*)(p + i + 32)));
+				const __m256i b = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(p + i + 64)), _mm256_loadu_si256((const __m256i*)(p + i + 96)));
+				if (_mm256_movemask_epi8(_mm256_or_si256(a, b)) != 0)
+					return false;
+			}
+			for (; i + 32 <= len; i += 32)
+			{
+				if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(p + i))) != 0)
+					return false;
+			}
+			return IsASCIIScalar(p + i, len - i);
+		}
+
+		PHOENIX_TARGET_AVX2 uint64_t CountCodePointsAVX2(const uint8_t* p, uint64_t len) noexcept
+		{
+			const __m256i limit = _mm256_set1_epi8((char)0xC0);
+			const __m256i zero = _mm256_setzero_si256();
+
+			uint64_t continuations = 0;
+			uint64_t i = 0;
+			while (i + 32 <= len)
+			{
+				__m256i counts = zero;
+				for (uint32_t round = 0; round < 255 && i + 32 <= len; ++round, i += 32)
+					counts = _mm256_sub_epi8(counts, _mm256_cmpgt_epi8(limit, _mm256_loadu_si256((const __m256i*)(p + i))));
+
+				const __m256i sums = _mm256_sad_epu8(counts, zero);
+				const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+				continuations += (uint64_t)(uint32_t)_mm_cvtsi128_si32(half) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(half, 8));
+			}
+			return (i - continuations) + CountCodePointsScalar(p + i, len - i);
+		}
+
+		// Validation after Keiser and Lemire, "Validating UTF-8 In Less Than One
+		// Instruction Per Byte" (2021): three 16 entry lookups on the high and low
+		// nibble of the previous byte and the high nibble of the current one flag
+		// every invalid two byte pattern; the third and fourth bytes of longer
+		// sequences are checked against the lead bytes two and three back.
+
+		constexpr uint8_t TooShort = 1 << 0;   // lead or ASCII, then a lead or ASCII where a continuation belongs
+		constexpr uint8_t TooLong = 1 << 1;    // ASCII, then a continuation
+		constexpr uint8_t Overlong3 = 1 << 2;  // E0 80..9F
+		constexpr uint8_t TooLarge = 1 << 3;   // F4 90..BF, F5..FF
+		constexpr uint8_t Surrogate = 1 << 4;  // ED A0..BF
+		constexpr uint8_t Overlong2 = 1 << 5;  // C0, C1
+		constexpr uint8_t TooLarge1000 = 1 << 6;
+		constexpr uint8_t Overlong4 = 1 << 6;  // F0 80..8F
+		constexpr uint8_t TwoConts = 1 << 7;   // a continuation, then a continuation
+		constexpr uint8_t Carry = TooShort | TooLong | TwoConts;
+
+		// A 16 entry table repeated in both lanes (vpshufb looks up per lane).
+#define PHOENIX_TABLE16(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+		PHOENIX_TARGET_AVX2 inline __m256i HighNibbles(__m256i v) noexcept
+		{
+			return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+		}
+
+		// The 32 bytes ending N bytes before the start of input.
+		template<int N>
+		PHOENIX_TARGET_AVX2 inline __m256i Previous(__m256i input, __m256i previous) noexcept
+		{
+			return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+		}
+
+		PHOENIX_TARGET_AVX2 inline __m256i CheckBlock(__m256i input, __m256i previousInput) noexcept
+		{
+			const __m256i prev1 = Previous<1>(input, previousInput);
+
+			const __m256i byte1High = _mm256_shuffle_epi8(PHOENIX_TABLE16(
+				TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+				TwoConts, TwoConts, TwoConts, TwoConts,
+				TooShort | Overlong2,
+				TooShort,
+				TooShort | Overlong3 | Surrogate,
+				TooShort | TooLarge | TooLarge1000 | Overlong4), HighNibbles(prev1));
+
+			const __m256i byte1Low = _mm256_shuffle_epi8(PHOENIX_TABLE16(
+				Carry | Overlong3 | Overlong2 | Overlong4,
+				Carry | Overlong2,
+				Carry,
+				Carry,
+				Carry | TooLarge,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000 | Surrogate,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000), _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+
+			const __m256i byte2High = _mm256_shuffle_epi8(PHOENIX_TABLE16(
+				TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooShort, TooShort, TooShort, TooShort), HighNibbles(input));
+
+			const __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+			// Bytes two after an E0..FF lead or three after an F0..FF lead must be
+			// continuations; the TwoConts flag above stands for exactly those.
+			const __m256i third = _mm256_subs_epu8(Previous<2>(input, previousInput), _mm256_set1_epi8((char)(0xE0 - 0x80)));
+			const __m256i fourth = _mm256_subs_epu8(Previous<3>(input, previousInput), _mm256_set1_epi8((char)(0xF0 - 0x80)));
+			const __m256i must = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+
+			return _mm256_xor_si256(must, special);
+		}
+
+		// Non-zero where the block ends inside a sequence (a lead in its last three bytes).
+		PHOENIX_TARGET_AVX2 inline __m256i Incomplete(__m256i input) noexcept
+		{
+			const __m256i last = _mm256_setr_epi8(
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				(char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+			return _mm256_subs_epu8(input, last);
+		}
+
+#undef PHOENIX_TABLE16
+
+		struct Validation
+		{
+			__m256i error;
+			__m256i previous;
+			__m256i previousIncomplete;
+		};
+
+		PHOENIX_TARGET_AVX2 inline void Step(Validation& state, __m256i input) noexcept
+		{
+			if (_mm256_movemask_epi8(input) == 0)
+			{
+				// ASCII: fine unless the block before stopped mid-sequence
+				state.error = _mm256_or_si256(state.error, state.previousIncomplete);
+			}
+			else
+			{
+				state.error = _mm256_or_si256(state.error, CheckBlock(input, state.previous));
+				state.previousIncomplete = Incomplete(input);
+			}
+			state.previous = input;
+		}
+
+		PHOENIX_TARGET_AVX2 bool IsValidUTF8AVX2(const uint8_t* p, uint64_t len) noexcept
+		{
+			Validation state = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+
+			uint64_t i = 0;
+			for (; i + 32 <= len; i += 32)
+			{
+				Step(state, _mm256_loadu_si256((const __m256i*)(p + i)));
+
+				// bail out early on long inputs
+				if ((i & 4095) == 4064 && !_mm256_testz_si256(state.error, state.error))
+					return false;
+			}
+
+			// The tail, zero padded. It is never full, so a sequence cut short by
+			// the end of input meets a zero; a block that is all padding closes
+			// the sequence open at the end of the last full block.
+			alignas(32) uint8_t tail[32] = {};
+			for (uint64_t j = 0; i + j < len; ++j)
+				tail[j] = p[i + j];
+			Step(state, _mm256_load_si256((const __m256i*)tail));
+
+			return _mm256_testz_si256(state.error, state.error) != 0;
+		}
+
+		PHOENIX_TARGET_AVX2 uint64_t FindPairAVX2(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const uint64_t end = len - distance;
+			const __m256i a = _mm256_set1_epi8((char)first);
+			const __m256i b = _mm256_set1_epi8((char)second);
+
+			uint64_t i = 0;
+			for (; i + 32 <= end; i += 32)
+			{
+				const __m256i x = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + i)), a);
+				const __m256i y = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + i + distance)), b);
+				const uint32_t hits = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(x, y));
+				if (hits != 0)
+					return i + LowestBit(hits);
+			}
+			return FinishPair(p, len, i, first, second, distance);
+		}
+
+		PHOENIX_TARGET_AVX2 uint64_t FindPairLastAVX2(const uint8_t* p, uint64_t len, uint8_t first, uint8_t second, uint64_t distance) noexcept
+		{
+			if (len <= distance)
+				return len;
+
+			const __m256i a = _mm256_set1_epi8((char)first);
+			const __m256i b = _mm256_set1_epi8((char)second);
+
+			uint64_t i = len - distance;
+			while (i >= 32)
+			{
+				i -= 32;
+				const __m256i x = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + i)), a);
+				const __m256i y = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + i + distance)), b);
+				const uint32_t hits = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(x, y));
+				if (hits != 0)
+					return i + HighestBit(hits);
+			}
+			return FinishPairLast(p, len, i, first, second, distance);
+		}
+
+		// Set membership of 32 bytes: the low nibbles pick each byte's row (from
+		// the lower or the upper half table by its top bit), the high nibbles
+		// the bit to test in it
+		struct SetLookup
+		{
+			__m256i lower;
+			__m256i upper;
+			__m256i bits;
+		};
+
+		PHOENIX_TARGET_AVX2 inline SetLookup LoadSet(const ByteSetTable& set) noexcept
+		{
+			const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128);
+			return SetLookup{
+				_mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)set.Rows[0])),
+				_mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)set.Rows[1])),
+				_mm256_broadcastsi128_si256(bits) };
+		}
+
+		PHOENIX_TARGET_AVX2 inline uint32_t SetHits(const SetLookup& set, __m256i v) noexcept
+		{
+			const __m256i nibble = _mm256_set1_epi8(0x0F);
+			const __m256i low = _mm256_and_si256(v, nibble);
+			const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+
+			const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(set.lower, low), _mm256_shuffle_epi8(set.upper, low), v);
+			const __m256i bit = _mm256_shuffle_epi8(set.bits, high);
+			return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+		}
+
+		PHOENIX_TARGET_AVX2 uint64_t FindAnyAVX2(const uint8_t* p, uint64_t len, const ByteSetTable& table) noexcept
+		{
+			const SetLookup set = LoadSet(table);
+
+			uint64_t i = 0;
+			for (; i + 32 <= len; i += 32)
+			{
+				const uint32_t hits = SetHits(set, _mm256_loadu_si256((const __m256i*)(p + i)));
+				if (hits != 0)
+					return i + LowestBit(hits);
+			}
+			const uint64_t r = FindAnyScalar(p + i, len - i, table);
+			return r == len - i ? len : i + r;
+		}
+
+		PHOENIX_TARGET_AVX2 uint64_t FindAnyLastAVX2(const uint8_t* p, uint64_t len, const ByteSetTable& table) noexcept
+		{
+			const SetLookup set = LoadSet(table);
+
+			uint64_t i = len;
+			while (i >= 32)
+			{
+				i -= 32;
+				const uint32_t hits = SetHits(set, _mm256_loadu_si256((const __m256i*)(p + i)));
+				if (hits != 0)
+					return i + HighestBit(hits);
+			}
+			const uint64_t r = FindAnyLastScalar(p, i, table);
+			return r == i ? len : r;
+		}
+
+		const Kernels AVX2Kernels = { Level::AVX2, &IsASCIIAVX2, &IsValidUTF8AVX2, &CountCodePointsAVX2, &FindPairAVX2, &FindPairLastAVX2, &FindAnyAVX2, &FindAnyLastAVX2 };
+
+#endif
+
+		const Kernels* volatile g_active = nullptr;
+
+		const Kernels* Select() noexcept
+		{
+			// CPUInfo builds Strings, which scan text: they get the scalar kernels
+			Volatile::Write(&g_active, &ScalarKernels);
+
+			const Kernels* best = &ScalarKernels;
+#if defined(PHOENIX_TEXTKERNELS_SIMD)
+			const CPUInfo cpu;
+			if (cpu.HaveAVX2())
+				best = &AVX2Kernels;
+			else if (cpu.HaveSSE2())
+				best = &SSE2Kernels;
+#endif
+			Volatile::Write(&g_active, best);
+			return best;
+		}
+	}
+
+	const Kernels& Active() noexcept
+	{
+		const Kernels* active = Volatile::Read(&g_active);
+		return active != nullptr ? *active : *Select();
+	}
+
+	const Kernels* ForLevel(Level level) noexcept
+	{
+		if (level == Level::Scalar)
+			return &ScalarKernels;
+
+#if defined(PHOENIX_TEXTKERNELS_SIMD)
+		const CPUInfo cpu;
+		if (level == Level::SSE2 && cpu.HaveSSE2())
+			return &SSE2Kernels;
+		if (level == Level::AVX2 && cpu.HaveAVX2())
+			return &AVX2Kernels;
+#endif
+		return nullptr;
+	}
+}
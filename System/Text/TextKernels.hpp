@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+
+// ==============================================================
+//  TextKernels - bulk byte scans behind ASCII, UTF8 and String
+//  - IsASCII: no byte has its high bit set
+//  - IsValidUTF8: well-formed UTF-8 (RFC 3629): no overlong forms,
+//    no surrogates, nothing above U+10FFFF, no truncated sequences
+//  - CountCodePoints: bytes that are not continuation bytes; this
+//    is the code point count when the input is valid UTF-8
+//  - FindPair / FindPairLast: the first / last i where bytes[i] is
+//    one given byte and bytes[i + distance] another; the candidate
+//    filter of TextSearch (first and last byte of a needle)
+//  - FindAny / FindAnyLast: the first / last byte that is in a
+//    ByteSetTable (IndexOfAny, Split on characters, TextMatcher)
+//  - Three implementations: scalar (8 byte SWAR words), SSE2 and
+//    AVX2. The best one the CPU reports (CPUInfo::HaveSSE2 /
+//    HaveAVX2) is picked on first use; code running while it is
+//    being picked (CPUInfo builds Strings) gets the scalar one
+// ==============================================================
+
+namespace TextKernels
+{
+	enum class Level : uint8_t
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	// 256-bit byte set laid out for nibble lookups: byte b is in the set
+	// when bit (b >> 4) & 7 of Rows[b >> 7][b & 15] is set. A byte shuffle
+	// indexed by the low nibbles reads 32 bytes' rows at once (AVX2).
+	struct ByteSetTable
+	{
+		alignas(16) uint8_t Rows[2][16];
+	};
+
+	inline void Add(ByteSetTable& set, uint8_t b) noexcept
+	{
+		set.Rows[b >> 7][b & 15] |= (uint8_t)(1u << ((b >> 4) & 7));
+	}
+
+	inline bool Contains(const ByteSetTable& set, uint8_t b) noexcept
+	{
+		return ((set.Rows[b >> 7][b & 15] >> ((b >> 4) & 7)) & 1) != 0;
+	}
+
+	struct Kernels
+	{
+		Level level;
+		bool (*IsASCII)(const uint8_t* bytes, uint64_t length) noexcept;
+		bool (*IsValidUTF8)(const uint8_t* bytes, uint64_t length) noexcept;
+		uint64_t (*CountCodePoints)(const uint8_t* bytes, uint64_t length) noexcept;
+
+		// i with i + distance < length, or length when there is none
+		uint64_t (*FindPair)(const uint8_t* bytes, uint64_t length, uint8_t first, uint8_t second, uint64_t distance) noexcept;
+		uint64_t (*FindPairLast)(const uint8_t* bytes, uint64_t length, uint8_t first, uint8_t second, uint64_t distance) noexcept;
+
+		// i with bytes[i] in the set, or length when there is none
+		uint64_t (*FindAny)(const uint8_t* bytes, uint64_t length, const ByteSetTable& set) noexcept;
+		uint64_t (*FindAnyLast)(const uint8_t* bytes, uint64_t length, const ByteSetTable& set) noexcept;
+	};
+
+	// The implementation in use.
+	const Kernels& Active() noexcept;
+
+	// A given implementation, or nullptr when this build or CPU lacks it
+	// (tests and benchmarks compare them side by side).
+	const Kernels* ForLevel(Level level) noexcept;
+
+	inline bool IsASCII(const void* bytes, uint64_t length) noexcept
+	{
+		return Active().IsASCII(static_cast<const uint8_t*>(bytes), length);
+	}
+
+	inline bool IsValidUTF8(const void* bytes, uint64_t length) noexcept
+	{
+		return Active().IsValidUTF8(static_cast<const uint8_t*>(bytes), length);
+	}
+
+	inline uint64_t CountCodePoints(const void* bytes, uint64_t length) noexcept
+	{
+		return Active().CountCodePoints(static_cast<const uint8_t*>(bytes), length);
+	}
+
+	inline uint64_t FindPair(const void* bytes, uint64_t length, uint8_t first, uint8_t second, uint64_t distance) noexcept
+	{
+		return Active().FindPair(static_cast<const uint8_t*>(bytes), length, first, second, distance);
+	}
+
+	inline uint64_t FindPairLast(const void* bytes, uint64_t length, uint8_t first, uint8_t second, uint64_t distance) noexcept
+	{
+		return Active().FindPairLast(static_cast<const uint8_t*>(bytes), length, first, second, distance);
+	}
+
+	inline uint64_t FindAny(const void* bytes, uint64_t length, const ByteSetTable& set) noexcept
+	{
+		return Active().FindAny(static_cast<const uint8_t*>(bytes), length, set);
+	}
+
+	inline uint64_t FindAnyLast(const void* bytes, uint64_t length, const ByteSetTable& set) noexcept
+	{
+		return Active().FindAnyLast(static_cast<const uint8_t*>(bytes), length, set);
+	}
+}
@@ -0,0 +1,246 @@
+#include "TextMatcher.hpp"
+
+namespace
+{
+	inline const uint8_t* as_bytes(const char* p) noexcept
+	{
+		return reinterpret_cast<const uint8_t*>(p);
+	}
+
+	// Leftmost wins, then longest
+	inline bool is_better(uint32_t offset, uint32_t length, const TextMatcher::Match& best, bool found) noexcept
+	{
+		return !found || offset < best.Offset || (offset == best.Offset && length > best.Length);
+	}
+
+	// Rightmost wins, then longest
+	inline bool is_better_last(uint32_t offset, uint32_t length, const TextMatcher::Match& best, bool found) noexcept
+	{
+		return !found || offset > best.Offset || (offset == best.Offset && length > best.Length);
+	}
+}
+
+TextMatcher::TextMatcher(const List<Char>& chars)
+{
+	build({}, chars);
+}
+
+TextMatcher::TextMatcher(const List<String>& patterns)
+{
+	List<StringView> views(patterns.Count());
+	for (const auto& s : patterns)
+		views.Add(StringView(s));
+	build(views, {});
+}
+
+TextMatcher::TextMatcher(const List<StringView>& patterns)
+{
+	build(patterns, {});
+}
+
+TextMatcher::TextMatcher(const List<StringView>& patterns, const List<Char>& chars)
+{
+	build(patterns, chars);
+}
+
+void TextMatcher::build(const List<StringView>& patterns, const List<Char>& chars)
+{
+	// columns for the bytes the patterns use, in order of appearance
+	auto classify = [this](uint8_t b)
+	{
+		if (_classes[b] == 0)
+			_classes[b] = (uint16_t)_columns++;
+	};
+
+	for (uint64_t i = 0; i < chars.Count(); ++i)
+	{
+		const uint8_t b = (unsigned char)chars[i];
+		_first.Add(b);
+		classify(b);
+		if (_maxLength == 0)
+			_maxLength = 1;
+	}
+
+	for (const auto& p : patterns)
+	{
+		const uint32_t n = p.GetByteCount();
+		if (n == 0)
+			continue;
+
+		const uint8_t* bytes = as_bytes(p.GetData());
+		_first.Add(bytes[0]);
+		for (uint32_t k = 0; k < n; ++k)
+			classify(bytes[k]);
+
+		if (n > 1)
+			_bytesOnly = false;
+		if (n > _maxLength)
+			_maxLength = n;
+	}
+
+	if (_bytesOnly)
+		return;
+
+	// trie: the root, then one state per distinct prefix
+	for (uint32_t c = 0; c < _columns; ++c)
+		_next.Add(0);
+	_terminal.Add(0);
+	_outputLink.Add(0);
+
+	for (uint64_t i = 0; i < chars.Count(); ++i)
+	{
+		const uint8_t b = (unsigned char)chars[i];
+		add_pattern(&b, 1);
+	}
+	for (const auto& p : patterns)
+	{
+		if (!p.IsEmpty())
+			add_pattern(as_bytes(p.GetData()), p.GetByteCount());
+	}
+
+	// breadth first: a state's failure link is shallower, so its row is
+	// complete by the time the state borrows the missing transitions from it
+	const uint32_t states = (uint32_t)_terminal.Count();
+	List<uint32_t> fail(states, (uint32_t)0);
+	List<uint32_t> queue(states);
+
+	for (uint32_t c = 0; c < _columns; ++c)
+	{
+		if (_next[c] != 0)
+			queue.Add(_next[c]);
+	}
+
+	for (uint64_t head = 0; head < queue.Count(); ++head)
+	{
+		const uint32_t u = queue[head];
+		for (uint32_t c = 0; c < _columns; ++c)
+		{
+			const uint32_t v = _next[u * _columns + c];
+			const uint32_t f = _next[fail[u] * _columns + c];
+			if (v != 0)
+			{
+				fail[v] = f;
+				_outputLink[v] = _terminal[f] != 0 ? f : _outputLink[f];
+				queue.Add(v);
+			}
+			else
+				_next[u * _columns + c] = f;
+		}
+	}
+}
+
+void TextMatcher::add_pattern(const uint8_t* bytes, uint32_t length)
+{
+	uint32_t state = 0;
+	for (uint32_t k = 0; k < length; ++k)
+	{
+		const uint32_t slot = state * _columns + _classes[bytes[k]];
+		if (_next[slot] == 0)
+		{
+			const uint32_t created = (uint32_t)_terminal.Count();
+			for (uint32_t c = 0; c < _columns; ++c)
+				_next.Add(0);
+			_terminal.Add(0);
+			_outputLink.Add(0);
+			_next[slot] = created;
+		}
+		state = _next[slot];
+	}
+	_terminal[state] = length;
+}
+
+Boolean TextMatcher::Find(const char* text, uint32_t length, uint32_t start, Match& match) const noexcept
+{
+	const uint8_t* hay = as_bytes(text);
+
+	if (_bytesOnly)
+	{
+		for (int64_t at = _first.IndexOfAny(hay, length, start); at >= 0; at = _first.IndexOfAny(hay, length, (uint64_t)at + 1))
+		{
+			if (TextSearch::IsBoundaryMatch(hay, length, (uint64_t)at, 1))
+			{
+				match = Match{ (uint32_t)at, 1 };
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool found = false;
+	uint32_t state = 0;
+	uint32_t i = start;
+	while (i < length)
+	{
+		if (state == 0)
+		{
+			// nothing in progress: a later match starts after the best one
+			if (found)
+				break;
+
+			const int64_t at = _first.IndexOfAny(hay, length, i);
+			if (at < 0)
+				break;
+			i = (uint32_t)at;
+		}
+
+		state = next(state, hay[i++]);
+		for_each_output(state, [&](uint32_t n)
+		{
+			const uint32_t offset = i - n;
+			if (is_better(offset, n, match, found) && TextSearch::IsBoundaryMatch(hay, length, offset, n))
+			{
+				match = Match{ offset, n };
+				found = true;
+			}
+		});
+
+		// anything still to come starts after the best match
+		if (found && i >= match.Offset + _maxLength)
+			break;
+	}
+	return found;
+}
+
+Boolean TextMatcher::FindLast(const char* text, uint32_t length, Match& match) const noexcept
+{
+	const uint8_t* hay = as_bytes(text);
+
+	if (_bytesOnly)
+	{
+		for (int64_t at = _first.LastIndexOfAny(hay, length); at >= 0; at = _first.LastIndexOfAny(hay, (uint64_t)at))
+		{
+			if (TextSearch::IsBoundaryMatch(hay, length, (uint64_t)at, 1))
+			{
+				match = Match{ (uint32_t)at, 1 };
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool found = false;
+	uint32_t state = 0;
+	uint32_t i = 0;
+	while (i < length)
+	{
+		if (state == 0)
+		{
+			const int64_t at = _first.IndexOfAny(hay, length, i);
+			if (at < 0)
+				break;
+			i = (uint32_t)at;
+		}
+
+		state = next(state, hay[i++]);
+		for_each_output(state, [&](uint32_t n)
+		{
+			const uint32_t offset = i - n;
+			if (is_better_last(offset, n, match, found) && TextSearch::IsBoundaryMatch(hay, length, offset, n))
+			{
+				match = Match{ offset, n };
+				found = true;
+			}
+		});
+	}
+	return found;
+}
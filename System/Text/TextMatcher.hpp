@@ -0,0 +1,79 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+#include "System/Text/TextSearch.hpp"
+#include "System/Collections/List.hpp"
+
+// ==============================================================
+//  TextMatcher - a set of characters or strings compiled once and
+//  searched for together (IndexOfAny, Split, Replace)
+//  - Only single bytes (a List<Char>, or strings one byte long):
+//    a TextSearch::ByteSet, scanned 32 bytes at a time
+//  - Longer strings: an Aho-Corasick automaton, stored as a full
+//    transition table over the byte classes the patterns use. One
+//    table lookup per byte whatever the number of patterns; while
+//    no pattern is in progress, the ByteSet of first bytes skips
+//    ahead to the next byte that can start one
+//  - Find returns the leftmost match, the longest one when several
+//    start there (what Split and Replace cut out); FindLast the
+//    rightmost, also the longest at its start
+//  - Matches start and end on code point boundaries, like String's
+//    other searches. A Char therefore matches an ASCII character (or
+//    a stray byte of ill-formed text), never part of a sequence
+//  - Empty patterns are ignored. Read only once built: safe to share
+//    between threads
+// ==============================================================
+
+class TextMatcher
+{
+public:
+
+	// Byte range of a match
+	struct Match
+	{
+		u32 Offset;
+		u32 Length;
+	};
+
+	explicit TextMatcher(const List<Char>& chars);
+	explicit TextMatcher(const List<String>& patterns);
+	explicit TextMatcher(const List<StringView>& patterns);
+	TextMatcher(const List<StringView>& patterns, const List<Char>& chars);
+
+	inline Boolean IsEmpty() const noexcept { return _maxLength == 0; }
+	inline u32 GetMaxLength() const noexcept { return _maxLength; }
+
+	// First match at or after byte offset start
+	Boolean Find(const char* text, uint32_t length, uint32_t start, Match& match) const noexcept;
+
+	// Last match lying inside text[0, length). String sets scan the
+	// text from the start (the automaton only runs forwards).
+	Boolean FindLast(const char* text, uint32_t length, Match& match) const noexcept;
+
+private:
+
+	void build(const List<StringView>& patterns, const List<Char>& chars);
+	void add_pattern(const uint8_t* bytes, uint32_t length);
+
+	// Calls f(length) for every pattern that ends in this state
+	template<typename F>
+	inline void for_each_output(uint32_t state, F&& f) const noexcept
+	{
+		for (uint32_t s = _terminal[state] != 0 ? state : _outputLink[state]; s != 0; s = _outputLink[s])
+			f(_terminal[s]);
+	}
+
+	inline uint32_t next(uint32_t state, uint8_t b) const noexcept { return _next[state * _columns + _classes[b]]; }
+
+	TextSearch::ByteSet _first;     // bytes that start a pattern
+	bool _bytesOnly = true;         // every pattern is one byte long: _first is the whole matcher
+	uint32_t _maxLength = 0;
+
+	uint16_t _classes[256] = {};    // byte -> column of _next; 0 for bytes in no pattern
+	uint32_t _columns = 1;
+	List<uint32_t> _next;           // state * _columns + column -> state (0 is the root)
+	List<uint32_t> _terminal;       // length of the pattern spelled by the state, 0 if none
+	List<uint32_t> _outputLink;     // nearest proper suffix state that is terminal, 0 if none
+};
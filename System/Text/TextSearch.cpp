@@ -0,0 +1,373 @@
+#include "TextSearch.hpp"
+#include "System/Text/TextKernels.hpp"
+
+namespace TextSearch
+{
+	namespace
+	{
+		// Byte i of a buffer, front to back or back to front. Two-Way runs on
+		// either, so LastIndexOf is a forward search of the mirrored bytes.
+		struct Forward
+		{
+			const uint8_t* bytes;
+			inline uint8_t operator[](uint64_t i) const noexcept { return bytes[i]; }
+		};
+
+		struct Mirrored
+		{
+			const uint8_t* end;   // one past the last byte
+			inline uint8_t operator[](uint64_t i) const noexcept { return *(end - 1 - i); }
+		};
+
+		inline bool Matches(const uint8_t* a, const uint8_t* b, uint64_t length) noexcept
+		{
+			for (uint64_t i = 0; i < length; ++i)
+			{
+				if (a[i] != b[i])
+					return false;
+			}
+			return true;
+		}
+
+		// Start of the maximal suffix of the needle under one byte order (the
+		// reverse one with greater == false) minus one; the suffix's period.
+		template<typename Bytes>
+		uint64_t MaximalSuffix(Bytes n, uint64_t length, bool greater, uint64_t& period) noexcept
+		{
+			uint64_t ip = ~0ull;   // -1: wraps to 0 in ip + k
+			uint64_t jp = 0;
+			uint64_t k = 1;
+			uint64_t p = 1;
+
+			while (jp + k < length)
+			{
+				const uint8_t a = n[ip + k];
+				const uint8_t b = n[jp + k];
+				if (a == b)
+				{
+					if (k == p)
+					{
+						jp += p;
+						k = 1;
+					}
+					else
+						++k;
+				}
+				else if (greater ? a > b : a < b)
+				{
+					jp += k;
+					k = 1;
+					p = jp - ip;
+				}
+				else
+				{
+					ip = jp++;
+					k = p = 1;
+				}
+			}
+
+			period = p;
+			return ip;
+		}
+
+		template<typename Bytes>
+		void Prepare(TwoWayTable& table, Bytes n, uint64_t length) noexcept
+		{
+			for (uint32_t b = 0; b < 256; ++b)
+				table.Shift[b] = 0;
+			for (uint64_t i = 0; i < length; ++i)
+				table.Shift[n[i]] = (uint32_t)(i + 1);
+
+			// critical factorization: the later of the two maximal suffixes
+			uint64_t p0 = 0;
+			uint64_t p = 0;
+			uint64_t ms = MaximalSuffix(n, length, true, p0);
+			const uint64_t ip = MaximalSuffix(n, length, false, p);
+			if (ip + 1 > ms + 1)
+				ms = ip;
+			else
+				p = p0;
+
+			// periodic needle: after a full match of the left half, the next
+			// length - p bytes are already known to match
+			bool periodic = true;
+			for (uint64_t i = 0; i < ms + 1; ++i)
+			{
+				if (n[i] != n[i + p])
+				{
+					periodic = false;
+					break;
+				}
+			}
+
+			table.Split = ms + 1;
+			if (periodic)
+			{
+				table.Period = p;
+				table.Memory = length - p;
+			}
+			else
+			{
+				table.Period = (ms > length - ms - 1 ? ms : length - ms - 1) + 1;
+				table.Memory = 0;
+			}
+		}
+
+		template<typename Bytes>
+		int64_t Search(const TwoWayTable& table, Bytes n, uint64_t length, Bytes h, uint64_t hayLength, uint64_t pos) noexcept
+		{
+			const uint64_t split = table.Split;
+			uint64_t memory = 0;
+
+			while (pos + length <= hayLength)
+			{
+				// Horspool: line the window's last byte up with its last
+				// occurrence in the needle, or jump past it entirely
+				const uint32_t shift = table.Shift[h[pos + length - 1]];
+				if (shift == 0)
+				{
+					pos += length;
+					memory = 0;
+					continue;
+				}
+				if (shift != length)
+				{
+					uint64_t k = length - shift;
+					if (k < memory)
+						k = memory;
+					pos += k;
+					memory = 0;
+					continue;
+				}
+
+				// right half, left to right
+				uint64_t k = split > memory ? split : memory;
+				while (k < length && n[k] == h[pos + k])
+					++k;
+				if (k < length)
+				{
+					pos += k - split + 1;
+					memory = 0;
+					continue;
+				}
+
+				// left half, right to left
+				k = split;
+				while (k > memory && n[k - 1] == h[pos + k - 1])
+					--k;
+				if (k <= memory)
+					return (int64_t)pos;
+
+				pos += table.Period;
+				memory = table.Memory;
+			}
+			return -1;
+		}
+
+		inline int64_t TwoWay(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length, uint64_t start, const TwoWayTable* prepared) noexcept
+		{
+			if (prepared != nullptr)
+				return Search(*prepared, Forward{ needle }, length, Forward{ hay }, hayLength, start);
+
+			TwoWayTable table;
+			Prepare(table, Forward{ needle }, length);
+			return Search(table, Forward{ needle }, length, Forward{ hay }, hayLength, start);
+		}
+
+		// Last match inside hay[0, hayLength): the first one in the mirror image
+		inline int64_t TwoWayLast(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length) noexcept
+		{
+			TwoWayTable table;
+			Prepare(table, Mirrored{ needle + length }, length);
+			const int64_t r = Search(table, Mirrored{ needle + length }, length, Mirrored{ hay + hayLength }, hayLength, 0);
+			return r < 0 ? -1 : (int64_t)(hayLength - (uint64_t)r - length);
+		}
+
+		// Once failed candidates have cost this much more than the ground
+		// they covered, the rest goes to Two-Way
+		inline bool OverBudget(uint64_t work, uint64_t progress) noexcept
+		{
+			return work > 4 * progress + 256;
+		}
+
+		// Needles of 2 to FilterLimit bytes, start + length <= hayLength
+		int64_t Filter(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length, uint64_t start, const TwoWayTable* prepared) noexcept
+		{
+			const uint8_t first = needle[0];
+			const uint8_t last = needle[length - 1];
+
+			uint64_t pos = start;
+			uint64_t work = 0;
+			while (pos + length <= hayLength)
+			{
+				const uint64_t found = TextKernels::FindPair(hay + pos, hayLength - pos, first, last, length - 1);
+				if (found == hayLength - pos)
+					return -1;
+
+				pos += found;
+				if (Matches(hay + pos + 1, needle + 1, length - 2))
+					return (int64_t)pos;
+
+				++pos;
+				work += length;
+				if (OverBudget(work, pos - start))
+					return TwoWay(hay, hayLength, needle, length, pos, prepared);
+			}
+			return -1;
+		}
+
+		int64_t FilterLast(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length) noexcept
+		{
+			const uint8_t first = needle[0];
+			const uint8_t last = needle[length - 1];
+
+			// matches must lie inside hay[0, end)
+			uint64_t end = hayLength;
+			uint64_t work = 0;
+			while (end >= length)
+			{
+				const uint64_t found = TextKernels::FindPairLast(hay, end, first, last, length - 1);
+				if (found == end)
+					return -1;
+
+				if (Matches(hay + found + 1, needle + 1, length - 2))
+					return (int64_t)found;
+
+				end = found + length - 1;
+				work += length;
+				if (OverBudget(work, hayLength - end))
+					return TwoWayLast(hay, end, needle, length);
+			}
+			return -1;
+		}
+
+		int64_t Find(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length, uint64_t start, const TwoWayTable* prepared) noexcept
+		{
+			if (start > hayLength)
+				return -1;
+			if (length == 0)
+				return (int64_t)start;
+			if (length > hayLength - start)
+				return -1;
+
+			if (length == 1)
+			{
+				const uint64_t found = TextKernels::FindPair(hay + start, hayLength - start, needle[0], needle[0], 0);
+				return found == hayLength - start ? -1 : (int64_t)(start + found);
+			}
+
+			if (length <= FilterLimit)
+				return Filter(hay, hayLength, needle, length, start, prepared);
+
+			return TwoWay(hay, hayLength, needle, length, start, prepared);
+		}
+	}
+
+	int64_t IndexOf(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength, uint64_t start) noexcept
+	{
+		return Find(hay, hayLength, needle, needleLength, start, nullptr);
+	}
+
+	int64_t LastIndexOf(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength) noexcept
+	{
+		if (needleLength == 0)
+			return (int64_t)hayLength;
+		if (needleLength > hayLength)
+			return -1;
+
+		if (needleLength == 1)
+		{
+			const uint64_t found = TextKernels::FindPairLast(hay, hayLength, needle[0], needle[0], 0);
+			return found == hayLength ? -1 : (int64_t)found;
+		}
+
+		if (needleLength <= FilterLimit)
+			return FilterLast(hay, hayLength, needle, needleLength);
+
+		return TwoWayLast(hay, hayLength, needle, needleLength);
+	}
+
+	int64_t IndexOfUTF8(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength, uint64_t start) noexcept
+	{
+		int64_t at = IndexOf(hay, hayLength, needle, needleLength, start);
+		while (at >= 0 && !IsBoundaryMatch(hay, hayLength, (uint64_t)at, needleLength))
+			at = IndexOf(hay, hayLength, needle, needleLength, (uint64_t)at + 1);
+		return at;
+	}
+
+	int64_t LastIndexOfUTF8(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength) noexcept
+	{
+		int64_t at = LastIndexOf(hay, hayLength, needle, needleLength);
+		while (at >= 0 && !IsBoundaryMatch(hay, hayLength, (uint64_t)at, needleLength))
+			at = LastIndexOf(hay, (uint64_t)at + needleLength - 1, needle, needleLength);   // ends before this one
+		return at;
+	}
+
+	Searcher::Searcher(const uint8_t* needle, uint64_t length) noexcept
+		: _needle(needle), _length(length)
+	{
+		if (length >= 2)
+			Prepare(_table, Forward{ needle }, length);
+	}
+
+	int64_t Searcher::IndexOf(const uint8_t* hay, uint64_t hayLength, uint64_t start) const noexcept
+	{
+		return Find(hay, hayLength, _needle, _length, start, &_table);
+	}
+
+	int64_t Searcher::IndexOfUTF8(const uint8_t* hay, uint64_t hayLength, uint64_t start) const noexcept
+	{
+		int64_t at = IndexOf(hay, hayLength, start);
+		while (at >= 0 && !IsBoundaryMatch(hay, hayLength, (uint64_t)at, _length))
+			at = IndexOf(hay, hayLength, (uint64_t)at + 1);
+		return at;
+	}
+
+	uint64_t Searcher::Count(const uint8_t* hay, uint64_t hayLength) const noexcept
+	{
+		if (_length == 0)
+			return 0;
+
+		uint64_t count = 0;
+		for (int64_t at = IndexOfUTF8(hay, hayLength, 0); at >= 0; at = IndexOfUTF8(hay, hayLength, (uint64_t)at + _length))
+			++count;
+		return count;
+	}
+
+	ByteSet::ByteSet() noexcept
+		: _table{}
+	{
+	}
+
+	ByteSet::ByteSet(const uint8_t* bytes, uint64_t count) noexcept
+		: _table{}
+	{
+		for (uint64_t i = 0; i < count; ++i)
+			Add(bytes[i]);
+	}
+
+	bool ByteSet::IsEmpty() const noexcept
+	{
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if ((_table.Rows[0][i] | _table.Rows[1][i]) != 0)
+				return false;
+		}
+		return true;
+	}
+
+	int64_t ByteSet::IndexOfAny(const uint8_t* hay, uint64_t hayLength, uint64_t start) const noexcept
+	{
+		if (start >= hayLength)
+			return -1;
+
+		const uint64_t found = TextKernels::FindAny(hay + start, hayLength - start, _table);
+		return found == hayLength - start ? -1 : (int64_t)(start + found);
+	}
+
+	int64_t ByteSet::LastIndexOfAny(const uint8_t* hay, uint64_t hayLength) const noexcept
+	{
+		const uint64_t found = TextKernels::FindAnyLast(hay, hayLength, _table);
+		return found == hayLength ? -1 : (int64_t)found;
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+
+#include "System/Text/TextKernels.hpp"
+
+// ==============================================================
+//  TextSearch - substring search on raw bytes
+//  - Short needles (up to FilterLimit bytes): the TextKernels pair
+//    filter finds positions where the first and the last byte of
+//    the needle both match, and only those are compared in full
+//  - Long needles, and short ones whose candidates keep failing
+//    (periodic haystacks such as "aaaa...ab"): Two-Way (Crochemore
+//    and Perrin, 1991) with a Horspool shift on the window's last
+//    byte. Linear in the worst case, sublinear on typical text
+//  - LastIndexOf runs the same code over the mirrored bytes
+//  - The UTF8 variants only accept matches that start and end on
+//    code point boundaries. Valid UTF-8 in valid UTF-8 always does;
+//    they matter for needles or haystacks that cut a sequence
+//  - Searcher prepares a needle once for loops (Replace, Split)
+//  - ByteSet finds the first / last byte out of a set (TextKernels
+//    FindAny); TextMatcher builds on it for sets of strings
+//  - Offsets are bytes; -1 when there is no match
+// ==============================================================
+
+namespace TextSearch
+{
+	// Needles up to this many bytes go through the pair filter first
+	constexpr uint64_t FilterLimit = 32;
+
+	// Two-Way factorization of a needle and the Horspool shift table
+	// (as in musl's memmem)
+	struct TwoWayTable
+	{
+		uint64_t Split;        // critical position: the right half starts here
+		uint64_t Period;       // shift after the left half matched
+		uint64_t Memory;       // bytes known to match after that shift (periodic needles)
+		uint32_t Shift[256];   // last position + 1 of each byte in the needle, 0 if absent
+	};
+
+	// First match at or after start
+	int64_t IndexOf(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength, uint64_t start = 0) noexcept;
+
+	// Last match lying entirely inside hay[0, hayLength)
+	int64_t LastIndexOf(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength) noexcept;
+
+	int64_t IndexOfUTF8(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength, uint64_t start = 0) noexcept;
+	int64_t LastIndexOfUTF8(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t needleLength) noexcept;
+
+	// Code point boundary at both ends of hay[offset, offset + length)
+	inline bool IsBoundaryMatch(const uint8_t* hay, uint64_t hayLength, uint64_t offset, uint64_t length) noexcept
+	{
+		const uint64_t end = offset + length;
+		return (offset == hayLength || (hay[offset] & 0xC0) != 0x80)
+			&& (end == hayLength || (hay[end] & 0xC0) != 0x80);
+	}
+
+	// A needle prepared once and searched for many times. Borrows the
+	// needle bytes: they must outlive the Searcher.
+	class Searcher
+	{
+	public:
+
+		Searcher(const uint8_t* needle, uint64_t length) noexcept;
+
+		inline uint64_t GetLength() const noexcept { return _length; }
+
+		int64_t IndexOf(const uint8_t* hay, uint64_t hayLength, uint64_t start = 0) const noexcept;
+		int64_t IndexOfUTF8(const uint8_t* hay, uint64_t hayLength, uint64_t start = 0) const noexcept;
+
+		// Non-overlapping matches, left to right (what Replace substitutes)
+		uint64_t Count(const uint8_t* hay, uint64_t hayLength) const noexcept;
+
+	private:
+
+		const uint8_t* _needle;
+		uint64_t _length;
+		TwoWayTable _table;    // prepared for needles of 2 bytes or more
+	};
+
+	// A set of bytes, looked up 32 at a time where the CPU allows
+	class ByteSet
+	{
+	public:
+
+		ByteSet() noexcept;
+		ByteSet(const uint8_t* bytes, uint64_t count) noexcept;
+
+		inline void Add(uint8_t b) noexcept { TextKernels::Add(_table, b); }
+		inline bool Contains(uint8_t b) const noexcept { return TextKernels::Contains(_table, b); }
+		bool IsEmpty() const noexcept;
+
+		// First byte of the set at or after start / last one in hay[0, hayLength)
+		int64_t IndexOfAny(const uint8_t* hay, uint64_t hayLength, uint64_t start = 0) const noexcept;
+		int64_t LastIndexOfAny(const uint8_t* hay, uint64_t hayLength) const noexcept;
+
+	private:
+
+		TextKernels::ByteSetTable _table;
+	};
+}
@@ -5,6 +5,7 @@
 
 #include "System/Types.hpp"
 #include "System/Collections/List.hpp"
+#include "System/Text/TextKernels.hpp"
 #include "unicode/UnicodeNormalization_utils.hpp"
 #include "unicode/UnicodeCase_utils.hpp"
 
@@ -125,6 +126,13 @@ namespace UTF8
 		return r;
 	}
 
+	// Well-formed UTF-8: no overlong forms, surrogates, values above
+	// U+10FFFF or truncated sequences
+	inline bool IsValid(const Char* bytes, uint32_t len) noexcept
+	{
+		return TextKernels::IsValidUTF8(bytes, len);
+	}
+
 	// ---------------------------------------------
 	// 1) Decode UTF-8 → List<CodePoint>
 	// ---------------------------------------------
@@ -137,6 +145,38 @@ namespace UTF8
 		out.EnsureCapacity(len); // worst-case: 1 byte → 1 CP
 
 		uint32_t pos = 0;
+
+		// Validated in bulk: every sequence is known to be well formed
+		if (TextKernels::IsValidUTF8(bytes, len))
+		{
+			const uint8_t* p = reinterpret_cast<const uint8_t*>(bytes);
+			while (pos < len)
+			{
+				uint32_t b0 = p[pos];
+				if (b0 < 0x80)
+				{
+					out.Add(CodePoint(static_cast<char32_t>(b0)));
+					pos += 1;
+				}
+				else if (b0 < 0xE0)
+				{
+					out.Add(CodePoint(static_cast<char32_t>(((b0 & 0x1F) << 6) | (p[pos + 1] & 0x3F))));
+					pos += 2;
+				}
+				else if (b0 < 0xF0)
+				{
+					out.Add(CodePoint(static_cast<char32_t>(((b0 & 0x0F) << 12) | ((p[pos + 1] & 0x3F) << 6) | (p[pos + 2] & 0x3F))));
+					pos += 3;
+				}
+				else
+				{
+					out.Add(CodePoint(static_cast<char32_t>(((b0 & 0x07) << 18) | ((p[pos + 1] & 0x3F) << 12) | ((p[pos + 2] & 0x3F) << 6) | (p[pos + 3] & 0x3F))));
+					pos += 4;
+				}
+			}
+			return;
+		}
+
 		while (pos < len)
 		{
 			auto r = UTF8::decode_utf8(bytes + pos, len - pos);
@@ -181,10 +221,12 @@ namespace UTF8
 
 		uint32_t cpCount = in.Count();
 
+		Memory::ScratchScope scratch(out.GetArena());
+		List<CodePoint> seq(scratch.GetArena(), 4);
+
 		for (uint32_t i = 0; i < cpCount; ++i)
 		{
-			List<CodePoint> seq;
-			seq.EnsureCapacity(4);
+			seq.FastClear();
 
 			UnicodeCase::map_to_casefold_sequence_nostd(
 				in[i],
@@ -214,16 +256,18 @@ namespace UTF8
 	// ---------------------------------------------
 	inline void Normalize(const List<CodePoint>& in, ::NormalizationForm form, List<CodePoint>& out)
 	{
-		out.Clear();
-
 		if (in.Count() == 0)
+		{
+			out.Clear();
 			return;
+		}
 
 		// 1) Decompose
 		bool compat = (form == ::NormalizationForm::NFKC || form == ::NormalizationForm::NFKD);
 
-		List<CodePoint> temp;
-		temp.EnsureCapacity(in.Count() * 3);
+		// 'in' and 'out' may be the same list: work on scratch and copy back
+		Memory::ScratchScope scratch(out.GetArena());
+		List<CodePoint> temp(scratch.GetArena(), in.Count() * 3);
 
 		for (uint32_t i = 0; i < in.Count(); ++i)
 		{
@@ -246,7 +290,8 @@ namespace UTF8
 		}
 
 		// final result
-		out = temp;
+		out.FastClear();
+		out.AddRange(temp.Data(), temp.Count());
 	}
 
 	// ---------------------------------------------
@@ -256,8 +301,9 @@ namespace UTF8
 	inline void FoldAndNormalize(const Char* bytes, uint32_t len, const char* locale,
 		List<CodePoint>& out)
 	{
-		List<CodePoint> cps;
-		List<CodePoint> folded;
+		Memory::ScratchScope scratch(out.GetArena());
+		List<CodePoint> cps(scratch.GetArena());
+		List<CodePoint> folded(scratch.GetArena());
 
 		// decode
 		Decode(bytes, len, cps);
@@ -312,7 +358,8 @@ namespace UTF8
 	// ---------------------------------------------
 	inline int CompareIgnoreCase(const List<CodePoint>& a, const List<CodePoint>& b, const char* locale)
 	{
-		List<CodePoint> fa, fb;
+		Memory::ScratchScope scratch;
+		List<CodePoint> fa(scratch.GetArena()), fb(scratch.GetArena());
 		CaseFold(a, locale, (uint32_t)strlen(locale), fa);
 		CaseFold(b, locale, (uint32_t)strlen(locale), fb);
 
@@ -383,7 +430,8 @@ namespace UTF8
 
 	inline bool StartsWithIgnoreCase(const List<CodePoint>& hay, const List<CodePoint>& nee, const char* locale)
 	{
-		List<CodePoint> fh, fn;
+		Memory::ScratchScope scratch;
+		List<CodePoint> fh(scratch.GetArena()), fn(scratch.GetArena());
 
 		CaseFold(hay, locale, (uint32_t)strlen(locale), fh);
 		CaseFold(nee, locale, (uint32_t)strlen(locale), fn);
@@ -396,7 +444,8 @@ namespace UTF8
 
 	inline bool EndsWithIgnoreCase(const List<CodePoint>& hay, const List<CodePoint>& nee, const char* locale)
 	{
-		List<CodePoint> fh, fn;
+		Memory::ScratchScope scratch;
+		List<CodePoint> fh(scratch.GetArena()), fn(scratch.GetArena());
 
 		CaseFold(hay, locale, (uint32_t)strlen(locale), fh);
 		CaseFold(nee, locale, (uint32_t)strlen(locale), fn);
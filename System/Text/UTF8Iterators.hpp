@@ -0,0 +1,427 @@
+#pragma once
+
+#include "System/Types.hpp"
+#include "System/Text/UTF8.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ==============================================================
+//  UTF-8 iterators - code points and grapheme clusters decoded
+//  in place from the bytes
+//  - Nothing is allocated; each step decodes the next sequence,
+//    so a scan can stop as soon as it has its answer
+//  - Ill-formed bytes read as U+FFFD, one per byte, exactly like
+//    UTF8::Decode
+//  - Forward and reverse versions; on well-formed input both visit
+//    the same items (a reverse walk may group stray bytes of
+//    ill-formed input differently)
+//  - Grapheme clusters follow UnicodeCase::IsGraphemeBreak and are
+//    returned as StringViews over the original bytes
+//  - The bytes must outlive the iterators and ranges
+// ==============================================================
+
+namespace UTF8
+{
+	// The code point starting at pos, its byte length in length.
+	inline CodePoint DecodeAt(const Char* bytes, uint32_t len, uint32_t pos, uint32_t& length) noexcept
+	{
+		const uint8_t b0 = static_cast<uint8_t>(bytes[pos]);
+		if (b0 < 0x80)
+		{
+			length = 1;
+			return CodePoint(static_cast<char32_t>(b0));
+		}
+
+		auto r = decode_utf8(bytes + pos, len - pos);
+		if (!r.IsValid || r.Length == 0)
+		{
+			length = 1;
+			return CodePoint(0xFFFD);
+		}
+
+		length = (uint32_t)r.Length;
+		return r.cp;
+	}
+
+	// The code point ending right before pos (pos > 0), its byte length in length.
+	inline CodePoint DecodeBefore(const Char* bytes, uint32_t pos, uint32_t& length) noexcept
+	{
+		const uint8_t last = static_cast<uint8_t>(bytes[pos - 1]);
+		if (last < 0x80)
+		{
+			length = 1;
+			return CodePoint(static_cast<char32_t>(last));
+		}
+
+		// back over up to three continuation bytes to the lead
+		uint32_t start = pos - 1;
+		const uint32_t limit = pos > 4 ? pos - 4 : 0;
+		while (start > limit && (static_cast<uint8_t>(bytes[start]) & 0xC0) == 0x80)
+			--start;
+
+		auto r = decode_utf8(bytes + start, pos - start);
+		if (r.IsValid && start + (uint32_t)r.Length == pos)
+		{
+			length = (uint32_t)r.Length;
+			return r.cp;
+		}
+
+		length = 1;
+		return CodePoint(0xFFFD);
+	}
+
+	class CodePointIterator
+	{
+	public:
+
+		CodePointIterator() noexcept = default;
+
+		CodePointIterator(const Char* bytes, uint32_t length, uint32_t offset = 0) noexcept
+			: _bytes(bytes), _length(length), _offset(offset)
+		{
+			Load();
+		}
+
+		inline CodePoint operator*() const noexcept { return _current; }
+
+		// Byte position and length of the current code point
+		inline uint32_t ByteOffset() const noexcept { return _offset; }
+		inline uint32_t ByteLength() const noexcept { return _size; }
+
+		inline bool IsEnd() const noexcept { return _offset >= _length; }
+
+		CodePointIterator& operator++() noexcept
+		{
+			_offset += _size;
+			Load();
+			return *this;
+		}
+
+		// Iterators over the same bytes compare by position
+		inline friend bool operator==(const CodePointIterator& a, const CodePointIterator& b) noexcept { return a._offset == b._offset; }
+		inline friend bool operator!=(const CodePointIterator& a, const CodePointIterator& b) noexcept { return a._offset != b._offset; }
+
+	private:
+
+		void Load() noexcept
+		{
+			if (_offset < _length)
+				_current = DecodeAt(_bytes, _length, _offset, _size);
+			else
+				_size = 0;
+		}
+
+		const Char* _bytes = nullptr;
+		uint32_t _length = 0;
+		uint32_t _offset = 0;
+		uint32_t _size = 0;
+		CodePoint _current;
+	};
+
+	// Walks from the end; the current code point is the one ending at Position().
+	class ReverseCodePointIterator
+	{
+	public:
+
+		ReverseCodePointIterator() noexcept = default;
+
+		ReverseCodePointIterator(const Char* bytes, uint32_t position) noexcept
+			: _bytes(bytes), _position(position)
+		{
+			Load();
+		}
+
+		inline CodePoint operator*() const noexcept { return _current; }
+
+		inline uint32_t Position() const noexcept { return _position; }
+		inline uint32_t ByteOffset() const noexcept { return _position - _size; }
+		inline uint32_t ByteLength() const noexcept { return _size; }
+
+		inline bool IsEnd() const noexcept { return _position == 0; }
+
+		ReverseCodePointIterator& operator++() noexcept
+		{
+			_position -= _size;
+			Load();
+			return *this;
+		}
+
+		inline friend bool operator==(const ReverseCodePointIterator& a, const ReverseCodePointIterator& b) noexcept { return a._position == b._position; }
+		inline friend bool operator!=(const ReverseCodePointIterator& a, const ReverseCodePointIterator& b) noexcept { return a._position != b._position; }
+
+	private:
+
+		void Load() noexcept
+		{
+			if (_position > 0)
+				_current = DecodeBefore(_bytes, _position, _size);
+			else
+				_size = 0;
+		}
+
+		const Char* _bytes = nullptr;
+		uint32_t _position = 0;
+		uint32_t _size = 0;
+		CodePoint _current;
+	};
+
+	class GraphemeIterator
+	{
+	public:
+
+		GraphemeIterator() noexcept = default;
+
+		// offset must be a cluster boundary; the code points before it are
+		// read back only as far as the break rules need
+		GraphemeIterator(const Char* bytes, uint32_t length, uint32_t offset = 0) noexcept
+			: _bytes(bytes), _length(length), _start(offset), _end(offset)
+		{
+			Prime();
+			Load();
+		}
+
+		// The past-the-end position, without decoding anything
+		static GraphemeIterator End(const Char* bytes, uint32_t length) noexcept
+		{
+			GraphemeIterator it;
+			it._bytes = bytes;
+			it._length = length;
+			it._start = length;
+			it._end = length;
+			return it;
+		}
+
+		inline StringView operator*() const noexcept
+		{
+			return StringView(reinterpret_cast<const char*>(_bytes + _start), _end - _start);
+		}
+
+		// Byte position and length of the current cluster
+		inline uint32_t ByteOffset() const noexcept { return _start; }
+		inline uint32_t ByteLength() const noexcept { return _end - _start; }
+
+		inline bool IsEnd() const noexcept { return _start >= _length; }
+
+		GraphemeIterator& operator++() noexcept
+		{
+			_start = _end;
+			Load();
+			return *this;
+		}
+
+		inline friend bool operator==(const GraphemeIterator& a, const GraphemeIterator& b) noexcept { return a._start == b._start; }
+		inline friend bool operator!=(const GraphemeIterator& a, const GraphemeIterator& b) noexcept { return a._start != b._start; }
+
+	private:
+
+		using GBP = UnicodeCase::GBP;
+
+		// The break rule context left by the code points before _start
+		void Prime() noexcept
+		{
+			uint32_t size;
+			for (uint32_t k = _start; k > 0 && UnicodeCase::IsRegionalIndicator(DecodeBefore(_bytes, k, size)); k -= size)
+				++_regionalRun;
+
+			for (uint32_t k = _start; k > 0; k -= size)
+			{
+				const GBP g = UnicodeCase::GetGBP(DecodeBefore(_bytes, k, size));
+				if (g != GBP::Extend)
+				{
+					_pictographicAtPrev = g == GBP::ExtendedPictographic;
+					break;
+				}
+			}
+		}
+
+		// prev moves on to g
+		inline void Consume(GBP g) noexcept
+		{
+			_pictographicBeforePrev = _pictographicAtPrev;
+			_pictographicAtPrev = g == GBP::ExtendedPictographic || (g == GBP::Extend && _pictographicAtPrev);
+			_regionalRun = g == GBP::RegionalIndicator ? _regionalRun + 1 : 0;
+			_prev = g;
+		}
+
+		void Load() noexcept
+		{
+			if (_start >= _length)
+			{
+				_end = _start;
+				return;
+			}
+
+			uint32_t size;
+			Consume(UnicodeCase::GetGBP(DecodeAt(_bytes, _length, _start, size)));
+			_end = _start + size;
+
+			while (_end < _length)
+			{
+				const GBP next = UnicodeCase::GetGBP(DecodeAt(_bytes, _length, _end, size));
+				const bool brk = UnicodeCase::IsGraphemeBreak(_prev, next,
+					[this]() noexcept { return _pictographicBeforePrev; },
+					[this]() noexcept { return _regionalRun; });
+				if (brk)
+					break;
+
+				Consume(next);
+				_end += size;
+			}
+		}
+
+		const Char* _bytes = nullptr;
+		uint32_t _length = 0;
+		uint32_t _start = 0;
+		uint32_t _end = 0;
+
+		GBP _prev = GBP::Other;
+		uint32_t _regionalRun = 0;
+		bool _pictographicAtPrev = false;
+		bool _pictographicBeforePrev = false;
+	};
+
+	// Walks clusters from the end; the current one ends at Position().
+	class ReverseGraphemeIterator
+	{
+	public:
+
+		ReverseGraphemeIterator() noexcept = default;
+
+		// position must be a cluster boundary
+		ReverseGraphemeIterator(const Char* bytes, uint32_t position) noexcept
+			: _bytes(bytes), _start(position), _end(position)
+		{
+			Load();
+		}
+
+		inline StringView operator*() const noexcept
+		{
+			return StringView(reinterpret_cast<const char*>(_bytes + _start), _end - _start);
+		}
+
+		inline uint32_t Position() const noexcept { return _end; }
+		inline uint32_t ByteOffset() const noexcept { return _start; }
+		inline uint32_t ByteLength() const noexcept { return _end - _start; }
+
+		inline bool IsEnd() const noexcept { return _end == 0; }
+
+		ReverseGraphemeIterator& operator++() noexcept
+		{
+			_end = _start;
+			Load();
+			return *this;
+		}
+
+		inline friend bool operator==(const ReverseGraphemeIterator& a, const ReverseGraphemeIterator& b) noexcept { return a._end == b._end; }
+		inline friend bool operator!=(const ReverseGraphemeIterator& a, const ReverseGraphemeIterator& b) noexcept { return a._end != b._end; }
+
+	private:
+
+		using GBP = UnicodeCase::GBP;
+
+		// Extends the cluster ending at _end backwards until the rules break;
+		// the extra context (GB11, GB12/13) is read further back only when asked.
+		void Load() noexcept
+		{
+			if (_end == 0)
+			{
+				_start = 0;
+				return;
+			}
+
+			uint32_t size;
+			GBP next = UnicodeCase::GetGBP(DecodeBefore(_bytes, _end, size));
+			uint32_t start = _end - size;
+
+			while (start > 0)
+			{
+				const GBP prev = UnicodeCase::GetGBP(DecodeBefore(_bytes, start, size));
+				const uint32_t prevStart = start - size;
+
+				auto pictographicBeforePrev = [this, prevStart]() noexcept
+				{
+					uint32_t n;
+					for (uint32_t k = prevStart; k > 0; k -= n)
+					{
+						const GBP g = UnicodeCase::GetGBP(DecodeBefore(_bytes, k, n));
+						if (g != GBP::Extend)
+							return g == GBP::ExtendedPictographic;
+					}
+					return false;
+				};
+
+				auto regionalRunAtPrev = [this, prevStart]() noexcept
+				{
+					uint32_t run = 1;
+					uint32_t n;
+					for (uint32_t k = prevStart; k > 0 && UnicodeCase::IsRegionalIndicator(DecodeBefore(_bytes, k, n)); k -= n)
+						++run;
+					return run;
+				};
+
+				if (UnicodeCase::IsGraphemeBreak(prev, next, pictographicBeforePrev, regionalRunAtPrev))
+					break;
+
+				start = prevStart;
+				next = prev;
+			}
+
+			_start = start;
+		}
+
+		const Char* _bytes = nullptr;
+		uint32_t _start = 0;
+		uint32_t _end = 0;
+	};
+
+	// begin()/end() pair for range-for
+	template<typename Iterator>
+	class IteratorRange
+	{
+	public:
+
+		IteratorRange(Iterator first, Iterator last) noexcept
+			: _first(first), _last(last) {
+		}
+
+		inline Iterator begin() const noexcept { return _first; }
+		inline Iterator end() const noexcept { return _last; }
+
+	private:
+
+		Iterator _first;
+		Iterator _last;
+	};
+
+	using CodePointRange = IteratorRange<CodePointIterator>;
+	using ReverseCodePointRange = IteratorRange<ReverseCodePointIterator>;
+	using GraphemeRange = IteratorRange<GraphemeIterator>;
+	using ReverseGraphemeRange = IteratorRange<ReverseGraphemeIterator>;
+
+	inline CodePointRange CodePoints(const Char* bytes, uint32_t len) noexcept
+	{
+		return CodePointRange(CodePointIterator(bytes, len, 0), CodePointIterator(bytes, len, len));
+	}
+
+	inline ReverseCodePointRange ReverseCodePoints(const Char* bytes, uint32_t len) noexcept
+	{
+		return ReverseCodePointRange(ReverseCodePointIterator(bytes, len), ReverseCodePointIterator(bytes, 0));
+	}
+
+	inline GraphemeRange Graphemes(const Char* bytes, uint32_t len) noexcept
+	{
+		return GraphemeRange(GraphemeIterator(bytes, len, 0), GraphemeIterator::End(bytes, len));
+	}
+
+	inline ReverseGraphemeRange ReverseGraphemes(const Char* bytes, uint32_t len) noexcept
+	{
+		return ReverseGraphemeRange(ReverseGraphemeIterator(bytes, len), ReverseGraphemeIterator(bytes, 0));
+	}
+
+	inline uint32_t CountGraphemes(const Char* bytes, uint32_t len) noexcept
+	{
+		uint32_t count = 0;
+		for (GraphemeIterator it(bytes, len); !it.IsEnd(); ++it)
+			++count;
+		return count;
+	}
+}
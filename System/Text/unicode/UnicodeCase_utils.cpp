@@ -1,4 +1,5 @@
 #include "UnicodeCase_utils.hpp"
+#include "System/Text/UTF8Iterators.hpp"
 
 namespace UnicodeCase
 {
@@ -67,6 +68,33 @@ namespace UnicodeCase
 		return !(foundBefore && foundAfter);
 	}
 
+	bool apply_final_sigma_context(const Char* bytes, uint32_t len, uint32_t offset) noexcept
+	{
+		if (offset >= len)
+			return false;
+
+		bool foundBefore = false;
+		for (UTF8::ReverseCodePointIterator it(bytes, offset); !it.IsEnd(); ++it)
+		{
+			if (is_cased(*it)) {
+				foundBefore = true;
+				break;
+			}
+		}
+
+		bool foundAfter = false;
+		UTF8::CodePointIterator it(bytes, len, offset);
+		for (++it; !it.IsEnd(); ++it)
+		{
+			if (is_letter(*it)) {
+				foundAfter = true;
+				break;
+			}
+		}
+
+		return !(foundBefore && foundAfter);
+	}
+
 	void map_to_upper_sequence_nostd(
 		CodePoint cp,
 		const char* localeBytes,
@@ -103,12 +131,14 @@ namespace UnicodeCase
 		output.Add(CodePoint(to_upper_simple((uint32_t)cp)));
 	}
 
-	void map_to_lower_sequence_nostd(
+	// finalSigma() decides the Final_Sigma condition; it is only asked for
+	// the code points that carry it
+	template<typename FinalSigma>
+	static void map_to_lower_sequence(
 		CodePoint cp,
 		const char* localeBytes,
 		uint32_t localeLen,
-		const List<CodePoint>& context,
-		uint32_t index,
+		FinalSigma&& finalSigma,
 		List<CodePoint>& output) noexcept
 	{
 		output.Clear();
@@ -128,7 +158,7 @@ namespace UnicodeCase
 				(e.condition[0] == 'a' && e.condition[1] == 'z'))
 				use = isTurkic;
 			else if (e.condition[0] == 'F')
-				use = apply_final_sigma_context(context, index);
+				use = finalSigma();
 
 			if (use)
 			{
@@ -144,6 +174,31 @@ namespace UnicodeCase
 		output.Add(CodePoint(to_lower_simple((uint32_t)cp)));
 	}
 
+	void map_to_lower_sequence_nostd(
+		CodePoint cp,
+		const char* localeBytes,
+		uint32_t localeLen,
+		const List<CodePoint>& context,
+		uint32_t index,
+		List<CodePoint>& output) noexcept
+	{
+		map_to_lower_sequence(cp, localeBytes, localeLen,
+			[&]() noexcept { return apply_final_sigma_context(context, index); }, output);
+	}
+
+	void map_to_lower_sequence_nostd(
+		CodePoint cp,
+		const char* localeBytes,
+		uint32_t localeLen,
+		const Char* context,
+		uint32_t contextLen,
+		uint32_t offset,
+		List<CodePoint>& output) noexcept
+	{
+		map_to_lower_sequence(cp, localeBytes, localeLen,
+			[&]() noexcept { return apply_final_sigma_context(context, contextLen, offset); }, output);
+	}
+
 	void map_to_casefold_sequence_nostd(
 		CodePoint cp,
 		const char* localeBytes,
@@ -240,64 +295,26 @@ namespace UnicodeCase
 	bool IsGraphemeBreak(CodePoint prev, CodePoint next,
 		const List<CodePoint>& cps, uint32_t len, uint32_t index) noexcept
 	{
-		GBP a = GetGBP(prev);
-		GBP b = GetGBP(next);
-
-		// GB3: CR × LF
-		if (a == GBP::CR && b == GBP::LF)
-			return false;
-
-		// GB4 / GB5: break before or after Control / CR / LF
-		if (a == GBP::Control || a == GBP::CR || a == GBP::LF) return true;
-		if (b == GBP::Control || b == GBP::CR || b == GBP::LF) return true;
-
-		// GB9: × Extend
-		if (b == GBP::Extend)
-			return false;
-
-		// GB9a: × ZWJ
-		if (b == GBP::ZWJ)
-			return false;
-
-		// GB9b: Prepend ×
-		if (a == GBP::Prepend)
-			return false;
-
-		// GB11: Extended pictographic sequences with ZWJ
-		if (a == GBP::ZWJ && b == GBP::ExtendedPictographic)
+		auto pictographicBeforePrev = [&]() noexcept
 		{
 			int32_t k = (int32_t)index - 2;
 			while (k >= 0 && GetGBP(cps[k]) == GBP::Extend) k--;
-			if (k >= 0 && GetGBP(cps[k]) == GBP::ExtendedPictographic)
-				return false;
-		}
+			return k >= 0 && GetGBP(cps[k]) == GBP::ExtendedPictographic;
+		};
 
-		// -------------------------------
-		// GB12 / GB13: Regional Indicator pairs
-		// -------------------------------
-		// If prev and next are both RI, we must count how many consecutive RIs
-		// immediately before 'next' (i.e. up to index-1). If that count is ODD
-		// -> join (no break). If EVEN -> break.
-		auto isRI = [](uint32_t cp) { return cp >= 0x1F1E6 && cp <= 0x1F1FF; };
-
-		if (isRI(prev) && isRI(next))
+		auto regionalRunAtPrev = [&]() noexcept
 		{
-			// count consecutive RIs ending at position index-1 (the 'prev')
 			uint32_t countRIs = 1; // prev is one RI
 			int32_t k = (int32_t)index - 2;
-			while (k >= 0 && isRI(cps[k]))
+			while (k >= 0 && IsRegionalIndicator(cps[k]))
 			{
 				countRIs++;
 				k--;
 			}
+			return countRIs;
+		};
 
-			// If countRIs is odd -> join (no break). If even -> break.
-			if ((countRIs & 1u) == 1u) return false;
-			else return true;
-		}
-
-		// Default = break
-		return true;
+		return IsGraphemeBreak(GetGBP(prev), GetGBP(next), pictographicBeforePrev, regionalRunAtPrev);
 	}
 
 	void ComputeGraphemeBoundaries(const List<CodePoint>& cps, uint32_t count, List<CodePoint>& boundaries, uint32_t& outCount) noexcept
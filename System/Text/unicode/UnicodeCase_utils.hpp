@@ -6,6 +6,8 @@
 #include "UnicodeCase_special.hpp"
 #include "UnicodeCase_props.hpp"
 #include "UnicodeCase_folding.hpp"
+#include "UnicodeCase_tries.hpp"
+#include "UnicodeTrie.hpp"
 #include "System/Types.hpp"
 #include "System/Collections/List.hpp"
 
@@ -23,69 +25,89 @@ namespace UnicodeCase
 		return false;
 	}
 
+	// GBP and the PROP_* flags of a code point, one trie lookup
+	inline static constexpr uint8_t case_props(CodePoint cp) noexcept {
+		return UnicodeTrie::Lookup(CASE_PROPS_TRIE_STAGE1, CASE_PROPS_TRIE_STAGE2, CASE_PROPS_TRIE_STAGE3, (uint32_t)cp);
+	}
+
 	inline static constexpr bool is_letter(CodePoint cp) noexcept {
-		return small_binsearch_has(LETTERS, sizeof(LETTERS) / sizeof(LETTERS[0]), cp);
+		return (case_props(cp) & PROP_LETTER) != 0;
 	}
 
 	inline static constexpr bool is_cased(CodePoint cp) noexcept {
-		return small_binsearch_has(CASED, sizeof(CASED) / sizeof(CASED[0]), cp);
+		return (case_props(cp) & PROP_CASED) != 0;
 	}
 
 	inline static constexpr bool is_soft_dotted(CodePoint cp) noexcept {
-		return small_binsearch_has(SOFT_DOTTED, sizeof(SOFT_DOTTED) / sizeof(SOFT_DOTTED[0]), cp);
+		return (case_props(cp) & PROP_SOFT_DOTTED) != 0;
 	}
 
 	bool locale_is_turkic(const char* locale, uint32_t len) noexcept;
 
 	bool apply_final_sigma_context(const List<CodePoint>& cps, uint32_t index) noexcept;
+	// Same context read straight from UTF-8 bytes; offset is where the sigma starts
+	bool apply_final_sigma_context(const Char* bytes, uint32_t len, uint32_t offset) noexcept;
 	void map_to_upper_sequence_nostd(CodePoint cp, const char* localeBytes, uint32_t localeLen, List<CodePoint>& output) noexcept;
 	void map_to_lower_sequence_nostd(CodePoint cp, const char* localeBytes, uint32_t localeLen, const List<CodePoint>& context, uint32_t index, List<CodePoint>& output) noexcept;
+	void map_to_lower_sequence_nostd(CodePoint cp, const char* localeBytes, uint32_t localeLen, const Char* context, uint32_t contextLen, uint32_t offset, List<CodePoint>& output) noexcept;
 	void map_to_casefold_sequence_nostd(CodePoint cp, const char* localeBytes, uint32_t localeLen, const List<CodePoint>& context, uint32_t index, List<CodePoint>& output) noexcept;
 
 	bool IsGraphemeBreak(CodePoint prev, CodePoint next, const List<CodePoint>& cps, uint32_t len, uint32_t index) noexcept;
 	void ComputeGraphemeBoundaries(const List<CodePoint>& cps, uint32_t count, List<CodePoint>& boundaries, uint32_t& outCount) noexcept;
 	bool IsEmojiExtendedPictographic(CodePoint cp);
 
+	// Grapheme_Cluster_Break, from the generated trie (the ranges are in
+	// ucd_downloader.py, grapheme_break_property)
 	static constexpr GBP GetGBP(CodePoint cp) noexcept
 	{
-		// Control / CR / LF
-		if (cp == 0x000D) return GBP::CR;   // CR
-		if (cp == 0x000A) return GBP::LF;   // LF
-		if (cp <= 0x001F || (cp >= 0x007F && cp <= 0x009F))
-			return GBP::Control;
-
-		// Zero Width Joiner
-		if (cp == 0x200D)
-			return GBP::ZWJ;
-
-		// Combining marks (Extend)
-		// Unicode range: combining diacritics, variation selectors, etc.
-		if ((cp >= 0x0300 && cp <= 0x036F) ||    // combining diacritics
-			(cp >= 0x1AB0 && cp <= 0x1AFF) ||    // extended combining diacritics
-			(cp >= 0x1DC0 && cp <= 0x1DFF) ||
-			(cp >= 0x20D0 && cp <= 0x20FF) ||
-			(cp >= 0xFE20 && cp <= 0xFE2F))
-		{
-			return GBP::Extend;
-		}
+		return static_cast<GBP>(case_props(cp) & PROP_GBP_MASK);
+	}
+
+	inline constexpr bool IsRegionalIndicator(uint32_t cp) noexcept
+	{
+		return cp >= 0x1F1E6 && cp <= 0x1F1FF;
+	}
+
+	// The break rules for one pair of code points, shared by the List based
+	// segmentation and the streaming iterators (UTF8Iterators.hpp). The two
+	// rules that need more context ask for it only when they apply:
+	//   pictographicBeforePrev() - the code points before prev, skipping
+	//                              Extend, end in an Extended_Pictographic (GB11)
+	//   regionalRunAtPrev()      - consecutive Regional Indicators ending at
+	//                              prev, prev included (GB12 / GB13)
+	template<typename PictographicBeforePrev, typename RegionalRunAtPrev>
+	inline bool IsGraphemeBreak(GBP a, GBP b, PictographicBeforePrev&& pictographicBeforePrev, RegionalRunAtPrev&& regionalRunAtPrev) noexcept
+	{
+		// GB3: CR × LF
+		if (a == GBP::CR && b == GBP::LF)
+			return false;
+
+		// GB4 / GB5: break before or after Control / CR / LF
+		if (a == GBP::Control || a == GBP::CR || a == GBP::LF) return true;
+		if (b == GBP::Control || b == GBP::CR || b == GBP::LF) return true;
+
+		// GB9: × Extend
+		if (b == GBP::Extend)
+			return false;
 
-		// Emoji modifiers (skin tones) — also Extend
-		if (cp >= 0x1F3FB && cp <= 0x1F3FF)
-			return GBP::Extend;
+		// GB9a: × ZWJ
+		if (b == GBP::ZWJ)
+			return false;
 
-		// Regional Indicator (flags)
-		if (cp >= 0x1F1E6 && cp <= 0x1F1FF)
-			return GBP::RegionalIndicator;
+		// GB9b: Prepend ×
+		if (a == GBP::Prepend)
+			return false;
 
-		// Mark Spacing (GB9b)
-		if (cp >= 0x0903 && cp <= 0x093B)
-			return GBP::SpacingMark;
+		// GB11: Extended pictographic sequences with ZWJ
+		if (a == GBP::ZWJ && b == GBP::ExtendedPictographic && pictographicBeforePrev())
+			return false;
 
-		// Extended pictographic (emojis)
-		// This is the minimal safe range covering all emoji blocks
-		if (IsEmojiExtendedPictographic(cp))
-			return GBP::ExtendedPictographic;
+		// GB12 / GB13: Regional Indicator pairs join when an odd number of
+		// them runs up to (and including) prev
+		if (a == GBP::RegionalIndicator && b == GBP::RegionalIndicator)
+			return (regionalRunAtPrev() & 1u) == 0;
 
-		return GBP::Other;
+		// Default = break
+		return true;
 	}
 }
\ No newline at end of file
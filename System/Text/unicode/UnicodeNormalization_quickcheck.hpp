@@ -0,0 +1,1109 @@
+// AUTO-GENERATED. DO NOT EDIT.
+// Unicode Normalization quick check (UAX #15, DerivedNormalizationProps.txt) - generated by script
+
+#pragma once
+
+#include <cstdint>
+
+namespace UnicodeNormalization {
+
+// [start, end, value] for code points whose quick check is not Yes: 1 = No, 2 = Maybe
+
+static constexpr uint32_t NFC_QC_FIRST = 0x0300u;
+static constexpr uint32_t NFC_QC_RANGES_COUNT = 122u;
+static constexpr CodePoint NFC_QC_RANGES[] = {
+  0x0300, 0x0304, 2,
+  0x0306, 0x030C, 2,
+  0x030F, 0x030F, 2,
+  0x0311, 0x0311, 2,
+  0x0313, 0x0314, 2,
+  0x031B, 0x031B, 2,
+  0x0323, 0x0328, 2,
+  0x032D, 0x032E, 2,
+  0x0330, 0x0331, 2,
+  0x0338, 0x0338, 2,
+  0x0340, 0x0341, 1,
+  0x0342, 0x0342, 2,
+  0x0343, 0x0344, 1,
+  0x0345, 0x0345, 2,
+  0x0374, 0x0374, 1,
+  0x037E, 0x037E, 1,
+  0x0387, 0x0387, 1,
+  0x0653, 0x0655, 2,
+  0x093C, 0x093C, 2,
+  0x0958, 0x095F, 1,
+  0x09BE, 0x09BE, 2,
+  0x09D7, 0x09D7, 2,
+  0x09DC, 0x09DD, 1,
+  0x09DF, 0x09DF, 1,
+  0x0A33, 0x0A33, 1,
+  0x0A36, 0x0A36, 1,
+  0x0A59, 0x0A5B, 1,
+  0x0A5E, 0x0A5E, 1,
+  0x0B3E, 0x0B3E, 2,
+  0x0B56, 0x0B57, 2,
+  0x0B5C, 0x0B5D, 1,
+  0x0BBE, 0x0BBE, 2,
+  0x0BD7, 0x0BD7, 2,
+  0x0C56, 0x0C56, 2,
+  0x0CC2, 0x0CC2, 2,
+  0x0CD5, 0x0CD6, 2,
+  0x0D3E, 0x0D3E, 2,
+  0x0D57, 0x0D57, 2,
+  0x0DCA, 0x0DCA, 2,
+  0x0DCF, 0x0DCF, 2,
+  0x0DDF, 0x0DDF, 2,
+  0x0F43, 0x0F43, 1,
+  0x0F4D, 0x0F4D, 1,
+  0x0F52, 0x0F52, 1,
+  0x0F57, 0x0F57, 1,
+  0x0F5C, 0x0F5C, 1,
+  0x0F69, 0x0F69, 1,
+  0x0F73, 0x0F73, 1,
+  0x0F75, 0x0F76, 1,
+  0x0F78, 0x0F78, 1,
+  0x0F81, 0x0F81, 1,
+  0x0F93, 0x0F93, 1,
+  0x0F9D, 0x0F9D, 1,
+  0x0FA2, 0x0FA2, 1,
+  0x0FA7, 0x0FA7, 1,
+  0x0FAC, 0x0FAC, 1,
+  0x0FB9, 0x0FB9, 1,
+  0x102E, 0x102E, 2,
+  0x1161, 0x1175, 2,
+  0x11A8, 0x11C2, 2,
+  0x1B35, 0x1B35, 2,
+  0x1F71, 0x1F71, 1,
+  0x1F73, 0x1F73, 1,
+  0x1F75, 0x1F75, 1,
+  0x1F77, 0x1F77, 1,
+  0x1F79, 0x1F79, 1,
+  0x1F7B, 0x1F7B, 1,
+  0x1F7D, 0x1F7D, 1,
+  0x1FBB, 0x1FBB, 1,
+  0x1FBE, 0x1FBE, 1,
+  0x1FC9, 0x1FC9, 1,
+  0x1FCB, 0x1FCB, 1,
+  0x1FD3, 0x1FD3, 1,
+  0x1FDB, 0x1FDB, 1,
+  0x1FE3, 0x1FE3, 1,
+  0x1FEB, 0x1FEB, 1,
+  0x1FEE, 0x1FEF, 1,
+  0x1FF9, 0x1FF9, 1,
+  0x1FFB, 0x1FFB, 1,
+  0x1FFD, 0x1FFD, 1,
+  0x2000, 0x2001, 1,
+  0x2126, 0x2126, 1,
+  0x212A, 0x212B, 1,
+  0x2329, 0x232A, 1,
+  0x2ADC, 0x2ADC, 1,
+  0x3099, 0x309A, 2,
+  0xF900, 0xFA0D, 1,
+  0xFA10, 0xFA10, 1,
+  0xFA12, 0xFA12, 1,
+  0xFA15, 0xFA1E, 1,
+  0xFA20, 0xFA20, 1,
+  0xFA22, 0xFA22, 1,
+  0xFA25, 0xFA26, 1,
+  0xFA2A, 0xFA6D, 1,
+  0xFA70, 0xFAD9, 1,
+  0xFB1D, 0xFB1D, 1,
+  0xFB1F, 0xFB1F, 1,
+  0xFB2A, 0xFB36, 1,
+  0xFB38, 0xFB3C, 1,
+  0xFB3E, 0xFB3E, 1,
+  0xFB40, 0xFB41, 1,
+  0xFB43, 0xFB44, 1,
+  0xFB46, 0xFB4E, 1,
+  0x110BA, 0x110BA, 2,
+  0x11127, 0x11127, 2,
+  0x1133E, 0x1133E, 2,
+  0x11357, 0x11357, 2,
+  0x113B8, 0x113B8, 2,
+  0x113BB, 0x113BB, 2,
+  0x113C2, 0x113C2, 2,
+  0x113C5, 0x113C5, 2,
+  0x113C7, 0x113C9, 2,
+  0x114B0, 0x114B0, 2,
+  0x114BA, 0x114BA, 2,
+  0x114BD, 0x114BD, 2,
+  0x115AF, 0x115AF, 2,
+  0x11930, 0x11930, 2,
+  0x1611E, 0x16129, 2,
+  0x16D67, 0x16D68, 2,
+  0x1D15E, 0x1D164, 1,
+  0x1D1BB, 0x1D1C0, 1,
+  0x2F800, 0x2FA1D, 1,
+};
+
+static constexpr uint32_t NFD_QC_FIRST = 0x00C0u;
+static constexpr uint32_t NFD_QC_RANGES_COUNT = 242u;
+static constexpr CodePoint NFD_QC_RANGES[] = {
+  0x00C0, 0x00C5, 1,
+  0x00C7, 0x00CF, 1,
+  0x00D1, 0x00D6, 1,
+  0x00D9, 0x00DD, 1,
+  0x00E0, 0x00E5, 1,
+  0x00E7, 0x00EF, 1,
+  0x00F1, 0x00F6, 1,
+  0x00F9, 0x00FD, 1,
+  0x00FF, 0x010F, 1,
+  0x0112, 0x0125, 1,
+  0x0128, 0x0130, 1,
+  0x0134, 0x0137, 1,
+  0x0139, 0x013E, 1,
+  0x0143, 0x0148, 1,
+  0x014C, 0x0151, 1,
+  0x0154, 0x0165, 1,
+  0x0168, 0x017E, 1,
+  0x01A0, 0x01A1, 1,
+  0x01AF, 0x01B0, 1,
+  0x01CD, 0x01DC, 1,
+  0x01DE, 0x01E3, 1,
+  0x01E6, 0x01F0, 1,
+  0x01F4, 0x01F5, 1,
+  0x01F8, 0x021B, 1,
+  0x021E, 0x021F, 1,
+  0x0226, 0x0233, 1,
+  0x0340, 0x0341, 1,
+  0x0343, 0x0344, 1,
+  0x0374, 0x0374, 1,
+  0x037E, 0x037E, 1,
+  0x0385, 0x038A, 1,
+  0x038C, 0x038C, 1,
+  0x038E, 0x0390, 1,
+  0x03AA, 0x03B0, 1,
+  0x03CA, 0x03CE, 1,
+  0x03D3, 0x03D4, 1,
+  0x0400, 0x0401, 1,
+  0x0403, 0x0403, 1,
+  0x0407, 0x0407, 1,
+  0x040C, 0x040E, 1,
+  0x0419, 0x0419, 1,
+  0x0439, 0x0439, 1,
+  0x0450, 0x0451, 1,
+  0x0453, 0x0453, 1,
+  0x0457, 0x0457, 1,
+  0x045C, 0x045E, 1,
+  0x0476, 0x0477, 1,
+  0x04C1, 0x04C2, 1,
+  0x04D0, 0x04D3, 1,
+  0x04D6, 0x04D7, 1,
+  0x04DA, 0x04DF, 1,
+  0x04E2, 0x04E7, 1,
+  0x04EA, 0x04F5, 1,
+  0x04F8, 0x04F9, 1,
+  0x0622, 0x0626, 1,
+  0x06C0, 0x06C0, 1,
+  0x06C2, 0x06C2, 1,
+  0x06D3, 0x06D3, 1,
+  0x0929, 0x0929, 1,
+  0x0931, 0x0931, 1,
+  0x0934, 0x0934, 1,
+  0x0958, 0x095F, 1,
+  0x09CB, 0x09CC, 1,
+  0x09DC, 0x09DD, 1,
+  0x09DF, 0x09DF, 1,
+  0x0A33, 0x0A33, 1,
+  0x0A36, 0x0A36, 1,
+  0x0A59, 0x0A5B, 1,
+  0x0A5E, 0x0A5E, 1,
+  0x0B48, 0x0B48, 1,
+  0x0B4B, 0x0B4C, 1,
+  0x0B5C, 0x0B5D, 1,
+  0x0B94, 0x0B94, 1,
+  0x0BCA, 0x0BCC, 1,
+  0x0C48, 0x0C48, 1,
+  0x0CC0, 0x0CC0, 1,
+  0x0CC7, 0x0CC8, 1,
+  0x0CCA, 0x0CCB, 1,
+  0x0D4A, 0x0D4C, 1,
+  0x0DDA, 0x0DDA, 1,
+  0x0DDC, 0x0DDE, 1,
+  0x0F43, 0x0F43, 1,
+  0x0F4D, 0x0F4D, 1,
+  0x0F52, 0x0F52, 1,
+  0x0F57, 0x0F57, 1,
+  0x0F5C, 0x0F5C, 1,
+  0x0F69, 0x0F69, 1,
+  0x0F73, 0x0F73, 1,
+  0x0F75, 0x0F76, 1,
+  0x0F78, 0x0F78, 1,
+  0x0F81, 0x0F81, 1,
+  0x0F93, 0x0F93, 1,
+  0x0F9D, 0x0F9D, 1,
+  0x0FA2, 0x0FA2, 1,
+  0x0FA7, 0x0FA7, 1,
+  0x0FAC, 0x0FAC, 1,
+  0x0FB9, 0x0FB9, 1,
+  0x1026, 0x1026, 1,
+  0x1B06, 0x1B06, 1,
+  0x1B08, 0x1B08, 1,
+  0x1B0A, 0x1B0A, 1,
+  0x1B0C, 0x1B0C, 1,
+  0x1B0E, 0x1B0E, 1,
+  0x1B12, 0x1B12, 1,
+  0x1B3B, 0x1B3B, 1,
+  0x1B3D, 0x1B3D, 1,
+  0x1B40, 0x1B41, 1,
+  0x1B43, 0x1B43, 1,
+  0x1E00, 0x1E99, 1,
+  0x1E9B, 0x1E9B, 1,
+  0x1EA0, 0x1EF9, 1,
+  0x1F00, 0x1F15, 1,
+  0x1F18, 0x1F1D, 1,
+  0x1F20, 0x1F45, 1,
+  0x1F48, 0x1F4D, 1,
+  0x1F50, 0x1F57, 1,
+  0x1F59, 0x1F59, 1,
+  0x1F5B, 0x1F5B, 1,
+  0x1F5D, 0x1F5D, 1,
+  0x1F5F, 0x1F7D, 1,
+  0x1F80, 0x1FB4, 1,
+  0x1FB6, 0x1FBC, 1,
+  0x1FBE, 0x1FBE, 1,
+  0x1FC1, 0x1FC4, 1,
+  0x1FC6, 0x1FD3, 1,
+  0x1FD6, 0x1FDB, 1,
+  0x1FDD, 0x1FEF, 1,
+  0x1FF2, 0x1FF4, 1,
+  0x1FF6, 0x1FFD, 1,
+  0x2000, 0x2001, 1,
+  0x2126, 0x2126, 1,
+  0x212A, 0x212B, 1,
+  0x219A, 0x219B, 1,
+  0x21AE, 0x21AE, 1,
+  0x21CD, 0x21CF, 1,
+  0x2204, 0x2204, 1,
+  0x2209, 0x2209, 1,
+  0x220C, 0x220C, 1,
+  0x2224, 0x2224, 1,
+  0x2226, 0x2226, 1,
+  0x2241, 0x2241, 1,
+  0x2244, 0x2244, 1,
+  0x2247, 0x2247, 1,
+  0x2249, 0x2249, 1,
+  0x2260, 0x2260, 1,
+  0x2262, 0x2262, 1,
+  0x226D, 0x2271, 1,
+  0x2274, 0x2275, 1,
+  0x2278, 0x2279, 1,
+  0x2280, 0x2281, 1,
+  0x2284, 0x2285, 1,
+  0x2288, 0x2289, 1,
+  0x22AC, 0x22AF, 1,
+  0x22E0, 0x22E3, 1,
+  0x22EA, 0x22ED, 1,
+  0x2329, 0x232A, 1,
+  0x2ADC, 0x2ADC, 1,
+  0x304C, 0x304C, 1,
+  0x304E, 0x304E, 1,
+  0x3050, 0x3050, 1,
+  0x3052, 0x3052, 1,
+  0x3054, 0x3054, 1,
+  0x3056, 0x3056, 1,
+  0x3058, 0x3058, 1,
+  0x305A, 0x305A, 1,
+  0x305C, 0x305C, 1,
+  0x305E, 0x305E, 1,
+  0x3060, 0x3060, 1,
+  0x3062, 0x3062, 1,
+  0x3065, 0x3065, 1,
+  0x3067, 0x3067, 1,
+  0x3069, 0x3069, 1,
+  0x3070, 0x3071, 1,
+  0x3073, 0x3074, 1,
+  0x3076, 0x3077, 1,
+  0x3079, 0x307A, 1,
+  0x307C, 0x307D, 1,
+  0x3094, 0x3094, 1,
+  0x309E, 0x309E, 1,
+  0x30AC, 0x30AC, 1,
+  0x30AE, 0x30AE, 1,
+  0x30B0, 0x30B0, 1,
+  0x30B2, 0x30B2, 1,
+  0x30B4, 0x30B4, 1,
+  0x30B6, 0x30B6, 1,
+  0x30B8, 0x30B8, 1,
+  0x30BA, 0x30BA, 1,
+  0x30BC, 0x30BC, 1,
+  0x30BE, 0x30BE, 1,
+  0x30C0, 0x30C0, 1,
+  0x30C2, 0x30C2, 1,
+  0x30C5, 0x30C5, 1,
+  0x30C7, 0x30C7, 1,
+  0x30C9, 0x30C9, 1,
+  0x30D0, 0x30D1, 1,
+  0x30D3, 0x30D4, 1,
+  0x30D6, 0x30D7, 1,
+  0x30D9, 0x30DA, 1,
+  0x30DC, 0x30DD, 1,
+  0x30F4, 0x30F4, 1,
+  0x30F7, 0x30FA, 1,
+  0x30FE, 0x30FE, 1,
+  0xAC00, 0xD7A3, 1,
+  0xF900, 0xFA0D, 1,
+  0xFA10, 0xFA10, 1,
+  0xFA12, 0xFA12, 1,
+  0xFA15, 0xFA1E, 1,
+  0xFA20, 0xFA20, 1,
+  0xFA22, 0xFA22, 1,
+  0xFA25, 0xFA26, 1,
+  0xFA2A, 0xFA6D, 1,
+  0xFA70, 0xFAD9, 1,
+  0xFB1D, 0xFB1D, 1,
+  0xFB1F, 0xFB1F, 1,
+  0xFB2A, 0xFB36, 1,
+  0xFB38, 0xFB3C, 1,
+  0xFB3E, 0xFB3E, 1,
+  0xFB40, 0xFB41, 1,
+  0xFB43, 0xFB44, 1,
+  0xFB46, 0xFB4E, 1,
+  0x105C9, 0x105C9, 1,
+  0x105E4, 0x105E4, 1,
+  0x1109A, 0x1109A, 1,
+  0x1109C, 0x1109C, 1,
+  0x110AB, 0x110AB, 1,
+  0x1112E, 0x1112F, 1,
+  0x1134B, 0x1134C, 1,
+  0x11383, 0x11383, 1,
+  0x11385, 0x11385, 1,
+  0x1138E, 0x1138E, 1,
+  0x11391, 0x11391, 1,
+  0x113C5, 0x113C5, 1,
+  0x113C7, 0x113C8, 1,
+  0x114BB, 0x114BC, 1,
+  0x114BE, 0x114BE, 1,
+  0x115BA, 0x115BB, 1,
+  0x11938, 0x11938, 1,
+  0x16121, 0x16128, 1,
+  0x16D68, 0x16D6A, 1,
+  0x1D15E, 0x1D164, 1,
+  0x1D1BB, 0x1D1C0, 1,
+  0x2F800, 0x2FA1D, 1,
+};
+
+static constexpr uint32_t NFKC_QC_FIRST = 0x00A0u;
+static constexpr uint32_t NFKC_QC_RANGES_COUNT = 305u;
+static constexpr CodePoint NFKC_QC_RANGES[] = {
+  0x00A0, 0x00A0, 1,
+  0x00A8, 0x00A8, 1,
+  0x00AA, 0x00AA, 1,
+  0x00AF, 0x00AF, 1,
+  0x00B2, 0x00B5, 1,
+  0x00B8, 0x00BA, 1,
+  0x00BC, 0x00BE, 1,
+  0x0132, 0x0133, 1,
+  0x013F, 0x0140, 1,
+  0x0149, 0x0149, 1,
+  0x017F, 0x017F, 1,
+  0x01C4, 0x01CC, 1,
+  0x01F1, 0x01F3, 1,
+  0x02B0, 0x02B8, 1,
+  0x02D8, 0x02DD, 1,
+  0x02E0, 0x02E4, 1,
+  0x0300, 0x0304, 2,
+  0x0306, 0x030C, 2,
+  0x030F, 0x030F, 2,
+  0x0311, 0x0311, 2,
+  0x0313, 0x0314, 2,
+  0x031B, 0x031B, 2,
+  0x0323, 0x0328, 2,
+  0x032D, 0x032E, 2,
+  0x0330, 0x0331, 2,
+  0x0338, 0x0338, 2,
+  0x0340, 0x0341, 1,
+  0x0342, 0x0342, 2,
+  0x0343, 0x0344, 1,
+  0x0345, 0x0345, 2,
+  0x0374, 0x0374, 1,
+  0x037A, 0x037A, 1,
+  0x037E, 0x037E, 1,
+  0x0384, 0x0385, 1,
+  0x0387, 0x0387, 1,
+  0x03D0, 0x03D6, 1,
+  0x03F0, 0x03F2, 1,
+  0x03F4, 0x03F5, 1,
+  0x03F9, 0x03F9, 1,
+  0x0587, 0x0587, 1,
+  0x0653, 0x0655, 2,
+  0x0675, 0x0678, 1,
+  0x093C, 0x093C, 2,
+  0x0958, 0x095F, 1,
+  0x09BE, 0x09BE, 2,
+  0x09D7, 0x09D7, 2,
+  0x09DC, 0x09DD, 1,
+  0x09DF, 0x09DF, 1,
+  0x0A33, 0x0A33, 1,
+  0x0A36, 0x0A36, 1,
+  0x0A59, 0x0A5B, 1,
+  0x0A5E, 0x0A5E, 1,
+  0x0B3E, 0x0B3E, 2,
+  0x0B56, 0x0B57, 2,
+  0x0B5C, 0x0B5D, 1,
+  0x0BBE, 0x0BBE, 2,
+  0x0BD7, 0x0BD7, 2,
+  0x0C56, 0x0C56, 2,
+  0x0CC2, 0x0CC2, 2,
+  0x0CD5, 0x0CD6, 2,
+  0x0D3E, 0x0D3E, 2,
+  0x0D57, 0x0D57, 2,
+  0x0DCA, 0x0DCA, 2,
+  0x0DCF, 0x0DCF, 2,
+  0x0DDF, 0x0DDF, 2,
+  0x0E33, 0x0E33, 1,
+  0x0EB3, 0x0EB3, 1,
+  0x0EDC, 0x0EDD, 1,
+  0x0F0C, 0x0F0C, 1,
+  0x0F43, 0x0F43, 1,
+  0x0F4D, 0x0F4D, 1,
+  0x0F52, 0x0F52, 1,
+  0x0F57, 0x0F57, 1,
+  0x0F5C, 0x0F5C, 1,
+  0x0F69, 0x0F69, 1,
+  0x0F73, 0x0F73, 1,
+  0x0F75, 0x0F79, 1,
+  0x0F81, 0x0F81, 1,
+  0x0F93, 0x0F93, 1,
+  0x0F9D, 0x0F9D, 1,
+  0x0FA2, 0x0FA2, 1,
+  0x0FA7, 0x0FA7, 1,
+  0x0FAC, 0x0FAC, 1,
+  0x0FB9, 0x0FB9, 1,
+  0x102E, 0x102E, 2,
+  0x10FC, 0x10FC, 1,
+  0x1161, 0x1175, 2,
+  0x11A8, 0x11C2, 2,
+  0x1B35, 0x1B35, 2,
+  0x1D2C, 0x1D2E, 1,
+  0x1D30, 0x1D3A, 1,
+  0x1D3C, 0x1D4D, 1,
+  0x1D4F, 0x1D6A, 1,
+  0x1D78, 0x1D78, 1,
+  0x1D9B, 0x1DBF, 1,
+  0x1E9A, 0x1E9B, 1,
+  0x1F71, 0x1F71, 1,
+  0x1F73, 0x1F73, 1,
+  0x1F75, 0x1F75, 1,
+  0x1F77, 0x1F77, 1,
+  0x1F79, 0x1F79, 1,
+  0x1F7B, 0x1F7B, 1,
+  0x1F7D, 0x1F7D, 1,
+  0x1FBB, 0x1FBB, 1,
+  0x1FBD, 0x1FC1, 1,
+  0x1FC9, 0x1FC9, 1,
+  0x1FCB, 0x1FCB, 1,
+  0x1FCD, 0x1FCF, 1,
+  0x1FD3, 0x1FD3, 1,
+  0x1FDB, 0x1FDB, 1,
+  0x1FDD, 0x1FDF, 1,
+  0x1FE3, 0x1FE3, 1,
+  0x1FEB, 0x1FEB, 1,
+  0x1FED, 0x1FEF, 1,
+  0x1FF9, 0x1FF9, 1,
+  0x1FFB, 0x1FFB, 1,
+  0x1FFD, 0x1FFE, 1,
+  0x2000, 0x200A, 1,
+  0x2011, 0x2011, 1,
+  0x2017, 0x2017, 1,
+  0x2024, 0x2026, 1,
+  0x202F, 0x202F, 1,
+  0x2033, 0x2034, 1,
+  0x2036, 0x2037, 1,
+  0x203C, 0x203C, 1,
+  0x203E, 0x203E, 1,
+  0x2047, 0x2049, 1,
+  0x2057, 0x2057, 1,
+  0x205F, 0x205F, 1,
+  0x2070, 0x2071, 1,
+  0x2074, 0x208E, 1,
+  0x2090, 0x209C, 1,
+  0x20A8, 0x20A8, 1,
+  0x2100, 0x2103, 1,
+  0x2105, 0x2107, 1,
+  0x2109, 0x2113, 1,
+  0x2115, 0x2116, 1,
+  0x2119, 0x211D, 1,
+  0x2120, 0x2122, 1,
+  0x2124, 0x2124, 1,
+  0x2126, 0x2126, 1,
+  0x2128, 0x2128, 1,
+  0x212A, 0x212D, 1,
+  0x212F, 0x2131, 1,
+  0x2133, 0x2139, 1,
+  0x213B, 0x2140, 1,
+  0x2145, 0x2149, 1,
+  0x2150, 0x217F, 1,
+  0x2189, 0x2189, 1,
+  0x222C, 0x222D, 1,
+  0x222F, 0x2230, 1,
+  0x2329, 0x232A, 1,
+  0x2460, 0x24EA, 1,
+  0x2A0C, 0x2A0C, 1,
+  0x2A74, 0x2A76, 1,
+  0x2ADC, 0x2ADC, 1,
+  0x2C7C, 0x2C7D, 1,
+  0x2D6F, 0x2D6F, 1,
+  0x2E9F, 0x2E9F, 1,
+  0x2EF3, 0x2EF3, 1,
+  0x2F00, 0x2FD5, 1,
+  0x3000, 0x3000, 1,
+  0x3036, 0x3036, 1,
+  0x3038, 0x303A, 1,
+  0x3099, 0x309A, 2,
+  0x309B, 0x309C, 1,
+  0x309F, 0x309F, 1,
+  0x30FF, 0x30FF, 1,
+  0x3131, 0x318E, 1,
+  0x3192, 0x319F, 1,
+  0x3200, 0x321E, 1,
+  0x3220, 0x3247, 1,
+  0x3250, 0x327E, 1,
+  0x3280, 0x33FF, 1,
+  0xA69C, 0xA69D, 1,
+  0xA770, 0xA770, 1,
+  0xA7F1, 0xA7F4, 1,
+  0xA7F8, 0xA7F9, 1,
+  0xAB5C, 0xAB5F, 1,
+  0xAB69, 0xAB69, 1,
+  0xF900, 0xFA0D, 1,
+  0xFA10, 0xFA10, 1,
+  0xFA12, 0xFA12, 1,
+  0xFA15, 0xFA1E, 1,
+  0xFA20, 0xFA20, 1,
+  0xFA22, 0xFA22, 1,
+  0xFA25, 0xFA26, 1,
+  0xFA2A, 0xFA6D, 1,
+  0xFA70, 0xFAD9, 1,
+  0xFB00, 0xFB06, 1,
+  0xFB13, 0xFB17, 1,
+  0xFB1D, 0xFB1D, 1,
+  0xFB1F, 0xFB36, 1,
+  0xFB38, 0xFB3C, 1,
+  0xFB3E, 0xFB3E, 1,
+  0xFB40, 0xFB41, 1,
+  0xFB43, 0xFB44, 1,
+  0xFB46, 0xFBB1, 1,
+  0xFBD3, 0xFD3D, 1,
+  0xFD50, 0xFD8F, 1,
+  0xFD92, 0xFDC7, 1,
+  0xFDF0, 0xFDFC, 1,
+  0xFE10, 0xFE19, 1,
+  0xFE30, 0xFE44, 1,
+  0xFE47, 0xFE52, 1,
+  0xFE54, 0xFE66, 1,
+  0xFE68, 0xFE6B, 1,
+  0xFE70, 0xFE72, 1,
+  0xFE74, 0xFE74, 1,
+  0xFE76, 0xFEFC, 1,
+  0xFF01, 0xFFBE, 1,
+  0xFFC2, 0xFFC7, 1,
+  0xFFCA, 0xFFCF, 1,
+  0xFFD2, 0xFFD7, 1,
+  0xFFDA, 0xFFDC, 1,
+  0xFFE0, 0xFFE6, 1,
+  0xFFE8, 0xFFEE, 1,
+  0x10781, 0x10785, 1,
+  0x10787, 0x107B0, 1,
+  0x107B2, 0x107BA, 1,
+  0x110BA, 0x110BA, 2,
+  0x11127, 0x11127, 2,
+  0x1133E, 0x1133E, 2,
+  0x11357, 0x11357, 2,
+  0x113B8, 0x113B8, 2,
+  0x113BB, 0x113BB, 2,
+  0x113C2, 0x113C2, 2,
+  0x113C5, 0x113C5, 2,
+  0x113C7, 0x113C9, 2,
+  0x114B0, 0x114B0, 2,
+  0x114BA, 0x114BA, 2,
+  0x114BD, 0x114BD, 2,
+  0x115AF, 0x115AF, 2,
+  0x11930, 0x11930, 2,
+  0x1611E, 0x16129, 2,
+  0x16D67, 0x16D68, 2,
+  0x1CCD6, 0x1CCF9, 1,
+  0x1D15E, 0x1D164, 1,
+  0x1D1BB, 0x1D1C0, 1,
+  0x1D400, 0x1D454, 1,
+  0x1D456, 0x1D49C, 1,
+  0x1D49E, 0x1D49F, 1,
+  0x1D4A2, 0x1D4A2, 1,
+  0x1D4A5, 0x1D4A6, 1,
+  0x1D4A9, 0x1D4AC, 1,
+  0x1D4AE, 0x1D4B9, 1,
+  0x1D4BB, 0x1D4BB, 1,
+  0x1D4BD, 0x1D4C3, 1,
+  0x1D4C5, 0x1D505, 1,
+  0x1D507, 0x1D50A, 1,
+  0x1D50D, 0x1D514, 1,
+  0x1D516, 0x1D51C, 1,
+  0x1D51E, 0x1D539, 1,
+  0x1D53B, 0x1D53E, 1,
+  0x1D540, 0x1D544, 1,
+  0x1D546, 0x1D546, 1,
+  0x1D54A, 0x1D550, 1,
+  0x1D552, 0x1D6A5, 1,
+  0x1D6A8, 0x1D7CB, 1,
+  0x1D7CE, 0x1D7FF, 1,
+  0x1E030, 0x1E06D, 1,
+  0x1EE00, 0x1EE03, 1,
+  0x1EE05, 0x1EE1F, 1,
+  0x1EE21, 0x1EE22, 1,
+  0x1EE24, 0x1EE24, 1,
+  0x1EE27, 0x1EE27, 1,
+  0x1EE29, 0x1EE32, 1,
+  0x1EE34, 0x1EE37, 1,
+  0x1EE39, 0x1EE39, 1,
+  0x1EE3B, 0x1EE3B, 1,
+  0x1EE42, 0x1EE42, 1,
+  0x1EE47, 0x1EE47, 1,
+  0x1EE49, 0x1EE49, 1,
+  0x1EE4B, 0x1EE4B, 1,
+  0x1EE4D, 0x1EE4F, 1,
+  0x1EE51, 0x1EE52, 1,
+  0x1EE54, 0x1EE54, 1,
+  0x1EE57, 0x1EE57, 1,
+  0x1EE59, 0x1EE59, 1,
+  0x1EE5B, 0x1EE5B, 1,
+  0x1EE5D, 0x1EE5D, 1,
+  0x1EE5F, 0x1EE5F, 1,
+  0x1EE61, 0x1EE62, 1,
+  0x1EE64, 0x1EE64, 1,
+  0x1EE67, 0x1EE6A, 1,
+  0x1EE6C, 0x1EE72, 1,
+  0x1EE74, 0x1EE77, 1,
+  0x1EE79, 0x1EE7C, 1,
+  0x1EE7E, 0x1EE7E, 1,
+  0x1EE80, 0x1EE89, 1,
+  0x1EE8B, 0x1EE9B, 1,
+  0x1EEA1, 0x1EEA3, 1,
+  0x1EEA5, 0x1EEA9, 1,
+  0x1EEAB, 0x1EEBB, 1,
+  0x1F100, 0x1F10A, 1,
+  0x1F110, 0x1F12E, 1,
+  0x1F130, 0x1F14F, 1,
+  0x1F16A, 0x1F16C, 1,
+  0x1F190, 0x1F190, 1,
+  0x1F200, 0x1F202, 1,
+  0x1F210, 0x1F23B, 1,
+  0x1F240, 0x1F248, 1,
+  0x1F250, 0x1F251, 1,
+  0x1FBF0, 0x1FBF9, 1,
+  0x2F800, 0x2FA1D, 1,
+};
+
+static constexpr uint32_t NFKD_QC_FIRST = 0x00A0u;
+static constexpr uint32_t NFKD_QC_RANGES_COUNT = 408u;
+static constexpr CodePoint NFKD_QC_RANGES[] = {
+  0x00A0, 0x00A0, 1,
+  0x00A8, 0x00A8, 1,
+  0x00AA, 0x00AA, 1,
+  0x00AF, 0x00AF, 1,
+  0x00B2, 0x00B5, 1,
+  0x00B8, 0x00BA, 1,
+  0x00BC, 0x00BE, 1,
+  0x00C0, 0x00C5, 1,
+  0x00C7, 0x00CF, 1,
+  0x00D1, 0x00D6, 1,
+  0x00D9, 0x00DD, 1,
+  0x00E0, 0x00E5, 1,
+  0x00E7, 0x00EF, 1,
+  0x00F1, 0x00F6, 1,
+  0x00F9, 0x00FD, 1,
+  0x00FF, 0x010F, 1,
+  0x0112, 0x0125, 1,
+  0x0128, 0x0130, 1,
+  0x0132, 0x0137, 1,
+  0x0139, 0x0140, 1,
+  0x0143, 0x0149, 1,
+  0x014C, 0x0151, 1,
+  0x0154, 0x0165, 1,
+  0x0168, 0x017F, 1,
+  0x01A0, 0x01A1, 1,
+  0x01AF, 0x01B0, 1,
+  0x01C4, 0x01DC, 1,
+  0x01DE, 0x01E3, 1,
+  0x01E6, 0x01F5, 1,
+  0x01F8, 0x021B, 1,
+  0x021E, 0x021F, 1,
+  0x0226, 0x0233, 1,
+  0x02B0, 0x02B8, 1,
+  0x02D8, 0x02DD, 1,
+  0x02E0, 0x02E4, 1,
+  0x0340, 0x0341, 1,
+  0x0343, 0x0344, 1,
+  0x0374, 0x0374, 1,
+  0x037A, 0x037A, 1,
+  0x037E, 0x037E, 1,
+  0x0384, 0x038A, 1,
+  0x038C, 0x038C, 1,
+  0x038E, 0x0390, 1,
+  0x03AA, 0x03B0, 1,
+  0x03CA, 0x03CE, 1,
+  0x03D0, 0x03D6, 1,
+  0x03F0, 0x03F2, 1,
+  0x03F4, 0x03F5, 1,
+  0x03F9, 0x03F9, 1,
+  0x0400, 0x0401, 1,
+  0x0403, 0x0403, 1,
+  0x0407, 0x0407, 1,
+  0x040C, 0x040E, 1,
+  0x0419, 0x0419, 1,
+  0x0439, 0x0439, 1,
+  0x0450, 0x0451, 1,
+  0x0453, 0x0453, 1,
+  0x0457, 0x0457, 1,
+  0x045C, 0x045E, 1,
+  0x0476, 0x0477, 1,
+  0x04C1, 0x04C2, 1,
+  0x04D0, 0x04D3, 1,
+  0x04D6, 0x04D7, 1,
+  0x04DA, 0x04DF, 1,
+  0x04E2, 0x04E7, 1,
+  0x04EA, 0x04F5, 1,
+  0x04F8, 0x04F9, 1,
+  0x0587, 0x0587, 1,
+  0x0622, 0x0626, 1,
+  0x0675, 0x0678, 1,
+  0x06C0, 0x06C0, 1,
+  0x06C2, 0x06C2, 1,
+  0x06D3, 0x06D3, 1,
+  0x0929, 0x0929, 1,
+  0x0931, 0x0931, 1,
+  0x0934, 0x0934, 1,
+  0x0958, 0x095F, 1,
+  0x09CB, 0x09CC, 1,
+  0x09DC, 0x09DD, 1,
+  0x09DF, 0x09DF, 1,
+  0x0A33, 0x0A33, 1,
+  0x0A36, 0x0A36, 1,
+  0x0A59, 0x0A5B, 1,
+  0x0A5E, 0x0A5E, 1,
+  0x0B48, 0x0B48, 1,
+  0x0B4B, 0x0B4C, 1,
+  0x0B5C, 0x0B5D, 1,
+  0x0B94, 0x0B94, 1,
+  0x0BCA, 0x0BCC, 1,
+  0x0C48, 0x0C48, 1,
+  0x0CC0, 0x0CC0, 1,
+  0x0CC7, 0x0CC8, 1,
+  0x0CCA, 0x0CCB, 1,
+  0x0D4A, 0x0D4C, 1,
+  0x0DDA, 0x0DDA, 1,
+  0x0DDC, 0x0DDE, 1,
+  0x0E33, 0x0E33, 1,
+  0x0EB3, 0x0EB3, 1,
+  0x0EDC, 0x0EDD, 1,
+  0x0F0C, 0x0F0C, 1,
+  0x0F43, 0x0F43, 1,
+  0x0F4D, 0x0F4D, 1,
+  0x0F52, 0x0F52, 1,
+  0x0F57, 0x0F57, 1,
+  0x0F5C, 0x0F5C, 1,
+  0x0F69, 0x0F69, 1,
+  0x0F73, 0x0F73, 1,
+  0x0F75, 0x0F79, 1,
+  0x0F81, 0x0F81, 1,
+  0x0F93, 0x0F93, 1,
+  0x0F9D, 0x0F9D, 1,
+  0x0FA2, 0x0FA2, 1,
+  0x0FA7, 0x0FA7, 1,
+  0x0FAC, 0x0FAC, 1,
+  0x0FB9, 0x0FB9, 1,
+  0x1026, 0x1026, 1,
+  0x10FC, 0x10FC, 1,
+  0x1B06, 0x1B06, 1,
+  0x1B08, 0x1B08, 1,
+  0x1B0A, 0x1B0A, 1,
+  0x1B0C, 0x1B0C, 1,
+  0x1B0E, 0x1B0E, 1,
+  0x1B12, 0x1B12, 1,
+  0x1B3B, 0x1B3B, 1,
+  0x1B3D, 0x1B3D, 1,
+  0x1B40, 0x1B41, 1,
+  0x1B43, 0x1B43, 1,
+  0x1D2C, 0x1D2E, 1,
+  0x1D30, 0x1D3A, 1,
+  0x1D3C, 0x1D4D, 1,
+  0x1D4F, 0x1D6A, 1,
+  0x1D78, 0x1D78, 1,
+  0x1D9B, 0x1DBF, 1,
+  0x1E00, 0x1E9B, 1,
+  0x1EA0, 0x1EF9, 1,
+  0x1F00, 0x1F15, 1,
+  0x1F18, 0x1F1D, 1,
+  0x1F20, 0x1F45, 1,
+  0x1F48, 0x1F4D, 1,
+  0x1F50, 0x1F57, 1,
+  0x1F59, 0x1F59, 1,
+  0x1F5B, 0x1F5B, 1,
+  0x1F5D, 0x1F5D, 1,
+  0x1F5F, 0x1F7D, 1,
+  0x1F80, 0x1FB4, 1,
+  0x1FB6, 0x1FC4, 1,
+  0x1FC6, 0x1FD3, 1,
+  0x1FD6, 0x1FDB, 1,
+  0x1FDD, 0x1FEF, 1,
+  0x1FF2, 0x1FF4, 1,
+  0x1FF6, 0x1FFE, 1,
+  0x2000, 0x200A, 1,
+  0x2011, 0x2011, 1,
+  0x2017, 0x2017, 1,
+  0x2024, 0x2026, 1,
+  0x202F, 0x202F, 1,
+  0x2033, 0x2034, 1,
+  0x2036, 0x2037, 1,
+  0x203C, 0x203C, 1,
+  0x203E, 0x203E, 1,
+  0x2047, 0x2049, 1,
+  0x2057, 0x2057, 1,
+  0x205F, 0x205F, 1,
+  0x2070, 0x2071, 1,
+  0x2074, 0x208E, 1,
+  0x2090, 0x209C, 1,
+  0x20A8, 0x20A8, 1,
+  0x2100, 0x2103, 1,
+  0x2105, 0x2107, 1,
+  0x2109, 0x2113, 1,
+  0x2115, 0x2116, 1,
+  0x2119, 0x211D, 1,
+  0x2120, 0x2122, 1,
+  0x2124, 0x2124, 1,
+  0x2126, 0x2126, 1,
+  0x2128, 0x2128, 1,
+  0x212A, 0x212D, 1,
+  0x212F, 0x2131, 1,
+  0x2133, 0x2139, 1,
+  0x213B, 0x2140, 1,
+  0x2145, 0x2149, 1,
+  0x2150, 0x217F, 1,
+  0x2189, 0x2189, 1,
+  0x219A, 0x219B, 1,
+  0x21AE, 0x21AE, 1,
+  0x21CD, 0x21CF, 1,
+  0x2204, 0x2204, 1,
+  0x2209, 0x2209, 1,
+  0x220C, 0x220C, 1,
+  0x2224, 0x2224, 1,
+  0x2226, 0x2226, 1,
+  0x222C, 0x222D, 1,
+  0x222F, 0x2230, 1,
+  0x2241, 0x2241, 1,
+  0x2244, 0x2244, 1,
+  0x2247, 0x2247, 1,
+  0x2249, 0x2249, 1,
+  0x2260, 0x2260, 1,
+  0x2262, 0x2262, 1,
+  0x226D, 0x2271, 1,
+  0x2274, 0x2275, 1,
+  0x2278, 0x2279, 1,
+  0x2280, 0x2281, 1,
+  0x2284, 0x2285, 1,
+  0x2288, 0x2289, 1,
+  0x22AC, 0x22AF, 1,
+  0x22E0, 0x22E3, 1,
+  0x22EA, 0x22ED, 1,
+  0x2329, 0x232A, 1,
+  0x2460, 0x24EA, 1,
+  0x2A0C, 0x2A0C, 1,
+  0x2A74, 0x2A76, 1,
+  0x2ADC, 0x2ADC, 1,
+  0x2C7C, 0x2C7D, 1,
+  0x2D6F, 0x2D6F, 1,
+  0x2E9F, 0x2E9F, 1,
+  0x2EF3, 0x2EF3, 1,
+  0x2F00, 0x2FD5, 1,
+  0x3000, 0x3000, 1,
+  0x3036, 0x3036, 1,
+  0x3038, 0x303A, 1,
+  0x304C, 0x304C, 1,
+  0x304E, 0x304E, 1,
+  0x3050, 0x3050, 1,
+  0x3052, 0x3052, 1,
+  0x3054, 0x3054, 1,
+  0x3056, 0x3056, 1,
+  0x3058, 0x3058, 1,
+  0x305A, 0x305A, 1,
+  0x305C, 0x305C, 1,
+  0x305E, 0x305E, 1,
+  0x3060, 0x3060, 1,
+  0x3062, 0x3062, 1,
+  0x3065, 0x3065, 1,
+  0x3067, 0x3067, 1,
+  0x3069, 0x3069, 1,
+  0x3070, 0x3071, 1,
+  0x3073, 0x3074, 1,
+  0x3076, 0x3077, 1,
+  0x3079, 0x307A, 1,
+  0x307C, 0x307D, 1,
+  0x3094, 0x3094, 1,
+  0x309B, 0x309C, 1,
+  0x309E, 0x309F, 1,
+  0x30AC, 0x30AC, 1,
+  0x30AE, 0x30AE, 1,
+  0x30B0, 0x30B0, 1,
+  0x30B2, 0x30B2, 1,
+  0x30B4, 0x30B4, 1,
+  0x30B6, 0x30B6, 1,
+  0x30B8, 0x30B8, 1,
+  0x30BA, 0x30BA, 1,
+  0x30BC, 0x30BC, 1,
+  0x30BE, 0x30BE, 1,
+  0x30C0, 0x30C0, 1,
+  0x30C2, 0x30C2, 1,
+  0x30C5, 0x30C5, 1,
+  0x30C7, 0x30C7, 1,
+  0x30C9, 0x30C9, 1,
+  0x30D0, 0x30D1, 1,
+  0x30D3, 0x30D4, 1,
+  0x30D6, 0x30D7, 1,
+  0x30D9, 0x30DA, 1,
+  0x30DC, 0x30DD, 1,
+  0x30F4, 0x30F4, 1,
+  0x30F7, 0x30FA, 1,
+  0x30FE, 0x30FF, 1,
+  0x3131, 0x318E, 1,
+  0x3192, 0x319F, 1,
+  0x3200, 0x321E, 1,
+  0x3220, 0x3247, 1,
+  0x3250, 0x327E, 1,
+  0x3280, 0x33FF, 1,
+  0xA69C, 0xA69D, 1,
+  0xA770, 0xA770, 1,
+  0xA7F1, 0xA7F4, 1,
+  0xA7F8, 0xA7F9, 1,
+  0xAB5C, 0xAB5F, 1,
+  0xAB69, 0xAB69, 1,
+  0xAC00, 0xD7A3, 1,
+  0xF900, 0xFA0D, 1,
+  0xFA10, 0xFA10, 1,
+  0xFA12, 0xFA12, 1,
+  0xFA15, 0xFA1E, 1,
+  0xFA20, 0xFA20, 1,
+  0xFA22, 0xFA22, 1,
+  0xFA25, 0xFA26, 1,
+  0xFA2A, 0xFA6D, 1,
+  0xFA70, 0xFAD9, 1,
+  0xFB00, 0xFB06, 1,
+  0xFB13, 0xFB17, 1,
+  0xFB1D, 0xFB1D, 1,
+  0xFB1F, 0xFB36, 1,
+  0xFB38, 0xFB3C, 1,
+  0xFB3E, 0xFB3E, 1,
+  0xFB40, 0xFB41, 1,
+  0xFB43, 0xFB44, 1,
+  0xFB46, 0xFBB1, 1,
+  0xFBD3, 0xFD3D, 1,
+  0xFD50, 0xFD8F, 1,
+  0xFD92, 0xFDC7, 1,
+  0xFDF0, 0xFDFC, 1,
+  0xFE10, 0xFE19, 1,
+  0xFE30, 0xFE44, 1,
+  0xFE47, 0xFE52, 1,
+  0xFE54, 0xFE66, 1,
+  0xFE68, 0xFE6B, 1,
+  0xFE70, 0xFE72, 1,
+  0xFE74, 0xFE74, 1,
+  0xFE76, 0xFEFC, 1,
+  0xFF01, 0xFFBE, 1,
+  0xFFC2, 0xFFC7, 1,
+  0xFFCA, 0xFFCF, 1,
+  0xFFD2, 0xFFD7, 1,
+  0xFFDA, 0xFFDC, 1,
+  0xFFE0, 0xFFE6, 1,
+  0xFFE8, 0xFFEE, 1,
+  0x105C9, 0x105C9, 1,
+  0x105E4, 0x105E4, 1,
+  0x10781, 0x10785, 1,
+  0x10787, 0x107B0, 1,
+  0x107B2, 0x107BA, 1,
+  0x1109A, 0x1109A, 1,
+  0x1109C, 0x1109C, 1,
+  0x110AB, 0x110AB, 1,
+  0x1112E, 0x1112F, 1,
+  0x1134B, 0x1134C, 1,
+  0x11383, 0x11383, 1,
+  0x11385, 0x11385, 1,
+  0x1138E, 0x1138E, 1,
+  0x11391, 0x11391, 1,
+  0x113C5, 0x113C5, 1,
+  0x113C7, 0x113C8, 1,
+  0x114BB, 0x114BC, 1,
+  0x114BE, 0x114BE, 1,
+  0x115BA, 0x115BB, 1,
+  0x11938, 0x11938, 1,
+  0x16121, 0x16128, 1,
+  0x16D68, 0x16D6A, 1,
+  0x1CCD6, 0x1CCF9, 1,
+  0x1D15E, 0x1D164, 1,
+  0x1D1BB, 0x1D1C0, 1,
+  0x1D400, 0x1D454, 1,
+  0x1D456, 0x1D49C, 1,
+  0x1D49E, 0x1D49F, 1,
+  0x1D4A2, 0x1D4A2, 1,
+  0x1D4A5, 0x1D4A6, 1,
+  0x1D4A9, 0x1D4AC, 1,
+  0x1D4AE, 0x1D4B9, 1,
+  0x1D4BB, 0x1D4BB, 1,
+  0x1D4BD, 0x1D4C3, 1,
+  0x1D4C5, 0x1D505, 1,
+  0x1D507, 0x1D50A, 1,
+  0x1D50D, 0x1D514, 1,
+  0x1D516, 0x1D51C, 1,
+  0x1D51E, 0x1D539, 1,
+  0x1D53B, 0x1D53E, 1,
+  0x1D540, 0x1D544, 1,
+  0x1D546, 0x1D546, 1,
+  0x1D54A, 0x1D550, 1,
+  0x1D552, 0x1D6A5, 1,
+  0x1D6A8, 0x1D7CB, 1,
+  0x1D7CE, 0x1D7FF, 1,
+  0x1E030, 0x1E06D, 1,
+  0x1EE00, 0x1EE03, 1,
+  0x1EE05, 0x1EE1F, 1,
+  0x1EE21, 0x1EE22, 1,
+  0x1EE24, 0x1EE24, 1,
+  0x1EE27, 0x1EE27, 1,
+  0x1EE29, 0x1EE32, 1,
+  0x1EE34, 0x1EE37, 1,
+  0x1EE39, 0x1EE39, 1,
+  0x1EE3B, 0x1EE3B, 1,
+  0x1EE42, 0x1EE42, 1,
+  0x1EE47, 0x1EE47, 1,
+  0x1EE49, 0x1EE49, 1,
+  0x1EE4B, 0x1EE4B, 1,
+  0x1EE4D, 0x1EE4F, 1,
+  0x1EE51, 0x1EE52, 1,
+  0x1EE54, 0x1EE54, 1,
+  0x1EE57, 0x1EE57, 1,
+  0x1EE59, 0x1EE59, 1,
+  0x1EE5B, 0x1EE5B, 1,
+  0x1EE5D, 0x1EE5D, 1,
+  0x1EE5F, 0x1EE5F, 1,
+  0x1EE61, 0x1EE62, 1,
+  0x1EE64, 0x1EE64, 1,
+  0x1EE67, 0x1EE6A, 1,
+  0x1EE6C, 0x1EE72, 1,
+  0x1EE74, 0x1EE77, 1,
+  0x1EE79, 0x1EE7C, 1,
+  0x1EE7E, 0x1EE7E, 1,
+  0x1EE80, 0x1EE89, 1,
+  0x1EE8B, 0x1EE9B, 1,
+  0x1EEA1, 0x1EEA3, 1,
+  0x1EEA5, 0x1EEA9, 1,
+  0x1EEAB, 0x1EEBB, 1,
+  0x1F100, 0x1F10A, 1,
+  0x1F110, 0x1F12E, 1,
+  0x1F130, 0x1F14F, 1,
+  0x1F16A, 0x1F16C, 1,
+  0x1F190, 0x1F190, 1,
+  0x1F200, 0x1F202, 1,
+  0x1F210, 0x1F23B, 1,
+  0x1F240, 0x1F248, 1,
+  0x1F250, 0x1F251, 1,
+  0x1FBF0, 0x1FBF9, 1,
+  0x2F800, 0x2FA1D, 1,
+};
+
+} // namespace UnicodeNormalization
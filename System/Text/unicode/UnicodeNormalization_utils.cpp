@@ -1,17 +1,24 @@
 #include "UnicodeNormalization_utils.hpp"
+#include "System/Text/UTF8.hpp"
 
 namespace UnicodeNormalization
 {
 
 	// --------------------------------------------------------
-	CodePoint GetCCC(CodePoint cp)
+	// Per code point lookups: one trie walk each (UnicodeNormalization_tries.hpp)
+	// --------------------------------------------------------
+	namespace
 	{
-		if (CCC_RANGES_COUNT == 0) return 0;
-
-		int idx = binary_search_ranges_uint32(CCC_RANGES, CCC_RANGES_COUNT, cp);
-		if (idx < 0) return 0;
+		inline uint16_t norm_flags(uint32_t cp) noexcept
+		{
+			return UnicodeTrie::Lookup(NORM_FLAGS_TRIE_STAGE1, NORM_FLAGS_TRIE_STAGE2, NORM_FLAGS_TRIE_STAGE3, cp);
+		}
+	}
 
-		return static_cast<uint8_t>(CCC_RANGES[idx * 3 + 2]);
+	// --------------------------------------------------------
+	CodePoint GetCCC(CodePoint cp)
+	{
+		return UnicodeTrie::Lookup(CCC_TRIE_STAGE1, CCC_TRIE_STAGE2, CCC_TRIE_STAGE3, (uint32_t)cp);
 	}
 
 	// --------------------------------------------------------
@@ -19,11 +26,7 @@ namespace UnicodeNormalization
 	// --------------------------------------------------------
 	bool IsCompositionExcluded(CodePoint cp)
 	{
-		// linear search; COMP_EXCL_COUNT expected to be small relative to other tables
-		for (uint32_t i = 0; i < COMP_EXCL_COUNT; ++i)
-			if (COMP_EXCL[i] == cp)
-				return true;
-		return false;
+		return (norm_flags(cp) & NORM_FLAG_EXCLUDED) != 0;
 	}
 
 	static inline bool HangulComposeSequence(CodePoint a, CodePoint b, CodePoint& out)
@@ -57,9 +60,10 @@ namespace UnicodeNormalization
 	// --------------------------------------------------------
 	// ComposePair: checks algorithmic Hangul first, then table
 	// COMPOSE_PAIRS expected as uint64_t entries where high 32 = (a<<32)|b key, low 32 = composed
-	// COMPOSE_COUNT is number of entries
+	// COMPOSE_TRIE gives the first pair starting with a; the pairs
+	// for one first code point are contiguous (a handful at most)
 	// --------------------------------------------------------
-	inline bool ComposePair(CodePoint a, CodePoint b, CodePoint& out)
+	bool ComposePair(CodePoint a, CodePoint b, CodePoint& out)
 	{
 		uint32_t av = (uint32_t)a;
 		uint32_t bv = (uint32_t)b;
@@ -72,27 +76,24 @@ namespace UnicodeNormalization
 			return true;
 		}
 
-		uint64_t key = (uint64_t(av) << 32) | uint64_t(bv);
+		uint32_t first = UnicodeTrie::Lookup(COMPOSE_TRIE_STAGE1, COMPOSE_TRIE_STAGE2, COMPOSE_TRIE_STAGE3, av);
+		if (first == 0)
+			return false;
 
-		int lo = 0, hi = (int)COMPOSE_COUNT - 1;
-		while (lo <= hi)
+		for (uint32_t i = first - 1; i < COMPOSE_COUNT && (uint32_t)(COMPOSE_PAIRS[i] >> 32) == av; ++i)
 		{
-			int mid = (lo + hi) >> 1;
-			uint64_t k = COMPOSE_PAIRS[mid];
-
-			if (k == key)
+			if ((uint32_t)COMPOSE_PAIRS[i] == bv)
 			{
-				out = CodePoint(COMPOSE_RESULT[mid]);
+				out = CodePoint(COMPOSE_RESULT[i]);
 				return true;
 			}
-			if (k < key) lo = mid + 1;
-			else hi = mid - 1;
 		}
 		return false;
 	}
 
 	// --------------------------------------------------------
 	// DecomposeCodePoint: recursive decomposition using DECOMP_* tables
+	// DECOMP_TRIE maps cp to 1 + its index in DECOMP_KEYS (0: no decomposition)
 	// Assumes DECOMP_OFFS length == DECOMP_COUNT + 1 (sentinel)
 	// DECOMP_FLAGS[mid] != 0 means that decomposition is "compat" (compatibility) - generator must provide it
 	// If DECOMP_FLAGS is not present in your tables, set all zeros in generated header or tell me to adapt.
@@ -117,42 +118,30 @@ namespace UnicodeNormalization
 			return;
 		}
 
-		// binary search
-		uint32_t cpv = (uint32_t)cp;
-		uint32_t low = 0;
-		uint32_t high = DECOMP_COUNT;
-
-		while (low < high)
+		uint32_t entry = UnicodeTrie::Lookup(DECOMP_TRIE_STAGE1, DECOMP_TRIE_STAGE2, DECOMP_TRIE_STAGE3, (uint32_t)cp);
+		if (entry == 0)
 		{
-			uint32_t mid = (low + high) >> 1;
-			uint32_t key = DECOMP_KEYS[mid];
+			out[outLen++] = cp;
+			return;
+		}
 
-			if (key == cpv)
-			{
-				uint32_t off = DECOMP_OFFS[mid];
-				uint32_t nextOff = DECOMP_OFFS[mid + 1];
-				uint32_t len = nextOff - off;
-				bool isCompat = (DECOMP_FLAGS[mid] != 0);
+		uint32_t mid = entry - 1;
+		uint32_t off = DECOMP_OFFS[mid];
+		uint32_t nextOff = DECOMP_OFFS[mid + 1];
+		uint32_t len = nextOff - off;
+		bool isCompat = (DECOMP_FLAGS[mid] != 0);
 
-				if (!compatibility && isCompat)
-				{
-					out[outLen++] = cp;
-					return;
-				}
-
-				for (uint32_t i = 0; i < len; ++i)
-				{
-					CodePoint sub(DECOMP_TARGETS[off + i]);
-					DecomposeCodePoint(sub, compatibility, out, outLen);
-				}
-				return;
-			}
-
-			if (key < cpv) low = mid + 1;
-			else high = mid;
+		if (!compatibility && isCompat)
+		{
+			out[outLen++] = cp;
+			return;
 		}
 
-		out[outLen++] = cp;
+		for (uint32_t i = 0; i < len; ++i)
+		{
+			CodePoint sub(DECOMP_TARGETS[off + i]);
+			DecomposeCodePoint(sub, compatibility, out, outLen);
+		}
 	}
 
 	void ReorderByCCC(List<CodePoint>& cps)
@@ -248,8 +237,8 @@ namespace UnicodeNormalization
 		uint32_t count = cps.Count();
 		if (count < 2) return;
 
-		List<CodePoint> outBuf;
-		outBuf.EnsureCapacity(count + 4); // small headroom
+		Memory::ScratchScope scratch(cps.GetArena());
+		List<CodePoint> outBuf(scratch.GetArena(), count + 4); // small headroom
 
 		// push first
 		outBuf.Add(cps[0]);
@@ -269,11 +258,11 @@ namespace UnicodeNormalization
 			{
 				bool blocked = false;
 
-				// block only if there exists a mid char with 0 < midCCC < ccc
+				// blocked by a mid char that is a starter or has ccc >= ccc (UAX#15 D115)
 				for (int k = lastStarterIndex + 1; k < (int)outBuf.Count(); ++k)
 				{
 					uint8_t midCCC = GetCCC(outBuf[k]);
-					if (midCCC > 0 && midCCC < ccc)
+					if (midCCC == 0 || midCCC >= ccc)
 					{
 						blocked = true;
 						break;
@@ -305,7 +294,202 @@ namespace UnicodeNormalization
 			}
 		}
 
-		// copy back: replace entire cps with outBuf (safe)
-		cps = outBuf;
+		// copy back: composition never lengthens the sequence
+		cps.FastClear();
+		cps.AddRange(outBuf.Data(), outBuf.Count());
+	}
+
+	// --------------------------------------------------------
+	// Quick check
+	// --------------------------------------------------------
+	namespace
+	{
+		struct QuickCheckTable
+		{
+			uint32_t shift;     // of the form's 2 bits in NORM_FLAGS_TRIE
+			uint32_t first;     // every code point below is Yes
+		};
+
+		inline QuickCheckTable quick_check_table(::NormalizationForm form) noexcept
+		{
+			switch (form)
+			{
+			case ::NormalizationForm::NFD:  return { 2, NFD_QC_FIRST };
+			case ::NormalizationForm::NFKC: return { 4, NFKC_QC_FIRST };
+			case ::NormalizationForm::NFKD: return { 6, NFKD_QC_FIRST };
+			default:                        return { 0, NFC_QC_FIRST };
+			}
+		}
+
+		inline QuickCheck lookup_quick_check(const QuickCheckTable& table, CodePoint cp) noexcept
+		{
+			if ((uint32_t)cp < table.first)
+				return QuickCheck::Yes;
+
+			return static_cast<QuickCheck>((norm_flags(cp) >> table.shift) & 3);
+		}
+
+		inline bool composes(::NormalizationForm form) noexcept
+		{
+			return form == ::NormalizationForm::NFC || form == ::NormalizationForm::NFKC;
+		}
+
+		inline uint32_t encoded_length(uint32_t cp) noexcept
+		{
+			return cp <= 0x7F ? 1 : cp <= 0x7FF ? 2 : cp <= 0xFFFF ? 3 : 4;
+		}
+
+		// Decompose, reorder and compose one segment of well-formed bytes
+		void normalize_segment(const Char* bytes, uint32_t length, ::NormalizationForm form, List<CodePoint>& out)
+		{
+			const bool compat = (form == ::NormalizationForm::NFKC || form == ::NormalizationForm::NFKD);
+
+			out.FastClear();
+			for (uint32_t i = 0; i < length; )
+			{
+				UTF8::UTF8DecodeResult r = UTF8::decode_utf8(bytes + i, length - i);
+
+				CodePoint local[32];
+				uint32_t localLen = 0;
+				DecomposeCodePoint(r.cp, compat, local, localLen);
+				out.AddRange(local, localLen);
+
+				i += (uint32_t)r.Length;
+			}
+
+			ReorderByCCC(out);
+			if (composes(form))
+				Compose(out);
+		}
+
+		// Whether cps encode to exactly these bytes
+		bool encodes_to(const List<CodePoint>& cps, const Char* bytes, uint32_t length)
+		{
+			uint32_t w = 0;
+			for (uint64_t i = 0; i < cps.Count(); ++i)
+			{
+				UTF8::UTF8EncodeResult enc = UTF8::encode_utf8(cps[i]);
+				if (w + enc.Length > length)
+					return false;
+
+				for (uint32_t j = 0; j < enc.Length; ++j)
+				{
+					if ((unsigned char)bytes[w + j] != (unsigned char)enc.Bytes[j])
+						return false;
+				}
+				w += (uint32_t)enc.Length;
+			}
+			return w == length;
+		}
+
+		// Walks the text segment by segment and calls changed(start, end, cps)
+		// for each one the form rewrites, cps being its normalized code points;
+		// changed returns false to stop. Returns -1 once the whole text is
+		// walked, otherwise the start of the segment it stopped at (the one
+		// rejected by changed, or the one holding ill-formed UTF-8).
+		// conflict is the arena changed writes into, if any: the segment
+		// scratch must not be the one it grows on.
+		template<typename F>
+		int64_t for_each_change(const Char* bytes, uint32_t length, ::NormalizationForm form, const Memory::Arena* conflict, F&& changed)
+		{
+			const QuickCheckTable table = quick_check_table(form);
+
+			Memory::ScratchScope scratch(conflict);
+			List<CodePoint> segment(scratch.GetArena(), 32);
+
+			uint32_t start = 0;         // first byte of the current segment
+			uint8_t lastCCC = 0;
+			bool suspect = false;       // the segment may not be in the form
+
+			// true to go on
+			auto close = [&](uint32_t end) -> bool
+			{
+				if (!suspect)
+					return true;
+
+				suspect = false;
+				normalize_segment(bytes + start, end - start, form, segment);
+				return encodes_to(segment, bytes + start, end - start) || changed(start, end, segment);
+			};
+
+			uint32_t i = 0;
+			while (i < length)
+			{
+				const uint8_t b = (uint8_t)bytes[i];
+				if (b < 0x80)
+				{
+					// ASCII is stable in every form
+					if (!close(i))
+						return start;
+					start = i++;
+					lastCCC = 0;
+					continue;
+				}
+
+				UTF8::UTF8DecodeResult r = UTF8::decode_utf8(bytes + i, length - i);
+				const uint32_t cp = (uint32_t)r.cp;
+				if (!r.IsValid || r.Length != encoded_length(cp))
+					return start;
+
+				// ccc is 0 below the first quick check entry of every form
+				const QuickCheck qc = lookup_quick_check(table, r.cp);
+				const uint8_t ccc = cp < table.first ? 0 : (uint8_t)GetCCC(r.cp);
+
+				if (ccc == 0 && qc == QuickCheck::Yes)
+				{
+					if (!close(i))
+						return start;
+					start = i;
+					lastCCC = 0;
+				}
+				else
+				{
+					if (qc != QuickCheck::Yes || (ccc != 0 && lastCCC > ccc))
+						suspect = true;
+					lastCCC = ccc;
+				}
+
+				i += (uint32_t)r.Length;
+			}
+
+			return close(length) ? -1 : (int64_t)start;
+		}
+	}
+
+	QuickCheck GetQuickCheck(CodePoint cp, ::NormalizationForm form)
+	{
+		return lookup_quick_check(quick_check_table(form), cp);
+	}
+
+	uint32_t SpanNormalized(const Char* bytes, uint32_t length, ::NormalizationForm form)
+	{
+		const int64_t stop = for_each_change(bytes, length, form, nullptr, [](uint32_t, uint32_t, const List<CodePoint>&)
+		{
+			return false;
+		});
+
+		return stop < 0 ? length : (uint32_t)stop;
+	}
+
+	bool NormalizeSegments(const Char* bytes, uint32_t length, ::NormalizationForm form, List<Char>& out)
+	{
+		uint32_t copied = 0;
+		const int64_t stop = for_each_change(bytes, length, form, out.GetArena(), [&](uint32_t start, uint32_t end, const List<CodePoint>& cps)
+		{
+			out.AddRange(bytes + copied, start - copied);
+			for (uint64_t i = 0; i < cps.Count(); ++i)
+			{
+				UTF8::UTF8EncodeResult enc = UTF8::encode_utf8(cps[i]);
+				out.AddRange(enc.Bytes, enc.Length);
+			}
+			copied = end;
+			return true;
+		});
+
+		if (stop >= 0)
+			return false;
+
+		out.AddRange(bytes + copied, length - copied);
+		return true;
 	}
-}
\ No newline at end of file
+}
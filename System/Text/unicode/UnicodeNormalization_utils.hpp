@@ -3,6 +3,9 @@
 #include "System/Types.hpp"
 #include "System/Collections/List.hpp"
 #include "UnicodeNormalization_tables.hpp"
+#include "UnicodeNormalization_quickcheck.hpp"
+#include "UnicodeNormalization_tries.hpp"
+#include "UnicodeTrie.hpp"
 #include <cstdint>
 #include <stdio.h>
 
@@ -98,4 +101,39 @@ namespace UnicodeNormalization
 	// Uses ComposePair + IsCompositionExcluded
 	// --------------------------------------------------------
 	void Compose(List<CodePoint>& cps);
+
+	// --------------------------------------------------------
+	// Quick check (UAX#15 section 9), from the *_QC properties:
+	// Yes: the code point is unchanged by the form; No: it never
+	// appears in it; Maybe: it may compose with what precedes it
+	// --------------------------------------------------------
+	enum class QuickCheck : uint8_t
+	{
+		Yes = 0,
+		No = 1,
+		Maybe = 2
+	};
+
+	QuickCheck GetQuickCheck(CodePoint cp, ::NormalizationForm form);
+
+	// --------------------------------------------------------
+	// Incremental normalization over UTF-8 bytes
+	// The text is cut into segments, each starting at a stable code
+	// point (ccc 0, quick check Yes): nothing before one can reorder
+	// past it or compose with it. A segment of Yes code points in
+	// canonical order is already normalized and is only scanned
+	// (ASCII and code points below the form's *_QC_FIRST without a
+	// table lookup). Segments holding a No or Maybe code point, or
+	// marks out of order, are normalized in scratch storage.
+	// --------------------------------------------------------
+
+	// Byte length of the prefix made of segments already in the form:
+	// length when the whole text is normalized. Stops at the segment
+	// holding ill-formed UTF-8, which normalization would rewrite.
+	uint32_t SpanNormalized(const Char* bytes, uint32_t length, ::NormalizationForm form);
+
+	// Appends the normalized text to out: bytes already in the form are
+	// copied, only the segments that change are re-encoded.
+	// Returns false on ill-formed UTF-8 (out then holds a partial result).
+	bool NormalizeSegments(const Char* bytes, uint32_t length, ::NormalizationForm form, List<Char>& out);
 }
\ No newline at end of file
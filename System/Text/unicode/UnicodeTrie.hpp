@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+// ==============================================================
+//  UnicodeTrie - three-stage lookup tables for per code point
+//  properties, generated by ucd-downloader (ucd_trie.py)
+//  - cp >> 10 selects a block of STAGE2, (cp >> 5) & 31 an entry
+//    in it, which selects a block of 32 values in STAGE3
+//  - Identical blocks are stored once: the unassigned planes and
+//    blocks cost one block each
+//  - Three loads whatever the code point, no branch but the
+//    range check; 0 above U+10FFFF (0 is every table's default)
+// ==============================================================
+
+namespace UnicodeTrie
+{
+	static constexpr uint32_t Shift1 = 10;
+	static constexpr uint32_t Shift2 = 5;
+	static constexpr uint32_t Limit = 0x110000;
+
+	template<typename Value, typename Index1, typename Index2>
+	inline constexpr Value Lookup(const Index1* stage1, const Index2* stage2, const Value* stage3, uint32_t cp) noexcept
+	{
+		if (cp >= Limit)
+			return Value(0);
+
+		const uint32_t block = (uint32_t)stage1[cp >> Shift1] << (Shift1 - Shift2);
+		const uint32_t values = (uint32_t)stage2[block | ((cp >> Shift2) & ((1u << (Shift1 - Shift2)) - 1))] << Shift2;
+		return stage3[values | (cp & ((1u << Shift2) - 1))];
+	}
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==============================================================
+//  Interlocked / Volatile
+//  - Atomic operations on plain integers and pointers, .NET style
+//  - Compiler intrinsics only (no std::atomic)
+//  - Interlocked::* are full barriers unless the name says Relaxed
+//  - Volatile::Read is an acquire load, Volatile::Write a release store
+// ==============================================================
+
+namespace Interlocked
+{
+	namespace Detail
+	{
+		template<typename T>
+		inline constexpr bool is_atomic_size_v = (sizeof(T) == 4 || sizeof(T) == 8);
+
+#if defined(_MSC_VER) && !defined(__clang__)
+		// C-style casts cover both integers and pointers (x64 pointers are 8 bytes)
+		template<typename T>
+		inline long long ToBits(T v) noexcept { return (long long)v; }
+
+		template<typename T>
+		inline T FromBits(long long bits) noexcept
+		{
+			if constexpr (sizeof(T) == 4) return (T)(long)bits;
+			else return (T)bits;
+		}
+#endif
+	}
+
+	template<typename T>
+	inline T Exchange(volatile T* location, T value) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		if constexpr (sizeof(T) == 4)
+			return Detail::FromBits<T>((unsigned long)_InterlockedExchange((volatile long*)location, (long)Detail::ToBits(value)));
+		else
+			return Detail::FromBits<T>(_InterlockedExchange64((volatile long long*)location, Detail::ToBits(value)));
+#else
+		return __atomic_exchange_n(location, value, __ATOMIC_SEQ_CST);
+#endif
+	}
+
+	// Returns the original value; the store happens only if it equaled comparand.
+	template<typename T>
+	inline T CompareExchange(volatile T* location, T value, T comparand) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		if constexpr (sizeof(T) == 4)
+			return Detail::FromBits<T>((unsigned long)_InterlockedCompareExchange((volatile long*)location,
+				(long)Detail::ToBits(value), (long)Detail::ToBits(comparand)));
+		else
+			return Detail::FromBits<T>(_InterlockedCompareExchange64((volatile long long*)location,
+				Detail::ToBits(value), Detail::ToBits(comparand)));
+#else
+		__atomic_compare_exchange_n(location, &comparand, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+		return comparand;
+#endif
+	}
+
+	// Returns the value before the addition.
+	template<typename T>
+	inline T Add(volatile T* location, T value) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		if constexpr (sizeof(T) == 4)
+			return (T)_InterlockedExchangeAdd((volatile long*)location, (long)value);
+		else
+			return (T)_InterlockedExchangeAdd64((volatile long long*)location, (long long)value);
+#else
+		return __atomic_fetch_add(location, value, __ATOMIC_SEQ_CST);
+#endif
+	}
+
+	// Relaxed variant: atomic but imposes no ordering (statistics, refcount increments).
+	template<typename T>
+	inline T AddRelaxed(volatile T* location, T value) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		return Add(location, value);
+#else
+		return __atomic_fetch_add(location, value, __ATOMIC_RELAXED);
+#endif
+	}
+
+	// Release variant: earlier reads and writes cannot move after it (refcount
+	// decrements; the thread that drops the last reference then issues an
+	// AcquireFence before freeing).
+	template<typename T>
+	inline T AddRelease(volatile T* location, T value) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		return Add(location, value);
+#else
+		return __atomic_fetch_add(location, value, __ATOMIC_RELEASE);
+#endif
+	}
+
+	// Returns the value before the bits were set.
+	template<typename T>
+	inline T Or(volatile T* location, T bits) noexcept
+	{
+		static_assert(Detail::is_atomic_size_v<T>, "Interlocked requires a 4 or 8 byte type");
+#if defined(_MSC_VER) && !defined(__clang__)
+		if constexpr (sizeof(T) == 4)
+			return (T)_InterlockedOr((volatile long*)location, (long)bits);
+		else
+			return (T)_InterlockedOr64((volatile long long*)location, (long long)bits);
+#else
+		return __atomic_fetch_or(location, bits, __ATOMIC_SEQ_CST);
+#endif
+	}
+
+	// Returns the value after the increment.
+	template<typename T>
+	inline T Increment(volatile T* location) noexcept
+	{
+		return Add(location, T(1)) + T(1);
+	}
+
+	// Returns the value after the decrement.
+	template<typename T>
+	inline T Decrement(volatile T* location) noexcept
+	{
+		return Add(location, T(0) - T(1)) - T(1);
+	}
+
+	// Full two-way fence (named Fence: winnt.h defines a MemoryBarrier macro)
+	inline void Fence() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		__faststorefence();
+#else
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+	}
+
+	// Acquire fence: loads before it are ordered before any load or store after it
+	// (seqlock readers validate their version with this).
+	inline void AcquireFence() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		_ReadWriteBarrier(); // x86/x64 never reorders loads with later loads or stores
+#else
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+	}
+
+	// CPU hint for spin-wait loops.
+	inline void SpinWait() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		_mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__)
+		asm volatile("yield");
+#endif
+	}
+}
+
+namespace Volatile
+{
+	// Acquire load: later reads/writes cannot move before it.
+	template<typename T>
+	inline T Read(const volatile T* location) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		T v = *location;
+		_ReadWriteBarrier();
+		return v;
+#else
+		return __atomic_load_n(location, __ATOMIC_ACQUIRE);
+#endif
+	}
+
+	// Release store: earlier reads/writes cannot move after it.
+	template<typename T>
+	inline void Write(volatile T* location, T value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		_ReadWriteBarrier();
+		*location = value;
+#else
+		__atomic_store_n(location, value, __ATOMIC_RELEASE);
+#endif
+	}
+
+	template<typename T>
+	inline T ReadRelaxed(const volatile T* location) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		return *location;
+#else
+		return __atomic_load_n(location, __ATOMIC_RELAXED);
+#endif
+	}
+
+	template<typename T>
+	inline void WriteRelaxed(volatile T* location, T value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		*location = value;
+#else
+		__atomic_store_n(location, value, __ATOMIC_RELAXED);
+#endif
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Interlocked.hpp"
+
+// ==============================================================
+//  ReaderWriterSpinLock - shared/exclusive spin lock for short,
+//  read-mostly critical sections (ConcurrentMap shards).
+//  - One 32 bit word: writer bit, writer-pending bit, reader count
+//  - A waiting writer sets the pending bit, which keeps new readers
+//    out so a steady stream of readers cannot starve it
+//  - Not reentrant, no upgrade from read to write
+// ==============================================================
+
+class ReaderWriterSpinLock
+{
+public:
+
+	constexpr ReaderWriterSpinLock() noexcept : _state(0) {}
+
+	ReaderWriterSpinLock(const ReaderWriterSpinLock&) = delete;
+	ReaderWriterSpinLock& operator=(const ReaderWriterSpinLock&) = delete;
+
+	inline void EnterRead() noexcept
+	{
+		for (;;)
+		{
+			uint32_t s = Volatile::ReadRelaxed(&_state);
+			if ((s & (Writer | Pending)) == 0 && Interlocked::CompareExchange(&_state, s + 1, s) == s)
+				return;
+			Interlocked::SpinWait();
+		}
+	}
+
+	inline void ExitRead() noexcept
+	{
+		Interlocked::Decrement(&_state);
+	}
+
+	inline void EnterWrite() noexcept
+	{
+		for (;;)
+		{
+			uint32_t s = Volatile::ReadRelaxed(&_state);
+			if ((s & ~Pending) == 0)
+			{
+				// free (possibly with our own pending bit): take it and drop the bit
+				if (Interlocked::CompareExchange(&_state, Writer, s) == s)
+					return;
+			}
+			else if ((s & Pending) == 0)
+			{
+				Interlocked::CompareExchange(&_state, s | Pending, s);
+			}
+			Interlocked::SpinWait();
+		}
+	}
+
+	inline void ExitWrite() noexcept
+	{
+		// keeps a pending bit another writer may have set meanwhile
+		Interlocked::Add(&_state, 0u - Writer);
+	}
+
+	inline bool IsWriteHeld() const noexcept
+	{
+		return (Volatile::ReadRelaxed(&_state) & Writer) != 0;
+	}
+
+private:
+
+	static constexpr uint32_t Writer = 1u << 31;
+	static constexpr uint32_t Pending = 1u << 30;
+
+	volatile uint32_t _state;
+};
+
+// Scope guards: enter on construction, exit on destruction.
+class ReadLockScope
+{
+public:
+
+	explicit ReadLockScope(ReaderWriterSpinLock& lock) noexcept : _lock(lock) { _lock.EnterRead(); }
+	~ReadLockScope() noexcept { _lock.ExitRead(); }
+
+	ReadLockScope(const ReadLockScope&) = delete;
+	ReadLockScope& operator=(const ReadLockScope&) = delete;
+
+private:
+
+	ReaderWriterSpinLock& _lock;
+};
+
+class WriteLockScope
+{
+public:
+
+	explicit WriteLockScope(ReaderWriterSpinLock& lock) noexcept : _lock(lock) { _lock.EnterWrite(); }
+	~WriteLockScope() noexcept { _lock.ExitWrite(); }
+
+	WriteLockScope(const WriteLockScope&) = delete;
+	WriteLockScope& operator=(const WriteLockScope&) = delete;
+
+private:
+
+	ReaderWriterSpinLock& _lock;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Interlocked.hpp"
+
+// ==============================================================
+//  SpinLock - test-and-test-and-set lock for very short critical
+//  sections (allocator free lists, table shards). Not reentrant.
+// ==============================================================
+
+class SpinLock
+{
+public:
+
+	constexpr SpinLock() noexcept : _state(0) {}
+
+	SpinLock(const SpinLock&) = delete;
+	SpinLock& operator=(const SpinLock&) = delete;
+
+	inline void Enter() noexcept
+	{
+		while (Interlocked::Exchange(&_state, 1u) != 0)
+		{
+			// spin on a plain read so the cache line stays shared while contended
+			while (Volatile::ReadRelaxed(&_state) != 0)
+				Interlocked::SpinWait();
+		}
+	}
+
+	inline bool TryEnter() noexcept
+	{
+		return Volatile::ReadRelaxed(&_state) == 0 && Interlocked::Exchange(&_state, 1u) == 0;
+	}
+
+	inline void Exit() noexcept
+	{
+		Volatile::Write(&_state, 0u);
+	}
+
+	inline bool IsHeld() const noexcept
+	{
+		return Volatile::ReadRelaxed(&_state) != 0;
+	}
+
+private:
+
+	volatile uint32_t _state;
+};
+
+// Scope guard: enters on construction, exits on destruction.
+class SpinLockScope
+{
+public:
+
+	explicit SpinLockScope(SpinLock& lock) noexcept : _lock(lock) { _lock.Enter(); }
+	~SpinLockScope() noexcept { _lock.Exit(); }
+
+	SpinLockScope(const SpinLockScope&) = delete;
+	SpinLockScope& operator=(const SpinLockScope&) = delete;
+
+private:
+
+	SpinLock& _lock;
+};
@@ -88,4 +88,14 @@ inline u32 Hash(const T& v) noexcept
     {
         return HashBytes(&v, sizeof(T));
     }
-}
\ No newline at end of file
+}
+
+// ==========================================================
+// Lookup views
+// ==========================================================
+// Borrowed type that hash containers keyed by K accept for lookups,
+// so probing does not have to build a K. A specialization must hash
+// like K (equal keys, equal Hash) and compare with K through ==.
+
+template<typename K>
+struct hash_lookup_view { using type = K; };
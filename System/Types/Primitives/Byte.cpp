@@ -1,5 +1,7 @@
 #include "Byte.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean Byte::Equals(const Byte& other) const noexcept
 {
@@ -13,7 +15,24 @@ UInt32 Byte::GetHashCode() const noexcept
 
 String Byte::ToString() const noexcept
 {
-	char buf[4];
-	int n = snprintf(buf, sizeof(buf), "%u", (unsigned)_value);
+	Char buf[NumberFormat::MaxUInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((uint32_t)_value, buf, NumberFormat::MaxUInt32Chars, n);
 	return String(buf, n);
+}
+
+Byte Byte::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Byte(value);
+}
+
+Boolean Byte::TryParse(const StringView& text, Byte& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Byte(value);
+	return true;
 }
\ No newline at end of file
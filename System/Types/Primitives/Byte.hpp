@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Byte final : public Object<Byte>
 {
@@ -515,6 +516,13 @@ public:
 	Boolean Equals(const Byte& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Byte Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Byte& result) noexcept;
 };
 
 inline const Byte Byte::MaxValue = static_cast<Byte::value_type>(0xFF);
@@ -1,5 +1,7 @@
 #include "Double.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean Double::Equals(const Double& other) const noexcept
 {
@@ -14,7 +16,24 @@ UInt32 Double::GetHashCode() const noexcept
 
 String Double::ToString() const noexcept
 {
-	char buf[64];
-	int n = snprintf(buf, sizeof(buf), "%g", _value);
+	Char buf[NumberFormat::MaxDoubleChars];
+	u32 n;
+	NumberFormat::TryFormat((double)_value, buf, NumberFormat::MaxDoubleChars, n);
 	return String(buf, n);
+}
+
+Double Double::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Double(value);
+}
+
+Boolean Double::TryParse(const StringView& text, Double& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Double(value);
+	return true;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Double final : public Object<Double>
 {
@@ -467,6 +468,13 @@ public:
 	Boolean Equals(const Double& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Double Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Double& result) noexcept;
 };
 
 inline const Double Double::Epsilon = static_cast<Double::value_type>(2.2204460492503131E-16);
@@ -1,5 +1,7 @@
 #include "Int16.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 #include "UInt32.hpp"
 
 Boolean Int16::Equals(const Int16& other) const noexcept
@@ -14,7 +16,24 @@ UInt32 Int16::GetHashCode() const noexcept
 
 String Int16::ToString() const noexcept
 {
-	char buf[8];
-	int n = snprintf(buf, sizeof(buf), "%d", (int16_t)_value);
+	Char buf[NumberFormat::MaxInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((int32_t)_value, buf, NumberFormat::MaxInt32Chars, n);
 	return String(buf, n);
+}
+
+Int16 Int16::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Int16(value);
+}
+
+Boolean Int16::TryParse(const StringView& text, Int16& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Int16(value);
+	return true;
 }
\ No newline at end of file
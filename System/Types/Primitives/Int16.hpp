@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Int16 final : public Object<Int16>
 {
@@ -468,6 +469,13 @@ public:
 	Boolean Equals(const Int16& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Int16 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Int16& result) noexcept;
 };
 
 inline const Int16 Int16::MaxValue = static_cast<Int16::value_type>(0x7FFF);
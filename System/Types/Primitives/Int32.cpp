@@ -1,5 +1,7 @@
 #include "Int32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 #include "UInt32.hpp"
 
 Boolean Int32::Equals(const Int32& other) const noexcept
@@ -14,7 +16,24 @@ UInt32 Int32::GetHashCode() const noexcept
 
 String Int32::ToString() const noexcept
 {
-	char buf[16];
-	int n = snprintf(buf, sizeof(buf), "%d", (int32_t)_value);
+	Char buf[NumberFormat::MaxInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((int32_t)_value, buf, NumberFormat::MaxInt32Chars, n);
 	return String(buf, n);
+}
+
+Int32 Int32::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Int32(value);
+}
+
+Boolean Int32::TryParse(const StringView& text, Int32& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Int32(value);
+	return true;
 }
\ No newline at end of file
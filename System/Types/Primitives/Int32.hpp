@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Int32 final : public Object<Int32>
 {
@@ -469,6 +470,13 @@ public:
 	Boolean Equals(const Int32& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Int32 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Int32& result) noexcept;
 };
 
 inline const Int32 Int32::MaxValue = 0x7FFFFFFF;
@@ -1,6 +1,8 @@
 #include "Int64.hpp"
 #include "UInt32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean Int64::Equals(const Int64& other) const noexcept
 {
@@ -15,7 +17,24 @@ UInt32 Int64::GetHashCode() const noexcept
 
 String Int64::ToString() const noexcept
 {
-	char buf[32];
-	int n = snprintf(buf, sizeof(buf), "%lld", (long long)_value);
+	Char buf[NumberFormat::MaxInt64Chars];
+	u32 n;
+	NumberFormat::TryFormat((int64_t)_value, buf, NumberFormat::MaxInt64Chars, n);
 	return String(buf, n);
+}
+
+Int64 Int64::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Int64(value);
+}
+
+Boolean Int64::TryParse(const StringView& text, Int64& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Int64(value);
+	return true;
 }
\ No newline at end of file
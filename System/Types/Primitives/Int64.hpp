@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Int64 final : public Object<Int64>
 {
@@ -468,6 +469,13 @@ public:
 	Boolean Equals(const Int64& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Int64 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Int64& result) noexcept;
 };
 
 inline const Int64 Int64::MaxValue = 0X7FFFFFFFFFFFFFFFLL;
@@ -1,6 +1,8 @@
 #include "SByte.hpp"
 #include "UInt32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean SByte::Equals(const SByte& other) const noexcept
 {
@@ -14,7 +16,24 @@ UInt32 SByte::GetHashCode() const noexcept
 
 String SByte::ToString() const noexcept
 {
-	char buf[4];
-	int n = snprintf(buf, sizeof(buf), "%i", (signed)_value);
+	Char buf[NumberFormat::MaxInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((int32_t)_value, buf, NumberFormat::MaxInt32Chars, n);
 	return String(buf, n);
+}
+
+SByte SByte::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return SByte(value);
+}
+
+Boolean SByte::TryParse(const StringView& text, SByte& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = SByte(value);
+	return true;
 }
\ No newline at end of file
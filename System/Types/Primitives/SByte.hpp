@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class SByte final : public Object<SByte>
 {
@@ -469,6 +470,13 @@ public:
 	Boolean Equals(const SByte& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static SByte Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, SByte& result) noexcept;
 };
 
 inline const SByte SByte::MaxValue = static_cast<SByte::value_type>(0x7F);
@@ -1,5 +1,7 @@
 #include "Single.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 #include "UInt32.hpp"
 
 Boolean Single::Equals(const Single& other) const noexcept
@@ -14,7 +16,24 @@ UInt32 Single::GetHashCode() const noexcept
 
 String Single::ToString() const noexcept
 {
-	char buf[32];
-	int n = snprintf(buf, sizeof(buf), "%g", (double)_value);
+	Char buf[NumberFormat::MaxSingleChars];
+	u32 n;
+	NumberFormat::TryFormat((float)_value, buf, NumberFormat::MaxSingleChars, n);
 	return String(buf, n);
+}
+
+Single Single::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return Single(value);
+}
+
+Boolean Single::TryParse(const StringView& text, Single& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = Single(value);
+	return true;
 }
\ No newline at end of file
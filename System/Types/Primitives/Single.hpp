@@ -6,6 +6,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class Single final : public Object<Single>
 {
@@ -467,6 +468,13 @@ public:
 	Boolean Equals(const Single& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static Single Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, Single& result) noexcept;
 };
 
 inline const Single Single::Epsilon = static_cast<Single::value_type>(1.1920928955078125e-7f);
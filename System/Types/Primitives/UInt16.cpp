@@ -1,6 +1,8 @@
 #include "UInt16.hpp"
 #include "UInt32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean UInt16::Equals(const UInt16& other) const noexcept
 {
@@ -14,7 +16,24 @@ UInt32 UInt16::GetHashCode() const noexcept
 
 String UInt16::ToString() const noexcept
 {
-	char buf[8];
-	int n = snprintf(buf, sizeof(buf), "%d", (int16_t)_value);
+	Char buf[NumberFormat::MaxUInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((uint32_t)_value, buf, NumberFormat::MaxUInt32Chars, n);
 	return String(buf, n);
+}
+
+UInt16 UInt16::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return UInt16(value);
+}
+
+Boolean UInt16::TryParse(const StringView& text, UInt16& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = UInt16(value);
+	return true;
 }
\ No newline at end of file
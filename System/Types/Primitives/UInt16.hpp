@@ -7,6 +7,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class UInt16 final : public Object<UInt16>
 {
@@ -473,6 +474,13 @@ public:
 	Boolean Equals(const UInt16& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static UInt16 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, UInt16& result) noexcept;
 };
 
 inline const UInt16 UInt16::MaxValue = static_cast<UInt16::value_type>(0xFFFF);
@@ -1,5 +1,7 @@
 #include "UInt32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean UInt32::Equals(const UInt32& other) const noexcept
 {
@@ -13,7 +15,24 @@ UInt32 UInt32::GetHashCode() const noexcept
 
 String UInt32::ToString() const noexcept
 {
-	char buf[16];
-	int n = snprintf(buf, sizeof(buf), "%u", (uint32_t)_value);
+	Char buf[NumberFormat::MaxUInt32Chars];
+	u32 n;
+	NumberFormat::TryFormat((uint32_t)_value, buf, NumberFormat::MaxUInt32Chars, n);
 	return String(buf, n);
+}
+
+UInt32 UInt32::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return UInt32(value);
+}
+
+Boolean UInt32::TryParse(const StringView& text, UInt32& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = UInt32(value);
+	return true;
 }
\ No newline at end of file
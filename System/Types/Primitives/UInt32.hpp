@@ -7,6 +7,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class UInt32 final : public Object<UInt32>
 {
@@ -468,6 +469,13 @@ public:
 	Boolean Equals(const UInt32& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static UInt32 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, UInt32& result) noexcept;
 };
 
 inline const UInt32 UInt32::MaxValue = static_cast<UInt32::value_type>(0xFFFFFFFF);
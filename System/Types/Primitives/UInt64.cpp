@@ -1,6 +1,8 @@
 #include "UInt64.hpp"
 #include "UInt32.hpp"
 #include "System/String.hpp"
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/NumberParse.hpp"
 
 Boolean UInt64::Equals(const UInt64& other) const noexcept
 {
@@ -15,7 +17,24 @@ UInt32 UInt64::GetHashCode() const noexcept
 
 String UInt64::ToString() const noexcept
 {
-	char buf[32];
-	int n = snprintf(buf, sizeof(buf), "%llu", (uint64_t)_value);
+	Char buf[NumberFormat::MaxUInt64Chars];
+	u32 n;
+	NumberFormat::TryFormat((uint64_t)_value, buf, NumberFormat::MaxUInt64Chars, n);
 	return String(buf, n);
+}
+
+UInt64 UInt64::Parse(const StringView& text)
+{
+	value_type value;
+	NumberParse::ThrowIfFailed(NumberParse::Parse(text.GetData(), text.GetByteCount(), value));
+	return UInt64(value);
+}
+
+Boolean UInt64::TryParse(const StringView& text, UInt64& result) noexcept
+{
+	value_type value;
+	if (NumberParse::Parse(text.GetData(), text.GetByteCount(), value) != NumberParse::Status::Ok)
+		return false;
+	result = UInt64(value);
+	return true;
 }
\ No newline at end of file
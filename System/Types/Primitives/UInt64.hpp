@@ -7,6 +7,7 @@
 #include "Operators.hpp"
 
 class String;
+class StringView;
 
 class UInt64 final : public Object<UInt64>
 {
@@ -474,6 +475,13 @@ public:
 	Boolean Equals(const UInt64& other) const noexcept;
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
+
+	/*
+	 * Parse: the whole text is the number, white space around it allowed.
+	 * Throws FormatException or OverflowException; TryParse returns false
+	 */
+	static UInt64 Parse(const StringView& text);
+	static Boolean TryParse(const StringView& text, UInt64& result) noexcept;
 };
 
 inline const UInt64 UInt64::MaxValue = static_cast<UInt64::value_type>(0XFFFFFFFFFFFFFFFFLL);
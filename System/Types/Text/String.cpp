@@ -4,6 +4,12 @@
 #include "System/Marvin32.hpp"
 #include "System/Globalization/Locale.hpp"
 #include "System/Memory.hpp"
+#include "System/Collections/SmallList.hpp"
+#include "System/Threading/Interlocked.hpp"
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/TextSearch.hpp"
+#include "System/Text/TextMatcher.hpp"
+#include "System/Text/GraphemeIndex.hpp"
 
 String::String() : _ptr(0), _byteOffset(0), _byteLength(0), _flags(FLAG_SSO), _gcLength(0)
 {
@@ -305,16 +311,42 @@ String::~String() noexcept
 	release();
 }
 
+// An empty String takes other's block as is; anything else appends in
+// place when it can (see append)
+String& String::operator+=(const String& other) noexcept
+{
+	if (other.IsEmpty())
+		return *this;
+
+	if (IsEmpty())
+		return *this = other;
+
+	append(other.data(), other._byteLength);
+	return *this;
+}
+
+// A view of a whole block computes the hash once and keeps it in the
+// block prefix, where every String sharing the block finds it (interned
+// blocks get it from StringPool). 0 means not computed yet: a hash that
+// really is 0 is just computed again. Every thread stores the same value,
+// and writes to the bytes in place clear it. Slices and SSO strings hash
+// their bytes each time.
 UInt32 String::GetHashCode() const noexcept
 {
-	if (_byteLength == 0)
-		return 0;
+	if (IsSSO() || !_ptr || _byteOffset != 0 || _byteLength != length_ref())
+	{
+		// StringView hashes the same bytes the same way; Map lookups by view rely on it
+		return StringView(*this).GetHashCode();
+	}
 
-	return Marvin32::Compute(
-		reinterpret_cast<const uint8_t*>(data()),
-		_byteLength,
-		Phoenix::GLOBAL_HASH_SEED
-	);
+	volatile uint32_t* slot = hash_slot();
+	uint32_t hash = Volatile::ReadRelaxed(slot);
+	if (hash == 0)
+	{
+		hash = StringView(*this).GetHashCode();
+		Volatile::WriteRelaxed(slot, hash);
+	}
+	return hash;
 }
 
 u32 String::GetLength() const noexcept
@@ -328,46 +360,26 @@ u32 String::GetLength() const noexcept
 		return 0;
 	}
 
-	const Char* p = data();
-
-	if (ASCII::IsAllASCII(p, _byteLength))
+	if (is_ascii(*this))
 	{
 		_gcLength = _byteLength;
 		return _gcLength;
 	}
 
-	// Slow path: decode + grapheme cluster detection
-
-	List<CodePoint> cps;
-	cps.EnsureCapacity(_byteLength);
-
-	uint32_t len = _byteLength;
-	uint32_t pos = 0;
-
-	UTF8::Decode(data(), GetByteCount(), cps);
-
-	uint32_t cpCount = cps.Count();
-	if (cpCount == 0)
-	{
-		_gcLength = 0;
-		return 0;
-	}
-
-	List<CodePoint> boundaries;
-	boundaries.EnsureCapacity(cpCount);
-
-	uint32_t gcTotal = 0;
-	UnicodeCase::ComputeGraphemeBoundaries(cps, cps.Count(), boundaries, gcTotal);
-
-	_gcLength = gcTotal;
-	return gcTotal;
+	// Slow path: count grapheme clusters straight off the bytes, or take
+	// the count from the block's index when this view is the whole block
+	const bool wholeBlock = !IsSSO() && _ptr && _byteOffset == 0 && _byteLength == length_ref();
+	const UTF8::GraphemeIndex* index = wholeBlock ? grapheme_index() : nullptr;
+	_gcLength = index ? index->GetGraphemeCount() : UTF8::CountGraphemes(data(), _byteLength);
+	return _gcLength;
 }
 
 Boolean String::Contains(const String& sub) const noexcept {
 	if (sub.IsEmpty()) return true;
 
-	// If identical region → contains
-	if (_ptr == sub._ptr &&
+	// If identical region → contains (SSO bytes alias _ptr, so heap blocks only)
+	if (!IsSSO() && !sub.IsSSO() &&
+		_ptr == sub._ptr &&
 		_byteOffset == sub._byteOffset &&
 		_byteLength == sub._byteLength)
 		return true;
@@ -375,6 +387,10 @@ Boolean String::Contains(const String& sub) const noexcept {
 	return contain_byte(sub);
 }
 
+Boolean String::Contains(StringView sub) const noexcept {
+	return contain_byte(sub);
+}
+
 Boolean String::Contains(CodePoint cp) const noexcept {
 	if (!cp.IsValid()) return false;
 	String s = FromCodePoint(cp);
@@ -441,8 +457,9 @@ Boolean String::Contains(CodePoint cp, Boolean ignoreCase) const noexcept
 
 Int32 String::Compare(const String& A, const String& B, Boolean ignoreCase, const Locale& locale) noexcept
 {
-	// Mesma região? iguais.
-	if (A._ptr == B._ptr &&
+	// Mesma região? iguais. (SSO bytes alias _ptr, so heap blocks only)
+	if (!A.IsSSO() && !B.IsSSO() &&
+		A._ptr == B._ptr &&
 		A._byteOffset == B._byteOffset &&
 		A._byteLength == B._byteLength)
 		return 0;
@@ -496,6 +513,10 @@ Boolean String::Contains(CodePoint cp, Boolean ignoreCase, const Locale& locale)
 
 Boolean String::Compare(const String& a, const String& b, const Locale& locale) noexcept
 {
+	if (!a.IsSSO() && !b.IsSSO() && a._ptr == b._ptr &&
+		a._byteOffset == b._byteOffset && a._byteLength == b._byteLength)
+		return true;
+
 	List<CodePoint> A, B;
 	UTF8::FoldAndNormalize(a.data(), a.GetByteCount(), locale.data(), A);
 	UTF8::FoldAndNormalize(b.data(), b.GetByteCount(), locale.data(), B);
@@ -566,12 +587,17 @@ Array<wchar_t> String::ToWideCharArray() const noexcept
 
 Boolean String::Equals(const String& other) const noexcept
 {
-	// Fast path: mesma região de memória
-	if (_ptr == other._ptr &&
+	// Fast path: mesma região de memória (SSO bytes alias _ptr, so heap blocks only)
+	if (!IsSSO() && !other.IsSSO() &&
+		_ptr == other._ptr &&
 		_byteOffset == other._byteOffset &&
 		_byteLength == other._byteLength)
 		return true;
 
+	// Two canonical instances hold the same bytes only if they are one block
+	if (IsInterned() && other.IsInterned())
+		return false;
+
 	// Tamanho diferente -> falso
 	if (_byteLength != other._byteLength)
 		return false;
@@ -586,6 +612,20 @@ Boolean String::Equals(const String& other) const noexcept
 	return true;
 }
 
+Boolean String::Equals(StringView other) const noexcept
+{
+	if (_byteLength != other.GetByteCount())
+		return false;
+
+	const Char* a = data();
+	const char* b = other.GetData();
+	for (uint32_t i = 0; i < _byteLength; ++i)
+		if (a[i] != Char(static_cast<unsigned char>(b[i])))
+			return false;
+
+	return true;
+}
+
 Boolean String::EndsWith(const String& compare, Boolean ignoreCase, const Locale& locale) const noexcept
 {
 	return Boolean(impl_EndsWith(compare, ignoreCase, locale));
@@ -597,6 +637,11 @@ Boolean String::EndsWith(const String& compare, Boolean ignoreCase) const noexce
 }
 
 Boolean String::EndsWith(const String& compare) const noexcept
+{
+	return Boolean(impl_EndsWith(ascii_view(compare), false, Locale("en")));
+}
+
+Boolean String::EndsWith(StringView compare) const noexcept
 {
 	return Boolean(impl_EndsWith(compare, false, Locale("en")));
 }
@@ -635,25 +680,49 @@ Boolean String::Equals(const String& a, const String& b, Boolean ignoreCase, con
 
 i64 String::IndexOf(const String& value, u32 startIndex) const
 {
+	return IndexOf(ascii_view(value), startIndex);
+}
+
+i64 String::IndexOf(StringView value, u32 startIndex) const noexcept
+{
+	const Char* needle = reinterpret_cast<const Char*>(value.GetData());
+
 	// -----------------------------
 	// 1) Fast-path: ambas ASCII puras
 	// -----------------------------
-	if (is_ascii(*this) && is_ascii(value))
+	if (is_ascii(*this) && value.IsASCII())
 	{
 		uint64_t H = _byteLength;
-		uint64_t N = value._byteLength;
+		uint64_t N = value.GetByteCount();
 
 		// ASCII::IndexOf já trata N==0 e bounds
-		int64_t res = ASCII::IndexOf(data(), H, value.data(), N, startIndex);
+		int64_t res = ASCII::IndexOf(data(), H, needle, N, startIndex);
 		return static_cast<Int64>(res);
 	}
 
-	// Decode both strings to codepoints
-	List<CodePoint> H, N;
-	UTF8::Decode(data(), _byteLength, H);
-	UTF8::Decode(value.data(), value._byteLength, N);
+	if (value.IsEmpty())
+		return startIndex;
+
+	// Well-formed UTF-8: search the bytes, then count the code points skipped
+	const uint32_t N = value.GetByteCount();
+	if (TextKernels::IsValidUTF8(data(), _byteLength) && TextKernels::IsValidUTF8(needle, N))
+	{
+		const uint32_t from = find_byte_offset_of_code_point(startIndex);
+		const int64_t at = TextSearch::IndexOfUTF8(as_bytes(data()), _byteLength, as_bytes(needle), N, from);
+		if (at < 0)
+			return -1;
+		return (int64_t)startIndex + (int64_t)TextKernels::CountCodePoints(data() + from, (uint64_t)at - from);
+	}
+
+	// Ill-formed bytes read as U+FFFD: code point search, decoded in place
+	uint32_t index = 0;
+	for (UTF8::CodePointIterator it(data(), _byteLength); !it.IsEnd(); ++it, ++index)
+	{
+		if (index >= startIndex && code_points_match_at(it, value))
+			return index;
+	}
 
-	return UTF8::IndexOf(H, N, startIndex);
+	return -1;
 }
 
 i64 String::IndexOf(const String& value) const noexcept
@@ -661,6 +730,11 @@ i64 String::IndexOf(const String& value) const noexcept
 	return IndexOf(value, 0);
 }
 
+i64 String::IndexOf(StringView value) const noexcept
+{
+	return IndexOf(value, 0);
+}
+
 i64 String::IndexOf(const String& value, u32 startIndex, u32 count) const noexcept
 {
 	uint64_t len = GetLength();
@@ -762,47 +836,50 @@ i64 String::IndexOf(Char c, StringComparison comp) const noexcept
 
 i64 String::IndexOfAny(const List<Char>& chars, u32 startIndex, u32 count) const noexcept
 {
-	uint32_t len = GetLength();
-	if (startIndex >= len || chars.IsEmpty())
+	if (chars.IsEmpty())
 		return -1;
 
-	if (count > len - startIndex)
-		count = len - startIndex;
-
-	const Char* bytes = data();
-	uint64_t end = startIndex + count;
+	return impl_IndexOfAny(TextMatcher(chars), startIndex, count);
+}
 
-	for (u32 g = startIndex; g < end; ++g)
-	{
-		// Grapheme index → byte offset do primeiro byte UTF-8
-		u32 byteOffset = find_byte_offset_of_code_point(g);
-		if (byteOffset >= _byteLength)
-			continue;
+i64 String::IndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept
+{
+	return IndexOfAny(chars, startIndex, UInt32::MaxValue);
+}
 
-		unsigned char lead = (unsigned char)bytes[byteOffset];
+i64 String::IndexOfAny(const List<Char>& chars) const noexcept
+{
+	return IndexOfAny(chars, 0, UInt32::MaxValue);
+}
 
-		for (uint32_t k = 0; k < chars.Count(); ++k)
-		{
-			if ((unsigned char)chars[k] == lead)
-				return (Int64)g;
-		}
-	}
+i64 String::IndexOfAny(const TextMatcher& matcher, u32 startIndex) const noexcept
+{
+	return impl_IndexOfAny(matcher, startIndex, UInt32::MaxValue);
+}
 
-	return -1;
+i64 String::IndexOfAny(const TextMatcher& matcher) const noexcept
+{
+	return impl_IndexOfAny(matcher, 0, UInt32::MaxValue);
 }
 
-i64 String::IndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept
+i64 String::impl_IndexOfAny(const TextMatcher& matcher, u32 startIndex, u32 count) const noexcept
 {
-	UInt64 len = GetLength();
-	if (startIndex >= len)
+	if (matcher.IsEmpty() || count == 0)
 		return -1;
 
-	return IndexOfAny(chars, startIndex, len - startIndex);
-}
+	// code points [startIndex, startIndex + count) as bytes [from, to)
+	const uint32_t from = find_byte_offset_of_code_point(startIndex);
+	if (from >= _byteLength)
+		return -1;
 
-i64 String::IndexOfAny(const List<Char>& chars) const noexcept
-{
-	return IndexOfAny(chars, 0, GetLength());
+	const uint64_t end = (uint64_t)startIndex + count;
+	const uint32_t to = end >= _byteLength ? _byteLength : find_byte_offset_of_code_point((uint32_t)end);
+
+	TextMatcher::Match m;
+	if (!matcher.Find(reinterpret_cast<const char*>(data()), to, from, m))
+		return -1;
+
+	return (i64)code_points_before_byte(m.Offset);
 }
 
 String String::Insert(u32 cpIndex, const String& value) const noexcept
@@ -979,12 +1056,33 @@ i64 String::LastIndexOf(const String& value, u32 startIndex) const noexcept
 		return static_cast<Int64>(res);
 	}
 
-	// Decode both strings to codepoints
-	List<CodePoint> H, N;
-	UTF8::Decode(data(), _byteLength, H);
-	UTF8::Decode(value.data(), value._byteLength, N);
+	// The last match that starts at or before startIndex
+	if (value._byteLength == 0)
+	{
+		const uint32_t count = GetCodePointsCount();
+		return startIndex < count ? startIndex : (count == 0 ? 0 : count - 1);
+	}
+
+	// Well-formed UTF-8: such a match ends by startIndex's byte offset + N
+	const uint32_t N = value._byteLength;
+	if (TextKernels::IsValidUTF8(data(), _byteLength) && TextKernels::IsValidUTF8(value.data(), N))
+	{
+		const uint64_t last = find_byte_offset_of_code_point(startIndex);
+		const uint64_t window = last + N < _byteLength ? last + N : _byteLength;
+		const int64_t at = TextSearch::LastIndexOfUTF8(as_bytes(data()), window, as_bytes(value.data()), N);
+		return at < 0 ? -1 : (int64_t)TextKernels::CountCodePoints(data(), (uint64_t)at);
+	}
+
+	// Ill-formed bytes read as U+FFFD: code point search, decoded in place
+	int64_t found = -1;
+	uint32_t index = 0;
+	for (UTF8::CodePointIterator it(data(), _byteLength); !it.IsEnd() && index <= startIndex; ++it, ++index)
+	{
+		if (code_points_match_at(it, value))
+			found = index;
+	}
 
-	return UTF8::LastIndexOf(H, N, startIndex);
+	return found;
 }
 
 i64 String::LastIndexOf(const String& value) const noexcept
@@ -1113,113 +1211,135 @@ i64 String::LastIndexOf(Char c,
 
 i64 String::LastIndexOfAny(const List<Char>& chars, u32 startIndex, u32 count) const noexcept
 {
-	UInt64 len = GetLength();
-	if (len == 0 || chars.IsEmpty())
+	if (chars.IsEmpty())
 		return -1;
 
-	Int64 sIndex = (Int64)startIndex;
-	if (sIndex >= (Int64)len)
-		sIndex = (Int64)len - 1;
+	return impl_LastIndexOfAny(TextMatcher(chars), startIndex, count);
+}
 
-	if (count == 0)
-		return -1;
+i64 String::LastIndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept
+{
+	return LastIndexOfAny(chars, startIndex, UInt32::MaxValue);
+}
 
-	Int64 c = (Int64)count;
-	if (c > sIndex + 1)
-		c = sIndex + 1;
+i64 String::LastIndexOfAny(const List<Char>& chars) const noexcept
+{
+	return LastIndexOfAny(chars, UInt32::MaxValue, UInt32::MaxValue);
+}
 
-	Int64 first = sIndex - c + 1;
+i64 String::LastIndexOfAny(const TextMatcher& matcher) const noexcept
+{
+	return impl_LastIndexOfAny(matcher, UInt32::MaxValue, UInt32::MaxValue);
+}
 
-	const Char* bytes = data();
+i64 String::impl_LastIndexOfAny(const TextMatcher& matcher, u32 startIndex, u32 count) const noexcept
+{
+	if (matcher.IsEmpty() || count == 0 || _byteLength == 0)
+		return -1;
 
-	for (int64_t g = sIndex; g >= first; --g)
-	{
-		uint32_t byteOffset = find_byte_offset_of_code_point((uint32_t)g);
-		if (byteOffset >= _byteLength)
-			continue;
+	// code points [first, last] as bytes [lo, hi)
+	const uint32_t length = GetCodePointsCount();
+	const uint32_t last = startIndex < length ? startIndex : length - 1;
+	const uint32_t first = count > last ? 0 : last - count + 1;
 
-		unsigned char lead = (unsigned char)bytes[byteOffset];
+	const uint32_t lo = find_byte_offset_of_code_point(first);
+	const uint32_t hi = last + 1 >= length ? _byteLength : find_byte_offset_of_code_point(last + 1);
+	if (lo >= hi)
+		return -1;
 
-		for (uint32_t k = 0; k < chars.Count(); ++k)
-		{
-			if ((unsigned char)chars[k] == lead)
-				return g;
-		}
-	}
+	TextMatcher::Match m;
+	if (!matcher.FindLast(reinterpret_cast<const char*>(data()) + lo, hi - lo, m))
+		return -1;
 
-	return -1;
+	return (i64)code_points_before_byte(lo + m.Offset);
 }
 
-i64 String::LastIndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept
+bool String::contains_zwj() const noexcept
 {
-	uint32_t len = GetLength();
-	if (len == 0)
-		return -1;
-
-	if (startIndex >= len)
-		startIndex = len - 1;
-
-	return LastIndexOfAny(chars, startIndex, startIndex + 1);
+	// U+200D
+	static const uint8_t zwj[] = { 0xE2, 0x80, 0x8D };
+	return TextSearch::IndexOf(as_bytes(data()), _byteLength, zwj, sizeof(zwj)) >= 0;
 }
 
-i64 String::LastIndexOfAny(const List<Char>& chars) const noexcept
+Boolean String::IsNormalized(NormalizationForm form) const noexcept
 {
-	uint32_t len = GetLength();
-	if (len == 0)
-		return -1;
+	// ASCII, and text left alone because of a ZWJ, are normalized already
+	if (IsEmpty() || is_ascii(*this) || contains_zwj())
+		return true;
 
-	return LastIndexOfAny(chars, len - 1, len);
+	return UnicodeNormalization::SpanNormalized(data(), _byteLength, form) == _byteLength;
 }
 
 String String::Normalize(NormalizationForm form) const noexcept
 {
-	if (IsEmpty()) return *this;
-
-	// 0) Decode to codepoints
-	List<CodePoint> cps = DecodeToCodePoints(*this);
-	uint32_t cpCount = cps.Count();
-	if (cpCount == 0) return *this;
+	if (IsEmpty() || is_ascii(*this)) return *this;
 
 	// 1) ZWJ → skip normalization
-	for (uint32_t i = 0; i < cpCount; ++i)
-		if ((uint32_t)cps[i] == 0x200D)
-			return *this;
+	if (contains_zwj())
+		return *this;
+
+	// 2) Already normalized up to span: nothing to allocate when it is everything
+	const uint32_t span = UnicodeNormalization::SpanNormalized(data(), _byteLength, form);
+	if (span == _byteLength)
+		return *this;
+
+	// 3) Only the segments that change are rewritten
+	Memory::ScratchScope scratch;
+	List<Char> tail(scratch.GetArena(), _byteLength - span + 16);
+	if (!UnicodeNormalization::NormalizeSegments(data() + span, _byteLength - span, form, tail))
+		return normalize_code_points(form);
+
+	const uint32_t totalBytes = span + (uint32_t)tail.Count();
+	unsigned char* block = allocate_block(totalBytes);
+	if (!block) return String();
+
+	unsigned char* dst = block + sizeof(refcount_type) + sizeof(u32);
+	Memory::Copy(Pointer(dst), Pointer(data()), span);
+	Memory::Copy(Pointer(dst + span), Pointer(tail.Data()), tail.Count());
+
+	String out(block);
+	out._byteLength = totalBytes;
+	return out;
+}
 
-	// 2) Decompose dynamically
+// Whole text pipeline over the decoded code points, U+FFFD standing
+// for ill-formed sequences
+String String::normalize_code_points(NormalizationForm form) const noexcept
+{
+	// 1) Decompose dynamically, straight from the bytes (scratch storage)
 	const bool compat = (form == NormalizationForm::NFKC || form == NormalizationForm::NFKD);
 
-	List<CodePoint> temp;
-	temp.EnsureCapacity(cpCount * 3);
+	Memory::ScratchScope scratch;
+	List<CodePoint> temp(scratch.GetArena(), _byteLength);
 
-	for (uint32_t i = 0; i < cpCount; ++i)
+	for (CodePoint cp : CodePoints())
 	{
 		CodePoint local[32];
 		uint32_t localLen = 0;
-		
-		UnicodeNormalization::DecomposeCodePoint(cps[i], compat, local, localLen);
+
+		UnicodeNormalization::DecomposeCodePoint(cp, compat, local, localLen);
 
 		for (uint32_t k = 0; k < localLen; ++k)
 			temp.Add(local[k]);
 	}
 
-	// 3) If nothing was produced, fallback to original cps
-	if (temp.Count() == 0 && cpCount > 0)
+	// 2) If nothing was produced, fallback to original cps
+	if (temp.Count() == 0)
 	{
-		temp.Clear();
-		for (uint32_t i = 0; i < cpCount; ++i)
-			temp.Add(cps[i]);
+		for (CodePoint cp : CodePoints())
+			temp.Add(cp);
 	}
 
-	// 4) Reorder
+	// 3) Reorder
 	UnicodeNormalization::ReorderByCCC(temp);
 
-	// 5) Compose
+	// 4) Compose
 	if (form == NormalizationForm::NFC || form == NormalizationForm::NFKC)
 	{
 		UnicodeNormalization::Compose(temp);
 	}
 
-	// 6) Re-encode UTF-8
+	// 5) Re-encode UTF-8
 	uint32_t totalBytes = 0;
 	for (u64 i = 0; i < temp.Count(); ++i)
 	{
@@ -1484,56 +1604,84 @@ String String::Replace(const String& oldValue, const String& newValue) const noe
 	const uint32_t O = oldValue._byteLength;
 	const uint32_t N = newValue._byteLength;
 
-	// -----------------------------------------
-	// FAST-PATH: ASCII ordinal replace
-	// -----------------------------------------
-	if (is_ascii(*this) && is_ascii(oldValue) && is_ascii(newValue))
-	{
-		const Char* h = data();
-		const Char* o = oldValue.data();
-		const Char* r = newValue.data();
+	if (O > H) return *this;
 
-		if (O == 0) return *this;
-		if (O > H) return *this;
+	// Ordinal: byte matches on code point boundaries, ASCII or not.
+	// Counted first for the exact block size, found again while copying.
+	const Char* h = data();
+	const Char* r = newValue.data();
+	TextSearch::Searcher searcher(as_bytes(oldValue.data()), O);
 
-		// 1) Count occurrences
-		uint32_t count = ASCII::CountOccurrences(h, H, o, O);
+	const uint64_t count = searcher.Count(as_bytes(h), H);
+	if (count == 0) return *this;
 
-		if (count == 0) return *this;
+	const uint32_t newByteLength = (uint32_t)(H + count * N - count * O);
+	unsigned char* block = allocate_block(newByteLength);
+	if (!block) return String();
 
-		uint32_t newByteLength = H + count * (N - O);
-		unsigned char* block = allocate_block(newByteLength);
-		if (!block) return String();
+	Char* dst = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
+	uint32_t i = 0;
+	uint32_t w = 0;
 
-		Char* dst = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
-		uint32_t writePos = 0;
+	for (int64_t at = searcher.IndexOfUTF8(as_bytes(h), H, 0); at >= 0; at = searcher.IndexOfUTF8(as_bytes(h), H, i))
+	{
+		while (i < (uint32_t)at)
+			dst[w++] = h[i++];
+		for (uint32_t k = 0; k < N; ++k)
+			dst[w++] = r[k];
+		i += O;
+	}
+	while (i < H)
+		dst[w++] = h[i++];
 
-		// 2) Build result
-		ASCII::ReplaceOrdinal(h, H, o, O, r, N, dst);
+	String out(block);
+	out._byteLength = newByteLength;
+	return out;
+}
 
-		String out(block);
-		out._byteLength = newByteLength;
-		return out;
-	}
+String String::Replace(const TextMatcher& oldValues, const String& newValue) const noexcept
+{
+	if (oldValues.IsEmpty()) return *this;
+	if (this->IsEmpty()) return *this;
 
-	// -----------------------------------------
-	// FALLBACK: original safe Unicode logic
-	// -----------------------------------------
-	String result = *this;
-	Int64 pos = 0;
+	const uint32_t H = _byteLength;
+	const uint32_t N = newValue._byteLength;
+	const char* h = reinterpret_cast<const char*>(data());
+	const Char* r = newValue.data();
 
-	while (true)
+	// Matches differ in length: counted and measured first, found again while copying
+	uint64_t count = 0;
+	uint64_t removed = 0;
+	TextMatcher::Match m;
+	for (uint32_t pos = 0; oldValues.Find(h, H, pos, m); pos = m.Offset + m.Length)
 	{
-		pos = result.IndexOf(oldValue, (size_t)pos);
-		if (pos < 0) break;
+		++count;
+		removed += m.Length;
+	}
+	if (count == 0) return *this;
+
+	const uint32_t newByteLength = (uint32_t)(H - removed + count * N);
+	unsigned char* block = allocate_block(newByteLength);
+	if (!block) return String();
 
-		result = result.Remove((int)pos, (int)oldValue.GetLength())
-			.Insert((uint32_t)pos, newValue);
+	Char* dst = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
+	uint32_t i = 0;
+	uint32_t w = 0;
 
-		pos += newValue.GetLength();
+	while (oldValues.Find(h, H, i, m))
+	{
+		while (i < m.Offset)
+			dst[w++] = h[i++];
+		for (uint32_t k = 0; k < N; ++k)
+			dst[w++] = r[k];
+		i += m.Length;
 	}
+	while (i < H)
+		dst[w++] = h[i++];
 
-	return result;
+	String out(block);
+	out._byteLength = newByteLength;
+	return out;
 }
 
 String String::Replace(const String& oldValue, const String& newValue, StringComparison comp) const noexcept
@@ -1812,26 +1960,22 @@ String String::ReplaceLineEndings(const String& replacement) const noexcept
 
 List<String> String::Split(const String& sep, i32 max, StringSplitOptions opt) const
 {
-	List<String> s;
-	s.Add(sep);
-	return impl_Split(s, {}, max, opt);
+	return Split(StringView(sep), max, opt);
 }
 
 List<String> String::Split(const String& separator, StringSplitOptions options) const
 {
-	List<String> s;
-	s.Add(separator);
-	return impl_Split(s, {}, Int32::MaxValue, options);
+	return Split(StringView(separator), Int32::MaxValue, options);
 }
 
 List<String> String::Split(const List<String>& seps, StringSplitOptions opt) const
 {
-	return impl_Split(seps, {}, Int32::MaxValue, opt);
+	return impl_Split(views_of(seps), {}, Int32::MaxValue, opt);
 }
 
 List<String> String::Split(const List<String>& separators, i32 maxCount, StringSplitOptions options) const
 {
-	return impl_Split(separators, {}, maxCount, options);
+	return impl_Split(views_of(separators), {}, maxCount, options);
 }
 
 List<String> String::Split(const List<Char>& separators, i32 maxCount, StringSplitOptions options) const
@@ -1851,14 +1995,44 @@ List<String> String::Split(const List<Char>& separators) const
 
 List<String> String::Split(const String& separator) const
 {
-	List<String> s;
-	s.Add(separator);
-	return impl_Split(s, {}, Int32::MaxValue, StringSplitOptions::None);
+	return Split(StringView(separator), Int32::MaxValue, StringSplitOptions::None);
 }
 
 List<String> String::Split(const List<String>& separators) const
 {
-	return impl_Split(separators, {}, Int32::MaxValue, StringSplitOptions::None);
+	return impl_Split(views_of(separators), {}, Int32::MaxValue, StringSplitOptions::None);
+}
+
+List<String> String::Split(StringView separator, i32 maxCount, StringSplitOptions options) const
+{
+	List<StringView> s;
+	s.Add(separator);
+	return impl_Split(s, {}, maxCount, options);
+}
+
+List<String> String::Split(StringView separator, StringSplitOptions options) const
+{
+	return Split(separator, Int32::MaxValue, options);
+}
+
+List<String> String::Split(StringView separator) const
+{
+	return Split(separator, Int32::MaxValue, StringSplitOptions::None);
+}
+
+List<String> String::Split(const TextMatcher& separators, i32 maxCount, StringSplitOptions options) const
+{
+	return impl_Split(separators, maxCount, options);
+}
+
+List<String> String::Split(const TextMatcher& separators, StringSplitOptions options) const
+{
+	return impl_Split(separators, Int32::MaxValue, options);
+}
+
+List<String> String::Split(const TextMatcher& separators) const
+{
+	return impl_Split(separators, Int32::MaxValue, StringSplitOptions::None);
 }
 
 Boolean String::StartsWith(const String& compare, Boolean ignoreCase, const Locale& locale) const noexcept
@@ -1872,6 +2046,11 @@ Boolean String::StartsWith(const String& compare, Boolean ignoreCase) const noex
 }
 
 Boolean String::StartsWith(const String& compare) const noexcept
+{
+	return Boolean(impl_StartsWith(ascii_view(compare), false, Locale("en")));
+}
+
+Boolean String::StartsWith(StringView compare) const noexcept
 {
 	return Boolean(impl_StartsWith(compare, false, Locale("en")));
 }
@@ -1914,32 +2093,40 @@ String String::Substring(u32 gcStart, u32 gcCount) const noexcept
 		}
 	}
 
-	// -------- Unicode slow-path (como você já tinha) --------
+	// -------- Unicode: walk the clusters, stop after the last one taken --------
 
-	List<CodePoint> cps = DecodeToCodePoints(*this);
-	uint32_t cpCount = cps.Count();
-	if (cpCount == 0)
-		return String::Empty();
+	// Views that start the block share its cluster boundaries, so the
+	// walks can start from the nearest checkpoint
+	const UTF8::GraphemeIndex* index = _byteOffset == 0 ? grapheme_index() : nullptr;
 
-	List<CodePoint> boundaries;
-	uint32_t gcTotal = 0;
-	UnicodeCase::ComputeGraphemeBoundaries(cps, cpCount, boundaries, gcTotal);
+	uint32_t cluster = 0;
+	UTF8::GraphemeIterator it(data(), _byteLength);
 
-	if (gcStart >= gcTotal)
-		return String::Empty();
+	auto advanceTo = [&](uint64_t target) noexcept
+	{
+		if (index)
+		{
+			const uint32_t k = index->ForGrapheme(target < UInt32::MaxValue ? (uint32_t)target : UInt32::MaxValue);
+			const UTF8::GraphemeIndex::Checkpoint& cp = index->GetCheckpoint(k);
+			if (k * UTF8::GraphemeIndex::Stride > cluster && cp.ByteOffset < _byteLength)
+			{
+				it = UTF8::GraphemeIterator(data(), _byteLength, cp.ByteOffset);
+				cluster = k * UTF8::GraphemeIndex::Stride;
+			}
+		}
 
-	uint32_t gcEnd = gcStart + gcCount;
-	if (gcEnd > gcTotal)
-		gcEnd = gcTotal;
+		for (; cluster < target && !it.IsEnd(); ++cluster)
+			++it;
+	};
 
-	uint32_t startCp = boundaries[gcStart];
-	uint32_t endCp = (gcEnd < gcTotal ? (uint32_t)boundaries[gcEnd] : cpCount);
+	advanceTo(gcStart);
+	if (it.IsEnd())
+		return String::Empty();
 
-	uint32_t byteStart = find_byte_offset_of_code_point(startCp);
-	uint32_t byteEnd = find_byte_offset_of_code_point(endCp);
-	if (byteEnd > _byteLength) byteEnd = _byteLength;
+	uint32_t byteStart = it.ByteOffset();
+	advanceTo((uint64_t)gcStart + gcCount);
 
-	uint32_t len = byteEnd - byteStart;
+	uint32_t len = it.ByteOffset() - byteStart;
 
 	if (IsSSO())
 	{
@@ -2091,68 +2278,35 @@ String String::ToLower(const Locale& locale) const noexcept
 		return result;
 	}
 
-	// =====================================================
-	// 1) Decode UTF-8 → List<CodePoint>
-	// =====================================================
-	List<CodePoint> cps;
-	cps.EnsureCapacity(_byteLength);
-
-	const Char* ptr = data();
-	uint32_t pos = 0;
-
-	UTF8::Decode(data(), GetByteCount(), cps);
-
-	if (cps.IsEmpty())
+	if (_byteLength == 0)
 		return String();
 
 	// =====================================================
-	// 2) Locale-aware lowercase expansion → List<CodePoint>
+	// Decode in place, map, and write the UTF-8 out as we go
+	// (the final sigma context is read from the bytes)
 	// =====================================================
-	List<CodePoint> lowered;
-	lowered.EnsureCapacity(cps.Count() * 3);
+	const Char* src = data();
 
-	for (uint32_t i = 0; i < cps.Count(); ++i)
+	Memory::ScratchScope scratch;
+	List<Char> out(scratch.GetArena(), _byteLength + 8);
+
+	for (UTF8::CodePointIterator it(src, _byteLength); !it.IsEnd(); ++it)
 	{
-		List<CodePoint> seq;
-		seq.EnsureCapacity(4);
+		SmallList<CodePoint, 4> seq;   // case mappings expand to at most 3
 
 		UnicodeCase::map_to_lower_sequence_nostd(
-			cps[i],
+			*it,
 			localeBytes, localeLen,
-			cps,        // contexto completo
-			i,          // index atual
-			seq         // saída
+			src, _byteLength,   // contexto completo
+			it.ByteOffset(),    // posição atual
+			seq                 // saída
 		);
 
-		for (uint32_t k = 0; k < seq.Count(); ++k)
-			lowered.Add(seq[k]);
+		append_utf8(out, seq);
 	}
 
-	// =====================================================
-	// 3) Re-encode lowered → UTF-8
-	// =====================================================
-	u64 totalBytes = 0;
-	for (CodePoint cp : lowered)
-		totalBytes += cp.ByteCount();
-
-	unsigned char* block = allocate_block(totalBytes);
-	if (!block) return String();
-
-	Char* dst = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
-	uint32_t w = 0;
-
-	for (CodePoint cp : lowered)
-	{
-		auto enc = UTF8::encode_utf8(cp);
-		for (uint32_t k = 0; k < enc.Length; ++k)
-			dst[w++] = Char(enc.Bytes[k]);
-	}
-
-	String result(block);
-	result._byteOffset = 0;
-	result._byteLength = totalBytes;
-	return result;
-}
+	return String(out.Data(), (u32)out.Count());
+}
 
 String String::ToLower() const noexcept
 {
@@ -2186,65 +2340,29 @@ String String::ToUpper(const Locale& locale) const noexcept
 		return result;
 	}
 
-	// =====================================================
-	// 1) Decode UTF-8 → List<CodePoint>
-	// =====================================================
-	List<CodePoint> cps;
-	cps.EnsureCapacity(_byteLength);
-
-	const Char* ptr = data();
-	uint32_t pos = 0;
-
-	UTF8::Decode(data(), GetByteCount(), cps);
-
-	if (cps.IsEmpty())
+	if (_byteLength == 0)
 		return String();
 
 	// =====================================================
-	// 2) Uppercase mapping → List<CodePoint>
+	// Decode in place, map, and write the UTF-8 out as we go
 	// =====================================================
-	List<CodePoint> upper;
-	upper.EnsureCapacity(cps.Count() * 3);
+	Memory::ScratchScope scratch;
+	List<Char> out(scratch.GetArena(), _byteLength + 8);
 
-	for (uint32_t i = 0; i < cps.Count(); ++i)
+	for (CodePoint cp : CodePoints())
 	{
-		List<CodePoint> seq;
-		seq.EnsureCapacity(4);
+		SmallList<CodePoint, 4> seq;   // case mappings expand to at most 3
 
 		UnicodeCase::map_to_upper_sequence_nostd(
-			cps[i],
+			cp,
 			localeBytes, localeLen,
 			seq
 		);
 
-		for (uint32_t k = 0; k < seq.Count(); ++k)
-			upper.Add(seq[k]);
-	}
-
-	// =====================================================
-	// 3) Encode UTF-8
-	// =====================================================
-	u64 totalBytes = 0;
-	for (CodePoint cp : upper)
-		totalBytes += cp.ByteCount();
-
-	unsigned char* block = allocate_block(totalBytes);
-	if (!block) return String();
-
-	Char* dst = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
-	uint32_t w = 0;
-
-	for (CodePoint cp : upper)
-	{
-		auto enc = UTF8::encode_utf8(cp);
-		for (uint32_t k = 0; k < enc.Length; ++k)
-			dst[w++] = Char(enc.Bytes[k]);
+		append_utf8(out, seq);
 	}
 
-	String result(block);
-	result._byteOffset = 0;
-	result._byteLength = totalBytes;
-	return result;
+	return String(out.Data(), (u32)out.Count());
 }
 
 String String::ToUpper() const noexcept
@@ -2333,7 +2451,7 @@ String String::Trim(const List<Char>& chars) const
 {
 	if (chars.IsEmpty()) return *this;
 
-	List<CodePoint> codeSet;
+	SmallList<CodePoint, 16> codeSet;
 	codeSet.Reserve(chars.Count());
 	for (uint32_t i = 0; i < chars.Count(); ++i)
 		codeSet.Add((uint32_t)chars[i]);
@@ -2520,18 +2638,31 @@ const Char* String::data() const noexcept
 	return bytes_ptr() + _byteOffset;
 }
 
+// Copies on any thread: the increment needs no ordering, the reference it
+// copies from already keeps the block alive. The last release frees, after
+// an acquire fence so every other holder's reads happen before the delete.
 void String::add_ref() noexcept
 {
-	if (!IsSSO() && _ptr) refcount_ref()++;
+	if (IsSSO() || !_ptr)
+		return;
+
+	volatile uint32_t* rc = refcount_word();
+	if ((Volatile::ReadRelaxed(rc) & REFCOUNT_IMMORTAL) == 0)
+		Interlocked::AddRelaxed(rc, 1u);
 }
 
 void String::release() noexcept
 {
 	if (!IsSSO() && _ptr)
 	{
-		refcount_type& rc = refcount_ref();
-		if (--rc == 0)
-			delete[] _ptr;
+		volatile uint32_t* rc = refcount_word();
+		if ((Volatile::ReadRelaxed(rc) & REFCOUNT_IMMORTAL) == 0 &&
+			Interlocked::AddRelease(rc, 0u - 1u) == 1)
+		{
+			Interlocked::AcquireFence();
+			delete Volatile::Read(index_slot());
+			delete[] (_ptr - BLOCK_PREFIX_SIZE);
+		}
 	}
 
 	_ptr = nullptr;
@@ -2544,14 +2675,66 @@ void String::release() noexcept
 	_gcLength = UInt32::MaxValue;
 }
 
+String& String::MakeImmortal() noexcept
+{
+	if (!IsSSO() && _ptr)
+		Interlocked::Or(refcount_word(), REFCOUNT_IMMORTAL);
+	return *this;
+}
+
+Boolean String::IsImmortal() const noexcept
+{
+	if (IsSSO() || !_ptr)
+		return true;
+	return (Volatile::ReadRelaxed(refcount_word()) & REFCOUNT_IMMORTAL) != 0;
+}
+
+Boolean String::IsInterned() const noexcept
+{
+	// a slice of a canonical block is not itself canonical
+	return !IsSSO() && _ptr && _byteOffset == 0 && _byteLength == length_ref() &&
+		(Volatile::ReadRelaxed(refcount_word()) & REFCOUNT_INTERNED) != 0;
+}
+
+// Always a heap block, even when the bytes would fit inline: the block
+// address is the identity Equals compares. The pool publishes the string
+// under its shard lock, which orders these writes before any reader.
+String String::make_interned(const Char* bytes, uint32_t len, uint32_t hash) noexcept
+{
+	unsigned char* block = allocate_block(len);
+	if (!block)
+		return String::Empty();
+
+	String result(block);
+	Memory::Copy(Pointer(result.bytes_ptr()), Pointer(bytes), len);
+	result.set_string_as_ascii(TextKernels::IsASCII(bytes, len));
+	result.prefix()->hash = hash;
+	*result.refcount_word() = 1u | REFCOUNT_IMMORTAL | REFCOUNT_INTERNED;
+	return result;
+}
+
 unsigned char* String::allocate_block(uint32_t lenChars) noexcept
 {
 	if (lenChars == 0) return nullptr;
 
+	return allocate_block(lenChars, lenChars);
+}
+
+// Room for capacity bytes (at least lenChars), so a block may be made
+// before anything is written into it
+unsigned char* String::allocate_block(uint32_t lenChars, uint32_t capacity) noexcept
+{
+	if (capacity < lenChars)
+		capacity = lenChars;
+	if (capacity == 0) return nullptr;
+
 	const unsigned int headerSize = sizeof(refcount_type) + sizeof(u32);
-	unsigned long total = headerSize + lenChars * sizeof(Char) + sizeof(Char);
+	uint64_t total = BLOCK_PREFIX_SIZE + headerSize + (uint64_t)capacity * sizeof(Char) + sizeof(Char);
 
 	unsigned char* p = new unsigned char[total];
+	*reinterpret_cast<block_prefix*>(p) = block_prefix{ nullptr, 0, capacity };
+	p += BLOCK_PREFIX_SIZE;
+
 	*(refcount_type*)p = 1;
 	*(u32*)(p + sizeof(refcount_type)) = lenChars;
 
@@ -2561,6 +2744,162 @@ unsigned char* String::allocate_block(uint32_t lenChars) noexcept
 	return p;
 }
 
+// No other String sees this block, it is mortal, and the view starts at
+// byte 0: the bytes from _byteLength on belong to nobody and may be written.
+// Acquire, so reads made through a copy released on another thread are done
+// before those writes.
+bool String::owns_block() const noexcept
+{
+	return !IsSSO() && _ptr && _byteOffset == 0 &&
+		Volatile::Read(refcount_word()) == 1u;
+}
+
+void String::adopt_block(unsigned char* block, uint32_t length) noexcept
+{
+	const uint32_t ascii = _flags & (FLAG_ASCII_KNOWN | FLAG_IS_ASCII);
+
+	release();
+	_flags = ascii;
+	_ptr = block;
+	_byteOffset = 0;
+	_byteLength = length;
+}
+
+// Appends in place while this String owns a block with room left (or the
+// bytes still fit inline); otherwise copies into a new block with half as
+// much room again, so a loop of appends copies each byte a bounded number
+// of times. bytes may point into this String.
+void String::append(const Char* bytes, uint32_t len) noexcept
+{
+	if (len == 0)
+		return;
+
+	const uint32_t total = _byteLength + len;
+	const bool ascii = is_ascii_known() && is_ascii_cached() && TextKernels::IsASCII(bytes, len);
+
+	if (IsSSO() && total <= SSO_CAPACITY)
+	{
+		Memory::Copy(Pointer(_sso + _byteLength), Pointer(bytes), len);
+		_sso[total] = Char(0);
+	}
+	else if (owns_block() && total <= prefix()->capacity)
+	{
+		// the index and the hash described the old bytes
+		block_prefix* p = prefix();
+		delete p->index;
+		p->index = nullptr;
+		p->hash = 0;
+
+		Char* buf = bytes_ptr();
+		Memory::Copy(Pointer(buf + _byteLength), Pointer(bytes), len);
+		buf[total] = Char(0);
+		length_ref() = total;
+	}
+	else
+	{
+		const uint64_t capacity = (uint64_t)total + total / 2;
+		unsigned char* block = allocate_block(total, capacity > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)capacity);
+		Char* buf = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
+		Memory::Copy(Pointer(buf), Pointer(data()), _byteLength);
+		Memory::Copy(Pointer(buf + _byteLength), Pointer(bytes), len);
+
+		adopt_block(block, total);
+	}
+
+	_byteLength = total;
+	_gcLength = u32::MaxValue;
+	if (ascii)
+		set_string_as_ascii(true);
+	else
+		invalidate_ascii_flag();
+}
+
+// Makes room for capacity bytes in total, in a block this String owns
+void String::reserve(uint32_t capacity) noexcept
+{
+	if (capacity <= SSO_CAPACITY || capacity <= _byteLength)
+		return;
+	if (owns_block() && prefix()->capacity >= capacity)
+		return;
+
+	unsigned char* block = allocate_block(_byteLength, capacity);
+	Char* buf = reinterpret_cast<Char*>(block + sizeof(refcount_type) + sizeof(u32));
+	Memory::Copy(Pointer(buf), Pointer(data()), _byteLength);
+
+	adopt_block(block, _byteLength);
+}
+
+// Empty, keeping an owned block (and its room) for the next appends
+void String::clear_keep_capacity() noexcept
+{
+	if (!owns_block())
+	{
+		release();
+		_sso[0] = Char(0);
+		set_string_as_ascii(true);
+		return;
+	}
+
+	block_prefix* p = prefix();
+	delete p->index;
+	p->index = nullptr;
+	p->hash = 0;
+
+	bytes_ptr()[0] = Char(0);
+	length_ref() = 0;
+	_byteLength = 0;
+	_gcLength = u32::MaxValue;
+	set_string_as_ascii(true);
+}
+
+// Where bytes can be written in place after the text, and how many
+// fit: the inline buffer, or the room left in a block this String owns.
+// None for a shared block or a slice.
+Char* String::spare_room(uint32_t& room) noexcept
+{
+	if (IsSSO())
+	{
+		room = SSO_CAPACITY - _byteLength;
+		return reinterpret_cast<Char*>(_sso + _byteLength);
+	}
+
+	if (owns_block())
+	{
+		room = prefix()->capacity - _byteLength;
+		return bytes_ptr() + _byteLength;
+	}
+
+	room = 0;
+	return nullptr;
+}
+
+// Keeps len ASCII bytes written at spare_room(); ASCII leaves the
+// ASCII flags as they were
+void String::commit_ascii(uint32_t len) noexcept
+{
+	if (len == 0)
+		return;
+
+	const uint32_t total = _byteLength + len;
+	if (IsSSO())
+	{
+		_sso[total] = Char(0);
+	}
+	else
+	{
+		block_prefix* p = prefix();
+		delete p->index;
+		p->index = nullptr;
+		p->hash = 0;
+
+		bytes_ptr()[total] = Char(0);
+		length_ref() = total;
+	}
+
+	_byteLength = total;
+	_gcLength = u32::MaxValue;
+}
+
 void String::init_from_bytes(const unsigned char* bytes, uint32_t len) noexcept
 {
 	static_assert(sizeof(Char) == sizeof(Byte));
@@ -2581,15 +2920,9 @@ void String::init_from_bytes(const unsigned char* bytes, uint32_t len) noexcept
 		_byteOffset = 0;
 		_byteLength = len;
 
-		bool ascii = true;
-		for (uint32_t i = 0; i < len; ++i)
-		{
-			_sso[i] = Char(bytes[i]);
-			if (bytes[i] & 0x80) ascii = false;
-		}
-
+		Memory::Copy(Pointer(_sso), Pointer(bytes), len);
 		_sso[len] = Char(0);
-		set_string_as_ascii(ascii);
+		set_string_as_ascii(TextKernels::IsASCII(bytes, len));
 		return;
 	}
 
@@ -2599,15 +2932,44 @@ void String::init_from_bytes(const unsigned char* bytes, uint32_t len) noexcept
 	_byteOffset = 0;
 	_byteLength = len;
 
-	bool ascii = true;
-	Char* dst = bytes_ptr();
-	for (u64 i = 0; i < len; ++i)
+	Memory::Copy(Pointer(bytes_ptr()), Pointer(bytes), len);
+	set_string_as_ascii(TextKernels::IsASCII(bytes, len));
+}
+
+// Built once per block, by whichever thread gets there first; a thread that
+// loses the race frees its copy and uses the published one. The block is
+// immutable, so the index stays valid for every String sharing it.
+const UTF8::GraphemeIndex* String::grapheme_index() const noexcept
+{
+	if (IsSSO() || !_ptr || length_ref() < INDEX_MIN_BYTES || is_ascii(*this))
+		return nullptr;
+
+	UTF8::GraphemeIndex* volatile* slot = index_slot();
+	if (UTF8::GraphemeIndex* index = Volatile::Read(slot))
+		return index;
+
+	UTF8::GraphemeIndex* built = new UTF8::GraphemeIndex(bytes_ptr(), length_ref());
+	UTF8::GraphemeIndex* published = Interlocked::CompareExchange(slot, built, (UTF8::GraphemeIndex*)nullptr);
+	if (published)
 	{
-		dst[i] = Char(bytes[i]);
-		if (bytes[i] & 0x80) ascii = false;
+		delete built;
+		return published;
 	}
+	return built;
+}
+
+// Code points of the block before this view starts, found from the nearest
+// checkpoint. False if _byteOffset is not on a code point boundary.
+bool String::code_points_before_view(const UTF8::GraphemeIndex& index, uint32_t& count) const noexcept
+{
+	const UTF8::GraphemeIndex::Checkpoint& cp = index.GetCheckpoint(index.ForByte(_byteOffset));
+
+	count = cp.CodePoints;
+	UTF8::CodePointIterator it(bytes_ptr(), index.GetByteCount(), cp.ByteOffset);
+	for (; it.ByteOffset() < _byteOffset; ++it)
+		++count;
 
-	set_string_as_ascii(ascii);
+	return it.ByteOffset() == _byteOffset;
 }
 
 uint32_t String::find_byte_offset_of_code_point(uint32_t cpIndex) const
@@ -2620,6 +2982,20 @@ uint32_t String::find_byte_offset_of_code_point(uint32_t cpIndex) const
 	uint64_t pos = 0;
 	uint64_t current = 0;
 
+	// Large strings: start from the nearest checkpoint instead of byte 0.
+	// Checkpoints are block positions and this may be a slice of the block.
+	const UTF8::GraphemeIndex* index = grapheme_index();
+	uint32_t before = 0;
+	if (index && index->IsWellFormed() && code_points_before_view(*index, before))
+	{
+		const UTF8::GraphemeIndex::Checkpoint& cp = index->GetCheckpoint(index->ForCodePoint(before + cpIndex));
+		if (cp.ByteOffset > _byteOffset && cp.ByteOffset - _byteOffset <= len)
+		{
+			pos = cp.ByteOffset - _byteOffset;
+			current = cp.CodePoints - before;
+		}
+	}
+
 	while (pos < len)
 	{
 		if (current == cpIndex)
@@ -2636,6 +3012,37 @@ uint32_t String::find_byte_offset_of_code_point(uint32_t cpIndex) const
 	return pos;
 }
 
+u32 String::GetCodePointsCount() const noexcept
+{
+	if (is_ascii(*this))
+		return _byteLength;
+
+	// well-formed text: one code point per byte that is not a continuation
+	if (TextKernels::IsValidUTF8(data(), _byteLength))
+		return (uint32_t)TextKernels::CountCodePoints(data(), _byteLength);
+
+	// malformed bytes decode one U+FFFD each
+	uint32_t count = 0;
+	for (UTF8::CodePointIterator it(data(), _byteLength); !it.IsEnd(); ++it)
+		++count;
+	return count;
+}
+
+uint32_t String::code_points_before_byte(uint32_t byteOffset) const noexcept
+{
+	if (is_ascii(*this))
+		return byteOffset;
+
+	// byteOffset starts a code point: the prefix is well-formed on its own
+	if (TextKernels::IsValidUTF8(data(), byteOffset))
+		return (uint32_t)TextKernels::CountCodePoints(data(), byteOffset);
+
+	uint32_t count = 0;
+	for (UTF8::CodePointIterator it(data(), _byteLength); !it.IsEnd() && it.ByteOffset() < byteOffset; ++it)
+		++count;
+	return count;
+}
+
 CodePoint String::GetCodePointAt(uint32_t cpIndex) const noexcept
 {
 	uint32_t offset = find_byte_offset_of_code_point(cpIndex);
@@ -2645,10 +3052,10 @@ CodePoint String::GetCodePointAt(uint32_t cpIndex) const noexcept
 	return r.cp;
 }
 
-void String::copy_bytes(char* dst, uint32_t& offset, const String& s) noexcept {
-	u64 len = s.GetByteCount();
-	const Char* src = s.data();
-	for (u64 i = 0; i < len; ++i)
+void String::copy_bytes(char* dst, uint32_t& offset, StringView s) noexcept {
+	const uint32_t len = s.GetByteCount();
+	const char* src = s.GetData();
+	for (uint32_t i = 0; i < len; ++i)
 		dst[offset++] = src[i];
 }
 
@@ -2658,46 +3065,58 @@ void String::copy_bytes(char* dst, uint32_t& offset, const char* cstr) noexcept
 		dst[offset++] = Char(static_cast<unsigned char>(*cstr++));
 }
 
-bool String::is_ascii(const String& s) noexcept
+bool String::code_points_match_at(UTF8::CodePointIterator at, StringView needle) noexcept
 {
-	// if known, return quickly
-	if (s.is_ascii_known()) return s.is_ascii_cached();
-
-	const Char* p = s.data();
-	uint32_t len = s._byteLength;
-
-	for (uint32_t i = 0; i < len; ++i)
+	UTF8::CodePointIterator n(reinterpret_cast<const Char*>(needle.GetData()), needle.GetByteCount());
+	while (!n.IsEnd())
 	{
-		if ((unsigned char)p[i] >= 0x80)
-		{
-			// cache negative
-			s.set_string_as_ascii(false);
+		if (at.IsEnd() || *at != *n)
 			return false;
-		}
+		++at;
+		++n;
 	}
-
-	// all ascii
-	s.set_string_as_ascii(true);
 	return true;
 }
 
-bool String::contain_byte(const String& sub) const noexcept
+void String::append_utf8(List<Char>& out, const List<CodePoint>& cps)
 {
-	const Char* hay = data();
-	const Char* needle = sub.data();
+	for (CodePoint cp : cps)
+	{
+		auto enc = UTF8::encode_utf8(cp);
+		for (uint32_t k = 0; k < enc.Length; ++k)
+			out.Add(Char(enc.Bytes[k]));
+	}
+}
 
-	uint32_t hlen = _byteLength;
-	uint32_t nlen = sub._byteLength;
+bool String::is_ascii(const String& s) noexcept
+{
+	// if known, return quickly
+	if (s.is_ascii_known()) return s.is_ascii_cached();
 
-	if (nlen == 0) return true;
-	if (nlen > hlen) return false;
+	const bool ascii = TextKernels::IsASCII(s.data(), s._byteLength);
+	s.set_string_as_ascii(ascii);
+	return ascii;
+}
 
-	for (uint32_t i = 0; i + nlen <= hlen; ++i)
-	{
-		if (Memory::Compare(Pointer(hay + i), Pointer(needle), nlen * sizeof(Char)) == 0)
-			return true;
-	}
-	return false;
+StringView String::ascii_view(const String& s) noexcept
+{
+	// scan once here so the flag lands on the String, not on a throwaway view
+	is_ascii(s);
+	return StringView(s);
+}
+
+List<StringView> String::views_of(const List<String>& list)
+{
+	List<StringView> views(list.Count());
+	for (const String& s : list)
+		views.Add(s);
+	return views;
+}
+
+bool String::contain_byte(StringView sub) const noexcept
+{
+	return TextSearch::IndexOfUTF8(as_bytes(data()), _byteLength,
+		reinterpret_cast<const uint8_t*>(sub.GetData()), sub.GetByteCount()) >= 0;
 }
 
 List<CodePoint> String::DecodeToCodePoints(const String& s)
@@ -2717,15 +3136,15 @@ List<CodePoint> String::DecodeToCodePoints(const String& s)
 	return result;
 }
 
-bool String::impl_EndsWith(const String& needle, bool ignoreCase, const Locale& locale) const noexcept
+bool String::impl_EndsWith(StringView needle, bool ignoreCase, const Locale& locale) const noexcept
 {
 	if (needle.IsEmpty())
 		return true;
 
 	const Char* hayBytes = data();
-	const Char* neeBytes = needle.data();
+	const Char* neeBytes = reinterpret_cast<const Char*>(needle.GetData());
 	uint32_t H = _byteLength;
-	uint32_t N = needle._byteLength;
+	uint32_t N = needle.GetByteCount();
 
 	if (H < N)
 		return false;
@@ -2736,8 +3155,8 @@ bool String::impl_EndsWith(const String& needle, bool ignoreCase, const Locale&
 	uint32_t locLen = (uint32_t)strlen(loc);
 	bool isTurkic = locale.IsTurkish();
 
-	bool asciiHay = ASCII::IsAllASCII(hayBytes, H);
-	bool asciiNee = ASCII::IsAllASCII(neeBytes, N);
+	bool asciiHay = is_ascii(*this);
+	bool asciiNee = needle.IsASCII();
 
 	// ====================================
 	// FAST-PATH 1: Ordinal ASCII
@@ -2756,7 +3175,7 @@ bool String::impl_EndsWith(const String& needle, bool ignoreCase, const Locale&
 	// ====================================
 	List<CodePoint> hayFold, neeFold;
 	UTF8::FoldAndNormalize(data(), GetByteCount(), loc, hayFold);
-	UTF8::FoldAndNormalize(needle.data(), needle.GetByteCount(), loc, neeFold);
+	UTF8::FoldAndNormalize(neeBytes, N, loc, neeFold);
 
 	if (ignoreCase)
 		return UTF8::EndsWithIgnoreCase(hayFold, neeFold, loc);
@@ -2764,15 +3183,15 @@ bool String::impl_EndsWith(const String& needle, bool ignoreCase, const Locale&
 		return UTF8::EndsWith(hayFold, neeFold);
 }
 
-bool String::impl_StartsWith(const String& needle, bool ignoreCase, const Locale& locale) const noexcept
+bool String::impl_StartsWith(StringView needle, bool ignoreCase, const Locale& locale) const noexcept
 {
 	if (needle.IsEmpty())
 		return true;
 
 	const Char* hayBytes = data();
-	const Char* neeBytes = needle.data();
+	const Char* neeBytes = reinterpret_cast<const Char*>(needle.GetData());
 	uint32_t H = _byteLength;
-	uint32_t N = needle._byteLength;
+	uint32_t N = needle.GetByteCount();
 
 	if (H < N)
 		return false;
@@ -2782,8 +3201,8 @@ bool String::impl_StartsWith(const String& needle, bool ignoreCase, const Locale
 	uint32_t locLen = (uint32_t)strlen(loc);
 	bool isTurkic = locale.IsTurkish();
 
-	bool asciiHay = ASCII::IsAllASCII(hayBytes, H);
-	bool asciiNee = ASCII::IsAllASCII(neeBytes, N);
+	bool asciiHay = is_ascii(*this);
+	bool asciiNee = needle.IsASCII();
 
 	// ====================================
 	// FAST-PATH 1: Ordinal ASCII
@@ -2802,7 +3221,7 @@ bool String::impl_StartsWith(const String& needle, bool ignoreCase, const Locale
 	// ====================================
 	List<CodePoint> hayFold, neeFold;
 	UTF8::FoldAndNormalize(data(), GetByteCount(), loc, hayFold);
-	UTF8::FoldAndNormalize(needle.data(), needle.GetByteCount(), loc, neeFold);
+	UTF8::FoldAndNormalize(neeBytes, N, loc, neeFold);
 
 	if (ignoreCase)
 		return UTF8::StartsWithIgnoreCase(hayFold, neeFold, loc);
@@ -2810,115 +3229,91 @@ bool String::impl_StartsWith(const String& needle, bool ignoreCase, const Locale
 		return UTF8::StartsWith(hayFold, neeFold);
 }
 
-List<String> String::impl_Split(
-	const List<String>& stringSeps,
-	const List<Char>& charSeps,
-	int maxCount,
-	StringSplitOptions options
-) const
+template<typename Find>
+List<String> String::split_by(Find&& find, int maxCount, StringSplitOptions options) const
 {
 	List<String> result;
 
-	const bool useString = !stringSeps.IsEmpty();
-	const bool useChars = !charSeps.IsEmpty();
-
-	if (!useString && !useChars)
-	{
-		result.Add(*this);
-		return result;
-	}
-
 	const int limit = (maxCount <= 0 ? Int32::MaxValue : (Int32)maxCount);
+	const uint32_t H = this->GetByteCount();
 
-	const Char* bytes = this->data();
-	uint32_t H = this->GetByteCount();
-	uint32_t pos = 0;
-
-	while (pos < H && (int)result.Count() < (limit - 1))
+	auto add = [&](uint32_t start, uint32_t length)
 	{
-		uint32_t cutPos = UINT32_MAX;
-		uint32_t cutLen = 0;
-
-		// ---------------------------------------------------
-		// 1) Separadores de string (byte-based)
-		// ---------------------------------------------------
-		if (useString)
-		{
-			for (const auto& sep : stringSeps)
-			{
-				uint32_t N = sep.GetByteCount();
-				if (N == 0) continue;
-
-				// IndexOf retorna byte offset → perfeito
-				Int64 idx = this->IndexOf(sep, pos);
-				if (idx >= 0)
-				{
-					uint32_t p = (uint32_t)idx;
-					if (p < cutPos || (p == cutPos && N > cutLen))
-					{
-						cutPos = p;
-						cutLen = N;
-					}
-				}
-			}
-		}
-
-		// ---------------------------------------------------
-		// 2) Separadores de Char (byte-based)
-		// ---------------------------------------------------
-		if (useChars)
-		{
-			for (uint32_t i = pos; i < H; ++i)
-			{
-				unsigned char b = (unsigned char)(Char)bytes[i];
-				if (charSeps.Contains(Char(b)))
-				{
-					if (i < cutPos)
-					{
-						cutPos = i;
-						cutLen = 1;
-					}
-					break;
-				}
-			}
-		}
-
-		// Nenhum separador encontrado → fim
-		if (cutPos == UInt32::MaxValue)
-			break;
-
-		// Extrai token (byte-based)
-		uint32_t tokLen = cutPos - pos;
-		String token = this->substring_by_bytes(pos, tokLen);
+		String token = this->substring_by_bytes(start, length);
 
 		if (HasFlag(options, StringSplitOptions::TrimEntries))
 			token = token.Trim();
 
 		if (!HasFlag(options, StringSplitOptions::RemoveEmptyEntries) || !token.IsEmpty())
 			result.Add(token);
+	};
 
+	uint32_t pos = 0;
+	uint32_t cutPos = 0;
+	uint32_t cutLen = 0;
+	while (pos < H && (int)result.Count() < (limit - 1) && find(pos, cutPos, cutLen))
+	{
+		add(pos, cutPos - pos);
 		pos = cutPos + cutLen;
 	}
 
 	// Último token
-	if (pos <= H)
-	{
-		uint32_t tokLen = H - pos;
-		String token = this->substring_by_bytes(pos, tokLen);
+	add(pos, H - pos);
+	return result;
+}
 
-		if (HasFlag(options, StringSplitOptions::TrimEntries))
-			token = token.Trim();
+List<String> String::impl_Split(
+	const List<StringView>& stringSeps,
+	const List<Char>& charSeps,
+	int maxCount,
+	StringSplitOptions options
+) const
+{
+	if (stringSeps.IsEmpty() && charSeps.IsEmpty())
+	{
+		List<String> result;
+		result.Add(*this);
+		return result;
+	}
 
-		if (!HasFlag(options, StringSplitOptions::RemoveEmptyEntries) || !token.IsEmpty())
-			result.Add(token);
+	// One separator: the substring search, no automaton to build
+	if (stringSeps.Count() == 1 && charSeps.IsEmpty() && !stringSeps[0].IsEmpty())
+	{
+		const StringView sep = stringSeps[0];
+		const TextSearch::Searcher searcher(reinterpret_cast<const uint8_t*>(sep.GetData()), sep.GetByteCount());
+		return split_by([&](uint32_t pos, uint32_t& cutPos, uint32_t& cutLen)
+		{
+			const int64_t at = searcher.IndexOfUTF8(as_bytes(data()), _byteLength, pos);
+			if (at < 0)
+				return false;
+			cutPos = (uint32_t)at;
+			cutLen = sep.GetByteCount();
+			return true;
+		}, maxCount, options);
 	}
 
-	return result;
+	return impl_Split(TextMatcher(stringSeps, charSeps), maxCount, options);
+}
+
+List<String> String::impl_Split(const TextMatcher& separators, int maxCount, StringSplitOptions options) const
+{
+	const char* text = reinterpret_cast<const char*>(data());
+	return split_by([&](uint32_t pos, uint32_t& cutPos, uint32_t& cutLen)
+	{
+		TextMatcher::Match m;
+		if (!separators.Find(text, _byteLength, pos, m))
+			return false;
+		cutPos = m.Offset;
+		cutLen = m.Length;
+		return true;
+	}, maxCount, options);
 }
 
 void String::remove_combining_dot_above(String& s)
 {
-	List<CodePoint> cps = String::DecodeToCodePoints(s);
+	Memory::ScratchScope scratch;
+	List<CodePoint> cps(scratch.GetArena(), s._byteLength);
+	UTF8::Decode(s.data(), s._byteLength, cps);
 	for (int i = (int)cps.Count() - 1; i >= 0; --i)
 		if (cps[i] == 0x0307) // COMBINING DOT ABOVE
 			cps.RemoveAt(i);
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "System/Types/Fundamentals/Object.hpp"
+#include "System/Types/Fundamentals/Hash.hpp"
 #include "System/Types/Primitives/Boolean.hpp"
 #include "System/Types/Primitives/Char.hpp"
 #include "System/Types/Primitives/CodePoint.hpp"
 #include "System/Text/Encoding.hpp"
+#include "System/Text/UTF8Iterators.hpp"
+#include "System/Types/Text/StringView.hpp"
 #include "System/Types/Primitives/Int32.hpp"
 #include "System/Types/Primitives/Int64.hpp"
 #include "System/Types/Primitives/UInt32.hpp"
@@ -12,13 +15,6 @@
 #include "System/Collections/List.hpp"
 #include "System/Meta/Forward.hpp"
 
-enum class StringSplitOptions : uint8_t
-{
-	None = 0,
-	RemoveEmptyEntries = 1 << 0,
-	TrimEntries = 1 << 1
-};
-
 enum class StringComparison
 {
 	Ordinal,
@@ -27,6 +23,23 @@ enum class StringComparison
 
 class Locale;
 class StringArg;
+class TextMatcher;
+class StringPool;
+
+namespace UTF8 { class GraphemeIndex; }
+
+// Literal as a template argument (String::Literal<"...">)
+template<size_t N>
+struct StringLiteral
+{
+	char bytes[N];
+
+	constexpr StringLiteral(const char(&text)[N]) noexcept
+	{
+		for (size_t i = 0; i < N; ++i)
+			bytes[i] = text[i];
+	}
+};
 
 class String final : public Object<String>
 {
@@ -72,9 +85,11 @@ public:
 	~String() noexcept;
 
 	inline friend String operator+(const String& a, const String& b) { return String::Concat(a, b); };
-	inline String& operator+=(const String& other) { *this = String::Concat(*this, other); return *this; }
+	String& operator+=(const String& other) noexcept;
 	inline friend Boolean operator==(const String& a, const String& b) noexcept { return a.Equals(b); }
 	inline friend Boolean operator!=(const String& a, const String& b) noexcept { return !(a == b); }
+	inline friend Boolean operator==(const String& a, const char* b) noexcept { return a.Equals(StringView(b)); }
+	inline friend Boolean operator!=(const String& a, const char* b) noexcept { return !a.Equals(StringView(b)); }
 
 	inline const Char& operator[](u32 i) const noexcept { return data()[i]; }
 
@@ -82,6 +97,11 @@ public:
 	explicit inline operator const char* () const noexcept { return reinterpret_cast<const char*>(data()); }
 	explicit inline operator const wchar_t* () const noexcept { return ToWideCharArray().GetData(); }
 	explicit inline operator const unsigned char* () const noexcept { return reinterpret_cast<const unsigned char*>(data()); }
+	inline operator StringView() const noexcept
+	{
+		const char* bytes = reinterpret_cast<const char*>(data());
+		return is_ascii_known() ? StringView(bytes, _byteLength, is_ascii_cached()) : StringView(bytes, _byteLength);
+	}
 
 	template<typename... Args>
 	static String Concat(Args&&... args)
@@ -123,6 +143,8 @@ public:
 	}
 
 	Boolean Contains(const String& sub) const noexcept;
+	Boolean Contains(StringView sub) const noexcept;
+	inline Boolean Contains(const char* sub) const noexcept { return Contains(StringView(sub)); }
 	Boolean Contains(CodePoint cp) const noexcept;
 	Boolean Contains(const String& sub, Boolean ignoreCase) const noexcept;
 	Boolean Contains(const String& sub, Boolean ignoreCase, const Locale& locale) const noexcept;
@@ -137,6 +159,8 @@ public:
 	static const String& Empty() { static const String emptyInstance; return emptyInstance; }
 
 	Boolean EndsWith(const String& compare) const noexcept;
+	Boolean EndsWith(StringView compare) const noexcept;
+	inline Boolean EndsWith(const char* compare) const noexcept { return EndsWith(StringView(compare)); }
 	Boolean EndsWith(const String& compare, Boolean ignoreCase) const noexcept;
 	Boolean EndsWith(const String& compare, Boolean ignoreCase, const Locale& locale) const noexcept;
 
@@ -194,21 +218,55 @@ public:
 
 	CodePoint GetCodePointAt(uint32_t cpIndex) const noexcept;
 
-	inline u32 GetCodePointsCount() const noexcept
-	{
-		return DecodeToCodePoints(*this).Count();
-	}
+	u32 GetCodePointsCount() const noexcept;
+
+	// Code points and grapheme clusters decoded in place, front to back or
+	// back to front (UTF8Iterators.hpp). The String must outlive the range.
+	inline UTF8::CodePointRange CodePoints() const noexcept { return UTF8::CodePoints(data(), _byteLength); }
+	inline UTF8::ReverseCodePointRange ReverseCodePoints() const noexcept { return UTF8::ReverseCodePoints(data(), _byteLength); }
+	inline UTF8::GraphemeRange Graphemes() const noexcept { return UTF8::Graphemes(data(), _byteLength); }
+	inline UTF8::ReverseGraphemeRange ReverseGraphemes() const noexcept { return UTF8::ReverseGraphemes(data(), _byteLength); }
 
 	u32 GetLength() const noexcept;
+	// Immortal blocks report the count they had when made immortal.
 	inline u32 GetReferenceCount() const noexcept
 	{
 		if (IsSSO()) return 1;
 		if (!_ptr) return 0;
-		return refcount_ref();
+		return (uint32_t)refcount_ref() & ~(REFCOUNT_IMMORTAL | REFCOUNT_INTERNED);
 	};
 
+	// Immortal strings are never freed: copying or destroying one skips the
+	// reference count entirely, which makes constants cheap to share between
+	// threads. SSO strings (String::Empty() included) have no block and
+	// already behave this way. Making a string immortal leaks its block.
+	String& MakeImmortal() noexcept;
+	Boolean IsImmortal() const noexcept;
+
+	// The canonical instance StringPool::Intern returned for these bytes.
+	// Interned strings hash from a cached value, and two of them are equal
+	// only if they are the same block (Equals, Compare, Map lookups).
+	Boolean IsInterned() const noexcept;
+
+	// One immortal instance per literal: String::Literal<"text/html">()
+	template<StringLiteral S>
+	static const String& Literal() noexcept
+	{
+		static const String instance = []() noexcept
+		{
+			String s(S.bytes, (u32)(sizeof(S.bytes) - 1));
+			s.MakeImmortal();
+			return s;
+		}();
+		return instance;
+	}
+
 	i64 IndexOf(const String& value, u32 startIndex) const;
 	i64 IndexOf(const String& value) const noexcept;
+	i64 IndexOf(StringView value, u32 startIndex) const noexcept;
+	i64 IndexOf(StringView value) const noexcept;
+	inline i64 IndexOf(const char* value, u32 startIndex) const noexcept { return IndexOf(StringView(value), startIndex); }
+	inline i64 IndexOf(const char* value) const noexcept { return IndexOf(StringView(value)); }
 	i64 IndexOf(const String& value, u32 startIndex, u32 count) const noexcept;
 	i64 IndexOf(const String& value, StringComparison comp) const noexcept;
 	i64 IndexOf(const String& value, u32 startIndex, StringComparison comp) const noexcept;
@@ -220,6 +278,8 @@ public:
 	i64 IndexOfAny(const List<Char>& chars, u32 startIndex, u32 count) const noexcept;
 	i64 IndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept;
 	i64 IndexOfAny(const List<Char>& chars) const noexcept;
+	i64 IndexOfAny(const TextMatcher& matcher, u32 startIndex) const noexcept;
+	i64 IndexOfAny(const TextMatcher& matcher) const noexcept;
 
 	String Insert(u32 cpIndex, const String& value) const noexcept;
 
@@ -227,10 +287,7 @@ public:
 
 	static inline Boolean IsEmpty(const String& s) { return s == String::Empty(); }
 
-	inline Boolean IsNormalized(NormalizationForm form = NormalizationForm::NFC) const noexcept
-	{
-		return Equals(Normalize(form));
-	}
+	Boolean IsNormalized(NormalizationForm form = NormalizationForm::NFC) const noexcept;
 
 	inline constexpr Boolean IsSSO() const noexcept { return (_flags & FLAG_SSO) != 0; }
 
@@ -282,6 +339,7 @@ public:
 	i64 LastIndexOfAny(const List<Char>& chars, u32 startIndex, u32 count) const noexcept;
 	i64 LastIndexOfAny(const List<Char>& chars, u32 startIndex) const noexcept;
 	i64 LastIndexOfAny(const List<Char>& chars) const noexcept;
+	i64 LastIndexOfAny(const TextMatcher& matcher) const noexcept;
 
 	String Normalize(NormalizationForm form = NormalizationForm::NFC) const noexcept;
 
@@ -384,6 +442,7 @@ public:
 	String Replace(const String& oldValue, const String& newValue) const noexcept;
 	String Replace(const String& oldValue, const String& newValue, StringComparison comp) const noexcept;
 	String Replace(const String& oldValue, const String& newValue, Boolean ignoreCase, const Locale& locale) const noexcept;
+	String Replace(const TextMatcher& oldValues, const String& newValue) const noexcept;
 
 	String ReplaceLineEndings() const noexcept;
 	String ReplaceLineEndings(const String& replacement) const noexcept;
@@ -397,12 +456,23 @@ public:
 	List<String> Split(const List<Char>& separators) const;
 	List<String> Split(const String& separator) const;
 	List<String> Split(const List<String>& separators) const;
+	List<String> Split(StringView separator, i32 maxCount, StringSplitOptions options) const;
+	List<String> Split(StringView separator, StringSplitOptions options) const;
+	List<String> Split(StringView separator) const;
+	inline List<String> Split(const char* separator, i32 maxCount, StringSplitOptions options) const { return Split(StringView(separator), maxCount, options); }
+	inline List<String> Split(const char* separator, StringSplitOptions options) const { return Split(StringView(separator), options); }
+	inline List<String> Split(const char* separator) const { return Split(StringView(separator)); }
+	List<String> Split(const TextMatcher& separators, i32 maxCount, StringSplitOptions options) const;
+	List<String> Split(const TextMatcher& separators, StringSplitOptions options) const;
+	List<String> Split(const TextMatcher& separators) const;
 
 	inline String Substring(u32 gcStart) const noexcept { return Substring(gcStart, this->GetLength() - gcStart); }
 	String Substring(u32 gcStart, u32 gcCount) const noexcept;
 	Boolean StartsWith(const String& compare, Boolean ignoreCase, const Locale& locale) const noexcept;
 	Boolean StartsWith(const String& compare, Boolean ignoreCase) const noexcept;
 	Boolean StartsWith(const String& compare) const noexcept;
+	Boolean StartsWith(StringView compare) const noexcept;
+	inline Boolean StartsWith(const char* compare) const noexcept { return StartsWith(StringView(compare)); }
 
 	String ToHex(Encoding enc = Encoding::UTF8) const noexcept;
 
@@ -432,6 +502,8 @@ public:
 	Array<wchar_t> ToWideCharArray() const noexcept;
 
 	Boolean Equals(const String& other) const noexcept;
+	Boolean Equals(StringView other) const noexcept;
+	inline Boolean Equals(const char* other) const noexcept { return Equals(StringView(other)); }
 	UInt32 GetHashCode() const noexcept;
 	String ToString() const noexcept;
 
@@ -442,6 +514,32 @@ private:
 	static constexpr uint32_t FLAG_ASCII_KNOWN = 1 << 1;
 	static constexpr uint32_t FLAG_IS_ASCII = 1 << 2;
 
+	// Reference count word of a heap block: the top bit marks it immortal.
+	// Counts are updated atomically, so copies may cross threads.
+	// The next bit marks a StringPool canonical block (always immortal too).
+	static constexpr uint32_t REFCOUNT_IMMORTAL = 1u << 31;
+	static constexpr uint32_t REFCOUNT_INTERNED = 1u << 30;
+
+	// Heap block: [block_prefix][refcount u32][length u32][bytes]\0
+	// _ptr points at the refcount. The prefix in front of it holds the
+	// grapheme index, null until a large non-ASCII string is first indexed
+	// into (see grapheme_index), the hash of the whole block once someone
+	// asked for it (0 until then, see GetHashCode), and the number of bytes
+	// the block has room for. Blocks grown by operator+= and StringBuilder
+	// have spare room past the length; the others don't.
+	struct block_prefix
+	{
+		UTF8::GraphemeIndex* index;
+		uint32_t hash;
+		uint32_t capacity;
+	};
+
+	static constexpr uint32_t BLOCK_PREFIX_SIZE = sizeof(block_prefix);
+	static constexpr uint32_t INDEX_MIN_BYTES = 512;
+
+	friend class StringPool;
+	friend class StringBuilder;
+
 	union
 	{
 		unsigned char* _ptr = nullptr;   // Block start (heap)
@@ -457,29 +555,58 @@ private:
 
 	const Char* data() const noexcept;
 	inline refcount_type& refcount_ref() const { return *reinterpret_cast<refcount_type*>(_ptr); }
+	inline volatile uint32_t* refcount_word() const { return reinterpret_cast<volatile uint32_t*>(_ptr); }
 	uint32_t& length_ref() const { return *reinterpret_cast<uint32_t*>(_ptr + sizeof(refcount_type)); }
 	inline Char* bytes_ptr() const { return reinterpret_cast<Char*>(_ptr + sizeof(refcount_type) + sizeof(u32)); }
+	inline block_prefix* prefix() const { return reinterpret_cast<block_prefix*>(_ptr - BLOCK_PREFIX_SIZE); }
+	inline UTF8::GraphemeIndex* volatile* index_slot() const { return reinterpret_cast<UTF8::GraphemeIndex* volatile*>(&prefix()->index); }
+	inline volatile uint32_t* hash_slot() const { return reinterpret_cast<volatile uint32_t*>(&prefix()->hash); }
 
 	void add_ref() noexcept;
 	void release() noexcept;
 	static unsigned char* allocate_block(uint32_t lenChars) noexcept;
+	static unsigned char* allocate_block(uint32_t lenChars, uint32_t capacity) noexcept;
+	bool owns_block() const noexcept;
+	void adopt_block(unsigned char* block, uint32_t length) noexcept;
+	void append(const Char* bytes, uint32_t len) noexcept;
+	void reserve(uint32_t capacity) noexcept;
+	void clear_keep_capacity() noexcept;
+	Char* spare_room(uint32_t& room) noexcept;
+	void commit_ascii(uint32_t len) noexcept;
+	static inline uint64_t block_size(uint32_t lenChars) noexcept { return BLOCK_PREFIX_SIZE + sizeof(refcount_type) + sizeof(u32) + lenChars + 1; }
+	static String make_interned(const Char* bytes, uint32_t len, uint32_t hash) noexcept;
 	void init_from_bytes(const unsigned char* bytes, uint32_t len) noexcept;
 	uint32_t find_byte_offset_of_code_point(uint32_t cpIndex) const;
+	uint32_t code_points_before_byte(uint32_t byteOffset) const noexcept;
+	const UTF8::GraphemeIndex* grapheme_index() const noexcept;
+	bool code_points_before_view(const UTF8::GraphemeIndex& index, uint32_t& count) const noexcept;
 
-	static void copy_bytes(char* dst, uint32_t& offset, const String& s) noexcept;
+	static void copy_bytes(char* dst, uint32_t& offset, StringView s) noexcept;
 	static void copy_bytes(char* dst, uint32_t& offset, const char* cstr) noexcept;
 
 	static bool is_ascii(const String& s) noexcept;
+	static inline const uint8_t* as_bytes(const Char* p) noexcept { return reinterpret_cast<const uint8_t*>(p); }
+	static StringView ascii_view(const String& s) noexcept;
+	static bool code_points_match_at(UTF8::CodePointIterator at, StringView needle) noexcept;
+	static void append_utf8(List<Char>& out, const List<CodePoint>& cps);
 
-	bool contain_byte(const String& sub) const noexcept;
+	bool contain_byte(StringView sub) const noexcept;
 	String substring_by_bytes(uint32_t byteStart, uint32_t byteLen) const noexcept;
 
-	bool impl_EndsWith(const String& needle, bool ignoreCase, const Locale& locale) const noexcept;
-	bool impl_StartsWith(const String& needle, bool ignoreCase, const Locale& locale) const noexcept;
+	bool impl_EndsWith(StringView needle, bool ignoreCase, const Locale& locale) const noexcept;
+	bool impl_StartsWith(StringView needle, bool ignoreCase, const Locale& locale) const noexcept;
 
 	static void remove_combining_dot_above(String& s);
 
-	List<String> impl_Split(const List<String>& stringSeps, const List<Char>& charSeps, int maxCount, StringSplitOptions options) const;
+	List<String> impl_Split(const List<StringView>& stringSeps, const List<Char>& charSeps, int maxCount, StringSplitOptions options) const;
+	List<String> impl_Split(const TextMatcher& separators, int maxCount, StringSplitOptions options) const;
+	template<typename Find>
+	List<String> split_by(Find&& find, int maxCount, StringSplitOptions options) const;
+	i64 impl_IndexOfAny(const TextMatcher& matcher, u32 startIndex, u32 count) const noexcept;
+	i64 impl_LastIndexOfAny(const TextMatcher& matcher, u32 startIndex, u32 count) const noexcept;
+	bool contains_zwj() const noexcept;
+	String normalize_code_points(NormalizationForm form) const noexcept;
+	static List<StringView> views_of(const List<String>& list);
 
 	// Verifica se TODOS os Strings em uma lista são ASCII
 	static bool are_all_strings_ascii(const List<String>& list) {
@@ -551,75 +678,78 @@ private:
 
 };
 
-inline StringSplitOptions operator|(StringSplitOptions a, StringSplitOptions b)
-{
-	return static_cast<StringSplitOptions>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
-}
+// Inline SSO bytes or a refcounted block pointer, never a pointer into
+// itself: List<String> can shift and grow with memmove.
+template<>
+struct is_trivially_relocatable<String> : true_type {};
 
-inline Boolean HasFlag(StringSplitOptions opt, StringSplitOptions flag)
-{
-	return (static_cast<uint8_t>(opt) & static_cast<uint8_t>(flag)) != 0;
-}
+// Map<String, V> and friends can be probed with a StringView (or a
+// const char*) without building a temporary String.
+template<>
+struct hash_lookup_view<String> { using type = StringView; };
 
 class StringArg
 {
 public:
 
-	StringArg(const String& s) noexcept : _str(&s), _owns(false) {}
+	// UTF-8 input is borrowed as a view; only wide / UTF-16 / UTF-32
+	// text is transcoded into a temporary String first
+	StringArg(const String& s) noexcept : _view(s) {}
+
+	StringArg(StringView v) noexcept : _view(v) {}
 
 	template<size_t N>
 	StringArg(const char(&p)[N]) noexcept
-		: _temp(p), _str(&_temp), _owns(true) {
+		: _view(p, N - 1) {
 	}
 
 	StringArg(const char* p, u32 length) noexcept
-		: _temp(p, length), _str(&_temp), _owns(true) {
+		: _view(p, length) {
 	}
 
 	template<size_t N>
 	StringArg(const wchar_t(&p)[N]) noexcept
-		: _temp(p), _str(&_temp), _owns(true) {
+		: _temp(p), _view(_temp) {
 	}
 
 	StringArg(const wchar_t* p, u32 length) noexcept
-		: _temp(p, length), _str(&_temp), _owns(true) {
+		: _temp(p, length), _view(_temp) {
 	}
 
 	template<size_t N>
 	StringArg(const char8_t(&p)[N]) noexcept
-		: _temp(p), _str(&_temp), _owns(true) {
+		: _view(reinterpret_cast<const char*>(p), N - 1) {
 	}
 
 	StringArg(const char8_t* p, u32 length) noexcept
-		: _temp(p, length), _str(&_temp), _owns(true) {
+		: _view(reinterpret_cast<const char*>(p), length) {
 	}
 
 	template<size_t N>
 	StringArg(const char16_t(&p)[N]) noexcept
-		: _temp(p), _str(&_temp), _owns(true) {
+		: _temp(p), _view(_temp) {
 	}
 
 	StringArg(const char16_t* p, u32 length) noexcept
-		: _temp(p, length), _str(&_temp), _owns(true) {
+		: _temp(p, length), _view(_temp) {
 	}
 
 	template<size_t N>
 	StringArg(const char32_t(&p)[N]) noexcept
-		: _temp(p), _str(&_temp), _owns(true) {
+		: _temp(p), _view(_temp) {
 	}
 
 	StringArg(const char32_t* p, u32 length) noexcept
-		: _temp(p, length), _str(&_temp), _owns(true) {
+		: _temp(p, length), _view(_temp) {
 	}
 
-	const String& Get() const noexcept
+	StringView Get() const noexcept
 	{
-		return *_str;
+		return _view;
 	}
 
 private:
 
-	String        _temp;
-	const String* _str;
-	bool          _owns;
+	String     _temp;
+	StringView _view;
 };
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "System/Types/Fundamentals/Object.hpp"
+#include "System/Types/Primitives/Boolean.hpp"
+#include "System/Types/Primitives/Int64.hpp"
+#include "System/Types/Primitives/UInt32.hpp"
+#include "System/Globals.hpp"
+#include "System/Marvin32.hpp"
+#include "System/WideHash.hpp"
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/TextSearch.hpp"
+#include "System/Collections/List.hpp"
+
+enum class StringSplitOptions : uint8_t
+{
+	None = 0,
+	RemoveEmptyEntries = 1 << 0,
+	TrimEntries = 1 << 1
+};
+
+inline StringSplitOptions operator|(StringSplitOptions a, StringSplitOptions b)
+{
+	return static_cast<StringSplitOptions>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+inline Boolean HasFlag(StringSplitOptions opt, StringSplitOptions flag)
+{
+	return (static_cast<uint8_t>(opt) & static_cast<uint8_t>(flag)) != 0;
+}
+
+// ==============================================================
+//  StringView - borrowed UTF-8 bytes (pointer + byte length)
+//  - Never owns or copies; the bytes must outlive the view
+//  - String converts to it implicitly, so APIs taking a view
+//    accept String, literals and slices of foreign buffers
+//  - Hashes and compares exactly like String, which makes it
+//    a lookup key for Map<String, V>
+//  - Whether the bytes are ASCII is scanned once and cached (or
+//    handed over by String, which already knows)
+//  - Searching, Slice and Split work on bytes and return offsets
+//    and views into the same buffer: a protocol line can be cut
+//    up straight out of a receive buffer without a String
+// ==============================================================
+
+class StringView final : public Object<StringView>
+{
+public:
+
+	constexpr StringView() noexcept : _data(""), _length(0), _ascii(ASCII_YES) {}
+
+	constexpr StringView(const char* data, uint32_t length) noexcept
+		: _data(data != nullptr ? data : ""), _length(data != nullptr ? length : 0), _ascii(ASCII_UNKNOWN) {
+	}
+
+	// Bytes whose ASCII-ness the caller already knows (String passes its flag)
+	constexpr StringView(const char* data, uint32_t length, bool isASCII) noexcept
+		: _data(data != nullptr ? data : ""), _length(data != nullptr ? length : 0), _ascii(isASCII ? ASCII_YES : ASCII_NO) {
+	}
+
+	constexpr StringView(const char* p) noexcept
+		: _data(p != nullptr ? p : ""), _length(0), _ascii(ASCII_UNKNOWN)
+	{
+		while (_data[_length]) ++_length;
+	}
+
+	inline constexpr const char* GetData() const noexcept { return _data; }
+	inline constexpr u32 GetByteCount() const noexcept { return _length; }
+	inline constexpr Boolean IsEmpty() const noexcept { return _length == 0; }
+	inline constexpr char operator[](uint32_t i) const noexcept { return _data[i]; }
+
+	Boolean IsASCII() const noexcept
+	{
+		if (_ascii == ASCII_UNKNOWN)
+			_ascii = TextKernels::IsASCII(_data, _length) ? ASCII_YES : ASCII_NO;
+		return _ascii == ASCII_YES;
+	}
+
+	// Byte range, clamped to the view. An ASCII view stays known ASCII.
+	StringView Slice(uint32_t byteStart, uint32_t byteCount) const noexcept
+	{
+		if (byteStart > _length)
+			byteStart = _length;
+		if (byteCount > _length - byteStart)
+			byteCount = _length - byteStart;
+
+		StringView view(_data + byteStart, byteCount);
+		if (_ascii == ASCII_YES)
+			view._ascii = ASCII_YES;
+		return view;
+	}
+
+	inline StringView Slice(uint32_t byteStart) const noexcept { return Slice(byteStart, _length); }
+
+	// Byte offset of the first match at or after startByte, -1 if none
+	Int64 IndexOf(char c, uint32_t startByte = 0) const noexcept
+	{
+		return IndexOf(StringView(&c, 1), startByte);
+	}
+
+	Int64 IndexOf(const StringView& value, uint32_t startByte = 0) const noexcept
+	{
+		return TextSearch::IndexOf(reinterpret_cast<const uint8_t*>(_data), _length,
+			reinterpret_cast<const uint8_t*>(value._data), value._length, startByte);
+	}
+
+	// Last match lying entirely inside the view, -1 if none
+	Int64 LastIndexOf(const StringView& value) const noexcept
+	{
+		return TextSearch::LastIndexOf(reinterpret_cast<const uint8_t*>(_data), _length,
+			reinterpret_cast<const uint8_t*>(value._data), value._length);
+	}
+
+	inline Boolean Contains(const StringView& value) const noexcept { return IndexOf(value) >= 0; }
+
+	Boolean StartsWith(const StringView& value) const noexcept
+	{
+		return value._length <= _length && Slice(0, value._length).Equals(value);
+	}
+
+	Boolean EndsWith(const StringView& value) const noexcept
+	{
+		return value._length <= _length && Slice(_length - value._length).Equals(value);
+	}
+
+	// Without leading / trailing ASCII whitespace (space, \t, \n, \v, \f, \r)
+	StringView Trim() const noexcept
+	{
+		uint32_t begin = 0;
+		uint32_t end = _length;
+		while (begin < end && is_space(_data[begin])) ++begin;
+		while (end > begin && is_space(_data[end - 1])) --end;
+		return Slice(begin, end - begin);
+	}
+
+	// Pieces between separators, as views into these bytes. An empty
+	// separator yields the whole view. TrimEntries trims ASCII whitespace.
+	List<StringView> Split(const StringView& separator, StringSplitOptions options = StringSplitOptions::None) const
+	{
+		List<StringView> result;
+		if (separator.IsEmpty())
+		{
+			add_piece(result, *this, options);
+			return result;
+		}
+
+		uint32_t pos = 0;
+		for (int64_t cut = IndexOf(separator, 0); cut >= 0; cut = IndexOf(separator, pos))
+		{
+			add_piece(result, Slice(pos, (uint32_t)cut - pos), options);
+			pos = (uint32_t)cut + separator._length;
+		}
+		add_piece(result, Slice(pos), options);
+		return result;
+	}
+
+	inline List<StringView> Split(char separator, StringSplitOptions options = StringSplitOptions::None) const
+	{
+		return Split(StringView(&separator, 1), options);
+	}
+
+	Boolean Equals(const StringView& other) const noexcept
+	{
+		if (_length != other._length)
+			return false;
+		if (_data == other._data)
+			return true;
+
+		for (uint32_t i = 0; i < _length; ++i)
+			if (_data[i] != other._data[i])
+				return false;
+		return true;
+	}
+
+	// Same value as String::GetHashCode for the same bytes
+	UInt32 GetHashCode() const noexcept
+	{
+		if (_length == 0)
+			return 0;
+
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(_data);
+		if (Phoenix::STRING_HASH_ALGORITHM == Phoenix::StringHashAlgorithm::Wide)
+			return WideHash::Fold(WideHash::Compute(bytes, _length, Phoenix::GLOBAL_HASH_SEED));
+
+		return Marvin32::Compute(bytes, _length, Phoenix::GLOBAL_HASH_SEED);
+	}
+
+	inline friend Boolean operator==(const StringView& a, const StringView& b) noexcept { return a.Equals(b); }
+	inline friend Boolean operator!=(const StringView& a, const StringView& b) noexcept { return !a.Equals(b); }
+
+private:
+
+	static constexpr uint8_t ASCII_UNKNOWN = 0;
+	static constexpr uint8_t ASCII_YES = 1;
+	static constexpr uint8_t ASCII_NO = 2;
+
+	static constexpr bool is_space(char c) noexcept
+	{
+		return c == ' ' || (c >= '\t' && c <= '\r');
+	}
+
+	static void add_piece(List<StringView>& out, StringView piece, StringSplitOptions options)
+	{
+		if (HasFlag(options, StringSplitOptions::TrimEntries))
+			piece = piece.Trim();
+		if (!HasFlag(options, StringSplitOptions::RemoveEmptyEntries) || !piece.IsEmpty())
+			out.Add(piece);
+	}
+
+	const char* _data;
+	uint32_t _length;
+	mutable uint8_t _ascii;
+};
@@ -0,0 +1,214 @@
+#include "WideHash.hpp"
+#include "CPUInfo.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define PHOENIX_WIDEHASH_AES 1
+#include <wmmintrin.h>
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define PHOENIX_WIDEHASH_TARGET_AES
+#else
+#define PHOENIX_WIDEHASH_TARGET_AES __attribute__((target("aes,sse2")))
+#endif
+
+namespace
+{
+    // wyhash's secret: odd, and half of the bits set in every byte
+    constexpr uint64_t K0 = 0xA0761D6478BD642Full;
+    constexpr uint64_t K1 = 0xE7037ED1A0B428DBull;
+    constexpr uint64_t K2 = 0x8EBC6AF09C88D6E5ull;
+    constexpr uint64_t K3 = 0x589965CC75374CC3ull;
+
+    inline uint64_t Read8(const uint8_t* p) noexcept
+    {
+        uint64_t v;
+#if defined(_MSC_VER) && !defined(__clang__)
+        v = *(const uint64_t __unaligned*)p;
+#else
+        __builtin_memcpy(&v, p, sizeof(v));
+#endif
+        return v;
+    }
+
+    inline uint64_t Read4(const uint8_t* p) noexcept
+    {
+        uint32_t v;
+#if defined(_MSC_VER) && !defined(__clang__)
+        v = *(const uint32_t __unaligned*)p;
+#else
+        __builtin_memcpy(&v, p, sizeof(v));
+#endif
+        return v;
+    }
+
+    // a * b as low and high halves
+    inline void Multiply(uint64_t& a, uint64_t& b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 r = (unsigned __int128)a * b;
+        a = (uint64_t)r;
+        b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        a = _umul128(a, b, &b);
+#else
+        const uint64_t aLo = (uint32_t)a, aHi = a >> 32;
+        const uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+        const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+        const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+        b = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        a = (mid << 32) | (uint32_t)ll;
+#endif
+    }
+
+    inline uint64_t Mix(uint64_t a, uint64_t b) noexcept
+    {
+        Multiply(a, b);
+        return a ^ b;
+    }
+
+    bool DetectAES() noexcept
+    {
+#if defined(PHOENIX_WIDEHASH_AES)
+        CPUInfo cpu;
+        return cpu.HaveAES() && cpu.HaveSSE2();
+#else
+        return false;
+#endif
+    }
+}
+
+bool WideHash::IsAccelerated() noexcept
+{
+    static const bool accelerated = DetectAES();
+    return accelerated;
+}
+
+uint64_t WideHash::Compute(const uint8_t* data, size_t len, uint64_t seed) noexcept
+{
+#if defined(PHOENIX_WIDEHASH_AES)
+    if (IsAccelerated())
+        return ComputeAES(data, len, seed);
+#endif
+    return ComputePortable(data, len, seed);
+}
+
+uint64_t WideHash::ComputePortable(const uint8_t* p, size_t len, uint64_t seed) noexcept
+{
+    seed ^= Mix(seed ^ K0, K1);
+
+    uint64_t a;
+    uint64_t b;
+    if (len <= 16)
+    {
+        if (len >= 4)
+        {
+            // the first and last 4 bytes, and the two in the middle
+            // for 8 or more; they overlap below that
+            const size_t middle = (len >> 3) << 2;
+            a = (Read4(p) << 32) | Read4(p + middle);
+            b = (Read4(p + len - 4) << 32) | Read4(p + len - 4 - middle);
+        }
+        else if (len > 0)
+        {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t rest = len;
+        if (rest > 32)
+        {
+            uint64_t lane = seed;
+            do
+            {
+                seed = Mix(Read8(p) ^ K1, Read8(p + 8) ^ seed);
+                lane = Mix(Read8(p + 16) ^ K2, Read8(p + 24) ^ lane);
+                p += 32;
+                rest -= 32;
+            } while (rest > 32);
+            seed ^= lane;
+        }
+        if (rest > 16)
+        {
+            seed = Mix(Read8(p) ^ K1, Read8(p + 8) ^ seed);
+            p += 16;
+            rest -= 16;
+        }
+
+        // the last 16 bytes of the input, some of them mixed already
+        a = Read8(p + rest - 16);
+        b = Read8(p + rest - 8);
+    }
+
+    a ^= K1;
+    b ^= seed;
+    Multiply(a, b);
+    return Mix(a ^ K0 ^ len, b ^ K1);
+}
+
+#if defined(PHOENIX_WIDEHASH_AES)
+
+PHOENIX_WIDEHASH_TARGET_AES
+uint64_t WideHash::ComputeAES(const uint8_t* p, size_t len, uint64_t seed) noexcept
+{
+    const uint8_t* const end = p + len;
+    const __m128i key = _mm_set_epi64x((long long)(seed ^ K2), (long long)(seed ^ K0));
+    const __m128i key2 = _mm_set_epi64x((long long)K3, (long long)K1);
+
+    // the length goes in first, so zero padding is not an extension
+    __m128i s0 = _mm_xor_si128(key, _mm_set_epi64x(0, (long long)len));
+    __m128i s1 = _mm_aesenc_si128(key, key2);
+
+    while (end - p >= 32)
+    {
+        s0 = _mm_aesenc_si128(_mm_xor_si128(s0, _mm_loadu_si128((const __m128i*)p)), key);
+        s1 = _mm_aesenc_si128(_mm_xor_si128(s1, _mm_loadu_si128((const __m128i*)(p + 16))), key);
+        p += 32;
+    }
+    if (end - p >= 16)
+    {
+        s0 = _mm_aesenc_si128(_mm_xor_si128(s0, _mm_loadu_si128((const __m128i*)p)), key);
+        p += 16;
+    }
+    if (p < end)
+    {
+        // the last 16 bytes when there are that many; below that the
+        // same overlapping loads as the portable path, which cover
+        // every byte for a given length
+        __m128i last;
+        if (len >= 16)
+            last = _mm_loadu_si128((const __m128i*)(end - 16));
+        else if (len >= 8)
+            last = _mm_set_epi64x((long long)Read8(end - 8), (long long)Read8(p));
+        else if (len >= 4)
+            last = _mm_set_epi64x((long long)Read4(end - 4), (long long)Read4(p));
+        else
+            last = _mm_set_epi64x(0, (long long)(((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1]));
+        s1 = _mm_aesenc_si128(_mm_xor_si128(s1, last), key2);
+    }
+
+    __m128i s = _mm_aesenc_si128(s0, s1);
+    s = _mm_aesenc_si128(s, key);
+    s = _mm_aesenc_si128(s, key2);
+    s = _mm_aesenclast_si128(s, key);
+
+    return (uint64_t)_mm_cvtsi128_si64(s) ^ (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(s, s));
+}
+
+#else
+
+uint64_t WideHash::ComputeAES(const uint8_t* data, size_t len, uint64_t seed) noexcept
+{
+    return ComputePortable(data, len, seed);
+}
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// ==============================================================
+//  WideHash - seeded 64-bit hash of a byte range
+//  - Portable: two 64-bit lanes, 32 bytes per round, each lane a
+//    64x64->128 multiply folded to 64 bits (the wyhash mix)
+//  - AES: two 128-bit lanes, 32 bytes per round, one AES round per
+//    16 bytes and four to finish. Taken on x64 when CPUInfo reports
+//    AES-NI; the two paths give different values, and a process
+//    only ever uses one of them
+//  - Short inputs (up to 16 bytes) are a couple of loads and two
+//    multiplies; nothing is read past the end
+// ==============================================================
+
+struct WideHash
+{
+    // The accelerated path when the CPU has it, the portable one otherwise
+    static uint64_t Compute(const uint8_t* data, size_t len, uint64_t seed) noexcept;
+
+    static uint64_t ComputePortable(const uint8_t* data, size_t len, uint64_t seed) noexcept;
+
+    // Only valid when IsAccelerated()
+    static uint64_t ComputeAES(const uint8_t* data, size_t len, uint64_t seed) noexcept;
+
+    static bool IsAccelerated() noexcept;
+
+    // 32 bits for the hash tables, from both halves
+    static inline uint32_t Fold(uint64_t hash) noexcept
+    {
+        return (uint32_t)(hash ^ (hash >> 32));
+    }
+};
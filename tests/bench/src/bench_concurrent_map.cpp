@@ -0,0 +1,101 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/ConcurrentMap.hpp"
+#include "System/Collections/Dictionary.hpp"
+#include "System/Threading/SpinLock.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// ConcurrentMap<K, V> read-mostly throughput (90% reads, 10%
+// writes) as threads are added, against one Map behind a single
+// SpinLock. Each run does the same total number of operations.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t Keys = 1u << 16;
+    constexpr uint32_t TotalOps = 1u << 20;
+
+    struct LockedMap
+    {
+        SpinLock lock;
+        Map<u64, u64> map;
+
+        bool TryGetValue(u64 key, u64& value)
+        {
+            SpinLockScope scope(lock);
+            const u64* found = map.Find(key);
+            if (found == nullptr) return false;
+            value = *found;
+            return true;
+        }
+
+        void Insert(u64 key, u64 value)
+        {
+            SpinLockScope scope(lock);
+            map.Insert(key, value);
+        }
+    };
+
+    template<typename Table>
+    uint64_t RunMixed(Table& table, uint32_t threads)
+    {
+        uint64_t hits[64] = {};
+        std::thread workers[64];
+
+        for (uint32_t t = 0; t < threads; ++t)
+        {
+            workers[t] = std::thread([&table, &hits, t, threads]() {
+                uint64_t x = 0x9E3779B97F4A7C15ull * (t + 1);
+                uint64_t local = 0;
+                for (uint32_t i = 0; i < TotalOps / threads; ++i)
+                {
+                    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                    u64 key = x % Keys;
+                    if ((x >> 32) % 10 == 0)
+                        table.Insert(key, u64(i));
+                    else
+                    {
+                        u64 value;
+                        local += table.TryGetValue(key, value) ? 1 : 0;
+                    }
+                }
+                hits[t] = local;
+            });
+        }
+
+        uint64_t total = 0;
+        for (uint32_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+            total += hits[t];
+        }
+        return total;
+    }
+}
+
+TEST_CASE("ConcurrentMap - read-mostly scaling", "[.][benchmark][ConcurrentMap]") {
+    ConcurrentMap<u64, u64> sharded;
+    LockedMap locked;
+    for (uint32_t i = 0; i < Keys; i += 2)
+    {
+        sharded.Insert(u64(i), u64(i));
+        locked.Insert(u64(i), u64(i));
+    }
+
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    for (uint32_t threads = 1; threads <= 16 && threads <= (hardware ? hardware : 1); threads *= 2)
+    {
+        BENCHMARK("ConcurrentMap<u64,u64> 1M ops, " + std::to_string(threads) + " threads") {
+            return RunMixed(sharded, threads);
+        };
+
+        BENCHMARK("SpinLock + Map<u64,u64> 1M ops, " + std::to_string(threads) + " threads") {
+            return RunMixed(locked, threads);
+        };
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/SpscRing.hpp"
+#include "System/Collections/MpmcQueue.hpp"
+#include "System/Collections/Queue.hpp"
+#include "System/Threading/SpinLock.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// Handing 1M values from producer threads to consumer threads:
+// SpscRing and MpmcQueue (one at a time and in batches of 16)
+// against Queue<T> behind a SpinLock.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint64_t Items = 1u << 20;
+    constexpr uint32_t Batch = 16;
+
+    struct LockedQueue
+    {
+        SpinLock lock;
+        Queue<u64> queue;
+
+        u32 TryPushN(const u64* values, u32 count)
+        {
+            SpinLockScope scope(lock);
+            for (uint32_t i = 0; i < (uint32_t)count; ++i) queue.Enqueue(values[i]);
+            return count;
+        }
+
+        u32 TryPopN(u64* values, u32 count)
+        {
+            SpinLockScope scope(lock);
+            uint32_t n = 0;
+            while (n < (uint32_t)count && queue.GetLength() > 0) values[n++] = queue.Dequeue();
+            return n;
+        }
+    };
+
+    // producers push Items in total, consumers pop until all arrived
+    template<typename Q>
+    uint64_t Transfer(Q& q, uint32_t producers, uint32_t consumers, uint32_t batch)
+    {
+        volatile uint64_t received = 0;
+        volatile uint64_t sum = 0;
+        std::thread threads[32];
+
+        for (uint32_t p = 0; p < producers; ++p)
+        {
+            threads[p] = std::thread([&q, producers, batch]() {
+                u64 values[Batch];
+                uint64_t left = Items / producers;
+                while (left > 0)
+                {
+                    uint32_t k = left < batch ? (uint32_t)left : batch;
+                    for (uint32_t i = 0; i < k; ++i) values[i] = left - i;
+                    uint32_t pushed = q.TryPushN(values, k);
+                    left -= pushed;
+                    if (pushed == 0) std::this_thread::yield();
+                }
+            });
+        }
+
+        const uint64_t total = (Items / producers) * producers;
+        for (uint32_t c = 0; c < consumers; ++c)
+        {
+            threads[producers + c] = std::thread([&q, &received, &sum, total, batch]() {
+                u64 values[Batch];
+                uint64_t local = 0;
+                while (Volatile::Read(&received) < total)
+                {
+                    uint32_t popped = q.TryPopN(values, batch);
+                    for (uint32_t i = 0; i < popped; ++i) local += values[i];
+                    if (popped == 0) std::this_thread::yield();
+                    else Interlocked::Add(&received, (uint64_t)popped);
+                }
+                Interlocked::Add(&sum, local);
+            });
+        }
+
+        for (uint32_t t = 0; t < producers + consumers; ++t)
+            threads[t].join();
+        return sum;
+    }
+}
+
+TEST_CASE("SpscRing - one producer, one consumer", "[.][benchmark][SpscRing]") {
+    BENCHMARK("SpscRing<u64> 1M items, single") {
+        SpscRing<u64> q(1024);
+        return Transfer(q, 1, 1, 1);
+    };
+
+    BENCHMARK("SpscRing<u64> 1M items, batches of 16") {
+        SpscRing<u64> q(1024);
+        return Transfer(q, 1, 1, Batch);
+    };
+
+    BENCHMARK("SpinLock + Queue<u64> 1M items, batches of 16") {
+        LockedQueue q;
+        return Transfer(q, 1, 1, Batch);
+    };
+}
+
+TEST_CASE("MpmcQueue - producers and consumers", "[.][benchmark][MpmcQueue]") {
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    for (uint32_t threads = 1; threads <= 8 && threads * 2 <= (hardware ? hardware : 2); threads *= 2)
+    {
+        BENCHMARK("MpmcQueue<u64> 1M items, " + std::to_string(threads) + "x" + std::to_string(threads) + " single") {
+            MpmcQueue<u64> q(1024);
+            return Transfer(q, threads, threads, 1);
+        };
+
+        BENCHMARK("MpmcQueue<u64> 1M items, " + std::to_string(threads) + "x" + std::to_string(threads) + " batches of 16") {
+            MpmcQueue<u64> q(1024);
+            return Transfer(q, threads, threads, Batch);
+        };
+
+        BENCHMARK("SpinLock + Queue<u64> 1M items, " + std::to_string(threads) + "x" + std::to_string(threads) + " batches of 16") {
+            LockedQueue q;
+            return Transfer(q, threads, threads, Batch);
+        };
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/UTF8Iterators.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Indexed access into a ~120 KB non-ASCII String, the editor
+// style workload: every call used to decode from byte 0, so a
+// walk by index was quadratic. With the sparse grapheme index
+// each call walks at most one stride from a checkpoint.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    String EditorText()
+    {
+        String line(u8"    let caf\u00E9 = \"na\u00EFve \u4E2D\u6587 \U0001F44D\U0001F3FB\"; // e\u0301\n");
+        String text;
+        while (text.GetByteCount() < 120000)
+            text += line;
+        return text;
+    }
+}
+
+TEST_CASE("GraphemeIndex - indexed access", "[.][benchmark][GraphemeIndex][String]") {
+    const String text = EditorText();
+    const uint32_t clusters = text.GetLength();
+    const uint32_t codePoints = text.GetCodePointsCount();
+
+    BENCHMARK("Substring(i, 16) every 97 clusters") {
+        uint64_t bytes = 0;
+        for (uint32_t i = 0; i < clusters; i += 97)
+            bytes += text.Substring(i, 16).GetByteCount();
+        return bytes;
+    };
+
+    BENCHMARK("GetCodePointAt(i) every 97 code points") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < codePoints; i += 97)
+            sum += (uint32_t)text.GetCodePointAt(i);
+        return sum;
+    };
+
+    BENCHMARK("Sequential GraphemeIterator walk (baseline)") {
+        uint32_t count = 0;
+        for (StringView cluster : text.Graphemes())
+            count += cluster.GetByteCount() > 0 ? 1 : 0;
+        return count;
+    };
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/List.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// List<T> shifting and growth. Trivially relocatable element
+// types (CodePoint, String) move with memmove; Boxed does not.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    // Not trivially relocatable: forces the element-by-element path
+    struct Boxed {
+        uint32_t v;
+        Boxed() : v(0) {}
+        Boxed(uint32_t x) : v(x) {}
+        Boxed(const Boxed& o) : v(o.v) {}
+        Boxed& operator=(const Boxed& o) { v = o.v; return *this; }
+        ~Boxed() {}
+        bool operator==(const Boxed& o) const { return v == o.v; }
+    };
+
+    template<typename T>
+    List<T> MakeList(uint32_t n) {
+        List<T> l(n);
+        for (uint32_t i = 0; i < n; ++i) l.Add(T(i));
+        return l;
+    }
+}
+
+TEST_CASE("List - Insert/RemoveAt in the middle", "[.][benchmark][List]") {
+    constexpr uint32_t N = 1000000;
+
+    List<CodePoint> cps = MakeList<CodePoint>(N);
+    List<Boxed> boxed = MakeList<Boxed>(N);
+
+    BENCHMARK("List<CodePoint> Insert+RemoveAt middle (1M)") {
+        cps.Insert(N / 2, CodePoint(0x41));
+        return cps.RemoveAt(N / 2);
+    };
+
+    BENCHMARK("List<Boxed> Insert+RemoveAt middle (1M)") {
+        boxed.Insert(N / 2, Boxed(0x41));
+        return boxed.RemoveAt(N / 2);
+    };
+
+    List<CodePoint> chunk = MakeList<CodePoint>(64);
+
+    BENCHMARK("List<CodePoint> InsertRange+RemoveRange 64 middle (1M)") {
+        cps.InsertRange(N / 2, chunk);
+        cps.RemoveRange(N / 2, 64);
+        return cps.Count();
+    };
+}
+
+TEST_CASE("List - growth", "[.][benchmark][List]") {
+    BENCHMARK("List<CodePoint> Add 1M") {
+        List<CodePoint> l;
+        for (uint32_t i = 0; i < 1000000; ++i) l.Add(CodePoint(i & 0xFFFF));
+        return l.Count();
+    };
+
+    String s = String("a string long enough to live on the heap");
+
+    BENCHMARK("List<String> Add 100k") {
+        List<String> l;
+        for (uint32_t i = 0; i < 100000; ++i) l.Add(s);
+        return l.Count();
+    };
+}
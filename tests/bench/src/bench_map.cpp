@@ -0,0 +1,228 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/Dictionary.hpp"
+#include "System/Collections/List.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ------------------------------------------------------------
+// Map<K, V> against the previous table (per-entry occupied and
+// tombstone flags, modulo probing), kept here as LegacyMap.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    template<typename K, typename V>
+    class LegacyMap
+    {
+    public:
+
+        LegacyMap() : _capacity(MAP_INITIAL_CAPACITY), _count(0)
+        {
+            _entries = static_cast<Entry*>(Memory::AllocZeroed(sizeof(Entry) * _capacity).Get());
+        }
+
+        ~LegacyMap()
+        {
+            Memory::Free(Pointer(_entries));
+        }
+
+        bool Insert(const K& key, const V& value)
+        {
+            if ((_count + 1) > (uint64_t)(_capacity * 0.70f))
+                Rehash(_capacity * 2);
+
+            uint32_t hash = Hash(key);
+            for (uint64_t i = 0; i < _capacity; ++i)
+            {
+                Entry& e = _entries[(hash + i) % _capacity];
+                if (!e.occupied || e.tombstone)
+                {
+                    e.key = key; e.value = value; e.hash = hash;
+                    e.occupied = true; e.tombstone = false;
+                    ++_count;
+                    return true;
+                }
+                if (e.hash == hash && e.key == key)
+                {
+                    e.value = value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        V* Find(const K& key)
+        {
+            uint32_t hash = Hash(key);
+            for (uint64_t i = 0; i < _capacity; ++i)
+            {
+                Entry& e = _entries[(hash + i) % _capacity];
+                if (!e.occupied) return nullptr;
+                if (!e.tombstone && e.hash == hash && e.key == key) return &e.value;
+            }
+            return nullptr;
+        }
+
+        bool Remove(const K& key)
+        {
+            uint32_t hash = Hash(key);
+            for (uint64_t i = 0; i < _capacity; ++i)
+            {
+                Entry& e = _entries[(hash + i) % _capacity];
+                if (!e.occupied) return false;
+                if (!e.tombstone && e.hash == hash && e.key == key)
+                {
+                    e.tombstone = true;
+                    --_count;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+
+        struct Entry { K key; V value; uint32_t hash; bool occupied; bool tombstone; };
+
+        void Rehash(uint64_t newCapacity)
+        {
+            Entry* old = _entries;
+            uint64_t oldCap = _capacity;
+            _entries = static_cast<Entry*>(Memory::AllocZeroed(sizeof(Entry) * newCapacity).Get());
+            _capacity = newCapacity;
+            _count = 0;
+            for (uint64_t i = 0; i < oldCap; ++i)
+                if (old[i].occupied && !old[i].tombstone)
+                    Insert(old[i].key, old[i].value);
+            Memory::Free(Pointer(old));
+        }
+
+        Entry* _entries;
+        uint64_t _capacity;
+        uint64_t _count;
+    };
+
+    constexpr uint32_t N = 100000;
+
+    // Scatters sequential indices so neither table gets sorted input
+    inline u32 KeyOf(uint32_t i) { return u32(i * 2654435761u); }
+}
+
+TEST_CASE("Map - insert", "[.][benchmark][Map]") {
+    BENCHMARK("Map<u32,u32> Insert 100k") {
+        Map<u32, u32> m;
+        for (uint32_t i = 0; i < N; ++i) m.Insert(KeyOf(i), u32(i));
+        return m.Count();
+    };
+
+    BENCHMARK("LegacyMap<u32,u32> Insert 100k") {
+        LegacyMap<u32, u32> m;
+        for (uint32_t i = 0; i < N; ++i) m.Insert(KeyOf(i), u32(i));
+        return m.Find(KeyOf(0)) != nullptr;
+    };
+}
+
+TEST_CASE("Map - lookup", "[.][benchmark][Map]") {
+    Map<u32, u32> map;
+    LegacyMap<u32, u32> legacy;
+    for (uint32_t i = 0; i < N; ++i) { map.Insert(KeyOf(i), u32(i)); legacy.Insert(KeyOf(i), u32(i)); }
+
+    BENCHMARK("Map<u32,u32> Find hit 100k") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < N; ++i) sum += (uint32_t)*map.Find(KeyOf(i));
+        return sum;
+    };
+
+    BENCHMARK("LegacyMap<u32,u32> Find hit 100k") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < N; ++i) sum += (uint32_t)*legacy.Find(KeyOf(i));
+        return sum;
+    };
+
+    BENCHMARK("Map<u32,u32> Find miss 100k") {
+        uint64_t hits = 0;
+        for (uint32_t i = N; i < 2 * N; ++i) hits += map.Find(KeyOf(i)) != nullptr;
+        return hits;
+    };
+
+    BENCHMARK("LegacyMap<u32,u32> Find miss 100k") {
+        uint64_t hits = 0;
+        for (uint32_t i = N; i < 2 * N; ++i) hits += legacy.Find(KeyOf(i)) != nullptr;
+        return hits;
+    };
+}
+
+TEST_CASE("Map - remove churn", "[.][benchmark][Map]") {
+    // Sliding window of live keys: the legacy table accumulates
+    // tombstones, the new one shifts entries back instead.
+    BENCHMARK("Map<u32,u32> Remove+Insert window 100k") {
+        Map<u32, u32> m;
+        for (uint32_t i = 0; i < N / 4; ++i) m.Insert(KeyOf(i), u32(i));
+        for (uint32_t i = N / 4; i < N; ++i) { m.Remove(KeyOf(i - N / 4)); m.Insert(KeyOf(i), u32(i)); }
+        return m.Count();
+    };
+
+    BENCHMARK("LegacyMap<u32,u32> Remove+Insert window 100k") {
+        LegacyMap<u32, u32> m;
+        for (uint32_t i = 0; i < N / 4; ++i) m.Insert(KeyOf(i), u32(i));
+        for (uint32_t i = N / 4; i < N; ++i) { m.Remove(KeyOf(i - N / 4)); m.Insert(KeyOf(i), u32(i)); }
+        return m.Find(KeyOf(N - 1)) != nullptr;
+    };
+}
+
+TEST_CASE("Map - String keys", "[.][benchmark][Map]") {
+    List<String> keys;
+    for (uint32_t i = 0; i < 10000; ++i) keys.Add(u32(i).ToString());
+
+    Map<String, u32> m;
+    for (uint32_t i = 0; i < keys.Count(); ++i) m.Insert(keys[i], u32(i));
+
+    BENCHMARK("Map<String,u32> Find hit 10k") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < keys.Count(); ++i) sum += (uint32_t)*m.Find(keys[i]);
+        return sum;
+    };
+}
+
+TEST_CASE("Map - String lookup from a byte buffer", "[.][benchmark][Map]") {
+    // symbol table probed with keys sliced out of an input buffer
+    const char* input = "identifier_alpha identifier_beta identifier_gamma identifier_delta";
+    const StringView words[] = {
+        StringView(input, 16), StringView(input + 17, 15),
+        StringView(input + 33, 16), StringView(input + 50, 16)
+    };
+
+    Map<String, u32> symbols;
+    for (uint32_t i = 0; i < 4; ++i) symbols.Insert(String(words[i].GetData(), words[i].GetByteCount()), u32(i));
+
+    Map<String, u32> scopes[3];
+    for (auto& scope : scopes) scope.Insert(String("identifier_gamma"), 1u);
+
+    BENCHMARK("Find via temporary String 4x10k") {
+        uint64_t sum = 0;
+        for (uint32_t n = 0; n < 10000; ++n)
+            for (const auto& w : words) sum += (uint32_t)*symbols.Find(String(w.GetData(), w.GetByteCount()));
+        return sum;
+    };
+
+    BENCHMARK("Find via StringView 4x10k") {
+        uint64_t sum = 0;
+        for (uint32_t n = 0; n < 10000; ++n)
+            for (const auto& w : words) sum += (uint32_t)*symbols.Find(w);
+        return sum;
+    };
+
+    BENCHMARK("FindWithHash across 3 scopes 10k") {
+        uint64_t hits = 0;
+        for (uint32_t n = 0; n < 10000; ++n)
+        {
+            u32 hash = Hash(words[2]);
+            for (auto& scope : scopes) hits += scope.FindWithHash(words[2], hash) != nullptr;
+        }
+        return hits;
+    };
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Memory.hpp"
+
+#include <cstdlib>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+// ------------------------------------------------------------
+// Memory::Alloc/Free vs the previous one-mapping-per-call path
+// and the CRT malloc/free. Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    // Replica of the old Memory::Alloc/Free (one OS mapping per allocation)
+    void* LegacyAlloc(size_t size)
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+#endif
+    }
+
+    void LegacyFree(void* p, size_t size)
+    {
+#if defined(_WIN32)
+        (void)size;
+        VirtualFree(p, 0, MEM_RELEASE);
+#else
+        munmap(p, size);
+#endif
+    }
+
+    constexpr int BENCH_BATCH = 256;
+
+    // Deterministic mix of small sizes (8..1024 bytes)
+    size_t MixedSize(int i)
+    {
+        return (size_t)(8 + ((i * 2654435761u) >> 7) % 1017);
+    }
+}
+
+TEST_CASE("Memory - Alloc/Free throughput", "[.][benchmark][Memory]") {
+    void* slots[BENCH_BATCH];
+
+    for (size_t size : { (size_t)16, (size_t)64, (size_t)512 }) {
+        BENCHMARK("Memory::Alloc/Free " + std::to_string(size) + "B x256") {
+            for (int i = 0; i < BENCH_BATCH; ++i) slots[i] = Memory::Alloc(size).Get();
+            for (int i = 0; i < BENCH_BATCH; ++i) Memory::Free(Pointer(slots[i]));
+            return slots[0];
+        };
+
+        BENCHMARK("malloc/free " + std::to_string(size) + "B x256") {
+            for (int i = 0; i < BENCH_BATCH; ++i) slots[i] = malloc(size);
+            for (int i = 0; i < BENCH_BATCH; ++i) free(slots[i]);
+            return slots[0];
+        };
+
+        BENCHMARK("legacy mmap " + std::to_string(size) + "B x256") {
+            for (int i = 0; i < BENCH_BATCH; ++i) slots[i] = LegacyAlloc(size);
+            for (int i = 0; i < BENCH_BATCH; ++i) LegacyFree(slots[i], size);
+            return slots[0];
+        };
+    }
+
+    BENCHMARK("Memory::Alloc/Free mixed x256") {
+        for (int i = 0; i < BENCH_BATCH; ++i) slots[i] = Memory::Alloc(MixedSize(i)).Get();
+        for (int i = 0; i < BENCH_BATCH; ++i) Memory::Free(Pointer(slots[i]));
+        return slots[0];
+    };
+
+    BENCHMARK("malloc/free mixed x256") {
+        for (int i = 0; i < BENCH_BATCH; ++i) slots[i] = malloc(MixedSize(i));
+        for (int i = 0; i < BENCH_BATCH; ++i) free(slots[i]);
+        return slots[0];
+    };
+}
+
+TEST_CASE("Memory - Realloc growth", "[.][benchmark][Memory]") {
+    BENCHMARK("Memory::Realloc 16B -> 64KiB doubling") {
+        Pointer p = Memory::Alloc(16);
+        for (uint64_t n = 32; n <= 65536; n *= 2) p = Memory::Realloc(p, n);
+        Memory::Free(p);
+        return p.IsNull();
+    };
+
+    BENCHMARK("realloc 16B -> 64KiB doubling") {
+        void* p = malloc(16);
+        for (size_t n = 32; n <= 65536; n *= 2) p = realloc(p, n);
+        free(p);
+        return p == nullptr;
+    };
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/UTF8.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Normalization of ~1 MB of accented text that is already NFC,
+// and of the same text with one decomposed letter per line.
+// The quick check only scans the first; in the second only the
+// segments around U+0301 are rewritten. The whole text through
+// decode / decompose / reorder / compose (what IsNormalized and
+// Normalize did for every call) is the baseline.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    String Repeat(const String& line, uint32_t bytes)
+    {
+        String text;
+        while (text.GetByteCount() < bytes)
+            text += line;
+        return text;
+    }
+
+    uint64_t FullPipeline(const String& text)
+    {
+        List<CodePoint> cps;
+        List<CodePoint> normalized;
+        UTF8::Decode(static_cast<const Char*>(text), text.GetByteCount(), cps);
+        UTF8::Normalize(cps, NormalizationForm::NFC, normalized);
+        return normalized.Count();
+    }
+}
+
+TEST_CASE("Normalization - quick check and segments", "[.][benchmark][Normalization][String]") {
+    const String nfc = Repeat(String(u8"L'\u00E9l\u00E8ve na\u00EFf lit \u00E0 la for\u00EAt, \u4E2D\u6587 ok.\n"), 1u << 20);
+    const String mixed = Repeat(String(u8"L'e\u0301l\u00E8ve na\u00EFf lit \u00E0 la for\u00EAt, \u4E2D\u6587 ok.\n"), 1u << 20);
+
+    REQUIRE(nfc.IsNormalized());
+    REQUIRE(mixed.Normalize().Equals(nfc));
+
+    BENCHMARK("IsNormalized, 1 MB NFC") {
+        return nfc.IsNormalized();
+    };
+
+    BENCHMARK("Normalize, 1 MB NFC (returned as is)") {
+        return nfc.Normalize().GetByteCount();
+    };
+
+    BENCHMARK("Normalize, 1 MB with one decomposed letter per line") {
+        return mixed.Normalize().GetByteCount();
+    };
+
+    BENCHMARK("whole text decode + normalize, 1 MB (baseline)") {
+        return FullPipeline(nfc);
+    };
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/NumberFormat.hpp"
+#include "System/Text/StringBuilder.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// ------------------------------------------------------------
+// Numbers to text: NumberFormat::TryFormat against snprintf
+// ("%llu" for integers, "%.17g" for doubles, the precision that
+// round trips), and a StringBuilder report of numbers, which
+// formats straight into the builder.
+// Values per second from a timed pass reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t ValueCount = 1u << 16;
+
+    std::vector<uint64_t> Integers()
+    {
+        std::mt19937_64 rng(11);
+        std::vector<uint64_t> values(ValueCount);
+        for (auto& v : values)
+            v = rng() >> (rng() % 64);     // every digit count
+        return values;
+    }
+
+    std::vector<double> Doubles()
+    {
+        std::mt19937_64 rng(12);
+        std::vector<double> values(ValueCount);
+        for (auto& v : values)
+        {
+            // finite values across the whole exponent range
+            uint64_t bits = rng() & ~(0x7FFull << 52);
+            bits |= (rng() % 0x7FFull) << 52;
+            std::memcpy(&v, &bits, sizeof(v));
+        }
+        return values;
+    }
+
+    template<typename T>
+    uint64_t FormatAll(const std::vector<T>& values)
+    {
+        Char buf[NumberFormat::MaxChars];
+        uint64_t total = 0;
+        for (const T v : values)
+        {
+            u32 n;
+            NumberFormat::TryFormat(v, buf, NumberFormat::MaxChars, n);
+            total += (uint32_t)n;
+        }
+        return total;
+    }
+
+    uint64_t PrintAll(const std::vector<uint64_t>& values)
+    {
+        char buf[32];
+        uint64_t total = 0;
+        for (const uint64_t v : values)
+            total += (uint64_t)std::snprintf(buf, sizeof(buf), "%llu", (unsigned long long)v);
+        return total;
+    }
+
+    uint64_t PrintAll(const std::vector<double>& values)
+    {
+        char buf[32];
+        uint64_t total = 0;
+        for (const double v : values)
+            total += (uint64_t)std::snprintf(buf, sizeof(buf), "%.17g", v);
+        return total;
+    }
+
+    template<typename F>
+    double ValuesPerSecond(uint32_t values, F&& format)
+    {
+        constexpr uint32_t Passes = 8;
+        volatile uint64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Passes; ++i)
+            sink = sink + format();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)values * Passes / seconds;
+    }
+}
+
+TEST_CASE("NumberFormat - throughput", "[.][benchmark][NumberFormat]") {
+    const std::vector<uint64_t> integers = Integers();
+    const std::vector<double> doubles = Doubles();
+
+    WARN("uint64 values/s: TryFormat " << ValuesPerSecond(ValueCount, [&] { return FormatAll(integers); })
+        << ", snprintf " << ValuesPerSecond(ValueCount, [&] { return PrintAll(integers); }));
+    WARN("double values/s: TryFormat " << ValuesPerSecond(ValueCount, [&] { return FormatAll(doubles); })
+        << ", snprintf %.17g " << ValuesPerSecond(ValueCount, [&] { return PrintAll(doubles); }));
+
+    BENCHMARK("TryFormat uint64, 64K values") {
+        return FormatAll(integers);
+    };
+
+    BENCHMARK("snprintf %llu, 64K values") {
+        return PrintAll(integers);
+    };
+
+    BENCHMARK("TryFormat double, 64K values") {
+        return FormatAll(doubles);
+    };
+
+    BENCHMARK("snprintf %.17g, 64K values") {
+        return PrintAll(doubles);
+    };
+
+    BENCHMARK("Double::ToString, 64K values") {
+        uint64_t total = 0;
+        for (const double v : doubles)
+            total += Double(v).ToString().GetByteCount();
+        return total;
+    };
+
+    BENCHMARK("StringBuilder AppendFormatted, 64K rows") {
+        StringBuilder sb;
+        for (uint32_t i = 0; i < ValueCount; ++i)
+            sb.AppendFormatted(integers[i]).Append(Char(';')).AppendFormatted(doubles[i]).AppendLine();
+        return sb.GetByteCount();
+    };
+}
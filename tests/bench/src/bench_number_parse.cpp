@@ -0,0 +1,149 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/NumberParse.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// ------------------------------------------------------------
+// Text to numbers: NumberParse::Parse against strtoll / strtod
+// over a CSV-like feed (an integer id and a price with a few
+// decimals per row, plus full 17-digit doubles), and the
+// wrappers' TryParse over StringView slices of one String.
+// strtod needs a terminated copy of each field; Parse reads the
+// field in place.
+// Fields per second from a timed pass reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t RowCount = 1u << 16;
+
+    struct Feed
+    {
+        std::string Text;
+        std::vector<uint32_t> Offsets;     // field start, then length
+    };
+
+    Feed MakeFeed(bool fullDoubles)
+    {
+        std::mt19937_64 rng(fullDoubles ? 14 : 13);
+        std::uniform_real_distribution<double> prices(0.0, 10000.0);
+        std::uniform_real_distribution<double> any(-1e300, 1e300);
+        Feed feed;
+        char buf[64];
+        for (uint32_t i = 0; i < RowCount; ++i)
+        {
+            const int n = std::snprintf(buf, sizeof(buf), "%lld", (long long)(rng() >> (rng() % 64)) - (long long)(1ll << 40));
+            feed.Offsets.push_back((uint32_t)feed.Text.size());
+            feed.Offsets.push_back((uint32_t)n);
+            feed.Text.append(buf, (size_t)n).push_back(',');
+
+            const int m = fullDoubles
+                ? std::snprintf(buf, sizeof(buf), "%.17g", any(rng))
+                : std::snprintf(buf, sizeof(buf), "%.2f", prices(rng));
+            feed.Offsets.push_back((uint32_t)feed.Text.size());
+            feed.Offsets.push_back((uint32_t)m);
+            feed.Text.append(buf, (size_t)m).push_back('\n');
+        }
+        return feed;
+    }
+
+    uint64_t ParseAll(const Feed& feed)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < feed.Offsets.size(); i += 4)
+        {
+            int64_t id = 0;
+            double price = 0;
+            NumberParse::Parse(feed.Text.data() + feed.Offsets[i], feed.Offsets[i + 1], id);
+            NumberParse::Parse(feed.Text.data() + feed.Offsets[i + 2], feed.Offsets[i + 3], price);
+            sum += (uint64_t)id + (uint64_t)(int64_t)price;
+        }
+        return sum;
+    }
+
+    uint64_t StrtodAll(const Feed& feed)
+    {
+        char field[64];
+        uint64_t sum = 0;
+        for (size_t i = 0; i < feed.Offsets.size(); i += 4)
+        {
+            std::memcpy(field, feed.Text.data() + feed.Offsets[i], feed.Offsets[i + 1]);
+            field[feed.Offsets[i + 1]] = '\0';
+            const long long id = std::strtoll(field, nullptr, 10);
+
+            std::memcpy(field, feed.Text.data() + feed.Offsets[i + 2], feed.Offsets[i + 3]);
+            field[feed.Offsets[i + 3]] = '\0';
+            const double price = std::strtod(field, nullptr);
+
+            sum += (uint64_t)id + (uint64_t)(int64_t)price;
+        }
+        return sum;
+    }
+
+    template<typename F>
+    double FieldsPerSecond(uint32_t fields, F&& parse)
+    {
+        constexpr uint32_t Passes = 8;
+        volatile uint64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Passes; ++i)
+            sink = sink + parse();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)fields * Passes / seconds;
+    }
+}
+
+TEST_CASE("NumberParse - throughput", "[.][benchmark][NumberParse]") {
+    const Feed prices = MakeFeed(false);
+    const Feed doubles = MakeFeed(true);
+
+    WARN("id,price fields/s: Parse " << FieldsPerSecond(RowCount * 2, [&] { return ParseAll(prices); })
+        << ", strtoll/strtod " << FieldsPerSecond(RowCount * 2, [&] { return StrtodAll(prices); }));
+    WARN("id,%.17g fields/s: Parse " << FieldsPerSecond(RowCount * 2, [&] { return ParseAll(doubles); })
+        << ", strtoll/strtod " << FieldsPerSecond(RowCount * 2, [&] { return StrtodAll(doubles); }));
+
+    BENCHMARK("Parse id,price, 64K rows") {
+        return ParseAll(prices);
+    };
+
+    BENCHMARK("strtoll/strtod id,price, 64K rows") {
+        return StrtodAll(prices);
+    };
+
+    BENCHMARK("Parse id,%.17g, 64K rows") {
+        return ParseAll(doubles);
+    };
+
+    BENCHMARK("strtoll/strtod id,%.17g, 64K rows") {
+        return StrtodAll(doubles);
+    };
+
+    BENCHMARK("Int64/Double TryParse over StringView slices, 64K rows") {
+        const String text(prices.Text.data(), (uint32_t)prices.Text.size());
+        const StringView view(text);
+        uint64_t sum = 0;
+        for (size_t i = 0; i < prices.Offsets.size(); i += 4)
+        {
+            Int64 id;
+            Double price;
+            Int64::TryParse(view.Slice(prices.Offsets[i], prices.Offsets[i + 1]), id);
+            Double::TryParse(view.Slice(prices.Offsets[i + 2], prices.Offsets[i + 3]), price);
+            sum += (uint64_t)(int64_t)id + (uint64_t)(int64_t)(double)price;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/Dictionary.hpp"
+#include "System/Collections/HashSet.hpp"
+#include "System/Collections/SmallSet.hpp"
+
+// ------------------------------------------------------------
+// Set emulated with Map<K, Boolean> against HashSet<T>, and the
+// common tiny set (< 8 values) against SmallSet<T>.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+TEST_CASE("HashSet - against Map<K,Boolean>", "[.][benchmark][HashSet]") {
+    constexpr uint32_t N = 100000;
+
+    BENCHMARK("Map<u64,Boolean> add + contains 100k") {
+        Map<u64, Boolean> m;
+        for (uint32_t i = 0; i < N; ++i) m.Insert(u64(i * 7ull), true);
+        uint64_t hits = 0;
+        for (uint32_t i = 0; i < N; ++i) hits += m.Contains(u64(i)) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK("HashSet<u64> add + contains 100k") {
+        HashSet<u64> s;
+        for (uint32_t i = 0; i < N; ++i) s.Add(u64(i * 7ull));
+        uint64_t hits = 0;
+        for (uint32_t i = 0; i < N; ++i) hits += s.Contains(u64(i)) ? 1 : 0;
+        return hits;
+    };
+}
+
+TEST_CASE("SmallSet - tiny sets", "[.][benchmark][SmallSet]") {
+    constexpr uint32_t Sets = 10000;
+
+    BENCHMARK("HashSet<u32> 10k sets of 6") {
+        uint64_t hits = 0;
+        for (uint32_t n = 0; n < Sets; ++n)
+        {
+            HashSet<u32> s;
+            for (uint32_t i = 0; i < 6; ++i) s.Add(u32(n + i));
+            hits += s.Contains(u32(n + 3)) ? 1 : 0;
+        }
+        return hits;
+    };
+
+    BENCHMARK("SmallSet<u32,8> 10k sets of 6") {
+        uint64_t hits = 0;
+        for (uint32_t n = 0; n < Sets; ++n)
+        {
+            SmallSet<u32, 8> s;
+            for (uint32_t i = 0; i < 6; ++i) s.Add(u32(n + i));
+            hits += s.Contains(u32(n + 3)) ? 1 : 0;
+        }
+        return hits;
+    };
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Memory.hpp"
+#include "System/Collections/List.hpp"
+#include "System/Collections/SmallList.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Many short lists (the shape of case mapping outputs and char
+// sets): List<T> against SmallList<T, N>. The heap allocations of
+// one pass are reported next to the timings.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    template<typename L>
+    uint64_t ShortLists(uint32_t lists, uint32_t length)
+    {
+        uint64_t sum = 0;
+        for (uint32_t n = 0; n < lists; ++n)
+        {
+            L l;
+            for (uint32_t i = 0; i < length; ++i) l.Add(CodePoint(n + i));
+            sum += (uint32_t)l[length - 1];
+        }
+        return sum;
+    }
+
+    template<typename F>
+    u64 CountAllocations(F&& run)
+    {
+        const u64 before = Memory::GetThreadAllocationCount();
+        run();
+        return Memory::GetThreadAllocationCount() - before;
+    }
+}
+
+TEST_CASE("SmallList - short lists", "[.][benchmark][SmallList]") {
+    constexpr uint32_t Lists = 100000;
+
+    WARN("heap allocations, 100k lists of 3: List " << (uint64_t)CountAllocations([] { ShortLists<List<CodePoint>>(Lists, 3); })
+        << ", SmallList<4> " << (uint64_t)CountAllocations([] { ShortLists<SmallList<CodePoint, 4>>(Lists, 3); }));
+
+    BENCHMARK("List<CodePoint> 100k lists of 3") {
+        return ShortLists<List<CodePoint>>(Lists, 3);
+    };
+
+    BENCHMARK("SmallList<CodePoint,4> 100k lists of 3") {
+        return ShortLists<SmallList<CodePoint, 4>>(Lists, 3);
+    };
+
+    // past N: one allocation, like List's first one
+    BENCHMARK("SmallList<CodePoint,4> 100k lists of 12 (spilled)") {
+        return ShortLists<SmallList<CodePoint, 4>>(Lists, 12);
+    };
+}
+
+TEST_CASE("SmallList - String case mapping", "[.][benchmark][SmallList][String]") {
+    String s;
+    for (uint32_t i = 0; i < 256; ++i) s = s + String(u8"éaß");
+
+    WARN("heap allocations, ToUpper of 768 code points: " << (uint64_t)CountAllocations([&] { s.ToUpper(); }));
+
+    BENCHMARK("String::ToUpper 768 non-ASCII code points") {
+        return s.ToUpper().GetByteCount();
+    };
+}
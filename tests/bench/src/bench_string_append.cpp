@@ -0,0 +1,153 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/StringBuilder.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/IO/Stream.hpp"
+
+#include <chrono>
+
+// ------------------------------------------------------------
+// Building a report out of many small fragments: String +=
+// (appends in place into a block with room to grow) against a
+// fresh Concat per fragment (what += did before), and a
+// StringBuilder whose ToString hands its block over. For large
+// outputs, the contiguous builder against the chunked one, and
+// WriteTo against ToString plus one Write.
+// Fragments per second from a timed pass reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t FragmentCount = 7;
+
+    const String& Fragment(uint32_t i)
+    {
+        static const String fragments[FragmentCount] = {
+            String("<tr><td>"), String("order-20240105"), String("</td><td>"),
+            String(u8"caf\u00E9 au lait"), String("</td><td>"), String("12.50"), String("</td></tr>\n"),
+        };
+        return fragments[i % FragmentCount];
+    }
+
+    template<typename F>
+    double FragmentsPerSecond(uint32_t fragments, F&& build)
+    {
+        volatile uint64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        sink = sink + (uint64_t)build(fragments);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)fragments / seconds;
+    }
+
+    uint64_t BuildWithAppend(uint32_t fragments)
+    {
+        String s;
+        for (uint32_t i = 0; i < fragments; ++i)
+            s += Fragment(i);
+        return s.GetByteCount();
+    }
+
+    uint64_t BuildWithConcat(uint32_t fragments)
+    {
+        String s;
+        for (uint32_t i = 0; i < fragments; ++i)
+            s = String::Concat(s, Fragment(i));
+        return s.GetByteCount();
+    }
+
+    uint64_t BuildWithBuilder(uint32_t fragments)
+    {
+        StringBuilder sb;
+        for (uint32_t i = 0; i < fragments; ++i)
+            sb.Append(Fragment(i));
+        return sb.ToString().GetByteCount();
+    }
+
+    void Fill(StringBuilder& sb, uint32_t rows)
+    {
+        for (uint32_t i = 0; i < rows; ++i)
+        {
+            sb.Append(Fragment(0)).AppendFormatted(i).Append(Fragment(2));
+            sb.Append(Fragment(3)).Append(Fragment(4)).AppendFormatted(i * 0.25).Append(Fragment(6));
+        }
+    }
+
+    // Counts what it is given, like a file that is never read back
+    class NullStream : public Stream
+    {
+    public:
+        size_type Read(Byte*, size_type) noexcept override { return 0; }
+        size_type Write(const Byte*, size_type count) noexcept override { return count; }
+        void Flush() noexcept override {}
+        bool CanRead() const noexcept override { return false; }
+        bool CanWrite() const noexcept override { return true; }
+    };
+}
+
+TEST_CASE("String - appending fragments", "[.][benchmark][String][StringBuilder]") {
+    REQUIRE(BuildWithAppend(7000) == BuildWithConcat(7000));
+    REQUIRE(BuildWithAppend(7000) == BuildWithBuilder(7000));
+
+    // Concat per fragment is quadratic: it only gets the small run
+    WARN("20K fragments/s: += " << FragmentsPerSecond(20000, BuildWithAppend)
+        << ", Concat " << FragmentsPerSecond(20000, BuildWithConcat)
+        << ", StringBuilder " << FragmentsPerSecond(20000, BuildWithBuilder));
+    WARN("500K fragments/s: += " << FragmentsPerSecond(500000, BuildWithAppend)
+        << ", StringBuilder " << FragmentsPerSecond(500000, BuildWithBuilder));
+
+    BENCHMARK("String += 100K fragments") {
+        return BuildWithAppend(100000);
+    };
+
+    BENCHMARK("StringBuilder 100K fragments + ToString") {
+        return BuildWithBuilder(100000);
+    };
+
+    BENCHMARK("String::Concat per fragment, 10K fragments") {
+        return BuildWithConcat(10000);
+    };
+
+    // a large builder result: ToString shares the block instead of copying it
+    StringBuilder big;
+    for (uint32_t i = 0; i < 100000; ++i)
+        big.Append(Fragment(i));
+
+    BENCHMARK("StringBuilder ToString, 1 MB") {
+        return big.ToString().GetByteCount();
+    };
+}
+
+TEST_CASE("StringBuilder - large outputs", "[.][benchmark][StringBuilder]") {
+    // about 64 MB of table rows
+    constexpr uint32_t Rows = 1u << 20;
+
+    BENCHMARK("contiguous StringBuilder, 64 MB") {
+        StringBuilder sb;
+        Fill(sb, Rows);
+        return sb.GetByteCount();
+    };
+
+    BENCHMARK("chunked StringBuilder, 64 MB") {
+        StringBuilder sb(StringBuilderMode::Chunked);
+        Fill(sb, Rows);
+        return sb.GetByteCount();
+    };
+
+    StringBuilder chunked(StringBuilderMode::Chunked);
+    Fill(chunked, Rows);
+    NullStream out;
+
+    BENCHMARK("chunked WriteTo, 64 MB") {
+        return chunked.WriteTo(out);
+    };
+
+    BENCHMARK("chunked ToString + Write, 64 MB") {
+        const String flat = chunked.ToString();
+        return out.Write(reinterpret_cast<const Byte*>(static_cast<const Char*>(flat)), flat.GetByteCount());
+    };
+}
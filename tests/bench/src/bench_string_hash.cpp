@@ -0,0 +1,166 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/Dictionary.hpp"
+#include "System/Globals.hpp"
+#include "System/Marvin32.hpp"
+#include "System/WideHash.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// ------------------------------------------------------------
+// String hashing: Marvin32 against WideHash (portable, and AES
+// when the CPU has it).
+// Quality, reported with WARN: chi-square of sequential keys
+// ("key0", "key1", ...) over 2^16 buckets from the low and the
+// high bits (about 65535 expected, 66500+ is suspect), and the
+// worst single bit avalanche bias (0 ideal; ~0.1 is sampling
+// noise at this count).
+// Throughput: GB/s per input length, then Map<String, u32>
+// lookups with heap keys, whose hash the block now caches.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    using HashFunction = uint32_t(*)(const uint8_t*, size_t, uint64_t);
+
+    uint32_t HashMarvin(const uint8_t* p, size_t n, uint64_t seed) { return Marvin32::Compute(p, n, seed); }
+    uint32_t HashWidePortable(const uint8_t* p, size_t n, uint64_t seed) { return WideHash::Fold(WideHash::ComputePortable(p, n, seed)); }
+    uint32_t HashWideAES(const uint8_t* p, size_t n, uint64_t seed) { return WideHash::Fold(WideHash::ComputeAES(p, n, seed)); }
+
+    struct Candidate
+    {
+        const char* Name;
+        HashFunction Hash;
+    };
+
+    std::vector<Candidate> Candidates()
+    {
+        std::vector<Candidate> all = { { "Marvin32", HashMarvin }, { "WideHash portable", HashWidePortable } };
+        if (WideHash::IsAccelerated())
+            all.push_back({ "WideHash AES", HashWideAES });
+        return all;
+    }
+
+    double ChiSquare(HashFunction hash, uint32_t shift)
+    {
+        constexpr uint32_t Buckets = 1u << 16;
+        constexpr uint32_t Keys = Buckets * 16;
+        std::vector<uint32_t> counts(Buckets, 0);
+        char key[32];
+        for (uint32_t i = 0; i < Keys; ++i)
+        {
+            const int n = std::snprintf(key, sizeof(key), "key%u", i);
+            ++counts[(hash(reinterpret_cast<const uint8_t*>(key), (size_t)n, 0x1234) >> shift) & (Buckets - 1)];
+        }
+
+        const double expected = (double)Keys / Buckets;
+        double chi = 0;
+        for (const uint32_t c : counts)
+            chi += (c - expected) * (c - expected) / expected;
+        return chi;
+    }
+
+    double WorstAvalancheBias(HashFunction hash, size_t len)
+    {
+        constexpr uint32_t Trials = 2000;
+        std::mt19937_64 rng(len);
+        std::vector<uint8_t> bytes(len);
+        std::vector<uint32_t> flips(len * 8 * 32, 0);
+        for (uint32_t t = 0; t < Trials; ++t)
+        {
+            for (auto& b : bytes)
+                b = (uint8_t)rng();
+            const uint32_t h = hash(bytes.data(), len, t);
+            for (size_t bit = 0; bit < len * 8; ++bit)
+            {
+                bytes[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+                const uint32_t diff = h ^ hash(bytes.data(), len, t);
+                bytes[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+                for (uint32_t o = 0; o < 32; ++o)
+                    flips[bit * 32 + o] += (diff >> o) & 1;
+            }
+        }
+
+        double worst = 0;
+        for (const uint32_t f : flips)
+            worst = std::fmax(worst, std::fabs((double)f / Trials - 0.5) * 2);
+        return worst;
+    }
+
+    double GigabytesPerSecond(HashFunction hash, const std::vector<uint8_t>& data, size_t len)
+    {
+        const size_t calls = (size_t)(32u << 20) / len;
+        volatile uint32_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < calls; ++i)
+            sink = sink + hash(data.data() + (i * 64) % (data.size() - len), len, i);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)calls * len / seconds / 1e9;
+    }
+}
+
+TEST_CASE("String hash - quality", "[.][benchmark][StringHash]") {
+    for (const Candidate& c : Candidates())
+    {
+        WARN(c.Name << ": chi-square low bits " << ChiSquare(c.Hash, 0) << ", high bits " << ChiSquare(c.Hash, 16)
+            << "; worst avalanche bias at 4 / 16 / 40 bytes " << WorstAvalancheBias(c.Hash, 4)
+            << " / " << WorstAvalancheBias(c.Hash, 16) << " / " << WorstAvalancheBias(c.Hash, 40));
+    }
+}
+
+TEST_CASE("String hash - throughput", "[.][benchmark][StringHash]") {
+    std::mt19937_64 rng(31);
+    std::vector<uint8_t> data(1u << 20);
+    for (auto& b : data)
+        b = (uint8_t)rng();
+
+    for (const Candidate& c : Candidates())
+    {
+        WARN(c.Name << " GB/s at 8 / 32 / 256 / 4096 bytes: " << GigabytesPerSecond(c.Hash, data, 8)
+            << " / " << GigabytesPerSecond(c.Hash, data, 32) << " / " << GigabytesPerSecond(c.Hash, data, 256)
+            << " / " << GigabytesPerSecond(c.Hash, data, 4096));
+    }
+
+    BENCHMARK("Marvin32, 1 MiB") {
+        return Marvin32::Compute(data.data(), data.size(), 1);
+    };
+
+    BENCHMARK("WideHash, 1 MiB") {
+        return WideHash::Compute(data.data(), data.size(), 1);
+    };
+
+    // heap keys: the first GetHashCode stores the hash in the block
+    constexpr uint32_t KeyCount = 4096;
+    List<String> keys(KeyCount);
+    Map<String, u32> map;
+    for (uint32_t i = 0; i < KeyCount; ++i)
+    {
+        keys.Add(String("bench.hash.component.identifier.") + u32(i).ToString());
+        map.Insert(keys[i], i);
+    }
+
+    BENCHMARK("Map<String, u32> lookups, cached hash") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < KeyCount; ++i)
+            sum += (uint32_t)*map.Find(keys[i]);
+        return sum;
+    };
+
+    BENCHMARK("Map<String, u32> lookups by StringView, hashed each time") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < KeyCount; ++i)
+            sum += (uint32_t)*map.Find(StringView(keys[i]));
+        return sum;
+    };
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/StringPool.hpp"
+#include "System/Collections/Dictionary.hpp"
+
+// ------------------------------------------------------------
+// Map<String, u32> lookups with 4096 identifier keys (~40 bytes,
+// heap blocks): separately built equal keys (hash cached in each
+// block after the first probe, memcmp per probe) against interned
+// keys (hash cached up front, identity compare).
+// Also reports the pool's memory counters with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t KeyCount = 4096;
+
+    String Identifier(uint32_t i)
+    {
+        return String("bench.pool.component.identifier.") + u32(i).ToString();
+    }
+}
+
+TEST_CASE("StringPool - Map lookups", "[.][benchmark][StringPool]") {
+    List<String> plain(KeyCount);
+    List<String> interned(KeyCount);
+    Map<String, u32> byPlain;
+    Map<String, u32> byInterned;
+
+    for (uint32_t i = 0; i < KeyCount; ++i)
+    {
+        plain.Add(Identifier(i));
+        interned.Add(StringPool::Intern(plain[i]));
+        byPlain.Insert(Identifier(i), i);
+        byInterned.Insert(interned[i], i);
+    }
+
+    BENCHMARK("plain keys") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < KeyCount; ++i)
+            sum += (uint32_t)*byPlain.Find(plain[i]);
+        return sum;
+    };
+
+    BENCHMARK("interned keys") {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < KeyCount; ++i)
+            sum += (uint32_t)*byInterned.Find(interned[i]);
+        return sum;
+    };
+
+    BENCHMARK("Intern hit") {
+        uint64_t bytes = 0;
+        for (uint32_t i = 0; i < KeyCount; ++i)
+            bytes += StringPool::Intern(plain[i]).GetByteCount();
+        return bytes;
+    };
+
+    const StringPool::Statistics stats = StringPool::GetStatistics();
+    WARN("pool: " << (uint64_t)stats.Strings << " strings, " << (uint64_t)stats.Hits << " hits of "
+        << (uint64_t)stats.Lookups << " lookups, " << (uint64_t)stats.BytesStored << " bytes stored, "
+        << (uint64_t)stats.BytesSaved << " bytes saved");
+}
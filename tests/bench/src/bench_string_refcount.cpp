@@ -0,0 +1,90 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+#include "System/Threading/Interlocked.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// Cost of atomic String reference counts. The counter alone: a
+// plain increment/decrement pair (the old non-atomic path) against
+// relaxed increment + release decrement. Then threads copying one
+// shared heap String, an immortal one, and deep copies (what had
+// to be done before to hand a String to another thread).
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t Copies = 1u << 20;
+
+    template<typename F>
+    void RunThreads(uint32_t threads, F&& work)
+    {
+        std::thread workers[64];
+        for (uint32_t t = 0; t < threads; ++t)
+            workers[t] = std::thread([&work, threads]() { work(Copies / threads); });
+        for (uint32_t t = 0; t < threads; ++t)
+            workers[t].join();
+    }
+}
+
+TEST_CASE("String - reference count operations", "[.][benchmark][String][refcount]") {
+    volatile uint32_t plain = 1;
+    volatile uint32_t atomic = 1;
+
+    BENCHMARK("plain u32 ++/-- 1M") {
+        for (uint32_t i = 0; i < Copies; ++i)
+        {
+            plain = plain + 1;
+            plain = plain - 1;
+        }
+        return plain;
+    };
+
+    BENCHMARK("Interlocked AddRelaxed/AddRelease 1M") {
+        for (uint32_t i = 0; i < Copies; ++i)
+        {
+            Interlocked::AddRelaxed(&atomic, 1u);
+            Interlocked::AddRelease(&atomic, 0u - 1u);
+        }
+        return atomic;
+    };
+}
+
+TEST_CASE("String - sharing between threads", "[.][benchmark][String][refcount]") {
+    const String shared("a string long enough to live in a refcounted heap block");
+    String immortal("another string long enough to live in a refcounted heap block");
+    immortal.MakeImmortal();
+
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    for (uint32_t threads = 1; threads <= 16 && threads <= (hardware ? hardware : 1); threads *= 2)
+    {
+        const std::string suffix = ", " + std::to_string(threads) + " threads";
+
+        BENCHMARK("shared String copy 1M" + suffix) {
+            RunThreads(threads, [&shared](uint32_t n) {
+                for (uint32_t i = 0; i < n; ++i) { String copy(shared); }
+            });
+            return shared.GetReferenceCount();
+        };
+
+        BENCHMARK("immortal String copy 1M" + suffix) {
+            RunThreads(threads, [&immortal](uint32_t n) {
+                for (uint32_t i = 0; i < n; ++i) { String copy(immortal); }
+            });
+            return immortal.GetReferenceCount();
+        };
+
+        BENCHMARK("deep String copy 1M" + suffix) {
+            RunThreads(threads, [&shared](uint32_t n) {
+                StringView view = shared;
+                for (uint32_t i = 0; i < n; ++i) { String copy(view.GetData(), view.GetByteCount()); }
+            });
+            return shared.GetReferenceCount();
+        };
+    }
+}
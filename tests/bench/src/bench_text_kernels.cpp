@@ -0,0 +1,104 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/UTF8.hpp"
+#include "System/Types/Text/String.hpp"
+
+#include <chrono>
+#include <string>
+
+// ------------------------------------------------------------
+// TextKernels throughput on a 4 MB payload, one BENCHMARK per
+// scan and implementation (scalar SWAR, SSE2, AVX2 when the CPU
+// has them), plus GB/s from a timed pass reported with WARN.
+// Payloads: pure ASCII, and mixed width UTF-8 (Latin, CJK, emoji).
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t PayloadBytes = 4u << 20;
+
+    List<uint8_t> Payload(const char* piece)
+    {
+        List<uint8_t> bytes(PayloadBytes);
+        while (bytes.Count() + 16 < PayloadBytes)
+        {
+            for (const char* p = piece; *p; ++p)
+                bytes.Add((uint8_t)*p);
+        }
+        return bytes;
+    }
+
+    const char* LevelName(TextKernels::Level level)
+    {
+        switch (level)
+        {
+        case TextKernels::Level::SSE2: return "SSE2";
+        case TextKernels::Level::AVX2: return "AVX2";
+        default: return "scalar";
+        }
+    }
+
+    template<typename F>
+    double GigabytesPerSecond(uint64_t bytes, F&& scan)
+    {
+        constexpr uint32_t Passes = 16;
+        volatile uint64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Passes; ++i)
+            sink = sink + (uint64_t)scan();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)bytes * Passes / seconds / 1e9;
+    }
+}
+
+TEST_CASE("TextKernels - throughput", "[.][benchmark][TextKernels]") {
+    const List<uint8_t> ascii = Payload("The quick brown fox jumps over the lazy dog. ");
+    const List<uint8_t> mixed = Payload("na\xC3\xAFve caf\xC3\xA9 \xE6\x96\x87\xE5\xAD\x97\xE5\x88\x97 \xF0\x9F\x98\x80 text ");
+
+    for (TextKernels::Level level : { TextKernels::Level::Scalar, TextKernels::Level::SSE2, TextKernels::Level::AVX2 })
+    {
+        const TextKernels::Kernels* k = TextKernels::ForLevel(level);
+        if (k == nullptr)
+            continue;
+
+        const std::string name = LevelName(level);
+
+        WARN(name << " GB/s: IsASCII " << GigabytesPerSecond(ascii.Count(), [&] { return k->IsASCII(ascii.Data(), ascii.Count()); })
+            << ", IsValidUTF8 ascii " << GigabytesPerSecond(ascii.Count(), [&] { return k->IsValidUTF8(ascii.Data(), ascii.Count()); })
+            << ", IsValidUTF8 mixed " << GigabytesPerSecond(mixed.Count(), [&] { return k->IsValidUTF8(mixed.Data(), mixed.Count()); })
+            << ", CountCodePoints mixed " << GigabytesPerSecond(mixed.Count(), [&] { return k->CountCodePoints(mixed.Data(), mixed.Count()); }));
+
+        BENCHMARK(name + " IsASCII 4 MB") {
+            return k->IsASCII(ascii.Data(), ascii.Count());
+        };
+
+        BENCHMARK(name + " IsValidUTF8 4 MB mixed") {
+            return k->IsValidUTF8(mixed.Data(), mixed.Count());
+        };
+
+        BENCHMARK(name + " CountCodePoints 4 MB mixed") {
+            return k->CountCodePoints(mixed.Data(), mixed.Count());
+        };
+    }
+}
+
+TEST_CASE("TextKernels - String ingest", "[.][benchmark][TextKernels][String]") {
+    const List<uint8_t> mixed = Payload("na\xC3\xAFve caf\xC3\xA9 \xE6\x96\x87\xE5\xAD\x97\xE5\x88\x97 \xF0\x9F\x98\x80 text ");
+
+    BENCHMARK("String from 4 MB UTF-8 + GetCodePointsCount") {
+        String s(reinterpret_cast<const char*>(mixed.Data()), (u32)mixed.Count());
+        return s.GetCodePointsCount();
+    };
+
+    BENCHMARK("UTF8::Decode 4 MB") {
+        List<CodePoint> cps;
+        UTF8::Decode(reinterpret_cast<const Char*>(mixed.Data()), (uint32_t)mixed.Count(), cps);
+        return cps.Count();
+    };
+}
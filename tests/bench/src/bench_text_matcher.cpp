@@ -0,0 +1,177 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextMatcher.hpp"
+#include "System/Types/Text/String.hpp"
+
+#include <chrono>
+#include <string>
+
+// ------------------------------------------------------------
+// TextMatcher on 4 MB of log lines, cut on a dozen delimiters:
+// the compiled matcher against one substring search per
+// delimiter at every cut (what Split did before), and a
+// character set against a per byte membership loop.
+// Tokens per second / GB/s from a timed pass reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t LogBytes = 4u << 20;
+
+    const char* const Delimiters[] = { " ", "[", "]", "(", ")", "=", ",", ";", ":", "\"", " => ", " | " };
+
+    std::string LogText()
+    {
+        std::string text;
+        text.reserve(LogBytes + 256);
+        for (uint32_t i = 0; text.size() < LogBytes; ++i)
+        {
+            text += "2024-01-05 10:22:";
+            text += std::to_string(i % 60);
+            text += " [worker-" + std::to_string(i % 8) + "] GET /api/v1/items?id=" + std::to_string(i);
+            text += " => 200 (" + std::to_string(i % 97) + "ms) | user=\"caf\xC3\xA9\"; region=eu, tags:a,b\n";
+        }
+        return text;
+    }
+
+    // One search per delimiter from the cut, keep the leftmost (longest on ties)
+    uint64_t CountTokensNaive(const std::string& text, const List<StringView>& delimiters)
+    {
+        const uint8_t* hay = reinterpret_cast<const uint8_t*>(text.data());
+        const uint64_t length = text.size();
+
+        uint64_t tokens = 0;
+        uint64_t pos = 0;
+        while (pos < length)
+        {
+            int64_t cut = -1;
+            uint32_t cutLength = 0;
+            for (const auto& d : delimiters)
+            {
+                const int64_t at = TextSearch::IndexOf(hay, length, reinterpret_cast<const uint8_t*>(d.GetData()), d.GetByteCount(), pos);
+                if (at >= 0 && (cut < 0 || at < cut || (at == cut && d.GetByteCount() > cutLength)))
+                {
+                    cut = at;
+                    cutLength = d.GetByteCount();
+                }
+            }
+            if (cut < 0)
+                break;
+            ++tokens;
+            pos = (uint64_t)cut + cutLength;
+        }
+        return tokens + 1;
+    }
+
+    uint64_t CountTokens(const std::string& text, const TextMatcher& matcher)
+    {
+        uint64_t tokens = 0;
+        uint32_t pos = 0;
+        TextMatcher::Match m;
+        while (matcher.Find(text.data(), (uint32_t)text.size(), pos, m))
+        {
+            ++tokens;
+            pos = m.Offset + m.Length;
+        }
+        return tokens + 1;
+    }
+
+    template<typename F>
+    double GigabytesPerSecond(uint64_t bytes, F&& scan)
+    {
+        constexpr uint32_t Passes = 4;
+        volatile uint64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Passes; ++i)
+            sink = sink + (uint64_t)scan();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)bytes * Passes / seconds / 1e9;
+    }
+}
+
+TEST_CASE("TextMatcher - log tokenizer throughput", "[.][benchmark][TextMatcher]") {
+    const std::string text = LogText();
+
+    List<StringView> delimiters;
+    for (const char* d : Delimiters)
+        delimiters.Add(StringView(d));
+    const TextMatcher matcher(delimiters);
+
+    REQUIRE(CountTokens(text, matcher) == CountTokensNaive(text, delimiters));
+
+    WARN("12 delimiters GB/s: TextMatcher " << GigabytesPerSecond(text.size(), [&] { return CountTokens(text, matcher); })
+        << ", one search per delimiter " << GigabytesPerSecond(text.size(), [&] { return CountTokensNaive(text, delimiters); }));
+
+    BENCHMARK("TextMatcher build, 12 delimiters") {
+        return TextMatcher(delimiters).GetMaxLength();
+    };
+
+    BENCHMARK("TextMatcher tokenize 4 MB") {
+        return CountTokens(text, matcher);
+    };
+
+    BENCHMARK("one search per delimiter, tokenize 4 MB") {
+        return CountTokensNaive(text, delimiters);
+    };
+
+    // String level: the same line through both Split overloads
+    const String line("2024-01-05 10:22:31 [worker-3] GET /api/v1/items?id=42 => 200 (12ms) | user=\"caf\xC3\xA9\"; region=eu, tags:a,b");
+    List<String> separators;
+    for (const char* d : Delimiters)
+        separators.Add(String(d));
+
+    BENCHMARK("String Split(List<String>), 12 delimiters") {
+        return line.Split(separators).Count();
+    };
+
+    BENCHMARK("String Split(TextMatcher), 12 delimiters") {
+        return line.Split(matcher).Count();
+    };
+}
+
+TEST_CASE("TextMatcher - character set throughput", "[.][benchmark][TextMatcher]") {
+    // no byte of the set in the text: every search covers it all
+    std::string text;
+    while (text.size() < LogBytes)
+        text += "The quick brown fox jumps over the lazy dog ";
+
+    List<Char> chars;
+    for (const char* c = "<>&'\"\\;#"; *c; ++c)
+        chars.Add(Char(*c));
+    const TextMatcher set(chars);
+
+    const uint8_t* hay = reinterpret_cast<const uint8_t*>(text.data());
+    auto naive = [&]
+    {
+        for (uint64_t i = 0; i < text.size(); ++i)
+        {
+            for (uint64_t k = 0; k < chars.Count(); ++k)
+            {
+                if (hay[i] == (unsigned char)chars[k])
+                    return (int64_t)i;
+            }
+        }
+        return (int64_t)-1;
+    };
+    auto compiled = [&]
+    {
+        TextMatcher::Match m;
+        return set.Find(text.data(), (uint32_t)text.size(), 0, m) ? (int64_t)m.Offset : (int64_t)-1;
+    };
+
+    WARN("8 chars GB/s: TextMatcher " << GigabytesPerSecond(text.size(), compiled)
+        << ", per byte loop " << GigabytesPerSecond(text.size(), naive));
+
+    BENCHMARK("TextMatcher IndexOfAny 8 chars, 4 MB") {
+        return compiled();
+    };
+
+    BENCHMARK("per byte loop IndexOfAny 8 chars, 4 MB") {
+        return naive();
+    };
+}
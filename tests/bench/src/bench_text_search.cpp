@@ -0,0 +1,135 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextSearch.hpp"
+#include "System/Types/Text/String.hpp"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+// ------------------------------------------------------------
+// TextSearch against a naive scan and std::string_view::find on
+// a 4 MB corpus: English-like ASCII, mixed width UTF-8, and an
+// all-'a' payload for the pathological needles ("aaa...ab",
+// periodic, single byte). Every needle is absent or sits at the
+// very end, so each search covers the whole corpus.
+// GB/s from a timed pass is reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t CorpusBytes = 4u << 20;
+
+    List<uint8_t> Corpus(const char* piece, const char* tail)
+    {
+        List<uint8_t> bytes(CorpusBytes + 64);
+        while (bytes.Count() + 64 < CorpusBytes)
+        {
+            for (const char* p = piece; *p; ++p)
+                bytes.Add((uint8_t)*p);
+        }
+        for (const char* p = tail; *p; ++p)
+            bytes.Add((uint8_t)*p);
+        return bytes;
+    }
+
+    int64_t NaiveIndexOf(const uint8_t* hay, uint64_t hayLength, const uint8_t* needle, uint64_t length)
+    {
+        for (uint64_t i = 0; i + length <= hayLength; ++i)
+        {
+            uint64_t k = 0;
+            while (k < length && hay[i + k] == needle[k]) ++k;
+            if (k == length)
+                return (int64_t)i;
+        }
+        return -1;
+    }
+
+    template<typename F>
+    double GigabytesPerSecond(uint64_t bytes, F&& search)
+    {
+        constexpr uint32_t Passes = 8;
+        volatile int64_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Passes; ++i)
+            sink = sink + search();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return (double)bytes * Passes / seconds / 1e9;
+    }
+
+    struct Case
+    {
+        const char* Name;
+        const List<uint8_t>* Hay;
+        std::string Needle;
+    };
+}
+
+TEST_CASE("TextSearch - throughput", "[.][benchmark][TextSearch]") {
+    const List<uint8_t> english = Corpus("The quick brown fox jumps over the lazy dog, then naps in the sun. ", "needle in a haystack");
+    const List<uint8_t> mixed = Corpus("na\xC3\xAFve caf\xC3\xA9 \xE6\x96\x87\xE5\xAD\x97\xE5\x88\x97 \xF0\x9F\x98\x80 text ", "\xE6\x96\x87\xE5\xAD\x97 end");
+    const List<uint8_t> run = Corpus("aaaaaaaaaaaaaaaa", "b");
+
+    const Case cases[] = {
+        { "english 1 byte", &english, "#" },
+        { "english short", &english, "haystack" },
+        { "english long", &english, "lazy dog, then naps in the shade of an old oak tree" },
+        { "mixed short", &mixed, "\xE6\x96\x87\xE5\xAD\x97 end" },
+        { "pathological a^15 b", &run, std::string(15, 'a') + "b" },
+        { "pathological a^31 b", &run, std::string(31, 'a') + "b" },
+        { "pathological a^200 b", &run, std::string(200, 'a') + "b" },
+        { "periodic (ab)^8 a", &run, "abababababababab" },
+    };
+
+    for (const Case& c : cases)
+    {
+        const uint8_t* hay = c.Hay->Data();
+        const uint64_t hayLength = c.Hay->Count();
+        const uint8_t* needle = reinterpret_cast<const uint8_t*>(c.Needle.data());
+        const uint64_t length = c.Needle.size();
+        const std::string_view view(reinterpret_cast<const char*>(hay), hayLength);
+        const TextSearch::Searcher searcher(needle, length);
+
+        REQUIRE(TextSearch::IndexOf(hay, hayLength, needle, length) == NaiveIndexOf(hay, hayLength, needle, length));
+
+        WARN(c.Name << " GB/s: TextSearch " << GigabytesPerSecond(hayLength, [&] { return TextSearch::IndexOf(hay, hayLength, needle, length); })
+            << ", Searcher " << GigabytesPerSecond(hayLength, [&] { return searcher.IndexOf(hay, hayLength); })
+            << ", naive " << GigabytesPerSecond(hayLength, [&] { return NaiveIndexOf(hay, hayLength, needle, length); })
+            << ", string_view::find " << GigabytesPerSecond(hayLength, [&] { return (int64_t)view.find(c.Needle); }));
+
+        BENCHMARK(std::string(c.Name) + " IndexOf") {
+            return TextSearch::IndexOf(hay, hayLength, needle, length);
+        };
+
+        BENCHMARK(std::string(c.Name) + " LastIndexOf") {
+            return TextSearch::LastIndexOf(hay, hayLength, needle, length);
+        };
+    }
+}
+
+TEST_CASE("String - search throughput", "[.][benchmark][TextSearch][String]") {
+    std::string text;
+    while (text.size() < (1u << 20))
+        text += "na\xC3\xAFve caf\xC3\xA9 \xE6\x96\x87\xE5\xAD\x97 \xF0\x9F\x98\x80 text ";
+
+    const String s(text.c_str());
+    const String needle("caf\xC3\xA9");
+    const String missing("caf\xC3\xA9!");
+
+    BENCHMARK("String IndexOf missing, 1 MB UTF-8") {
+        return s.IndexOf(missing);
+    };
+
+    BENCHMARK("String LastIndexOf, 1 MB UTF-8") {
+        return s.LastIndexOf(needle);
+    };
+
+    BENCHMARK("String Replace, 1 MB UTF-8") {
+        return s.Replace(needle, String("cafe")).GetLength();
+    };
+}
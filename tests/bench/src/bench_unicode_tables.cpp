@@ -0,0 +1,162 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/unicode/UnicodeCase_utils.hpp"
+#include "System/Text/unicode/UnicodeNormalization_utils.hpp"
+
+#include <chrono>
+
+// ------------------------------------------------------------
+// Per code point property lookups over 1M code points of mixed
+// scripts: the generated tries against the tables they replace
+// (binary search over LETTERS and CCC_RANGES, the range tests
+// GetGBP used to chain, binary search over COMPOSE_PAIRS).
+// Nanoseconds per code point from a timed pass reported with WARN.
+// Run with: DSCPP-Tests "[benchmark]"
+// ------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t Count = 1u << 20;
+
+    List<uint32_t> MixedCodePoints()
+    {
+        // Latin with marks, Greek, Cyrillic, Devanagari, CJK, Hangul, emoji
+        const uint32_t sample[] = {
+            'T', 'h', 'e', ' ', 0x00E9, 'e', 0x0301, 0x00F1, ' ', 0x03B1, 0x03CC, 0x0436, 0x0416, ' ',
+            0x0915, 0x093F, 0x0903, ' ', 0x4E2D, 0x6587, 0xAC00, 0x1100, 0x1161, ' ', 0x1F600, 0x1F3FB,
+            0x200D, 0x2764, 0x1F1E6, 0x0323, 0x0307, '\n',
+        };
+        List<uint32_t> cps(Count);
+        for (uint32_t i = 0; i < Count; ++i)
+            cps.Add(sample[(i * 7) % (sizeof(sample) / sizeof(sample[0]))]);
+        return cps;
+    }
+
+    // GetGBP as it was: one range test after another
+    UnicodeCase::GBP RangeChainGBP(uint32_t cp)
+    {
+        using UnicodeCase::GBP;
+        if (cp == 0x000D) return GBP::CR;
+        if (cp == 0x000A) return GBP::LF;
+        if (cp <= 0x001F || (cp >= 0x007F && cp <= 0x009F)) return GBP::Control;
+        if (cp == 0x200D) return GBP::ZWJ;
+        if ((cp >= 0x0300 && cp <= 0x036F) || (cp >= 0x1AB0 && cp <= 0x1AFF) || (cp >= 0x1DC0 && cp <= 0x1DFF) ||
+            (cp >= 0x20D0 && cp <= 0x20FF) || (cp >= 0xFE20 && cp <= 0xFE2F))
+            return GBP::Extend;
+        if (cp >= 0x1F3FB && cp <= 0x1F3FF) return GBP::Extend;
+        if (cp >= 0x1F1E6 && cp <= 0x1F1FF) return GBP::RegionalIndicator;
+        if (cp >= 0x0903 && cp <= 0x093B) return GBP::SpacingMark;
+        if (UnicodeCase::IsEmojiExtendedPictographic(cp)) return GBP::ExtendedPictographic;
+        return GBP::Other;
+    }
+
+    bool BinarySearchCompose(uint32_t a, uint32_t b, uint32_t& out)
+    {
+        using namespace UnicodeNormalization;
+        const uint64_t key = ((uint64_t)a << 32) | b;
+        int lo = 0, hi = (int)COMPOSE_COUNT - 1;
+        while (lo <= hi)
+        {
+            const int mid = (lo + hi) >> 1;
+            if (COMPOSE_PAIRS[mid] == key)
+            {
+                out = COMPOSE_RESULT[mid];
+                return true;
+            }
+            if (COMPOSE_PAIRS[mid] < key) lo = mid + 1;
+            else hi = mid - 1;
+        }
+        return false;
+    }
+
+    template<typename F>
+    double NanosecondsPerCodePoint(const List<uint32_t>& cps, F&& lookup)
+    {
+        volatile uint64_t sink = 0;
+        uint64_t sum = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            sum += (uint64_t)lookup(cps[i]);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        sink = sum;
+        return seconds * 1e9 / (double)cps.Count();
+    }
+}
+
+TEST_CASE("Unicode tables - lookup cost per code point", "[.][benchmark][Unicode]") {
+    const List<uint32_t> cps = MixedCodePoints();
+
+    auto letterTrie = [](uint32_t cp) { return UnicodeCase::is_letter(cp); };
+    auto letterSearch = [](uint32_t cp) { return UnicodeCase::small_binsearch_has(UnicodeCase::LETTERS, sizeof(UnicodeCase::LETTERS) / sizeof(UnicodeCase::LETTERS[0]), cp); };
+    auto cccTrie = [](uint32_t cp) { return (uint32_t)UnicodeNormalization::GetCCC(cp); };
+    auto cccSearch = [](uint32_t cp)
+    {
+        using namespace UnicodeNormalization;
+        const int idx = binary_search_ranges_uint32(CCC_RANGES, CCC_RANGES_COUNT, cp);
+        return idx < 0 ? 0u : (uint32_t)CCC_RANGES[idx * 3 + 2];
+    };
+    auto gbpTrie = [](uint32_t cp) { return (uint32_t)UnicodeCase::GetGBP(cp); };
+    auto gbpChain = [](uint32_t cp) { return (uint32_t)RangeChainGBP(cp); };
+    auto composeTrie = [](uint32_t cp) { CodePoint out; return UnicodeNormalization::ComposePair(cp, 0x0301, out) ? (uint32_t)out : 0u; };
+    auto composeSearch = [](uint32_t cp) { uint32_t out = 0; return BinarySearchCompose(cp, 0x0301, out) ? out : 0u; };
+
+    for (uint64_t i = 0; i < 64; ++i)
+    {
+        REQUIRE(letterTrie(cps[i]) == letterSearch(cps[i]));
+        REQUIRE(cccTrie(cps[i]) == cccSearch(cps[i]));
+        REQUIRE(gbpTrie(cps[i]) == gbpChain(cps[i]));
+        REQUIRE(composeTrie(cps[i]) == composeSearch(cps[i]));
+    }
+
+    WARN("ns per code point, trie vs current tables:"
+        << "\n  is_letter " << NanosecondsPerCodePoint(cps, letterTrie) << " vs binary search " << NanosecondsPerCodePoint(cps, letterSearch)
+        << "\n  GetCCC    " << NanosecondsPerCodePoint(cps, cccTrie) << " vs binary search " << NanosecondsPerCodePoint(cps, cccSearch)
+        << "\n  GetGBP    " << NanosecondsPerCodePoint(cps, gbpTrie) << " vs range chain " << NanosecondsPerCodePoint(cps, gbpChain)
+        << "\n  ComposePair " << NanosecondsPerCodePoint(cps, composeTrie) << " vs binary search " << NanosecondsPerCodePoint(cps, composeSearch));
+
+    BENCHMARK("is_letter, trie, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += letterTrie(cps[i]);
+        return n;
+    };
+
+    BENCHMARK("is_letter, binary search over LETTERS, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += letterSearch(cps[i]);
+        return n;
+    };
+
+    BENCHMARK("GetCCC, trie, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += cccTrie(cps[i]);
+        return n;
+    };
+
+    BENCHMARK("GetCCC, binary search over CCC_RANGES, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += cccSearch(cps[i]);
+        return n;
+    };
+
+    BENCHMARK("GetGBP, trie, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += gbpTrie(cps[i]);
+        return n;
+    };
+
+    BENCHMARK("GetGBP, range chain, 1M code points") {
+        uint32_t n = 0;
+        for (uint64_t i = 0; i < cps.Count(); ++i)
+            n += gbpChain(cps[i]);
+        return n;
+    };
+}
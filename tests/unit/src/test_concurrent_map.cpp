@@ -0,0 +1,120 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/ConcurrentMap.hpp"
+#include "System/Types/Text/String.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// Tests for ConcurrentMap<K, V>
+// ------------------------------------------------------------
+TEST_CASE("ConcurrentMap<u64,u64> - single thread semantics", "[ConcurrentMap]") {
+    ConcurrentMap<u64, u64> m(4);
+
+    REQUIRE(m.ShardCount() == 4);
+    REQUIRE(m.Count() == 0);
+
+    REQUIRE(m.TryAdd(1u, 10u));
+    REQUIRE_FALSE(m.TryAdd(1u, 11u));
+    m.Insert(2u, 20u);
+    m.Insert(2u, 21u);
+
+    u64 value = 0;
+    REQUIRE(m.TryGetValue(1u, value));
+    REQUIRE(value == 10u);
+    REQUIRE(m.TryGetValue(2u, value));
+    REQUIRE(value == 21u);
+    REQUIRE_FALSE(m.TryGetValue(3u, value));
+    REQUIRE(m.Count() == 2);
+
+    REQUIRE(m.Remove(1u));
+    REQUIRE_FALSE(m.Remove(1u));
+    REQUIRE_FALSE(m.Contains(1u));
+
+    // grows well past the initial table of each shard
+    for (uint64_t i = 0; i < 5000; ++i)
+        m.Insert(u64(i + 100), u64(i));
+    for (uint64_t i = 0; i < 5000; ++i)
+    {
+        REQUIRE(m.TryGetValue(u64(i + 100), value));
+        REQUIRE(value == i);
+    }
+
+    uint64_t visited = 0;
+    m.ForEach([&](const u64&, const u64&) { ++visited; });
+    REQUIRE(visited == m.Count());
+
+    m.Clear();
+    REQUIRE(m.Count() == 0);
+}
+
+TEST_CASE("ConcurrentMap - shard count hint", "[ConcurrentMap]") {
+    u32 hint = ConcurrentMapShardHint();
+    REQUIRE(hint >= 1u);
+    REQUIRE(hint <= CONCURRENT_MAP_MAX_SHARDS);
+    REQUIRE(((uint32_t)hint & ((uint32_t)hint - 1)) == 0);
+
+    ConcurrentMap<u64, u64> m(5);
+    REQUIRE(m.ShardCount() == 8u);
+}
+
+TEST_CASE("ConcurrentMap<u64,u64> - GetOrAdd runs the factory once per key", "[ConcurrentMap][threads]") {
+    ConcurrentMap<u64, u64> m;
+    volatile uint32_t calls = 0;
+    volatile uint32_t wrong = 0;
+
+    std::thread workers[4];
+    for (auto& worker : workers)
+    {
+        worker = std::thread([&]() {
+            for (uint64_t i = 0; i < 20000; ++i)
+            {
+                u64 key = i % 1000;
+                u64 v = m.GetOrAdd(key, [&](const u64& k) {
+                    Interlocked::Increment(&calls);
+                    return u64((uint64_t)k * 3);
+                });
+                if (v != u64((uint64_t)key * 3))
+                    Interlocked::Increment(&wrong);
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    REQUIRE(calls == 1000u);
+    REQUIRE(wrong == 0u);
+    REQUIRE(m.Count() == 1000);
+}
+
+TEST_CASE("ConcurrentMap<String,u32> - locked readers under writers", "[ConcurrentMap][String][threads]") {
+    ConcurrentMap<String, u32> m(8);
+
+    std::thread writer([&]() {
+        for (uint32_t i = 0; i < 5000; ++i)
+        {
+            m.Insert(u32(i).ToString(), u32(i));
+            if (i % 3 == 0) m.Remove(u32(i / 2).ToString());
+        }
+    });
+
+    volatile uint32_t mismatches = 0;
+    std::thread reader([&]() {
+        for (uint32_t i = 0; i < 5000; ++i)
+        {
+            u32 value = 0;
+            if (m.TryGetValue(u32(i).ToString(), value) && value != u32(i))
+                Interlocked::Increment(&mismatches);
+        }
+    });
+
+    writer.join();
+    reader.join();
+
+    REQUIRE(mismatches == 0u);
+    u32 value = 0;
+    REQUIRE(m.TryGetValue(String("4999"), value));
+    REQUIRE(value == 4999u);
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/SpscRing.hpp"
+#include "System/Collections/MpmcQueue.hpp"
+#include "System/Types/Text/String.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// Tests for SpscRing<T> and MpmcQueue<T>
+// ------------------------------------------------------------
+TEST_CASE("SpscRing - bounded FIFO with batches", "[SpscRing]") {
+    SpscRing<String> r(5);
+    REQUIRE(r.Capacity() == 8);
+
+    for (uint32_t i = 0; i < 8; ++i)
+        REQUIRE(r.TryPush(u32(i).ToString()));
+    REQUIRE_FALSE(r.TryPush(String("full")));
+    REQUIRE(r.Count() == 8);
+
+    String out[3];
+    REQUIRE(r.TryPopN(out, 3) == 3);
+    REQUIRE(out[0] == String("0"));
+    REQUIRE(out[2] == String("2"));
+
+    // only three slots were freed
+    String in[5] = { String("a"), String("b"), String("c"), String("d"), String("e") };
+    REQUIRE(r.TryPushN(in, 5) == 3);
+
+    String value;
+    for (uint32_t i = 3; i < 8; ++i)
+    {
+        REQUIRE(r.TryPop(value));
+        REQUIRE(value == u32(i).ToString());
+    }
+    REQUIRE(r.TryPopN(out, 3) == 3);
+    REQUIRE(out[2] == String("c"));
+    REQUIRE_FALSE(r.TryPop(value));
+}
+
+TEST_CASE("MpmcQueue - bounded FIFO with batches", "[MpmcQueue]") {
+    MpmcQueue<String> q(4);
+    REQUIRE(q.Capacity() == 4);
+
+    String in[6] = { String("a"), String("b"), String("c"), String("d"), String("e"), String("f") };
+    REQUIRE(q.TryPushN(in, 6) == 4);
+    REQUIRE_FALSE(q.TryPush(String("x")));
+
+    String value;
+    REQUIRE(q.TryPop(value));
+    REQUIRE(value == String("a"));
+    REQUIRE(q.TryPush(String("g")));
+
+    String out[8];
+    REQUIRE(q.TryPopN(out, 8) == 4);
+    REQUIRE(out[0] == String("b"));
+    REQUIRE(out[3] == String("g"));
+    REQUIRE_FALSE(q.TryPop(value));
+    REQUIRE(q.Count() == 0);
+
+    // left in the queue: destroyed with it
+    REQUIRE(q.TryPush(String("a string long enough to live on the heap")));
+}
+
+TEST_CASE("SpscRing - producer and consumer threads", "[SpscRing][threads]") {
+    constexpr uint64_t N = 200000;
+    SpscRing<u64> r(64);
+
+    std::thread producer([&]() {
+        u64 batch[16];
+        uint64_t next = 0;
+        while (next < N)
+        {
+            uint32_t k = 0;
+            for (; k < 16 && next + k < N; ++k) batch[k] = next + k;
+            uint32_t pushed = r.TryPushN(batch, k);
+            next += pushed;
+            if (pushed == 0) std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t outOfOrder = 0;
+    u64 batch[7];
+    while (expected < N)
+    {
+        uint32_t popped = r.TryPopN(batch, 7);
+        for (uint32_t i = 0; i < popped; ++i, ++expected)
+            outOfOrder += batch[i] != expected ? 1 : 0;
+        if (popped == 0) std::this_thread::yield();
+    }
+    producer.join();
+
+    REQUIRE(outOfOrder == 0);
+    REQUIRE(r.Count() == 0);
+}
+
+TEST_CASE("MpmcQueue - many producers and consumers", "[MpmcQueue][threads]") {
+    constexpr uint32_t Producers = 4;
+    constexpr uint32_t Consumers = 4;
+    constexpr uint64_t PerProducer = 50000;
+    MpmcQueue<u64> q(128);
+
+    volatile uint64_t received = 0;
+    volatile uint64_t sum = 0;
+    volatile uint32_t outOfOrder = 0;
+
+    std::thread producers[Producers];
+    for (uint32_t p = 0; p < Producers; ++p)
+    {
+        producers[p] = std::thread([&q, p]() {
+            u64 batch[8];
+            uint64_t next = 1;
+            while (next <= PerProducer)
+            {
+                uint32_t k = 0;
+                for (; k < 8 && next + k <= PerProducer; ++k) batch[k] = ((uint64_t)p << 40) | (next + k);
+                uint32_t pushed = (p & 1) ? q.TryPushN(batch, k) : (q.TryPush(batch[0]) ? 1u : 0u);
+                next += pushed;
+                if (pushed == 0) std::this_thread::yield();
+            }
+        });
+    }
+
+    std::thread consumers[Consumers];
+    for (uint32_t c = 0; c < Consumers; ++c)
+    {
+        consumers[c] = std::thread([&, c]() {
+            // values of one producer must arrive in order at each consumer
+            uint64_t last[Producers] = {};
+            u64 batch[5];
+            while (Volatile::Read(&received) < Producers * PerProducer)
+            {
+                uint32_t popped = (c & 1) ? q.TryPopN(batch, 5) : (q.TryPop(batch[0]) ? 1u : 0u);
+                for (uint32_t i = 0; i < popped; ++i)
+                {
+                    uint64_t producer = (uint64_t)batch[i] >> 40;
+                    uint64_t value = (uint64_t)batch[i] & ((1ull << 40) - 1);
+                    if (value <= last[producer]) Interlocked::Increment(&outOfOrder);
+                    last[producer] = value;
+                    Interlocked::Add(&sum, value);
+                }
+                if (popped == 0) std::this_thread::yield();
+                else Interlocked::Add(&received, (uint64_t)popped);
+            }
+        });
+    }
+
+    for (auto& t : producers) t.join();
+    for (auto& t : consumers) t.join();
+
+    REQUIRE(outOfOrder == 0u);
+    REQUIRE(received == Producers * PerProducer);
+    REQUIRE(sum == Producers * (PerProducer * (PerProducer + 1) / 2));
+    REQUIRE(q.Count() == 0);
+}
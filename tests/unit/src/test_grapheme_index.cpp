@@ -0,0 +1,119 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/GraphemeIndex.hpp"
+#include "System/Text/UTF8Iterators.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for the sparse grapheme index behind String's indexed
+// access. Lookups through the index must give the same answers
+// as walking from byte 0, for whole strings and slices alike.
+// ------------------------------------------------------------
+namespace
+{
+    // mixed width text with multi code point clusters, well past
+    // the size String starts indexing at
+    String LongText()
+    {
+        String piece(u8"e\u0301 caf\u00E9 \U0001F469\u200D\u2764\u200D\U0001F48B \U0001F1E7\U0001F1F7 \u4E2D\u6587 ");
+        String text;
+        for (int i = 0; i < 200; ++i)
+            text += piece;
+        return text;
+    }
+
+    uint32_t WalkToCluster(const String& s, uint32_t gcIndex)
+    {
+        const Char* bytes = static_cast<const Char*>(s);
+        UTF8::GraphemeIterator it(bytes, (uint32_t)s.GetByteCount());
+        for (uint32_t i = 0; i < gcIndex && !it.IsEnd(); ++i)
+            ++it;
+        return it.ByteOffset();
+    }
+}
+
+TEST_CASE("GraphemeIndex - checkpoints", "[GraphemeIndex]") {
+    String text = LongText();
+    const Char* bytes = static_cast<const Char*>(text);
+    const uint32_t len = (uint32_t)text.GetByteCount();
+
+    UTF8::GraphemeIndex index(bytes, len);
+
+    REQUIRE(index.IsWellFormed());
+    REQUIRE(index.GetByteCount() == len);
+    REQUIRE(index.GetGraphemeCount() == UTF8::CountGraphemes(bytes, len));
+    REQUIRE(index.GetCodePointCount() == text.GetCodePointsCount());
+    REQUIRE(index.GetCheckpointCount() == (index.GetGraphemeCount() + UTF8::GraphemeIndex::Stride - 1) / UTF8::GraphemeIndex::Stride);
+
+    for (uint32_t k = 0; k < index.GetCheckpointCount(); ++k)
+    {
+        const UTF8::GraphemeIndex::Checkpoint& cp = index.GetCheckpoint(k);
+        REQUIRE(cp.ByteOffset == WalkToCluster(text, k * UTF8::GraphemeIndex::Stride));
+        REQUIRE(index.ForByte(cp.ByteOffset) == k);
+        REQUIRE(index.ForCodePoint(cp.CodePoints) == k);
+        REQUIRE(index.ForGrapheme(k * UTF8::GraphemeIndex::Stride + 1) == k);
+    }
+
+    // past the end clamps to the last checkpoint
+    REQUIRE(index.ForGrapheme(UInt32::MaxValue) == index.GetCheckpointCount() - 1);
+}
+
+TEST_CASE("GraphemeIndex - String indexed access", "[GraphemeIndex][String]") {
+    String text = LongText();
+    const uint32_t length = text.GetLength();
+    List<CodePoint> cps = String::DecodeToCodePoints(text);
+
+    SECTION("Substring matches a walk from the start") {
+        for (uint32_t g = 0; g < length; g += 37)
+        {
+            const uint32_t start = WalkToCluster(text, g);
+            const uint32_t end = WalkToCluster(text, g + 70);
+            String expected(static_cast<const Char*>(text) + start, end - start);
+            REQUIRE(text.Substring(g, 70) == expected);
+        }
+
+        REQUIRE(text.Substring(length).IsEmpty());
+        REQUIRE(text.Substring(length - 1, 100).GetLength() == 1);
+    }
+
+    SECTION("GetCodePointAt on the whole string and on slices") {
+        for (uint32_t i = 0; i < cps.Count(); i += 29)
+            REQUIRE(text.GetCodePointAt(i) == cps[i]);
+
+        // a slice that starts mid block still counts from its own start
+        String slice = text.Substring(130, 900);
+        List<CodePoint> sliceCps = String::DecodeToCodePoints(slice);
+        for (uint32_t i = 0; i < sliceCps.Count(); i += 17)
+            REQUIRE(slice.GetCodePointAt(i) == sliceCps[i]);
+
+        REQUIRE(slice.GetLength() == 900);
+    }
+
+    SECTION("Copies share the index") {
+        String copy = text;
+        REQUIRE(copy.GetCodePointAt((uint32_t)cps.Count() - 1) == cps[cps.Count() - 1]);
+        REQUIRE(text.GetCodePointAt((uint32_t)cps.Count() - 1) == cps[cps.Count() - 1]);
+    }
+}
+
+TEST_CASE("GraphemeIndex - ill-formed bytes", "[GraphemeIndex]") {
+    List<Char> bytes;
+    for (int i = 0; i < 300; ++i)
+    {
+        bytes.Add(Char('a'));
+        bytes.Add(Char((uint8_t)0xC3));
+        bytes.Add(Char((uint8_t)0xA9));
+    }
+    bytes[500] = Char((uint8_t)0xFF);
+
+    UTF8::GraphemeIndex index(bytes.Data(), (uint32_t)bytes.Count());
+    REQUIRE_FALSE(index.IsWellFormed());
+    REQUIRE(index.GetGraphemeCount() == UTF8::CountGraphemes(bytes.Data(), (uint32_t)bytes.Count()));
+
+    // clusters through the index still match the plain walk
+    String s(bytes.Data(), (u32)bytes.Count());
+    for (uint32_t g = 0; g < s.GetLength(); g += 50)
+        REQUIRE(s.Substring(g, 3) == String(static_cast<const Char*>(s) + WalkToCluster(s, g), WalkToCluster(s, g + 3) - WalkToCluster(s, g)));
+}
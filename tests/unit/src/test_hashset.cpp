@@ -0,0 +1,157 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/HashSet.hpp"
+#include "System/Collections/SmallMap.hpp"
+#include "System/Collections/SmallSet.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ------------------------------------------------------------
+// Tests for HashSet<T>
+// ------------------------------------------------------------
+TEST_CASE("HashSet<u32> - add/contains/remove", "[HashSet]") {
+    HashSet<u32> s;
+
+    REQUIRE(s.Count() == 0);
+    REQUIRE(s.Capacity() == 0); // nothing allocated yet
+
+    REQUIRE(s.Add(1u));
+    REQUIRE(s.Add(2u));
+    REQUIRE_FALSE(s.Add(1u));
+    REQUIRE(s.Count() == 2);
+    REQUIRE(s.Contains(1u));
+    REQUIRE_FALSE(s.Contains(3u));
+
+    REQUIRE(s.Remove(1u));
+    REQUIRE_FALSE(s.Remove(1u));
+    REQUIRE(s.Count() == 1);
+
+    for (uint32_t i = 0; i < 5000; ++i)
+        s.Add(u32(i));
+    REQUIRE(s.Count() == 5000);
+
+    uint64_t seen = 0;
+    for (const u32& v : s)
+    {
+        REQUIRE((uint32_t)v < 5000u);
+        ++seen;
+    }
+    REQUIRE(seen == 5000);
+}
+
+TEST_CASE("HashSet<u32> - set operations", "[HashSet]") {
+    HashSet<u32> evens, threes;
+    for (uint32_t i = 0; i < 60; i += 2) evens.Add(u32(i));
+    for (uint32_t i = 0; i < 60; i += 3) threes.Add(u32(i));
+
+    HashSet<u32> both(evens);
+    both.IntersectWith(threes);
+    HashSet<u32> either(evens);
+    either.UnionWith(threes);
+    HashSet<u32> onlyEven(evens);
+    onlyEven.ExceptWith(threes);
+
+    for (uint32_t i = 0; i < 60; ++i)
+    {
+        bool e = i % 2 == 0, t = i % 3 == 0;
+        REQUIRE(both.Contains(u32(i)) == (e && t));
+        REQUIRE(either.Contains(u32(i)) == (e || t));
+        REQUIRE(onlyEven.Contains(u32(i)) == (e && !t));
+    }
+
+    REQUIRE(both.IsSubsetOf(evens));
+    REQUIRE_FALSE(evens.IsSubsetOf(both));
+    REQUIRE(evens.Overlaps(threes));
+    REQUIRE_FALSE(onlyEven.Overlaps(both));
+}
+
+TEST_CASE("HashSet<u32> - set operations with itself", "[HashSet]") {
+    HashSet<u32> set;
+    for (uint32_t i = 0; i < 1000; ++i) set.Add(u32(i * 7));
+
+    set.UnionWith(set);
+    REQUIRE(set.Count() == 1000);
+    set.IntersectWith(set);
+    REQUIRE(set.Count() == 1000);
+    REQUIRE(set.IsSubsetOf(set));
+
+    set.ExceptWith(set);
+    REQUIRE(set.Count() == 0);
+    for (uint32_t i = 0; i < 1000; ++i)
+        REQUIRE_FALSE(set.Contains(u32(i * 7)));
+
+    set.Add(u32(3));
+    REQUIRE(set.Contains(u32(3)));
+}
+
+TEST_CASE("HashSet<String> - lookup by StringView", "[HashSet][String]") {
+    HashSet<String> s;
+    s.Add(String("en-US"));
+    s.Add(String("pt-BR"));
+
+    const char* header = "Accept-Language: pt-BR";
+    REQUIRE(s.Contains(StringView(header + 17, 5)));
+    REQUIRE(s.Contains("en-US"));
+    REQUIRE_FALSE(s.Contains("tr-TR"));
+}
+
+// ------------------------------------------------------------
+// Tests for SmallSet<T, N> / SmallMap<K, V, N>
+// ------------------------------------------------------------
+TEST_CASE("SmallSet<u32> - inline until N, then spills", "[SmallSet]") {
+    SmallSet<u32, 8> s;
+
+    for (uint32_t i = 0; i < 8; ++i)
+        REQUIRE(s.Add(u32(i * 10)));
+    REQUIRE_FALSE(s.Add(0u));
+    REQUIRE(s.IsInline());
+    REQUIRE(s.Count() == 8);
+
+    REQUIRE(s.Remove(30u));
+    REQUIRE_FALSE(s.Contains(30u));
+    REQUIRE(s.Contains(70u)); // swapped into the hole
+
+    REQUIRE(s.Add(30u));
+    REQUIRE(s.Add(80u));
+    REQUIRE_FALSE(s.IsInline());
+    REQUIRE(s.Count() == 9);
+    for (uint32_t i = 0; i < 9; ++i)
+        REQUIRE(s.Contains(u32(i * 10)));
+
+    s.Clear();
+    REQUIRE(s.IsInline());
+    REQUIRE(s.Count() == 0);
+}
+
+TEST_CASE("SmallMap<String,u32> - insert/find/remove across the spill", "[SmallMap][String]") {
+    SmallMap<String, u32, 4> m;
+
+    m.Insert(String("a"), 1u);
+    m.Insert(String("b"), 2u);
+    m.Insert(String("a"), 3u);
+    REQUIRE(m.Count() == 2);
+    REQUIRE(*m.Find(String("a")) == 3u);
+    REQUIRE(*m.Find("b") == 2u);
+    REQUIRE(m.IsInline());
+
+    for (uint32_t i = 0; i < 10; ++i)
+        m.Insert(u32(i).ToString(), u32(i));
+    REQUIRE_FALSE(m.IsInline());
+    REQUIRE(m.Count() == 12);
+    REQUIRE(*m.Find(String("a")) == 3u);
+    REQUIRE(m.Remove(String("b")));
+    REQUIRE(m.Find("b") == nullptr);
+
+    uint32_t seen = 0;
+    for (auto pair : m)
+    {
+        REQUIRE(*m.Find(pair.key) == pair.value);
+        ++seen;
+    }
+    REQUIRE(seen == 11);
+
+    SmallMap<String, u32, 4> copy(m);
+    REQUIRE(copy.Count() == 11);
+}
@@ -285,4 +285,151 @@ TEST_CASE("List iterators", "[List][iterators]") {
         sum2 += *it;
 
     REQUIRE(sum2 == 10);
-}
\ No newline at end of file
+}
+// ------------------------------------------------------------
+// Raw storage / allocators
+// ------------------------------------------------------------
+struct NoDefault {
+    int v;
+    explicit NoDefault(int x) : v(x) {}
+    bool operator==(const NoDefault& o) const { return v == o.v; }
+};
+
+TEST_CASE("List<T> without default constructor", "[List][allocator]") {
+    List<NoDefault> lst;
+    for (int i = 0; i < 10; i++) lst.Add(NoDefault(i));
+
+    lst.Insert(0, NoDefault(-1));
+    lst.RemoveAt(5);
+
+    REQUIRE(lst.Count() == 10);
+    REQUIRE(lst[0].v == -1);
+    REQUIRE(lst[5].v == 5);
+
+    // capacity slots are not constructed
+    lst.Reserve(100);
+    REQUIRE(lst.Count() == 10);
+}
+
+TEST_CASE("List<String> growth keeps contents", "[List][allocator]") {
+    List<String> lst;
+    for (int i = 0; i < 200; i++) lst.Add(String("item ") + String::FromCodePoint(CodePoint(0x41 + i % 26)));
+
+    const String ninth = lst[9];
+    const String tenth = lst[10];
+    const String last = lst[199];
+
+    // the whole list lands at 10; the old tail moves up by 200
+    lst.InsertRange(10, lst);
+
+    REQUIRE(lst.Count() == 400);
+    REQUIRE(lst[9] == ninth);
+    REQUIRE(lst[10] == lst[0]);
+    REQUIRE(lst[19] == ninth);
+    REQUIRE(lst[20] == tenth);
+    REQUIRE(lst[209] == last);
+    REQUIRE(lst[210] == tenth);
+    REQUIRE(lst[399] == last);
+}
+
+TEST_CASE("List<int, ArenaAllocator>", "[List][allocator]") {
+    Memory::Arena arena;
+    {
+        List<int, Memory::ArenaAllocator> lst(Memory::ArenaAllocator{ arena });
+        for (int i = 0; i < 1000; i++) lst.Add(i);
+
+        REQUIRE(lst[999] == 999);
+        REQUIRE(lst.GetArena() == &arena);
+
+        // copies stay in the arena for ArenaAllocator
+        List<int, Memory::ArenaAllocator> copy(lst);
+        REQUIRE(copy.GetArena() == &arena);
+        REQUIRE(copy[500] == 500);
+    }
+    REQUIRE(arena.GetBytesUsed() > 0);
+    arena.Reset();
+    REQUIRE(arena.GetBytesUsed() == 0);
+}
+
+TEST_CASE("List move assignment does not bind heap lists to an arena", "[List][allocator]") {
+    Memory::Arena arena;
+    List<String> member;
+    {
+        List<String> scratch(arena, 4);
+        for (int i = 0; i < 20; i++) scratch.Add(String("scratch item ") + String::FromCodePoint(CodePoint(0x41 + i)));
+
+        // the elements move to the member's heap storage
+        member = static_cast<List<String>&&>(scratch);
+        REQUIRE(member.GetArena() == nullptr);
+        REQUIRE(member.Count() == 20);
+        REQUIRE(scratch.Count() == 0);
+    }
+    arena.Reset();
+    member.Add(String("after reset"));
+    REQUIRE(member[0] == String("scratch item A"));
+    REQUIRE(member[20] == String("after reset"));
+
+    // arena-bound lists still take the buffer, from an arena or the heap
+    List<int> a(arena);
+    List<int> b(arena, 8);
+    b.Add(1);
+    const int* data = b.Data();
+    a = static_cast<List<int>&&>(b);
+    REQUIRE(a.Data() == data);
+    REQUIRE(a.GetArena() == &arena);
+
+    List<int> heap;
+    heap.Add(2);
+    data = heap.Data();
+    a = static_cast<List<int>&&>(heap);
+    REQUIRE(a.Data() == data);
+    REQUIRE(a.GetArena() == nullptr);
+
+    // move construction keeps the binding
+    List<int> c(arena, 8);
+    c.Add(3);
+    List<int> d(static_cast<List<int>&&>(c));
+    REQUIRE(d.GetArena() == &arena);
+    REQUIRE(d[0] == 3);
+}
+
+TEST_CASE("List<int, HeapAllocator>::Create", "[List][allocator]") {
+    // Create builds the list with the class's own allocator
+    auto lst = List<int, Memory::HeapAllocator>::Create(1, 2, 3);
+    static_assert(is_same<decltype(lst), List<int, Memory::HeapAllocator>>::value);
+
+    REQUIRE(lst.Count() == 3);
+    REQUIRE(lst[0] == 1);
+    REQUIRE(lst[2] == 3);
+    REQUIRE(lst.GetArena() == nullptr);
+
+    lst.Add(4);
+    REQUIRE(lst[3] == 4);
+}
+
+static_assert(is_trivially_relocatable_v<int>);
+static_assert(is_trivially_relocatable_v<CodePoint>);
+static_assert(is_trivially_relocatable_v<String>);
+static_assert(!is_trivially_relocatable_v<StringArg>);
+
+TEST_CASE("List<String> Insert/Remove relocate elements", "[List][relocatable]") {
+    List<String> lst;
+    for (int i = 0; i < 50; i++) lst.Add(String("value number ") + String::FromCodePoint(CodePoint(0x61 + i % 26)));
+
+    String first = lst[0];
+    String mid = lst[25];
+
+    lst.Insert(25, String("inserted"));
+    REQUIRE(lst[25] == String("inserted"));
+    REQUIRE(lst[26] == mid);
+
+    lst.RemoveRange(0, 10);
+    REQUIRE(lst.Count() == 41);
+    REQUIRE(lst[16] == mid);
+
+    lst.InsertRange(0, List<String>(1, first));
+    REQUIRE(lst[0] == first);
+
+    lst.RemoveAt(0);
+    REQUIRE(lst.Count() == 41);
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Collections/Dictionary.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ------------------------------------------------------------
+// Tests for Map<K, V>
+// ------------------------------------------------------------
+TEST_CASE("Map<u32,u32> - insert/find/overwrite", "[Map]") {
+    Map<u32, u32> m;
+
+    REQUIRE(m.Count() == 0);
+    REQUIRE(m.Find(1u) == nullptr);
+
+    REQUIRE(m.Insert(1u, 10u));
+    REQUIRE(m.Insert(2u, 20u));
+    REQUIRE(m.Count() == 2);
+    REQUIRE(*m.Find(1u) == 10u);
+    REQUIRE(*m[2u] == 20u);
+
+    m.Insert(1u, 11u);
+    REQUIRE(m.Count() == 2);
+    REQUIRE(*m.Find(1u) == 11u);
+    REQUIRE(m.Contains(2u));
+    REQUIRE_FALSE(m.Contains(3u));
+}
+
+TEST_CASE("Map<u32,u32> - growth keeps every entry", "[Map][growth]") {
+    Map<u32, u32> m;
+
+    for (uint32_t i = 0; i < 10000; ++i)
+        m.Insert(u32(i), u32(i * 3));
+
+    REQUIRE(m.Count() == 10000);
+    for (uint32_t i = 0; i < 10000; ++i)
+        REQUIRE(*m.Find(u32(i)) == i * 3);
+    REQUIRE(m.Find(u32(10000)) == nullptr);
+}
+
+TEST_CASE("Map<u32,u32> - remove shifts probe runs back", "[Map][remove]") {
+    Map<u32, u32> m;
+
+    for (uint32_t i = 0; i < 2000; ++i)
+        m.Insert(u32(i), u32(i));
+
+    for (uint32_t i = 0; i < 2000; i += 2)
+        REQUIRE(m.Remove(u32(i)));
+    REQUIRE_FALSE(m.Remove(u32(0)));
+    REQUIRE(m.Count() == 1000);
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        if (i & 1) REQUIRE(*m.Find(u32(i)) == i);
+        else REQUIRE(m.Find(u32(i)) == nullptr);
+    }
+
+    // churn without tombstones: the table stays usable after many cycles
+    for (uint32_t round = 0; round < 50; ++round)
+    {
+        for (uint32_t i = 0; i < 2000; i += 2) m.Insert(u32(i), u32(round));
+        for (uint32_t i = 0; i < 2000; i += 2) m.Remove(u32(i));
+    }
+    REQUIRE(m.Count() == 1000);
+    REQUIRE(*m.Find(u32(1999)) == 1999u);
+}
+
+TEST_CASE("Map<String,u32> - iteration, copy and clear", "[Map][String]") {
+    Map<String, u32> m;
+    m.Insert(String("alpha"), 1u);
+    m.Insert(String("beta"), 2u);
+    m.Insert(String("gamma"), 3u);
+
+    uint32_t sum = 0, seen = 0;
+    for (auto pair : m)
+    {
+        sum += (uint32_t)pair.value;
+        ++seen;
+    }
+    REQUIRE(seen == 3);
+    REQUIRE(sum == 6);
+
+    Map<String, u32> copy(m);
+    REQUIRE(m.Remove(String("beta")));
+    REQUIRE(copy.Count() == 3);
+    REQUIRE(*copy.Find(String("beta")) == 2u);
+
+    m.Clear();
+    REQUIRE(m.Count() == 0);
+    REQUIRE(m.Find(String("alpha")) == nullptr);
+    m.Insert(String("alpha"), 4u);
+    REQUIRE(*m.Find(String("alpha")) == 4u);
+}
+
+TEST_CASE("Map<String,u32> - lookup by StringView and precomputed hash", "[Map][String][StringView]") {
+    Map<String, u32> m;
+    m.Insert(String("alpha"), 1u);
+    m.Insert(String("a key longer than the inline buffer"), 2u);
+
+    const char* buffer = "GET alpha HTTP/1.1";
+    StringView slice(buffer + 4, 5);
+
+    REQUIRE(Hash(slice) == Hash(String("alpha")));
+    REQUIRE(*m.Find(slice) == 1u);
+    REQUIRE(*m.Find("a key longer than the inline buffer") == 2u);
+    REQUIRE(m.Contains(StringView("alpha")));
+    REQUIRE(m.Find(StringView(buffer, 3)) == nullptr);
+
+    // one hash, several tables
+    u32 hash = Hash(slice);
+    Map<String, u32> other;
+    other.InsertWithHash(String("alpha"), 7u, hash);
+    REQUIRE(*m.FindWithHash(slice, hash) == 1u);
+    REQUIRE(*other.FindWithHash(slice, hash) == 7u);
+    REQUIRE(*other.FindWithHash(String("alpha"), hash) == 7u);
+}
+
+TEST_CASE("String - Equals compares all SSO bytes", "[Map][String]") {
+    // same first 8 bytes and length: must not take the shared-block fast path
+    REQUIRE(String("abcdefgh1") != String("abcdefgh2"));
+
+    Map<String, u32> m;
+    m.Insert(String("abcdefgh1"), 1u);
+    REQUIRE(m.Find(String("abcdefgh2")) == nullptr);
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Memory.hpp"
+#include "System/Arena.hpp"
+#include "System/Collections/List.hpp"
+
+// ------------------------------------------------------------
+// Tests for Memory::Alloc / Free / Realloc
+// ------------------------------------------------------------
+TEST_CASE("Memory - small allocations are aligned and sized", "[Memory][Alloc]") {
+    for (uint64_t size = 1; size <= 4096; size += 13) {
+        Pointer p = Memory::Alloc(size);
+
+        REQUIRE(!p.IsNull());
+        REQUIRE(Memory::IsAligned(p, 16));
+        REQUIRE(Memory::GetAllocationSize(p) == size);
+        REQUIRE(Memory::GetAllocationCapacity(p) >= size);
+
+        Memory::Fill(p, 0xAB, (uint32_t)size);
+        Memory::Free(p);
+    }
+}
+
+TEST_CASE("Memory - zero-size allocation returns a valid block", "[Memory][Alloc]") {
+    Pointer p = Memory::Alloc(0);
+
+    REQUIRE(!p.IsNull());
+    REQUIRE(Memory::GetAllocationSize(p) == 0);
+
+    Memory::Free(p);
+}
+
+TEST_CASE("Memory - freed blocks are reused by the same size class", "[Memory][Alloc]") {
+    Pointer a = Memory::Alloc(48);
+    Memory::Free(a);
+    Pointer b = Memory::Alloc(40);
+
+    REQUIRE(a == b);
+
+    Memory::Free(b);
+}
+
+TEST_CASE("Memory - large allocations go through pages", "[Memory][Alloc]") {
+    const uint64_t size = Memory::MaxSmallAllocation + 1;
+    Pointer p = Memory::Alloc(size);
+
+    REQUIRE(!p.IsNull());
+    REQUIRE(Memory::GetAllocationSize(p) == size);
+    REQUIRE(Memory::GetAllocationCapacity(p) >= size);
+
+    unsigned char* bytes = static_cast<unsigned char*>(p.Get());
+    bytes[0] = 1;
+    bytes[size - 1] = 2;
+
+    Memory::Free(p);
+}
+
+TEST_CASE("Memory - AllocZeroed clears recycled blocks", "[Memory][Alloc]") {
+    Pointer dirty = Memory::Alloc(256);
+    Memory::Fill(dirty, 0xFF, 256);
+    Memory::Free(dirty);
+
+    Pointer p = Memory::AllocZeroed(256);
+    const unsigned char* bytes = static_cast<const unsigned char*>(p.Get());
+
+    for (int i = 0; i < 256; ++i)
+        REQUIRE(bytes[i] == 0);
+
+    Memory::Free(p);
+}
+
+TEST_CASE("Memory - Realloc preserves contents", "[Memory][Realloc]") {
+    Pointer p = Memory::Realloc(Pointer(), 8);
+    REQUIRE(!p.IsNull());
+
+    unsigned char* bytes = static_cast<unsigned char*>(p.Get());
+    for (int i = 0; i < 8; ++i) bytes[i] = (unsigned char)i;
+
+    // within capacity: same block
+    Pointer same = Memory::Realloc(p, 12);
+    REQUIRE(same == p);
+    REQUIRE(Memory::GetAllocationSize(same) == 12);
+
+    // small -> large -> small
+    Pointer big = Memory::Realloc(same, 100000);
+    bytes = static_cast<unsigned char*>(big.Get());
+    for (int i = 0; i < 8; ++i) REQUIRE(bytes[i] == (unsigned char)i);
+
+    Pointer small = Memory::Realloc(big, 4);
+    REQUIRE(Memory::GetAllocationSize(small) == 4);
+    bytes = static_cast<unsigned char*>(small.Get());
+    for (int i = 0; i < 4; ++i) REQUIRE(bytes[i] == (unsigned char)i);
+
+    Memory::Free(small);
+}
+
+TEST_CASE("Memory - Free(null) is a no-op", "[Memory][Free]") {
+    Memory::Free(Pointer());
+    REQUIRE(Memory::GetAllocationSize(Pointer()) == 0);
+}
+
+// ------------------------------------------------------------
+// Tests for Memory::Arena / ScratchScope
+// ------------------------------------------------------------
+TEST_CASE("Arena - bump allocation respects alignment", "[Memory][Arena]") {
+    Memory::Arena arena;
+
+    Pointer a = arena.Allocate(3, 1);
+    Pointer b = arena.Allocate(8, 8);
+    Pointer c = arena.Allocate(1, 64);
+
+    REQUIRE(!a.IsNull());
+    REQUIRE(Memory::IsAligned(b, 8));
+    REQUIRE(Memory::IsAligned(c, 64));
+    REQUIRE(arena.GetBytesUsed() >= 3 + 8 + 1);
+}
+
+TEST_CASE("Arena - reset to mark releases later allocations", "[Memory][Arena]") {
+    Memory::Arena arena(4096);
+
+    arena.Allocate(100);
+    Memory::Arena::Marker mark = arena.Mark();
+    uint64_t used = arena.GetBytesUsed();
+
+    // spill over several chunks
+    for (int i = 0; i < 16; ++i)
+        REQUIRE(!arena.Allocate(1000).IsNull());
+
+    arena.Reset(mark);
+    REQUIRE(arena.GetBytesUsed() == used);
+
+    // chunks are kept for reuse
+    uint64_t reserved = arena.GetBytesReserved();
+    for (int i = 0; i < 16; ++i)
+        arena.Allocate(1000);
+    REQUIRE(arena.GetBytesReserved() == reserved);
+
+    arena.Reset();
+    REQUIRE(arena.GetBytesUsed() == 0);
+
+    arena.Release();
+    REQUIRE(arena.GetBytesReserved() == 0);
+}
+
+TEST_CASE("Arena - oversized allocation gets its own chunk", "[Memory][Arena]") {
+    Memory::Arena arena(4096);
+
+    Pointer p = arena.Allocate(1024 * 1024);
+    REQUIRE(!p.IsNull());
+    Memory::Fill(p, 0x5A, 1024 * 1024);
+}
+
+TEST_CASE("Arena - TryResize grows only the last block", "[Memory][Arena]") {
+    Memory::Arena arena;
+
+    Pointer a = arena.Allocate(32);
+    REQUIRE(arena.TryResize(a, 32, 64));
+
+    Pointer b = arena.Allocate(16);
+    REQUIRE_FALSE(arena.TryResize(a, 64, 128));
+    REQUIRE(arena.TryResize(b, 16, 8));
+}
+
+TEST_CASE("ScratchScope - nested scopes reset in order", "[Memory][Arena]") {
+    Memory::Arena& arena = Memory::GetScratchArena();
+    uint64_t before = arena.GetBytesUsed();
+
+    {
+        Memory::ScratchScope outer;
+        REQUIRE(&outer.GetArena() == &arena);
+        outer.GetArena().Allocate(64);
+
+        {
+            Memory::ScratchScope inner;
+            inner.GetArena().Allocate(128);
+            REQUIRE(arena.GetBytesUsed() >= before + 64 + 128);
+        }
+
+        REQUIRE(arena.GetBytesUsed() < before + 64 + 128);
+
+        // a conflicting scope must pick the other scratch arena
+        Memory::ScratchScope other(&outer.GetArena());
+        REQUIRE(&other.GetArena() != &arena);
+    }
+
+    REQUIRE(arena.GetBytesUsed() == before);
+}
+
+TEST_CASE("List<int> - arena-backed storage", "[Memory][Arena][List]") {
+    Memory::ScratchScope scratch;
+    List<int> list(scratch.GetArena());
+
+    for (int i = 0; i < 1000; ++i)
+        list.Add(i);
+
+    REQUIRE(list.Count() == 1000);
+    REQUIRE(list.GetArena() == &scratch.GetArena());
+    REQUIRE(list[999] == 999);
+
+    // copies always go to the heap
+    List<int> copy(list);
+    REQUIRE(copy.GetArena() == nullptr);
+    REQUIRE(copy[500] == 500);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/NumberFormat.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+// ------------------------------------------------------------
+// Tests for NumberFormat
+// Integers against std::to_string, floating point text for
+// known values (notation switch, special values), round trips
+// of random bit patterns through strtod / strtof, buffers that
+// are too small, and the primitive ToString built on it.
+// ------------------------------------------------------------
+namespace
+{
+    template<typename T>
+    std::string Format(T value, uint32_t capacity = NumberFormat::MaxChars)
+    {
+        Char buf[NumberFormat::MaxChars + 8];
+        u32 written = 0u;
+        if (!NumberFormat::TryFormat(value, buf, capacity, written))
+            return "<no room>";
+        return std::string(reinterpret_cast<const char*>(buf), (uint32_t)written);
+    }
+}
+
+TEST_CASE("NumberFormat - integers", "[NumberFormat]") {
+    REQUIRE(Format((int32_t)0) == "0");
+    REQUIRE(Format((int32_t)-7) == "-7");
+    REQUIRE(Format(std::numeric_limits<int32_t>::min()) == "-2147483648");
+    REQUIRE(Format(std::numeric_limits<int32_t>::max()) == "2147483647");
+    REQUIRE(Format(std::numeric_limits<uint32_t>::max()) == "4294967295");
+    REQUIRE(Format(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+    REQUIRE(Format(std::numeric_limits<uint64_t>::max()) == "18446744073709551615");
+
+    // every digit count, both sides of each power of ten
+    uint64_t p = 1;
+    for (uint32_t digits = 1; digits < 20; ++digits, p *= 10)
+    {
+        REQUIRE(Format(p) == std::to_string(p));
+        REQUIRE(Format(p - 1) == std::to_string(p - 1));
+        REQUIRE(Format(-(int64_t)p) == std::to_string(-(int64_t)p));
+    }
+
+    std::mt19937_64 rng(7);
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        const uint64_t v = rng() >> (rng() % 64);
+        REQUIRE(Format(v) == std::to_string(v));
+        REQUIRE(Format((int64_t)v) == std::to_string((int64_t)v));
+        REQUIRE(Format((int32_t)v) == std::to_string((int32_t)v));
+    }
+}
+
+TEST_CASE("NumberFormat - floating point text", "[NumberFormat]") {
+    SECTION("shortest digits") {
+        REQUIRE(Format(0.1) == "0.1");
+        REQUIRE(Format(0.1 + 0.2) == "0.30000000000000004");
+        REQUIRE(Format(1.0 / 3.0) == "0.3333333333333333");
+        REQUIRE(Format(2.5) == "2.5");
+        REQUIRE(Format(-1234.5678) == "-1234.5678");
+        REQUIRE(Format(100.0) == "100");
+        REQUIRE(Format(0.1f) == "0.1");
+        REQUIRE(Format(1.0f / 3.0f) == "0.33333334");
+        REQUIRE(Format(16777216.0f) == "16777216");
+    }
+
+    SECTION("fixed while the exponent is in [-5, 15)") {
+        REQUIRE(Format(0.00001) == "0.00001");
+        REQUIRE(Format(0.000012345) == "0.000012345");
+        REQUIRE(Format(0.000001) == "1E-06");
+        REQUIRE(Format(123456789012345.0) == "123456789012345");
+        REQUIRE(Format(1e15) == "1E+15");
+        REQUIRE(Format(-1.5e20) == "-1.5E+20");
+        REQUIRE(Format(1e-7f) == "1E-07");
+        REQUIRE(Format(5e-324) == "5E-324");
+        REQUIRE(Format(std::numeric_limits<double>::max()) == "1.7976931348623157E+308");
+        REQUIRE(Format(std::numeric_limits<float>::max()) == "3.4028235E+38");
+    }
+
+    SECTION("special values") {
+        REQUIRE(Format(0.0) == "0");
+        REQUIRE(Format(-0.0) == "-0");
+        REQUIRE(Format(-0.0f) == "-0");
+        REQUIRE(Format(std::numeric_limits<double>::quiet_NaN()) == "NaN");
+        REQUIRE(Format(std::numeric_limits<double>::infinity()) == "Infinity");
+        REQUIRE(Format(-std::numeric_limits<float>::infinity()) == "-Infinity");
+    }
+}
+
+TEST_CASE("NumberFormat - round trips", "[NumberFormat]") {
+    std::mt19937_64 rng(2024);
+    for (uint32_t i = 0; i < 200000; ++i)
+    {
+        const uint64_t bits = rng();
+
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (std::isfinite(d))
+        {
+            const std::string text = Format(d);
+            REQUIRE(text.size() <= NumberFormat::MaxDoubleChars);
+            REQUIRE(std::strtod(text.c_str(), nullptr) == d);
+        }
+
+        const uint32_t bits32 = (uint32_t)bits;
+        float f;
+        std::memcpy(&f, &bits32, sizeof(f));
+        if (std::isfinite(f))
+        {
+            const std::string text = Format(f);
+            REQUIRE(text.size() <= NumberFormat::MaxSingleChars);
+            REQUIRE(std::strtof(text.c_str(), nullptr) == f);
+        }
+    }
+}
+
+TEST_CASE("NumberFormat - buffer too small", "[NumberFormat]") {
+    REQUIRE(Format(12345, 5) == "12345");
+    REQUIRE(Format(12345, 4) == "<no room>");
+    REQUIRE(Format(-1.5, 4) == "-1.5");
+    REQUIRE(Format(-1.5, 3) == "<no room>");
+    REQUIRE(Format(-std::numeric_limits<double>::infinity(), 8) == "<no room>");
+
+    // nothing is written when it does not fit
+    Char buf[4] = { Char('x'), Char('x'), Char('x'), Char('x') };
+    u32 written = 9u;
+    REQUIRE_FALSE(NumberFormat::TryFormat((uint64_t)123456, buf, 4, written));
+    REQUIRE(written == 0u);
+    REQUIRE(buf[0] == Char('x'));
+}
+
+TEST_CASE("NumberFormat - primitive ToString", "[NumberFormat]") {
+    REQUIRE(Int32(-42).ToString() == String("-42"));
+    REQUIRE(UInt64(18446744073709551615ull).ToString() == String("18446744073709551615"));
+    REQUIRE(SByte((int8_t)-128).ToString() == String("-128"));
+    REQUIRE(UInt16((uint16_t)40000).ToString() == String("40000"));
+    REQUIRE(Double(0.1).ToString() == String("0.1"));
+    REQUIRE(Single(0.1f).ToString() == String("0.1"));
+    REQUIRE(Double(1e100).ToString() == String("1E+100"));
+}
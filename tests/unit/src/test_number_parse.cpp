@@ -0,0 +1,259 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Exceptions.hpp"
+#include "System/Network/IPAddress.hpp"
+#include "System/Text/NumberParse.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+// ------------------------------------------------------------
+// Tests for NumberParse
+// Integer limits and grammar against std::from_chars, floating
+// point against strtod / strtof (random bit patterns, halfway
+// points, long digit strings, subnormals, out of range), the
+// wrappers' Parse / TryParse, and IPAddress::TryParse.
+// ------------------------------------------------------------
+namespace
+{
+    using NumberParse::Status;
+
+    template<typename T>
+    Status ParseText(const std::string& text, T& value)
+    {
+        return NumberParse::Parse(text.data(), (uint32_t)text.size(), value);
+    }
+
+    template<typename T>
+    bool SameBits(T a, T b)
+    {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    // Both widths against the C library for one text
+    void RequireLikeStrtod(const std::string& text)
+    {
+        double d = 0;
+        REQUIRE(ParseText(text, d) == Status::Ok);
+        REQUIRE(SameBits(d, std::strtod(text.c_str(), nullptr)));
+
+        float f = 0;
+        REQUIRE(ParseText(text, f) == Status::Ok);
+        REQUIRE(SameBits(f, std::strtof(text.c_str(), nullptr)));
+    }
+}
+
+TEST_CASE("NumberParse - integer limits", "[NumberParse]") {
+    int8_t i8; uint8_t u8; int16_t i16; uint16_t u16;
+    int32_t i32; uint32_t u32v; int64_t i64; uint64_t u64;
+
+    REQUIRE(ParseText("-128", i8) == Status::Ok);
+    REQUIRE(i8 == -128);
+    REQUIRE(ParseText("128", i8) == Status::Overflow);
+    REQUIRE(ParseText("-129", i8) == Status::Overflow);
+    REQUIRE(ParseText("255", u8) == Status::Ok);
+    REQUIRE(ParseText("256", u8) == Status::Overflow);
+    REQUIRE(ParseText("-32768", i16) == Status::Ok);
+    REQUIRE(ParseText("65536", u16) == Status::Overflow);
+    REQUIRE(ParseText("-2147483648", i32) == Status::Ok);
+    REQUIRE(i32 == std::numeric_limits<int32_t>::min());
+    REQUIRE(ParseText("2147483648", i32) == Status::Overflow);
+    REQUIRE(ParseText("4294967295", u32v) == Status::Ok);
+    REQUIRE(u32v == 4294967295u);
+    REQUIRE(ParseText("-9223372036854775808", i64) == Status::Ok);
+    REQUIRE(i64 == std::numeric_limits<int64_t>::min());
+    REQUIRE(ParseText("9223372036854775808", i64) == Status::Overflow);
+    REQUIRE(ParseText("18446744073709551615", u64) == Status::Ok);
+    REQUIRE(u64 == std::numeric_limits<uint64_t>::max());
+    REQUIRE(ParseText("18446744073709551616", u64) == Status::Overflow);
+    REQUIRE(ParseText("99999999999999999999", u64) == Status::Overflow);
+    REQUIRE(ParseText("100000000000000000000000", u64) == Status::Overflow);
+
+    // leading zeros do not count toward the length
+    REQUIRE(ParseText("000000000000000000000000018446744073709551615", u64) == Status::Ok);
+    REQUIRE(u64 == std::numeric_limits<uint64_t>::max());
+
+    // minus zero is zero, even unsigned; any other negative is not
+    REQUIRE(ParseText("-0", u32v) == Status::Ok);
+    REQUIRE(u32v == 0u);
+    REQUIRE(ParseText("-1", u32v) == Status::Overflow);
+}
+
+TEST_CASE("NumberParse - integer grammar", "[NumberParse]") {
+    int32_t v = 7;
+
+    REQUIRE(ParseText("  +42\t\r\n", v) == Status::Ok);
+    REQUIRE(v == 42);
+
+    for (const char* bad : { "", " ", "+", "-", "--1", "+-1", "1 2", "12a", "a12", "0x10", "1e3", "1.0", "1,000" })
+    {
+        INFO(bad);
+        REQUIRE(ParseText(bad, v) == Status::Invalid);
+    }
+
+    // every digit count, and random values, against from_chars
+    std::mt19937_64 rng(24);
+    for (uint32_t i = 0; i < 200000; ++i)
+    {
+        const uint64_t x = rng() >> (rng() % 64);
+        const std::string text = (i & 1 ? "-" : "") + std::to_string(x);
+
+        int64_t ours;
+        int64_t expected;
+        const auto r = std::from_chars(text.data(), text.data() + text.size(), expected);
+        const Status status = ParseText(text, ours);
+        if (r.ec == std::errc::result_out_of_range)
+            REQUIRE(status == Status::Overflow);
+        else
+        {
+            REQUIRE(status == Status::Ok);
+            REQUIRE(ours == expected);
+        }
+
+        uint64_t unsignedValue;
+        REQUIRE(ParseText(std::to_string(x), unsignedValue) == Status::Ok);
+        REQUIRE(unsignedValue == x);
+    }
+}
+
+TEST_CASE("NumberParse - floating point", "[NumberParse]") {
+    SECTION("known values") {
+        for (const char* text : { "0", "1", "-2.5e-3", ".5", "5.", "1E+5", "0.1", "0.30000000000000004",
+                                  "9007199254740993", "123456789012345678901234567890", "1e22", "1e23",
+                                  "1.7976931348623157e308", "1.7976931348623158e308", "2.2250738585072011e-308",
+                                  "4.9406564584124654e-324", "2.4703282292062328e-324", "3.4028235e38",
+                                  "1.4e-45", "7.1e-46" })
+        {
+            INFO(text);
+            RequireLikeStrtod(text);
+        }
+    }
+
+    SECTION("out of range saturates") {
+        double d;
+        REQUIRE(ParseText("1e309", d) == Status::Ok);
+        REQUIRE(d == std::numeric_limits<double>::infinity());
+        REQUIRE(ParseText("-1e100000000000000000000", d) == Status::Ok);
+        REQUIRE(d == -std::numeric_limits<double>::infinity());
+        REQUIRE(ParseText("1e-400", d) == Status::Ok);
+        REQUIRE(d == 0.0);
+        REQUIRE(ParseText("-0", d) == Status::Ok);
+        REQUIRE(std::signbit(d));
+
+        float f;
+        REQUIRE(ParseText("3.5e38", f) == Status::Ok);
+        REQUIRE(f == std::numeric_limits<float>::infinity());
+    }
+
+    SECTION("special values and invalid text") {
+        double d;
+        REQUIRE(ParseText("NaN", d) == Status::Ok);
+        REQUIRE(std::isnan(d));
+        REQUIRE(ParseText(" -infinity ", d) == Status::Ok);
+        REQUIRE(d == -std::numeric_limits<double>::infinity());
+
+        for (const char* bad : { "", ".", "-.", "e5", "1e", "1e+", "1.2.3", "1 e5", "--1", "inf", "nan(1)", "0x1p3" })
+        {
+            INFO(bad);
+            REQUIRE(ParseText(bad, d) == Status::Invalid);
+        }
+    }
+
+    SECTION("round trips of random bit patterns") {
+        std::mt19937_64 rng(2025);
+        char buf[64];
+        for (uint32_t i = 0; i < 100000; ++i)
+        {
+            const uint64_t bits = rng();
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            if (!std::isfinite(d))
+                continue;
+
+            std::snprintf(buf, sizeof(buf), "%.*e", (int)(rng() % 20), d);
+            RequireLikeStrtod(buf);
+        }
+    }
+
+    SECTION("halfway points and long digit strings") {
+        // more than 19 significant digits right at, or next to, a
+        // midpoint: the big integer comparison. The midpoint between
+        // two floats is exact in a double, and its full expansion is
+        // 60-odd digits
+        std::mt19937_64 rng(7);
+        char buf[128];
+        for (uint32_t i = 0; i < 20000; ++i)
+        {
+            const uint32_t bits = (uint32_t)rng() & 0x7F7FFFFFu;
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            const double mid = ((double)f + (double)std::nextafter(f, INFINITY)) / 2;
+            std::snprintf(buf, sizeof(buf), "%.60e", mid);
+            RequireLikeStrtod(buf);
+
+            std::string digits;
+            const uint32_t count = 20 + (uint32_t)(rng() % 60);
+            for (uint32_t k = 0; k < count; ++k)
+                digits += char('0' + rng() % 10);
+            RequireLikeStrtod(digits + "e" + std::to_string((int)(rng() % 700) - 350));
+        }
+    }
+}
+
+TEST_CASE("NumberParse - wrappers", "[NumberParse]") {
+    REQUIRE(Int32::Parse("-42") == -42);
+    REQUIRE(UInt64::Parse(String("18446744073709551615")) == 18446744073709551615ull);
+    REQUIRE(Double::Parse(" 0.1 ") == 0.1);
+    REQUIRE(Single::Parse("0.1") == 0.1f);
+
+    REQUIRE_THROWS_AS(Int32::Parse("forty-two"), FormatException);
+    REQUIRE_THROWS_AS(Byte::Parse("256"), OverflowException);
+
+    SByte sb;
+    REQUIRE(SByte::TryParse("-128", sb));
+    REQUIRE(sb == (int8_t)-128);
+    REQUIRE_FALSE(SByte::TryParse("128", sb));
+    REQUIRE(sb == (int8_t)-128);     // untouched on failure
+
+    // a slice, not the whole string
+    const String row("12;34;56");
+    Int16 middle;
+    REQUIRE(Int16::TryParse(StringView(row).Slice(3, 2), middle));
+    REQUIRE(middle == (int16_t)34);
+}
+
+TEST_CASE("IPAddress - TryParse", "[NumberParse]") {
+    IPAddress address;
+
+    REQUIRE(IPAddress::TryParse("192.168.0.1", address));
+    REQUIRE(address.IsV4());
+    REQUIRE(address.GetBytes()[0] == (uint8_t)192);
+    REQUIRE(address.GetBytes()[3] == (uint8_t)1);
+
+    REQUIRE(IPAddress::TryParse("::1", address));
+    REQUIRE(address == IPAddress::LoopbackV6());
+    REQUIRE(IPAddress::TryParse("::", address));
+    REQUIRE(address == IPAddress::AnyV6());
+    REQUIRE(IPAddress::TryParse("fe80::1:2", address));
+    REQUIRE(address.GetBytes()[0] == (uint8_t)0xFE);
+    REQUIRE(address.GetBytes()[13] == (uint8_t)1);
+    REQUIRE(IPAddress::TryParse("1:2:3:4:5:6:7:8", address));
+    REQUIRE(IPAddress::TryParse("1::", address));
+
+    for (const char* bad : { "", "256.1.1.1", "1.2.3", "1.2.3.4.5", ":1", "1:", ":::", "1::2::3",
+                             "12345::", "1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7:8::", "192.168.0.1x" })
+    {
+        INFO(bad);
+        REQUIRE_FALSE(IPAddress::TryParse(bad, address));
+    }
+}
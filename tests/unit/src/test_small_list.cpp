@@ -0,0 +1,171 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Memory.hpp"
+#include "System/Collections/SmallList.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for SmallList<T, N>
+// Memory::GetThreadAllocationCount is diffed to check that the
+// inline elements never touch the heap.
+// ------------------------------------------------------------
+namespace
+{
+    void FillWords(List<String>& out, uint32_t count)
+    {
+        out.Clear();
+        for (uint32_t i = 0; i < count; ++i)
+            out.Add(String("a word long enough to live on the heap"));
+    }
+
+    template<typename A, typename B>
+    concept MovesInto = requires(A& a) { B(static_cast<A&&>(a)); };
+
+    template<typename A, typename B>
+    concept MoveAssignsInto = requires(A& a, B& b) { b = static_cast<A&&>(a); };
+
+    template<typename A, typename B>
+    concept SwapsWith = requires(A& a, B& b) { a.Swap(b); };
+
+    template<typename A, typename B>
+    concept CopiesInto = requires(A& a, B& b) { B(a); b = a; };
+
+    using Small = SmallList<u32, 4>;
+
+    // the inline buffer never leaves the SmallList that owns it
+    static_assert(!MovesInto<Small, List<u32>>);
+    static_assert(!MoveAssignsInto<Small, List<u32>>);
+    static_assert(!SwapsWith<List<u32>, Small>);
+    static_assert(!SwapsWith<Small, List<u32>>);
+    static_assert(!SwapsWith<Small, Small>);
+    static_assert(CopiesInto<Small, List<u32>>);
+    static_assert(MovesInto<Small, Small>);
+    static_assert(MovesInto<List<u32>, List<u32>>);
+    static_assert(SwapsWith<List<u32>, List<u32>>);
+}
+
+TEST_CASE("SmallList - first N elements stay inline", "[SmallList]") {
+    const u64 before = Memory::GetThreadAllocationCount();
+
+    SmallList<u32, 4> l;
+    for (uint32_t i = 0; i < 4; ++i) l.Add(u32(i));
+
+    REQUIRE(l.IsInline());
+    REQUIRE(l.Capacity() == 4);
+    REQUIRE(Memory::GetThreadAllocationCount() == before);
+
+    l.Add(u32(4));
+    REQUIRE_FALSE(l.IsInline());
+    REQUIRE(Memory::GetThreadAllocationCount() == before + 1);
+    for (uint32_t i = 0; i < 5; ++i) REQUIRE(l[i] == i);
+
+    // shrinking back under N returns to the inline buffer
+    l.RemoveRange(0, 3);
+    l.ShrinkToFit();
+    REQUIRE(l.IsInline());
+    REQUIRE(l[0] == 3u);
+    REQUIRE(l[1] == 4u);
+}
+
+TEST_CASE("SmallList - usable wherever a List is expected", "[SmallList]") {
+    SmallList<String, 4> words;
+    FillWords(words, 3);
+    REQUIRE(words.IsInline());
+    REQUIRE(words.Count() == 3);
+
+    List<String> copy(words);
+    REQUIRE(copy.Count() == 3);
+    REQUIRE(copy.GetArena() == nullptr);
+
+    FillWords(words, 10);
+    REQUIRE_FALSE(words.IsInline());
+    REQUIRE(words[9] == copy[0]);
+
+    SmallList<Char, 8> separators;
+    separators.Add(Char(','));
+    separators.Add(Char(';'));
+    REQUIRE(String("a;b,c").IndexOfAny(separators) == 1);
+}
+
+TEST_CASE("SmallList - copy and move", "[SmallList]") {
+    SmallList<String, 3> a;
+    FillWords(a, 2);
+
+    // inline source: elements move, both lists stay inline
+    SmallList<String, 3> b(static_cast<SmallList<String, 3>&&>(a));
+    REQUIRE(b.Count() == 2);
+    REQUIRE(a.Count() == 0);
+    REQUIRE(a.IsInline());
+    REQUIRE(b.IsInline());
+
+    // spilled source: the heap buffer changes hands
+    FillWords(b, 10);
+    const String* heap = b.Data();
+    SmallList<String, 3> c(static_cast<SmallList<String, 3>&&>(b));
+    REQUIRE(c.Data() == heap);
+    REQUIRE(c.Count() == 10);
+    REQUIRE(b.Count() == 0);
+    REQUIRE(b.IsInline());
+
+    b = c;
+    REQUIRE(b.Count() == 10);
+    REQUIRE(b[9] == c[9]);
+
+    a.Add(String("x"));
+    a = static_cast<SmallList<String, 3>&&>(c);
+    REQUIRE(a.Count() == 10);
+    REQUIRE(c.Count() == 0);
+}
+
+TEST_CASE("SmallList - moved from through a List reference", "[SmallList]") {
+    List<String> moved;
+    List<String> assigned;
+    {
+        SmallList<String, 4> small;
+        FillWords(small, 3);
+        List<String>& out = small;
+
+        moved = List<String>(static_cast<List<String>&&>(out));
+        REQUIRE(moved.Count() == 3);
+        REQUIRE(moved.Data() != small.Data());
+        REQUIRE(small.Count() == 0);
+        REQUIRE(small.IsInline());
+
+        // the list keeps inline storage for its next elements
+        FillWords(small, 2);
+        REQUIRE(small.IsInline());
+        assigned = static_cast<List<String>&&>(out);
+        REQUIRE(assigned.Count() == 2);
+        REQUIRE(small.Count() == 0);
+    }
+
+    // the SmallList is gone; both lists own what they hold and can grow
+    moved.Add(String("after"));
+    assigned.Add(String("after"));
+    REQUIRE(moved[0] == String("a word long enough to live on the heap"));
+    REQUIRE(moved[3] == String("after"));
+    REQUIRE(assigned[2] == String("after"));
+    REQUIRE(moved.GetArena() == nullptr);
+
+    // a plain list moved into a SmallList through the base takes its buffer
+    SmallList<String, 4> small;
+    List<String>& in = small;
+    const String* heap = moved.Data();
+    in = static_cast<List<String>&&>(moved);
+    REQUIRE(small.Data() == heap);
+    REQUIRE(small.Count() == 4);
+}
+
+TEST_CASE("SmallList - case mapping no longer allocates per code point", "[SmallList][String]") {
+    String s;
+    for (uint32_t i = 0; i < 64; ++i) s = s + String(u8"éaß");
+
+    const u64 before = Memory::GetThreadAllocationCount();
+    String upper = s.ToUpper();
+    const u64 allocations = Memory::GetThreadAllocationCount() - before;
+
+    REQUIRE(upper.GetByteCount() > 0);
+    REQUIRE(allocations < 16);   // was one per code point (192+)
+}
@@ -8,6 +8,8 @@
 #include "System/Collections/List.hpp"
 #include "System/Framework.hpp"
 
+#include <thread>
+
 static List<Char> Chars(std::initializer_list<Char> list)
 {
     List<Char> r;
@@ -143,6 +145,81 @@ TEST_CASE("String: Operators")
     }
 }
 
+TEST_CASE("String: Operator+= appends in place")
+{
+    SECTION("Growth leaves room: later appends keep the block")
+    {
+        String s("a heap string, longer than the inline buffer");
+        s += String(" and more");
+        const Char* block = static_cast<const Char*>(s);
+
+        s += String("!");
+        s += String("?");
+        REQUIRE(static_cast<const Char*>(s) == block);
+        REQUIRE(s.Equals("a heap string, longer than the inline buffer and more!?"));
+        REQUIRE(s.GetByteCount() == 55);
+    }
+
+    SECTION("Shared blocks and slices are never written")
+    {
+        String s("a heap string, longer than the inline buffer");
+        s += String("+");
+        String copy(s);
+        String slice = s.Substring(0, 30);
+
+        s += String("tail");
+        REQUIRE(copy.Equals("a heap string, longer than the inline buffer+"));
+        REQUIRE(s.Equals("a heap string, longer than the inline buffer+tail"));
+        REQUIRE(s.GetReferenceCount() == 1);
+        REQUIRE(copy.GetReferenceCount() == 2);
+
+        slice += String("!");
+        REQUIRE(slice.Equals("a heap string, longer than the!"));
+        REQUIRE(copy.Equals("a heap string, longer than the inline buffer+"));
+    }
+
+    SECTION("Self append")
+    {
+        String s("0123456789abcdefghij");
+        s += s;
+        s += s;
+        REQUIRE(s.Equals("0123456789abcdefghij0123456789abcdefghij0123456789abcdefghij0123456789abcdefghij"));
+    }
+
+    SECTION("Cached length and index follow the new bytes")
+    {
+        String s(u8"caf\u00E9 caf\u00E9 caf\u00E9 caf\u00E9 caf\u00E9");
+        s += String("!");
+        REQUIRE(s.GetLength() == 25);
+
+        // the combining mark joins the last cluster
+        s += String(u8"\u0301");
+        REQUIRE(s.GetLength() == 25);
+        s += String("x");
+        REQUIRE(s.GetLength() == 26);
+
+        // past the size where a grapheme index is built
+        String big;
+        for (uint32_t i = 0; i < 400; ++i)
+            big += String(u8"\u00E9");
+        REQUIRE(big.GetLength() == 400);
+        REQUIRE(big.Substring(399).Equals(u8"\u00E9"));
+        big += String("z");
+        REQUIRE(big.GetLength() == 401);
+        REQUIRE(big.Substring(400).Equals("z"));
+    }
+
+    SECTION("Loop of appends")
+    {
+        String s;
+        for (uint32_t i = 0; i < 10000; ++i)
+            s += String("0123456789");
+        REQUIRE(s.GetByteCount() == 100000);
+        REQUIRE(s.IndexOf(String("90123")) == 9);
+        REQUIRE(s.EndsWith(String("789")));
+    }
+}
+
 // =====================================================
 // 3. Equals (ordinal, ignoreCase, locale)
 // =====================================================
@@ -555,6 +632,26 @@ TEST_CASE("Unicode Normalization – Hangul")
     REQUIRE(nfd.Normalize(NF::NFC).Equals(u8"\uAC00"));
 }
 
+TEST_CASE("Unicode Normalization \u2013 long Hangul run grows the output")
+{
+    // \uAC01 (U+AC01) is 3 bytes and decomposes into 3 jamo, 9 bytes: the
+    // rewritten tail ends up three times its reserve
+    String composed("prefix ");
+    String expected("prefix ");
+    for (int i = 0; i < 2000; ++i)
+    {
+        composed += String(u8"\uAC01");
+        expected += String(u8"\u1100\u1161\u11A8");
+    }
+
+    String nfd = composed.Normalize(NF::NFD);
+    REQUIRE(nfd.GetByteCount() == 7u + 2000u * 9u);
+    REQUIRE(nfd.Equals(expected));
+
+    REQUIRE(composed.Normalize(NF::NFKD).Equals(expected));
+    REQUIRE(nfd.Normalize(NF::NFC).Equals(composed));
+}
+
 // =====================================================
 //  CANONICAL EQUIVALENCE TEST CASES (UAX #15)
 // =====================================================
@@ -687,8 +784,13 @@ TEST_CASE("Unicode Normalization – Blocked canonical composition")
     // NFD keeps exact order after canonical reorder
     REQUIRE(s.Normalize(NF::NFD).Equals(u8"a\u031B\u0301"));
 
-    // NFC must NOT compose “á̛” → should remain decomposed
-    REQUIRE(s.Normalize(NF::NFC).Equals(u8"a\u031B\u0301"));
+    // NFC composes a + 0301 across 031B: the horn's CCC is lower, so it does not block
+    REQUIRE(s.Normalize(NF::NFC).Equals(u8"\u00E1\u031B"));
+
+    // a starter in between does block
+    String starter(u8"ab\u0301");
+    REQUIRE(String(u8"a\u0301").Normalize(NF::NFC).Equals(u8"\u00E1"));
+    REQUIRE(starter.Normalize(NF::NFC).Equals(u8"ab\u0301"));
 }
 
 TEST_CASE("Unicode Normalization – Multi-mark composition (Vietnamese)")
@@ -771,6 +873,86 @@ TEST_CASE("Unicode Normalization – Fraktur letters")
     REQUIRE(frak.Normalize(NF::NFKC).Equals("H"));
 }
 
+// =====================================================
+//  QUICK CHECK + INCREMENTAL NORMALIZATION
+// =====================================================
+
+TEST_CASE("Unicode Normalization – Quick check properties")
+{
+    using UnicodeNormalization::GetQuickCheck;
+    using QC = UnicodeNormalization::QuickCheck;
+
+    REQUIRE(GetQuickCheck(CodePoint('a'), NF::NFC) == QC::Yes);
+    REQUIRE(GetQuickCheck(CodePoint(0x00E9), NF::NFC) == QC::Yes);
+    REQUIRE(GetQuickCheck(CodePoint(0x00E9), NF::NFD) == QC::No);
+    REQUIRE(GetQuickCheck(CodePoint(0x0301), NF::NFC) == QC::Maybe);   // composes with a preceding letter
+    REQUIRE(GetQuickCheck(CodePoint(0x0301), NF::NFD) == QC::Yes);
+    REQUIRE(GetQuickCheck(CodePoint(0x0340), NF::NFC) == QC::No);      // singleton decomposition
+    REQUIRE(GetQuickCheck(CodePoint(0x1161), NF::NFC) == QC::Maybe);   // Hangul V jamo
+    REQUIRE(GetQuickCheck(CodePoint(0xFB01), NF::NFC) == QC::Yes);
+    REQUIRE(GetQuickCheck(CodePoint(0xFB01), NF::NFKC) == QC::No);
+    REQUIRE(GetQuickCheck(CodePoint(0x00A0), NF::NFKD) == QC::No);
+}
+
+TEST_CASE("Unicode Normalization – IsNormalized agrees with Normalize")
+{
+    const char8_t* samples[] = {
+        u8"plain ascii",
+        u8"caf\u00E9 na\u00EFve",
+        u8"cafe\u0301",
+        u8"a\u0327\u0301 and a\u0301\u0327",
+        u8"\u1E0A\u0316 and D\u0316\u0307",
+        u8"\uAC00\u11A8 \u1100\u1161",
+        u8"\uFB01 \u00BC \u2460 \u212B",
+        u8"\u0301 leading mark",
+        u8"\u4E2D\u6587 \U0001F600",
+    };
+
+    for (const char8_t* sample : samples)
+    {
+        String s(sample);
+        for (NF form : { NF::NFC, NF::NFD, NF::NFKC, NF::NFKD })
+        {
+            String n = s.Normalize(form);
+            REQUIRE(s.IsNormalized(form) == s.Equals(n));
+            REQUIRE(n.IsNormalized(form));
+            REQUIRE(n.Normalize(form).Equals(n));
+        }
+    }
+}
+
+TEST_CASE("Unicode Normalization – Only the changed segments are rewritten")
+{
+    // long enough for a heap block
+    String prefix(u8"Les na\u00EFfs \u00E9l\u00E8ves de la for\u00EAt, ");
+    String text = prefix + String(u8"cafe\u0301") + String(u8" et cr\u00E8me \u00E0 l'\u00E9t\u00E9");
+    String expected = prefix + String(u8"caf\u00E9") + String(u8" et cr\u00E8me \u00E0 l'\u00E9t\u00E9");
+
+    // the span stops at the segment of the stray mark: "e" + U+0301
+    const uint32_t span = UnicodeNormalization::SpanNormalized(static_cast<const Char*>(text), text.GetByteCount(), NF::NFC);
+    REQUIRE(span == prefix.GetByteCount() + 3);
+
+    REQUIRE_FALSE(text.IsNormalized(NF::NFC));
+    REQUIRE(text.Normalize(NF::NFC).Equals(expected));
+
+    // normalized text comes back as is: same bytes, nothing allocated
+    REQUIRE(expected.IsNormalized(NF::NFC));
+    String same = expected.Normalize(NF::NFC);
+    REQUIRE(static_cast<const Char*>(same) == static_cast<const Char*>(expected));
+}
+
+TEST_CASE("Unicode Normalization – Ill-formed UTF-8")
+{
+    // overlong '/': normalization replaces it, so the text is not normalized
+    const char bad[] = "ab\xC0\xAF";
+    String s(bad, (u32)(sizeof(bad) - 1));
+
+    REQUIRE_FALSE(s.IsNormalized(NF::NFC));
+    String n = s.Normalize(NF::NFC);
+    REQUIRE(n.IsNormalized(NF::NFC));
+    REQUIRE(n.StartsWith("ab"));
+}
+
 // =====================================================
 //  STARTSWITH / ENDSWITH / CONTAINS — FULL TEST SUITE
 // =====================================================
@@ -2952,4 +3134,52 @@ TEST_CASE("String::Join — mixing ASCII and Emoji")
 {
     List<String> v = L({ "A","👍","B","😀" });
     REQUIRE(String::Join(String("|"), v) == "A|👍|B|😀");
-}
\ No newline at end of file
+}
+// ========================================================
+// Reference counting across threads, immortal strings
+// ========================================================
+
+TEST_CASE("String - copies shared between threads")
+{
+    String shared("a string long enough to live in a refcounted block");
+    REQUIRE(shared.GetReferenceCount() == 1);
+
+    std::thread workers[4];
+    for (auto& worker : workers)
+    {
+        worker = std::thread([&shared]() {
+            for (uint32_t i = 0; i < 20000; ++i)
+            {
+                String copy(shared);
+                String other = copy;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    REQUIRE(shared.GetReferenceCount() == 1);
+}
+
+TEST_CASE("String - immortal strings skip reference counting")
+{
+    String s("an immortal string that does not fit inline");
+    REQUIRE_FALSE(s.IsImmortal());
+    s.MakeImmortal();
+    REQUIRE(s.IsImmortal());
+
+    {
+        String copy(s);
+        REQUIRE(copy.IsImmortal());
+        REQUIRE(copy.GetReferenceCount() == 1);
+    }
+    REQUIRE(s.GetReferenceCount() == 1);
+
+    REQUIRE(String::Empty().IsImmortal());
+    REQUIRE(String("short").IsImmortal());
+
+    const String& literal = String::Literal<"text/html; charset=utf-8 (shared constant)">();
+    REQUIRE(literal.IsImmortal());
+    REQUIRE(&literal == &String::Literal<"text/html; charset=utf-8 (shared constant)">());
+    REQUIRE(literal == String("text/html; charset=utf-8 (shared constant)"));
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/StringBuilder.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/IO/Stream.hpp"
+#include "System/Arena.hpp"
+
+#include <string>
+
+// ------------------------------------------------------------
+// Tests for StringBuilder
+// Appends of every kind, ToString sharing the builder's block,
+// and appends after ToString leaving the returned String as it
+// was. Chunked mode: text split across chunks, arena chunks,
+// AppendFormatted, and WriteTo with gather writes.
+// ------------------------------------------------------------
+namespace
+{
+    // Keeps what is written; takes at most limit bytes per Write
+    class MemoryStream : public Stream
+    {
+    public:
+        explicit MemoryStream(uint64_t limit = ~0ull) : Limit(limit) {}
+
+        size_type Read(Byte*, size_type) noexcept override { return 0; }
+
+        size_type Write(const Byte* buffer, size_type count) noexcept override
+        {
+            const uint64_t n = (uint64_t)count < Limit ? (uint64_t)count : Limit;
+            Text.append(reinterpret_cast<const char*>(buffer), n);
+            ++Writes;
+            return n;
+        }
+
+        size_type WriteSegments(const Segment* segments, size_type count) noexcept override
+        {
+            ++Gathers;
+            return Stream::WriteSegments(segments, count);
+        }
+
+        void Flush() noexcept override {}
+        bool CanRead() const noexcept override { return false; }
+        bool CanWrite() const noexcept override { return true; }
+
+        std::string Text;
+        uint64_t Limit;
+        uint32_t Writes = 0;
+        uint32_t Gathers = 0;
+    };
+}
+
+TEST_CASE("StringBuilder - appends", "[StringBuilder]") {
+    StringBuilder sb;
+    REQUIRE(sb.IsEmpty());
+    REQUIRE(sb.ToString().IsEmpty());
+
+    sb.Append("caf").Append(CodePoint(0x00E9)).Append(Char(' '));
+    sb.Append(String("au lait"));
+    sb.AppendLine();
+    sb << "x=" << String("1");
+
+    const unsigned char bytes[] = { 0xE2, 0x82, 0xAC };
+    sb.Append(bytes, 3);
+
+    REQUIRE(sb.GetByteCount() == 20);
+    REQUIRE(sb.ToString() == String(u8"caf\u00E9 au lait\nx=1\u20AC"));
+
+    // invalid code points are dropped
+    sb.Append(CodePoint(0xD800));
+    REQUIRE(sb.GetByteCount() == 20);
+}
+
+TEST_CASE("StringBuilder - ToString shares the block", "[StringBuilder]") {
+    StringBuilder sb(256);
+    for (uint32_t i = 0; i < 10; ++i)
+        sb.Append("0123456789");
+
+    String first = sb.ToString();
+    String second = sb.ToString();
+    REQUIRE(first.GetByteCount() == 100);
+    REQUIRE(static_cast<const Char*>(first) == static_cast<const Char*>(second));
+    REQUIRE(first.GetReferenceCount() == 3);
+
+    // the next append moves the builder to its own block
+    sb.Append("!");
+    REQUIRE(first.GetByteCount() == 100);
+    REQUIRE(first.EndsWith(String("789")));
+    REQUIRE(sb.ToString().EndsWith(String("789!")));
+    REQUIRE(first.GetReferenceCount() == 2);
+
+    // short text is copied inline
+    StringBuilder small;
+    small.Append("short");
+    REQUIRE(small.ToString().IsSSO());
+}
+
+TEST_CASE("StringBuilder - Clear and reuse", "[StringBuilder]") {
+    StringBuilder sb;
+    for (uint32_t i = 0; i < 1000; ++i)
+        sb.AppendLine("line");
+    REQUIRE(sb.GetByteCount() == 5000);
+
+    const String all = sb.ToString();
+    sb.Clear();
+    REQUIRE(sb.IsEmpty());
+    REQUIRE(all.GetByteCount() == 5000);
+
+    sb.Append(String(u8"\u00FCber"));
+    sb.Append(all);
+    REQUIRE(sb.GetByteCount() == 5005);
+    REQUIRE(sb.ToString().StartsWith(String(u8"\u00FCberline\n")));
+    REQUIRE(sb.ToString().GetLength() == 5004);
+}
+
+TEST_CASE("StringBuilder - AppendFormatted", "[StringBuilder]") {
+    StringBuilder sb;
+    sb.AppendFormatted(-42).Append(Char(' '));
+    sb.AppendFormatted(18446744073709551615ull).Append(Char(' '));
+    sb.AppendFormatted((uint8_t)7).Append(Char(' '));
+    sb.AppendFormatted(2.5);
+    REQUIRE(sb.ToString() == String("-42 18446744073709551615 7 2.5"));
+
+    // the shortest text that reads back as the same value
+    sb.Clear();
+    sb.AppendFormatted(0.1f).Append(Char(' ')).AppendFormatted(0.1 + 0.2).Append(Char(' ')).AppendFormatted(1e21);
+    REQUIRE(sb.ToString() == String("0.1 0.30000000000000004 1E+21"));
+
+    sb.Clear();
+    sb.AppendFormatted("%s=%05d|%-4s|", "id", 42, "ab");
+    REQUIRE(sb.ToString() == String("id=00042|ab  |"));
+
+    // longer than the stack buffer
+    sb.Clear();
+    sb.AppendFormatted("%0300d", 1);
+    REQUIRE(sb.GetByteCount() == 300);
+    REQUIRE(sb.ToString().EndsWith(String("0001")));
+}
+
+TEST_CASE("StringBuilder - chunked mode", "[StringBuilder]") {
+    // small chunks: appends and code points straddle them
+    StringBuilder sb(StringBuilderMode::Chunked, 16);
+    REQUIRE(sb.GetMode() == StringBuilderMode::Chunked);
+    REQUIRE(sb.ToString().IsEmpty());
+
+    std::string expected;
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        sb.Append(String(u8"row \u00E9 ")).AppendFormatted(i).AppendLine();
+        expected += "row \xC3\xA9 " + std::to_string(i) + "\n";
+    }
+
+    REQUIRE(sb.GetByteCount() == expected.size());
+    const String flat = sb.ToString();
+    REQUIRE(flat == String(expected.data(), (u32)expected.size()));
+    REQUIRE(flat.GetReferenceCount() == 1);
+
+    // copies do not share chunks
+    StringBuilder copy(sb);
+    sb.Clear();
+    REQUIRE(sb.IsEmpty());
+    REQUIRE(copy.ToString() == flat);
+
+    sb.Append("again");
+    REQUIRE(sb.ToString() == String("again"));
+
+    StringBuilder moved(static_cast<StringBuilder&&>(copy));
+    REQUIRE(moved.ToString() == flat);
+    REQUIRE(copy.IsEmpty());
+}
+
+TEST_CASE("StringBuilder - chunks from an arena", "[StringBuilder]") {
+    Memory::Arena arena;
+    const u64 before = arena.GetBytesUsed();
+    {
+        StringBuilder sb(arena, 1024);
+        for (uint32_t i = 0; i < 100; ++i)
+            sb.Append("0123456789");
+
+        REQUIRE(sb.GetByteCount() == 1000);
+        REQUIRE(arena.GetBytesUsed() > before);
+        REQUIRE(sb.ToString().StartsWith(String("01234567890123456789")));
+    }
+    arena.Reset();
+    REQUIRE(arena.GetBytesUsed() == 0);
+}
+
+TEST_CASE("StringBuilder - WriteTo", "[StringBuilder]") {
+    std::string expected;
+    StringBuilder chunked(StringBuilderMode::Chunked, 100);
+    StringBuilder contiguous;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        chunked.Append("line ").AppendFormatted(i).AppendLine();
+        contiguous.Append("line ").AppendFormatted(i).AppendLine();
+        expected += "line " + std::to_string(i) + "\n";
+    }
+
+    MemoryStream out;
+    REQUIRE(chunked.WriteTo(out) == expected.size());
+    REQUIRE(out.Text == expected);
+
+    // 89 chunks of 100 bytes, 64 per gather write
+    REQUIRE(out.Gathers == 2);
+    REQUIRE(out.Writes == 89);
+
+    MemoryStream single;
+    REQUIRE(contiguous.WriteTo(single) == expected.size());
+    REQUIRE(single.Text == expected);
+    REQUIRE(single.Writes == 1);
+
+    // a stream that takes less than asked: both resume where it stopped
+    MemoryStream shortChunked(30);
+    REQUIRE(chunked.WriteTo(shortChunked) == expected.size());
+    REQUIRE(shortChunked.Text == expected);
+
+    MemoryStream shortContiguous(50);
+    REQUIRE(contiguous.WriteTo(shortContiguous) == expected.size());
+    REQUIRE(shortContiguous.Text == expected);
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Globals.hpp"
+#include "System/Marvin32.hpp"
+#include "System/WideHash.hpp"
+#include "System/Types/Text/String.hpp"
+#include "System/Types.hpp"
+
+#include <cstring>
+#include <random>
+#include <set>
+#include <vector>
+
+// ------------------------------------------------------------
+// Tests for string hashing: WideHash on its own (both paths,
+// every short length, seeds, single bit changes), and the hash
+// String caches in its block staying equal to StringView's for
+// the same bytes, through copies, slices and in-place appends,
+// under either algorithm. Only local strings are hashed while
+// the algorithm is switched, and it is restored afterwards.
+// ------------------------------------------------------------
+namespace
+{
+    // Heap sized: longer than the inline buffer
+    const char* const LongText = "a string long enough to live in a heap block";
+
+    struct AlgorithmScope
+    {
+        Phoenix::StringHashAlgorithm saved = Phoenix::STRING_HASH_ALGORITHM;
+
+        explicit AlgorithmScope(Phoenix::StringHashAlgorithm algorithm) { Phoenix::STRING_HASH_ALGORITHM = algorithm; }
+        ~AlgorithmScope() { Phoenix::STRING_HASH_ALGORITHM = saved; }
+    };
+
+    void RequireCacheMatchesView()
+    {
+        String s(LongText);
+        const uint32_t expected = StringView(LongText).GetHashCode();
+
+        REQUIRE(s.GetHashCode() == expected);
+        REQUIRE(s.GetHashCode() == expected);          // from the cache
+
+        const String copy = s;                         // same block
+        REQUIRE(copy.GetHashCode() == expected);
+
+        // a slice is not the whole block: it hashes its own bytes
+        const String slice = s.Substring(2, 6);
+        REQUIRE(slice.GetHashCode() == StringView("string").GetHashCode());
+        REQUIRE(s.GetHashCode() == expected);
+
+        // appending in place drops the cached value
+        String grown(LongText);
+        grown += String(" and then some more");
+        const uint32_t before = grown.GetHashCode();
+        grown += String("!");
+        REQUIRE(grown.GetHashCode() != before);
+        REQUIRE(grown.GetHashCode() == StringView(String(LongText) + String(" and then some more!")).GetHashCode());
+    }
+}
+
+TEST_CASE("WideHash - lengths, seeds and bit changes", "[StringHash]") {
+    std::mt19937_64 rng(25);
+    std::vector<uint8_t> bytes(256);
+    for (auto& b : bytes)
+        b = (uint8_t)rng();
+
+    const bool accelerated = WideHash::IsAccelerated();
+
+    // every prefix length hashes differently, on both paths
+    std::set<uint64_t> portable;
+    std::set<uint64_t> aes;
+    for (size_t len = 0; len <= bytes.size(); ++len)
+    {
+        portable.insert(WideHash::ComputePortable(bytes.data(), len, 1));
+        if (accelerated)
+            aes.insert(WideHash::ComputeAES(bytes.data(), len, 1));
+    }
+    REQUIRE(portable.size() == bytes.size() + 1);
+    if (accelerated)
+        REQUIRE(aes.size() == bytes.size() + 1);
+
+    // zeros of different lengths are not the same input
+    const uint8_t zeros[40] = {};
+    std::set<uint64_t> zeroHashes;
+    for (size_t len = 0; len <= sizeof(zeros); ++len)
+        zeroHashes.insert(WideHash::Compute(zeros, len, 7));
+    REQUIRE(zeroHashes.size() == sizeof(zeros) + 1);
+
+    for (size_t len : { 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 100 })
+    {
+        INFO(len);
+        const uint64_t h = WideHash::Compute(bytes.data(), len, 3);
+        REQUIRE(h == WideHash::Compute(bytes.data(), len, 3));
+        REQUIRE(h != WideHash::Compute(bytes.data(), len, 4));
+
+        // one bit anywhere changes about half of the output
+        for (size_t bit = 0; bit < len * 8; bit += 5)
+        {
+            bytes[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+            const uint64_t flipped = WideHash::Compute(bytes.data(), len, 3);
+            bytes[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+
+            const uint64_t diff = h ^ flipped;
+            uint32_t changed = 0;
+            for (uint32_t i = 0; i < 64; ++i)
+                changed += (uint32_t)((diff >> i) & 1);
+            REQUIRE(changed >= 12);
+            REQUIRE(changed <= 52);
+        }
+    }
+
+    if (accelerated)
+        REQUIRE(WideHash::Compute(bytes.data(), 50, 9) == WideHash::ComputeAES(bytes.data(), 50, 9));
+    else
+        REQUIRE(WideHash::Compute(bytes.data(), 50, 9) == WideHash::ComputePortable(bytes.data(), 50, 9));
+}
+
+TEST_CASE("String - cached hash", "[StringHash]") {
+    SECTION("Marvin32") {
+        AlgorithmScope scope(Phoenix::StringHashAlgorithm::Marvin32);
+        RequireCacheMatchesView();
+
+        const StringView view(LongText);
+        REQUIRE(view.GetHashCode() == Marvin32::Compute(reinterpret_cast<const uint8_t*>(LongText),
+            std::strlen(LongText), Phoenix::GLOBAL_HASH_SEED));
+    }
+
+    SECTION("Wide") {
+        AlgorithmScope scope(Phoenix::StringHashAlgorithm::Wide);
+        RequireCacheMatchesView();
+
+        const StringView view(LongText);
+        REQUIRE(view.GetHashCode() == WideHash::Fold(WideHash::Compute(reinterpret_cast<const uint8_t*>(LongText),
+            std::strlen(LongText), Phoenix::GLOBAL_HASH_SEED)));
+
+        // short strings, inline, are hashed the same way
+        REQUIRE(String("short").GetHashCode() == StringView("short").GetHashCode());
+    }
+
+    REQUIRE(String::Empty().GetHashCode() == 0u);
+}
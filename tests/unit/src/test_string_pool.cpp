@@ -0,0 +1,113 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/StringPool.hpp"
+#include "System/Collections/Dictionary.hpp"
+#include "System/Globalization/Locale.hpp"
+#include "System/Threading/Interlocked.hpp"
+
+#include <thread>
+
+// ------------------------------------------------------------
+// Tests for StringPool: one canonical block per value, cached
+// hashes, identity based equality, and concurrent interning.
+// The pool is process wide, so values here are unique to this
+// file and counters are checked as deltas.
+// ------------------------------------------------------------
+
+TEST_CASE("StringPool - canonical instances", "[StringPool]") {
+    String a = StringPool::Intern(String("pool.test.alpha"));
+    String b = StringPool::Intern("pool.test.alpha");
+    String c = StringPool::Intern(StringView("pool.test.alpha"));
+
+    REQUIRE(a.IsInterned());
+    REQUIRE(a.IsImmortal());
+    REQUIRE(a == String("pool.test.alpha"));
+
+    // same block for every caller, even for a short (inline sized) value
+    REQUIRE(static_cast<const Char*>(a) == static_cast<const Char*>(b));
+    REQUIRE(static_cast<const Char*>(a) == static_cast<const Char*>(c));
+
+    // interning a canonical string returns it as is
+    REQUIRE(static_cast<const Char*>(StringPool::Intern(a)) == static_cast<const Char*>(a));
+
+    // plain copies and slices are not canonical
+    REQUIRE_FALSE(String("pool.test.alpha").IsInterned());
+    REQUIRE_FALSE(a.Substring(0, 4).IsInterned());
+
+    REQUIRE(StringPool::Intern(String::Empty()).IsEmpty());
+}
+
+TEST_CASE("StringPool - hashing and equality", "[StringPool]") {
+    String a = StringPool::Intern("pool.test.hash.one");
+    String b = StringPool::Intern("pool.test.hash.two");
+    String plain("pool.test.hash.one");
+
+    // the cached hash is the ordinary one
+    REQUIRE(a.GetHashCode() == plain.GetHashCode());
+    REQUIRE(a.GetHashCode() == StringView("pool.test.hash.one").GetHashCode());
+
+    REQUIRE(a.Equals(plain));
+    REQUIRE(plain.Equals(a));
+    REQUIRE_FALSE(a.Equals(b));
+    REQUIRE(String::Compare(a, StringPool::Intern("pool.test.hash.one"), false, Locale("en")) == 0);
+    REQUIRE(String::Compare(a, b, false, Locale("en")) < 0);
+
+    Map<String, u32> map;
+    map.Insert(a, 1u);
+    map.Insert(b, 2u);
+    REQUIRE(*map.Find(StringPool::Intern("pool.test.hash.two")) == 2u);
+    REQUIRE(*map.Find(plain) == 1u);
+    REQUIRE(*map.Find(StringView("pool.test.hash.one")) == 1u);
+}
+
+TEST_CASE("StringPool - TryGet and statistics", "[StringPool]") {
+    String canonical;
+    REQUIRE_FALSE(StringPool::TryGet("pool.test.stats.a-value-past-the-inline-size", canonical));
+
+    const StringPool::Statistics before = StringPool::GetStatistics();
+
+    String first = StringPool::Intern("pool.test.stats.a-value-past-the-inline-size");
+    for (int i = 0; i < 9; ++i)
+        StringPool::Intern(String("pool.test.stats.a-value-past-the-inline-size"));
+
+    const StringPool::Statistics after = StringPool::GetStatistics();
+    REQUIRE(after.Strings - before.Strings == 1u);
+    REQUIRE(after.Lookups - before.Lookups == 10u);
+    REQUIRE(after.Hits - before.Hits == 9u);
+    REQUIRE(after.BytesStored > before.BytesStored);
+    REQUIRE(after.BytesSaved - before.BytesSaved == (after.BytesStored - before.BytesStored) * 9);
+
+    REQUIRE(StringPool::TryGet("pool.test.stats.a-value-past-the-inline-size", canonical));
+    REQUIRE(static_cast<const Char*>(canonical) == static_cast<const Char*>(first));
+}
+
+TEST_CASE("StringPool - concurrent interning", "[StringPool][threads]") {
+    constexpr uint32_t Values = 2000;
+    const Char* seen[Values] = {};
+    volatile uint32_t mismatches = 0;
+
+    std::thread workers[4];
+    for (auto& worker : workers)
+    {
+        worker = std::thread([&]() {
+            for (uint32_t i = 0; i < Values; ++i)
+            {
+                String s = StringPool::Intern(String("pool.test.threads.") + u32(i).ToString());
+                const Char* block = static_cast<const Char*>(s);
+
+                // the first thread to see a value records its block; the rest must agree
+                const Char* expected = Interlocked::CompareExchange(&seen[i], block, (const Char*)nullptr);
+                if (expected != nullptr && expected != block)
+                    Interlocked::Increment(&mismatches);
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    REQUIRE(mismatches == 0u);
+    for (uint32_t i = 0; i < Values; ++i)
+        REQUIRE(StringPool::Intern(String("pool.test.threads.") + u32(i).ToString()).IsInterned());
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Types/Text/String.hpp"
+#include "System/Types/Text/StringView.hpp"
+
+// ------------------------------------------------------------
+// Tests for StringView and the String overloads that take one
+// Byte level search / Split must cut the same pieces as String,
+// and literals or foreign buffers must not need a String first.
+// ------------------------------------------------------------
+
+TEST_CASE("StringView - search and slices", "[StringView]") {
+    const char buffer[] = "GET /index.html HTTP/1.1\r\nHost: x\r\n\r\n";
+    StringView request(buffer, (uint32_t)(sizeof(buffer) - 1));
+
+    REQUIRE(request.StartsWith("GET "));
+    REQUIRE(request.EndsWith("\r\n\r\n"));
+    REQUIRE(request.Contains("Host:"));
+    REQUIRE_FALSE(request.Contains("Cookie"));
+
+    const int64_t eol = request.IndexOf("\r\n");
+    REQUIRE(eol == 24);
+    REQUIRE(request.IndexOf("\r\n", (uint32_t)eol + 2) == 33);
+    REQUIRE(request.IndexOf('/', 5) == 20);
+    REQUIRE(request.IndexOf("\r\n", 1000) == -1);
+
+    StringView line = request.Slice(0, (uint32_t)eol);
+    REQUIRE(line == StringView("GET /index.html HTTP/1.1"));
+    REQUIRE(request.Slice(1000).IsEmpty());
+    REQUIRE(StringView("  \tpadded \r\n").Trim() == StringView("padded"));
+}
+
+TEST_CASE("StringView - Split returns views into the buffer", "[StringView]") {
+    StringView csv("a,,b , c,");
+
+    List<StringView> all = csv.Split(',');
+    REQUIRE(all.Count() == 5);
+    REQUIRE(all[0] == StringView("a"));
+    REQUIRE(all[1].IsEmpty());
+    REQUIRE(all[2] == StringView("b "));
+    REQUIRE(all[4].IsEmpty());
+    REQUIRE(all[3] == StringView(" c"));
+    REQUIRE(all[3].GetData() == csv.GetData() + 6);
+
+    List<StringView> clean = csv.Split(",", StringSplitOptions::RemoveEmptyEntries | StringSplitOptions::TrimEntries);
+    REQUIRE(clean.Count() == 3);
+    REQUIRE(clean[1] == StringView("b"));
+    REQUIRE(clean[2] == StringView("c"));
+
+    REQUIRE(StringView("").Split(',').Count() == 1);
+    REQUIRE(StringView("abc").Split("").Count() == 1);
+}
+
+TEST_CASE("StringView - ASCII flag", "[StringView]") {
+    REQUIRE(StringView("plain").IsASCII());
+    REQUIRE_FALSE(StringView(reinterpret_cast<const char*>(u8"caf\u00E9")).IsASCII());
+
+    // String hands over its flag once it has one, before and after
+    String ascii("header-name");
+    REQUIRE(StringView(ascii).IsASCII());
+    REQUIRE(ascii.IndexOf("name") == 7);
+    REQUIRE(StringView(ascii).IsASCII());
+
+    String wide(u8"\u00FCber");
+    REQUIRE_FALSE(StringView(wide).IsASCII());
+    REQUIRE(wide.IndexOf("er") == 2);
+    REQUIRE_FALSE(StringView(wide).IsASCII());
+    REQUIRE(StringView(wide).Slice(2).IsASCII());
+}
+
+TEST_CASE("String - view overloads agree with the String ones", "[StringView][String]") {
+    String s(u8"na\u00EFve caf\u00E9, na\u00EFve");
+    const char8_t* raw = u8"caf\u00E9";
+    StringView cafe(reinterpret_cast<const char*>(raw));
+
+    REQUIRE(s.Contains(cafe));
+    REQUIRE(s.IndexOf(cafe) == s.IndexOf(String(raw)));
+    REQUIRE(s.IndexOf(cafe) == 6);
+    REQUIRE(s.IndexOf(StringView(reinterpret_cast<const char*>(u8"na\u00EFve")), 1) == 12);
+    REQUIRE(s.StartsWith(StringView(reinterpret_cast<const char*>(u8"na\u00EF"))));
+    REQUIRE(s.EndsWith(StringView(reinterpret_cast<const char*>(u8"\u00EFve"))));
+    REQUIRE_FALSE(s.Contains(StringView("cafe")));
+
+    String ascii("key=value;other=thing");
+    REQUIRE(ascii.Contains("other"));
+    REQUIRE(ascii.IndexOf("value") == 4);
+    REQUIRE(ascii.StartsWith("key="));
+    REQUIRE(ascii.EndsWith("thing"));
+    REQUIRE(ascii.Equals(StringView(ascii)));
+    REQUIRE_FALSE(ascii.Equals("key"));
+    REQUIRE(ascii == "key=value;other=thing");
+    REQUIRE(ascii != "key");
+    REQUIRE("key=value;other=thing" == ascii);
+}
+
+TEST_CASE("String - Split by a view", "[StringView][String]") {
+    String s(u8"\u00E9t\u00E9 :: hiver :: ");
+
+    List<String> parts = s.Split("::", StringSplitOptions::TrimEntries | StringSplitOptions::RemoveEmptyEntries);
+    REQUIRE(parts.Count() == 2);
+    REQUIRE(parts[0] == String(u8"\u00E9t\u00E9"));
+    REQUIRE(parts[1] == "hiver");
+
+    List<String> bySeparator = s.Split(String("::"));
+    List<String> byView = s.Split(StringView("::"));
+    REQUIRE(bySeparator.Count() == byView.Count());
+    for (uint32_t i = 0; i < byView.Count(); ++i)
+        REQUIRE(bySeparator[i] == byView[i]);
+
+    REQUIRE(String("a b c").Split(" ", 2, StringSplitOptions::None).Count() == 2);
+}
+
+TEST_CASE("String - Concat borrows UTF-8 arguments", "[StringView][String]") {
+    const char buffer[] = "payload-bytes";
+    String head("head:");
+
+    String joined = String::Concat(head, StringArg(buffer, 7), StringView(buffer + 7, 6), "!", u8"\u00E9", u"\u00FC");
+    REQUIRE(joined == String(u8"head:payload-bytes!\u00E9\u00FC"));
+
+    // past the inline capacity the same pieces go to a heap block
+    String longer = String::Concat(joined, joined, joined, " ", StringView(buffer));
+    REQUIRE(longer.GetByteCount() == joined.GetByteCount() * 3 + 1 + 13);
+    REQUIRE(longer.EndsWith(" payload-bytes"));
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextKernels.hpp"
+#include "System/Text/UTF8.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for the TextKernels scans
+// Every implementation this CPU supports must agree with the
+// scalar one; inputs straddle the 16 / 32 byte vector blocks.
+// ------------------------------------------------------------
+namespace
+{
+    using namespace TextKernels;
+
+    struct Case
+    {
+        const char* bytes;
+        bool valid;
+    };
+
+    const Case Cases[] = {
+        { "", true },
+        { "plain ascii", true },
+        { "\xC3\xA9", true },                  // U+00E9
+        { "\xE2\x82\xAC", true },              // U+20AC
+        { "\xF0\x9F\x98\x80", true },          // U+1F600
+        { "\xF4\x8F\xBF\xBF", true },          // U+10FFFF
+        { "\xED\x9F\xBF", true },              // U+D7FF
+        { "\xEE\x80\x80", true },              // U+E000
+        { "\x80", false },                     // lone continuation
+        { "\xC3", false },                     // truncated
+        { "\xE2\x82", false },
+        { "\xF0\x9F\x98", false },
+        { "\xC0\xAF", false },                 // overlong '/'
+        { "\xC1\xBF", false },
+        { "\xE0\x9F\xBF", false },             // overlong 3 byte
+        { "\xF0\x8F\xBF\xBF", false },         // overlong 4 byte
+        { "\xED\xA0\x80", false },             // U+D800
+        { "\xED\xBF\xBF", false },             // U+DFFF
+        { "\xF4\x90\x80\x80", false },         // U+110000
+        { "\xF5\x80\x80\x80", false },
+        { "\xFF", false },
+        { "\xC3\xA9\xA9", false },             // one continuation too many
+        { "\xE2\x41\xAC", false },
+    };
+
+    List<const Kernels*> Available()
+    {
+        List<const Kernels*> kernels;
+        for (Level level : { Level::Scalar, Level::SSE2, Level::AVX2 })
+        {
+            if (const Kernels* k = ForLevel(level))
+                kernels.Add(k);
+        }
+        return kernels;
+    }
+
+    // text placed at offset inside a run of 'a', total length bytes
+    List<uint8_t> Embed(const char* text, uint32_t offset, uint32_t length)
+    {
+        const uint32_t n = (uint32_t)strlen(text);
+        List<uint8_t> out;
+        for (uint32_t i = 0; i < length; ++i)
+            out.Add((uint8_t)'a');
+        for (uint32_t i = 0; i < n && offset + i < length; ++i)
+            out[offset + i] = (uint8_t)text[i];
+        return out;
+    }
+
+    bool AllBelow80(const List<uint8_t>& bytes)
+    {
+        for (uint64_t i = 0; i < bytes.Count(); ++i)
+        {
+            if (bytes[i] & 0x80)
+                return false;
+        }
+        return true;
+    }
+
+    uint64_t CountLeadBytes(const List<uint8_t>& bytes)
+    {
+        uint64_t count = 0;
+        for (uint64_t i = 0; i < bytes.Count(); ++i)
+            count += (bytes[i] & 0xC0) != 0x80 ? 1 : 0;
+        return count;
+    }
+}
+
+TEST_CASE("TextKernels - known sequences", "[TextKernels]") {
+    for (const Kernels* k : Available())
+    {
+        for (const Case& c : Cases)
+        {
+            const uint64_t n = strlen(c.bytes);
+            INFO("level " << (int)k->level << ", case " << c.bytes);
+            REQUIRE(k->IsValidUTF8((const uint8_t*)c.bytes, n) == c.valid);
+        }
+    }
+}
+
+TEST_CASE("TextKernels - every block position", "[TextKernels]") {
+    for (const Kernels* k : Available())
+    {
+        for (const Case& c : Cases)
+        {
+            if (c.bytes[0] == 0)
+                continue;
+
+            const uint32_t n = (uint32_t)strlen(c.bytes);
+            for (uint32_t offset = 0; offset < 70; ++offset)
+            {
+                // the sequence in the middle, then cut off right after it
+                for (uint32_t length : { offset + n, 100u })
+                {
+                    List<uint8_t> bytes = Embed(c.bytes, offset, length);
+                    INFO("level " << (int)k->level << ", offset " << offset << ", length " << length);
+
+                    REQUIRE(k->IsValidUTF8(bytes.Data(), bytes.Count()) == c.valid);
+                    REQUIRE(k->IsASCII(bytes.Data(), bytes.Count()) == AllBelow80(bytes));
+                    REQUIRE(k->CountCodePoints(bytes.Data(), bytes.Count()) == CountLeadBytes(bytes));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TextKernels - long inputs", "[TextKernels]") {
+    // 300 KB of mixed width text: the per byte counters of the vector paths wrap every 255 blocks
+    List<uint8_t> bytes;
+    const char* piece = "h\xC3\xA9llo w\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80 ";
+    while (bytes.Count() < 300000)
+    {
+        for (const char* p = piece; *p; ++p)
+            bytes.Add((uint8_t)*p);
+    }
+
+    List<uint8_t> ascii(300000, (uint8_t)'x');
+
+    for (const Kernels* k : Available())
+    {
+        REQUIRE(k->IsValidUTF8(bytes.Data(), bytes.Count()));
+        REQUIRE(k->CountCodePoints(bytes.Data(), bytes.Count()) == CountLeadBytes(bytes));
+        REQUIRE(k->IsASCII(ascii.Data(), ascii.Count()));
+        REQUIRE(k->IsValidUTF8(ascii.Data(), ascii.Count()));
+
+        // a single bad byte near the end
+        ascii[299990] = 0xFF;
+        REQUIRE_FALSE(k->IsASCII(ascii.Data(), ascii.Count()));
+        REQUIRE_FALSE(k->IsValidUTF8(ascii.Data(), ascii.Count()));
+        ascii[299990] = (uint8_t)'x';
+    }
+}
+
+TEST_CASE("TextKernels - FindPair and FindPairLast", "[TextKernels][TextSearch]") {
+    // 'x' at every pair position across the vector blocks, in a run of 'a'
+    for (const Kernels* k : Available())
+    {
+        for (uint32_t length : { 1u, 15u, 16u, 33u, 70u })
+        {
+            for (uint32_t distance = 0; distance < 40; distance += 3)
+            {
+                for (uint32_t at = 0; at + distance < length; ++at)
+                {
+                    List<uint8_t> bytes(length, (uint8_t)'a');
+                    bytes[at] = (uint8_t)'x';
+                    bytes[at + distance] = distance == 0 ? (uint8_t)'x' : (uint8_t)'y';
+                    const uint8_t second = distance == 0 ? (uint8_t)'x' : (uint8_t)'y';
+                    INFO("level " << (int)k->level << ", length " << length << ", distance " << distance << ", at " << at);
+
+                    REQUIRE(k->FindPair(bytes.Data(), length, 'x', second, distance) == at);
+                    REQUIRE(k->FindPairLast(bytes.Data(), length, 'x', second, distance) == at);
+                    REQUIRE(k->FindPair(bytes.Data(), length, 'y', 'x', distance + 1) == length);
+                }
+
+                // both ends of the pair must match; all 'a' has a pair everywhere
+                List<uint8_t> run(length, (uint8_t)'a');
+                const uint64_t expectedLast = distance < length ? length - distance - 1 : length;
+                REQUIRE(k->FindPair(run.Data(), length, 'a', 'a', distance) == (distance < length ? 0 : length));
+                REQUIRE(k->FindPairLast(run.Data(), length, 'a', 'a', distance) == expectedLast);
+            }
+        }
+    }
+}
+
+TEST_CASE("TextKernels - FindAny and FindAnyLast", "[TextKernels][TextMatcher]") {
+    // every byte value, below and above 0x80, across the vector blocks
+    for (const Kernels* k : Available())
+    {
+        for (uint32_t value = 0; value < 256; ++value)
+        {
+            const uint8_t b = (uint8_t)value;
+            const uint8_t filler = (b & 0x7F) == 'a' ? (uint8_t)'b' : (uint8_t)'a';
+
+            TextKernels::ByteSetTable set{};
+            TextKernels::Add(set, b);
+            TextKernels::Add(set, (uint8_t)(b ^ 0x80));
+            REQUIRE(TextKernels::Contains(set, b));
+            REQUIRE_FALSE(TextKernels::Contains(set, filler));
+
+            for (uint32_t length : { 1u, 31u, 32u, 70u })
+            {
+                List<uint8_t> bytes(length, filler);
+                REQUIRE(k->FindAny(bytes.Data(), length, set) == length);
+                REQUIRE(k->FindAnyLast(bytes.Data(), length, set) == length);
+
+                for (uint32_t at = 0; at < length; at += 7)
+                {
+                    bytes[at] = b;
+                    INFO("level " << (int)k->level << ", byte " << value << ", length " << length << ", at " << at);
+                    REQUIRE(k->FindAny(bytes.Data(), length, set) == at);
+                    REQUIRE(k->FindAnyLast(bytes.Data(), length, set) == at);
+                    bytes[at] = filler;
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TextKernels - String and UTF8 agree with the decoder", "[TextKernels][String]") {
+    String valid(u8"naïve café € \U0001F600 and some ascii to cross a block");
+    REQUIRE(valid.GetCodePointsCount() == String::DecodeToCodePoints(valid).Count());
+    REQUIRE(UTF8::IsValid(static_cast<const Char*>(valid), (uint32_t)valid.GetByteCount()));
+
+    // malformed bytes become one U+FFFD each, whichever path counts them
+    const char bad[] = "ab\xC0\xAF" "cd\xED\xA0\x80" "ef\xF0\x9F\x98";
+    String invalid(bad, (u32)(sizeof(bad) - 1));
+    REQUIRE_FALSE(UTF8::IsValid(static_cast<const Char*>(invalid), (uint32_t)invalid.GetByteCount()));
+    REQUIRE(invalid.GetCodePointsCount() == String::DecodeToCodePoints(invalid).Count());
+
+    List<CodePoint> cps;
+    UTF8::Decode(static_cast<const Char*>(valid), (uint32_t)valid.GetByteCount(), cps);
+    REQUIRE(String(cps) == valid);
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextMatcher.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for TextMatcher
+// Character sets (ByteSet) and string sets (Aho-Corasick):
+// leftmost-longest Find, rightmost FindLast, overlapping and
+// nested patterns, code point boundaries, and the String
+// overloads that take a matcher.
+// ------------------------------------------------------------
+namespace
+{
+    List<StringView> Views(std::initializer_list<const char*> patterns)
+    {
+        List<StringView> out;
+        for (const char* p : patterns)
+            out.Add(StringView(p));
+        return out;
+    }
+
+    List<Char> Chars(const char* chars)
+    {
+        List<Char> out;
+        for (const char* p = chars; *p; ++p)
+            out.Add(Char(*p));
+        return out;
+    }
+}
+
+TEST_CASE("TextMatcher - characters", "[TextMatcher]") {
+    const TextMatcher m(Chars(",;|"));
+    TextMatcher::Match match{};
+
+    const char* text = "alpha;beta,gamma|delta";
+    REQUIRE(m.Find(text, 22, 0, match));
+    REQUIRE(match.Offset == 5);
+    REQUIRE(match.Length == 1);
+    REQUIRE(m.Find(text, 22, 6, match));
+    REQUIRE(match.Offset == 10);
+    REQUIRE(m.FindLast(text, 22, match));
+    REQUIRE(match.Offset == 16);
+    REQUIRE_FALSE(m.Find(text, 5, 0, match));
+
+    REQUIRE(TextMatcher(List<Char>()).IsEmpty());
+}
+
+TEST_CASE("TextMatcher - strings, leftmost then longest", "[TextMatcher]") {
+    const TextMatcher m(Views({ "he", "she", "his", "hers" }));
+    TextMatcher::Match match{};
+
+    // "she" starts before "he" and "hers" inside it
+    REQUIRE(m.Find("ushers", 6, 0, match));
+    REQUIRE(match.Offset == 1);
+    REQUIRE(match.Length == 3);
+
+    // "hers" is longer than "he" at the same start
+    REQUIRE(m.Find("ushers", 6, 2, match));
+    REQUIRE(match.Offset == 2);
+    REQUIRE(match.Length == 4);
+
+    REQUIRE(m.FindLast("his hers she", 12, match));
+    REQUIRE(match.Offset == 10);
+    REQUIRE(match.Length == 2);
+
+    REQUIRE_FALSE(m.Find("xyz", 3, 0, match));
+    REQUIRE(m.GetMaxLength() == 4);
+}
+
+TEST_CASE("TextMatcher - nested and repeated patterns", "[TextMatcher]") {
+    const TextMatcher m(Views({ "aab", "ab", "b", "" }));
+    TextMatcher::Match match{};
+
+    REQUIRE(m.Find("aaab", 4, 0, match));
+    REQUIRE(match.Offset == 1);
+    REQUIRE(match.Length == 3);
+
+    REQUIRE(m.Find("xxbab", 5, 0, match));
+    REQUIRE(match.Offset == 2);
+    REQUIRE(match.Length == 1);
+}
+
+TEST_CASE("TextMatcher - code point boundaries", "[TextMatcher][UTF8]") {
+    // U+00E9 is C3 A9: a set holding A9 never matches inside it
+    List<Char> chars;
+    chars.Add(Char('\xA9'));
+    chars.Add(Char('!'));
+    const TextMatcher m(chars);
+    TextMatcher::Match match{};
+
+    const char* text = "caf\xC3\xA9!";
+    REQUIRE(m.Find(text, 6, 0, match));
+    REQUIRE(match.Offset == 5);
+
+    const TextMatcher words(Views({ "\xC3\xA9", "\xA9!" }));
+    REQUIRE(words.Find(text, 6, 0, match));
+    REQUIRE(match.Offset == 3);
+    REQUIRE(match.Length == 2);
+}
+
+TEST_CASE("String - IndexOfAny and LastIndexOfAny", "[TextMatcher][String]") {
+    String s(u8"\u00E9t\u00E9, caf\u00E9; na\u00EFve");
+
+    // code point indices
+    REQUIRE(s.IndexOfAny(Chars(",;")) == 3);
+    REQUIRE(s.IndexOfAny(Chars(",;"), 4) == 9);
+    REQUIRE(s.IndexOfAny(Chars(",;"), 4, 3) == -1);
+    REQUIRE(s.LastIndexOfAny(Chars(",;")) == 9);
+    REQUIRE(s.LastIndexOfAny(Chars(",;"), 8) == 3);
+    REQUIRE(s.IndexOfAny(Chars("xyz")) == -1);
+
+    const TextMatcher words(Views({ "caf\xC3\xA9", "na" }));
+    REQUIRE(s.IndexOfAny(words) == 5);
+    REQUIRE(s.IndexOfAny(words, 6) == 11);
+    REQUIRE(s.LastIndexOfAny(words) == 11);
+}
+
+TEST_CASE("String - Split and Replace with a TextMatcher", "[TextMatcher][String]") {
+    // a log line cut on several delimiters at once
+    String line("2024-01-05 10:22:31 [worker-3] get /api/v1 => 200 (12ms)");
+    const TextMatcher delimiters(Views({ " ", "[", "]", " => ", "(", ")" }));
+
+    List<String> parts = line.Split(delimiters, StringSplitOptions::RemoveEmptyEntries);
+    REQUIRE(parts.Count() == 7);
+    REQUIRE(parts[0] == String("2024-01-05"));
+    REQUIRE(parts[1] == String("10:22:31"));
+    REQUIRE(parts[2] == String("worker-3"));
+    REQUIRE(parts[5] == String("200"));
+    REQUIRE(parts[6] == String("12ms"));
+
+    // same cuts as the List<String> overload
+    List<String> seps;
+    seps.Add(String(" "));
+    seps.Add(String(" => "));
+    List<String> viaList = line.Split(seps, StringSplitOptions::None);
+    List<String> viaMatcher = line.Split(TextMatcher(seps), StringSplitOptions::None);
+    REQUIRE(viaList.Count() == viaMatcher.Count());
+    for (uint64_t i = 0; i < viaList.Count(); ++i)
+        REQUIRE(viaList[i] == viaMatcher[i]);
+
+    REQUIRE(line.Split(delimiters, 2, StringSplitOptions::None).Count() == 2);
+
+    String text(u8"red, gr\u00FCn; blue|red");
+    const TextMatcher colors(Views({ "red", "gr\xC3\xBCn", "blue" }));
+    REQUIRE(text.Replace(colors, String("#")) == String("#, #; #|#"));
+    REQUIRE(text.Replace(TextMatcher(Chars(",;|")), String()) == String(u8"red gr\u00FCn bluered"));
+    REQUIRE(text.Replace(TextMatcher(Chars("@")), String("!")) == text);
+}
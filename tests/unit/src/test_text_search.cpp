@@ -0,0 +1,137 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/TextSearch.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for TextSearch
+// Every needle length (1 byte, pair filter, Two-Way) against a
+// naive scan, including periodic needles that push the filter
+// over to Two-Way, and the String operations built on it.
+// ------------------------------------------------------------
+namespace
+{
+    const uint8_t* Bytes(const char* text)
+    {
+        return reinterpret_cast<const uint8_t*>(text);
+    }
+
+    int64_t NaiveIndexOf(const List<uint8_t>& hay, const List<uint8_t>& needle, uint64_t start)
+    {
+        for (uint64_t i = start; i + needle.Count() <= hay.Count(); ++i)
+        {
+            uint64_t k = 0;
+            while (k < needle.Count() && hay[i + k] == needle[k]) ++k;
+            if (k == needle.Count())
+                return (int64_t)i;
+        }
+        return -1;
+    }
+
+    int64_t NaiveLastIndexOf(const List<uint8_t>& hay, const List<uint8_t>& needle)
+    {
+        for (int64_t i = (int64_t)hay.Count() - (int64_t)needle.Count(); i >= 0; --i)
+        {
+            uint64_t k = 0;
+            while (k < needle.Count() && hay[(uint64_t)i + k] == needle[k]) ++k;
+            if (k == needle.Count())
+                return i;
+        }
+        return -1;
+    }
+
+    // deterministic bytes from a small alphabet, mostly its first letter
+    List<uint8_t> Sample(uint32_t& seed, uint64_t length, const char* alphabet, uint32_t alphabetLength)
+    {
+        List<uint8_t> out(length);
+        for (uint64_t i = 0; i < length; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            const uint32_t r = (seed >> 16) & 0x7FFF;
+            out.Add((uint8_t)alphabet[r % 8 == 0 ? r % alphabetLength : 0]);
+        }
+        return out;
+    }
+}
+
+TEST_CASE("TextSearch - agrees with a naive scan", "[TextSearch]") {
+    uint32_t seed = 7;
+    for (uint32_t round = 0; round < 3000; ++round)
+    {
+        const uint64_t hayLength = round % 10 == 0 ? 2000 : round % 97;
+        const uint64_t needleLength = round % 7 == 0 ? 40 + round % 30 : round % 9;
+        const List<uint8_t> hay = Sample(seed, hayLength, "abc", 3);
+        const List<uint8_t> needle = Sample(seed, needleLength, "abc", 3);
+        const uint64_t start = round % 5;
+        INFO("round " << round << ", hay " << hayLength << ", needle " << needleLength);
+
+        const int64_t expected = start > hayLength ? -1 : NaiveIndexOf(hay, needle, start);
+        REQUIRE(TextSearch::IndexOf(hay.Data(), hayLength, needle.Data(), needleLength, start) == expected);
+        REQUIRE(TextSearch::Searcher(needle.Data(), needleLength).IndexOf(hay.Data(), hayLength, start) == expected);
+
+        const int64_t expectedLast = needleLength == 0 ? (int64_t)hayLength : NaiveLastIndexOf(hay, needle);
+        REQUIRE(TextSearch::LastIndexOf(hay.Data(), hayLength, needle.Data(), needleLength) == expectedLast);
+    }
+}
+
+TEST_CASE("TextSearch - periodic and pathological needles", "[TextSearch]") {
+    // a^n b in a^m, a^n in a^m b: the filter keeps failing and hands over
+    List<uint8_t> hay(100000, (uint8_t)'a');
+    for (uint64_t n : { 2u, 7u, 31u, 32u, 33u, 500u })
+    {
+        List<uint8_t> needle(n, (uint8_t)'a');
+        needle[n - 1] = (uint8_t)'b';
+        INFO("needle length " << n);
+
+        REQUIRE(TextSearch::IndexOf(hay.Data(), hay.Count(), needle.Data(), n) == -1);
+        REQUIRE(TextSearch::LastIndexOf(hay.Data(), hay.Count(), needle.Data(), n) == -1);
+
+        hay[77777] = (uint8_t)'b';
+        REQUIRE(TextSearch::IndexOf(hay.Data(), hay.Count(), needle.Data(), n) == (int64_t)(77777 - (n - 1)));
+        REQUIRE(TextSearch::LastIndexOf(hay.Data(), hay.Count(), needle.Data(), n) == (int64_t)(77777 - (n - 1)));
+        hay[77777] = (uint8_t)'a';
+
+        needle[n - 1] = (uint8_t)'a';
+        REQUIRE(TextSearch::IndexOf(hay.Data(), hay.Count(), needle.Data(), n, 12345) == 12345);
+        REQUIRE(TextSearch::LastIndexOf(hay.Data(), hay.Count(), needle.Data(), n) == (int64_t)(hay.Count() - n));
+    }
+}
+
+TEST_CASE("TextSearch - code point boundaries", "[TextSearch][UTF8]") {
+    // U+00E9 is C3 A9, U+00A9 is C2 A9, then a stray A9
+    const char* hay = "caf\xC3\xA9 \xC2\xA9 \xA9";
+    const uint64_t length = strlen(hay);
+
+    REQUIRE(TextSearch::IndexOf(Bytes(hay), length, Bytes("\xA9"), 1) == 4);
+    REQUIRE(TextSearch::IndexOfUTF8(Bytes(hay), length, Bytes("\xA9"), 1) == -1);
+    REQUIRE(TextSearch::LastIndexOfUTF8(Bytes(hay), length, Bytes("\xC2"), 1) == -1);
+    REQUIRE(TextSearch::IndexOfUTF8(Bytes(hay), length, Bytes("\xC3\xA9"), 2) == 3);
+    REQUIRE(TextSearch::LastIndexOfUTF8(Bytes(hay), length, Bytes(" \xC2\xA9"), 3) == 5);
+
+    REQUIRE(TextSearch::Searcher(Bytes("\xA9"), 1).Count(Bytes(hay), length) == 0);
+    // the second space is followed by the stray byte: no boundary after it
+    REQUIRE(TextSearch::Searcher(Bytes(" "), 1).Count(Bytes(hay), length) == 1);
+}
+
+TEST_CASE("String - search operations on UTF-8", "[TextSearch][String]") {
+    String s(u8"\u00E9t\u00E9 \u2192 \u00E9t\u00E9 \U0001F600 \u00E9t\u00E9");
+
+    // code point indices, not bytes
+    REQUIRE(s.IndexOf(String(u8"\u00E9t\u00E9")) == 0);
+    REQUIRE(s.IndexOf(String(u8"\u00E9t\u00E9"), 1) == 6);
+    REQUIRE(s.IndexOf(String(u8"\U0001F600")) == 10);
+    REQUIRE(s.LastIndexOf(String(u8"\u00E9t\u00E9")) == 12);
+    REQUIRE(s.LastIndexOf(String(u8"\u00E9t\u00E9"), 11) == 6);
+    REQUIRE(s.Contains(String(u8"\u2192")));
+    REQUIRE_FALSE(s.Contains(String(u8"\u00E9\u00E9")));
+
+    REQUIRE(s.Replace(String(u8"\u00E9t\u00E9"), String("summer")) == String(u8"summer \u2192 summer \U0001F600 summer"));
+    REQUIRE(s.Replace(String(u8"\U0001F600"), String()) == String(u8"\u00E9t\u00E9 \u2192 \u00E9t\u00E9  \u00E9t\u00E9"));
+    REQUIRE(s.Replace(String("xyz"), String("!")) == s);
+
+    List<String> parts = s.Split(String(u8" \u2192 "));
+    REQUIRE(parts.Count() == 2);
+    REQUIRE(parts[0] == String(u8"\u00E9t\u00E9"));
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/unicode/UnicodeCase_utils.hpp"
+#include "System/Text/unicode/UnicodeNormalization_utils.hpp"
+
+// ------------------------------------------------------------
+// Tests for the generated lookup tries
+// Every code point must read the same value from the trie as
+// from the sorted arrays and range tables it replaces.
+// ------------------------------------------------------------
+namespace
+{
+    constexpr uint32_t CodeSpace = 0x110000;
+
+    template<typename T>
+    bool SortedContains(const T* values, uint32_t count, uint64_t value)
+    {
+        uint32_t lo = 0, hi = count;
+        while (lo < hi)
+        {
+            const uint32_t mid = (lo + hi) >> 1;
+            if ((uint64_t)values[mid] == value)
+                return true;
+            if ((uint64_t)values[mid] < value)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return false;
+    }
+
+    uint32_t RangeValue(const CodePoint* ranges, uint32_t count, uint32_t cp)
+    {
+        const int idx = UnicodeNormalization::binary_search_ranges_uint32(ranges, count, cp);
+        return idx < 0 ? 0 : (uint32_t)ranges[idx * 3 + 2];
+    }
+}
+
+TEST_CASE("Unicode tables - case properties", "[Unicode]") {
+    using namespace UnicodeCase;
+
+    uint32_t mismatches = 0;
+    for (uint32_t cp = 0; cp < CodeSpace; ++cp)
+    {
+        mismatches += is_letter(cp) != small_binsearch_has(LETTERS, sizeof(LETTERS) / sizeof(LETTERS[0]), cp);
+        mismatches += is_cased(cp) != small_binsearch_has(CASED, sizeof(CASED) / sizeof(CASED[0]), cp);
+        mismatches += is_soft_dotted(cp) != small_binsearch_has(SOFT_DOTTED, sizeof(SOFT_DOTTED) / sizeof(SOFT_DOTTED[0]), cp);
+    }
+    REQUIRE(mismatches == 0);
+
+    // above the code space
+    REQUIRE_FALSE(is_letter(0x110000));
+    REQUIRE(GetGBP(0x110000) == GBP::Other);
+}
+
+TEST_CASE("Unicode tables - grapheme break property", "[Unicode]") {
+    using namespace UnicodeCase;
+
+    REQUIRE(GetGBP('a') == GBP::Other);
+    REQUIRE(GetGBP(0x000D) == GBP::CR);
+    REQUIRE(GetGBP(0x000A) == GBP::LF);
+    REQUIRE(GetGBP(0x0000) == GBP::Control);
+    REQUIRE(GetGBP(0x0085) == GBP::Control);
+    REQUIRE(GetGBP(0x200D) == GBP::ZWJ);
+    REQUIRE(GetGBP(0x0301) == GBP::Extend);
+    REQUIRE(GetGBP(0xFE2F) == GBP::Extend);
+    REQUIRE(GetGBP(0x1F3FB) == GBP::Extend);            // skin tone before the emoji blocks
+    REQUIRE(GetGBP(0x1F1E6) == GBP::RegionalIndicator); // before Extended_Pictographic
+    REQUIRE(GetGBP(0x0903) == GBP::SpacingMark);
+    REQUIRE(GetGBP(0x2764) == GBP::ExtendedPictographic);
+    REQUIRE(GetGBP(0x1F600) == GBP::ExtendedPictographic);
+    REQUIRE(GetGBP(0x1FB00) == GBP::Other);
+
+    // usable in constant expressions
+    static_assert(GetGBP(0x200D) == GBP::ZWJ);
+}
+
+TEST_CASE("Unicode tables - combining class and quick check", "[Unicode][Normalization]") {
+    using namespace UnicodeNormalization;
+
+    uint32_t mismatches = 0;
+    for (uint32_t cp = 0; cp < CodeSpace; ++cp)
+    {
+        mismatches += (uint32_t)GetCCC(cp) != RangeValue(CCC_RANGES, CCC_RANGES_COUNT, cp);
+        mismatches += (uint32_t)GetQuickCheck(cp, NormalizationForm::NFC) != RangeValue(NFC_QC_RANGES, NFC_QC_RANGES_COUNT, cp);
+        mismatches += (uint32_t)GetQuickCheck(cp, NormalizationForm::NFD) != RangeValue(NFD_QC_RANGES, NFD_QC_RANGES_COUNT, cp);
+        mismatches += (uint32_t)GetQuickCheck(cp, NormalizationForm::NFKC) != RangeValue(NFKC_QC_RANGES, NFKC_QC_RANGES_COUNT, cp);
+        mismatches += (uint32_t)GetQuickCheck(cp, NormalizationForm::NFKD) != RangeValue(NFKD_QC_RANGES, NFKD_QC_RANGES_COUNT, cp);
+    }
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("Unicode tables - decomposition and composition", "[Unicode][Normalization]") {
+    using namespace UnicodeNormalization;
+
+    uint32_t mismatches = 0;
+    for (uint32_t cp = 0; cp < CodeSpace; ++cp)
+    {
+        mismatches += IsCompositionExcluded(cp) != SortedContains(COMP_EXCL, COMP_EXCL_COUNT, cp);
+
+        // code points without an entry decompose to themselves
+        if (!CodePoint(cp).IsHangulSyllable() && !SortedContains(DECOMP_KEYS, DECOMP_COUNT, cp))
+        {
+            CodePoint out[32];
+            uint32_t outLen = 0;
+            DecomposeCodePoint(cp, true, out, outLen);
+            mismatches += outLen != 1 || (uint32_t)out[0] != cp;
+        }
+    }
+    REQUIRE(mismatches == 0);
+
+    // every pair composes to its result, and nothing else composes with its first code point
+    for (uint32_t i = 0; i < COMPOSE_COUNT; ++i)
+    {
+        const uint32_t a = (uint32_t)(COMPOSE_PAIRS[i] >> 32);
+        const uint32_t b = (uint32_t)COMPOSE_PAIRS[i];
+
+        CodePoint composed;
+        REQUIRE(ComposePair(a, b, composed));
+        REQUIRE((uint32_t)composed == COMPOSE_RESULT[i]);
+        REQUIRE_FALSE(ComposePair(a, 'x', composed));
+    }
+
+    CodePoint composed;
+    REQUIRE(ComposePair(0x1100, 0x1161, composed));     // Hangul stays algorithmic
+    REQUIRE((uint32_t)composed == 0xAC00);
+    REQUIRE_FALSE(ComposePair('x', 0x0301, composed));
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "catch_amalgamated.hpp"
+
+#include "System/Text/UTF8Iterators.hpp"
+#include "System/Types/Text/String.hpp"
+
+// ------------------------------------------------------------
+// Tests for the in place UTF-8 iterators
+// Code points must match UTF8::Decode and grapheme clusters must
+// match UnicodeCase::ComputeGraphemeBoundaries, both directions.
+// ------------------------------------------------------------
+namespace
+{
+    const char8_t* const Samples[] = {
+        u8"",
+        u8"plain ascii",
+        u8"na\u00EFve caf\u00E9",
+        u8"e\u0301\u0301x",  // stacked combining marks
+        u8"a\r\nb\r\r\n",
+        u8"\U0001F469\u200D\u2764\u200D\U0001F48B",  // ZWJ sequence
+        u8"\U0001F44D\U0001F3FB!",  // skin tone
+        u8"\U0001F1E7\U0001F1F7\U0001F1FA\U0001F1F8\U0001F1E6",  // two flags and a lone RI
+        u8"\u4E2D\u6587 \u200Dx\u0903",
+    };
+
+    // byte offset of every cluster, from the List based segmentation
+    List<uint32_t> ReferenceBoundaries(const String& s)
+    {
+        List<CodePoint> cps = String::DecodeToCodePoints(s);
+        List<uint32_t> offsets;
+        List<uint32_t> result;
+        if (cps.Count() == 0)
+            return result;
+
+        uint32_t pos = 0;
+        for (uint32_t i = 0; i < cps.Count(); ++i)
+        {
+            offsets.Add(pos);
+            pos += (uint32_t)UTF8::encode_utf8(cps[i]).Length;
+        }
+
+        List<CodePoint> boundaries;
+        uint32_t count = 0;
+        UnicodeCase::ComputeGraphemeBoundaries(cps, cps.Count(), boundaries, count);
+        for (uint32_t i = 0; i < count; ++i)
+            result.Add(offsets[(uint32_t)boundaries[i]]);
+        return result;
+    }
+}
+
+TEST_CASE("UTF8 iterators - code points match Decode", "[UTF8Iterators]") {
+    for (const char8_t* sample : Samples)
+    {
+        String s(sample);
+        List<CodePoint> expected = String::DecodeToCodePoints(s);
+        INFO(reinterpret_cast<const char*>(sample));
+
+        uint32_t i = 0;
+        for (CodePoint cp : s.CodePoints())
+        {
+            REQUIRE(i < expected.Count());
+            REQUIRE(cp == expected[i]);
+            ++i;
+        }
+        REQUIRE(i == expected.Count());
+
+        for (CodePoint cp : s.ReverseCodePoints())
+        {
+            REQUIRE(i > 0);
+            REQUIRE(cp == expected[--i]);
+        }
+        REQUIRE(i == 0);
+    }
+}
+
+TEST_CASE("UTF8 iterators - ill-formed bytes read as U+FFFD", "[UTF8Iterators]") {
+    const char bad[] = "a\xC3" "b\x80\xE2\x82" "c\xED\xA0\x80";
+    const uint32_t len = (uint32_t)(sizeof(bad) - 1);
+    const Char* bytes = reinterpret_cast<const Char*>(bad);
+
+    List<CodePoint> expected;
+    UTF8::Decode(bytes, len, expected);
+
+    List<CodePoint> got;
+    for (CodePoint cp : UTF8::CodePoints(bytes, len))
+        got.Add(cp);
+
+    REQUIRE(got.Count() == expected.Count());
+    for (uint32_t i = 0; i < got.Count(); ++i)
+        REQUIRE(got[i] == expected[i]);
+
+    // the reverse walk still covers every byte exactly once
+    uint32_t covered = 0;
+    for (UTF8::ReverseCodePointIterator it(bytes, len); !it.IsEnd(); ++it)
+        covered += it.ByteLength();
+    REQUIRE(covered == len);
+}
+
+TEST_CASE("UTF8 iterators - grapheme clusters match the segmentation", "[UTF8Iterators]") {
+    for (const char8_t* sample : Samples)
+    {
+        String s(sample);
+        List<uint32_t> expected = ReferenceBoundaries(s);
+        const Char* bytes = static_cast<const Char*>(s);
+        const uint32_t len = (uint32_t)s.GetByteCount();
+        INFO(reinterpret_cast<const char*>(sample));
+
+        List<uint32_t> forward;
+        for (UTF8::GraphemeIterator it(bytes, len); !it.IsEnd(); ++it)
+            forward.Add(it.ByteOffset());
+        REQUIRE(forward.Count() == expected.Count());
+        for (uint32_t i = 0; i < forward.Count(); ++i)
+            REQUIRE(forward[i] == expected[i]);
+
+        List<uint32_t> reverse;
+        for (UTF8::ReverseGraphemeIterator it(bytes, len); !it.IsEnd(); ++it)
+            reverse.Add(it.ByteOffset());
+        REQUIRE(reverse.Count() == expected.Count());
+        for (uint32_t i = 0; i < reverse.Count(); ++i)
+            REQUIRE(reverse[i] == expected[expected.Count() - 1 - i]);
+
+        // starting in the middle carries the same break context
+        for (uint32_t k = 0; k < expected.Count(); ++k)
+        {
+            UTF8::GraphemeIterator it(bytes, len, expected[k]);
+            for (uint32_t j = k; j < expected.Count(); ++j, ++it)
+                REQUIRE(it.ByteOffset() == expected[j]);
+            REQUIRE(it.IsEnd());
+        }
+
+        REQUIRE(s.GetLength() == expected.Count());
+    }
+}
+
+TEST_CASE("UTF8 iterators - clusters are views over the string", "[UTF8Iterators]") {
+    String s(u8"a\U0001F1E7\U0001F1F7e\u0301");
+
+    List<String> clusters;
+    for (StringView cluster : s.Graphemes())
+        clusters.Add(String(cluster.GetData(), cluster.GetByteCount()));
+
+    REQUIRE(clusters.Count() == 3);
+    REQUIRE(clusters[0] == "a");
+    REQUIRE(clusters[1] == String(u8"\U0001F1E7\U0001F1F7"));
+    REQUIRE(clusters[2] == String(u8"e\u0301"));
+}
+
+TEST_CASE("UTF8 iterators - String operations built on them", "[UTF8Iterators][String]") {
+    String s(u8"caf\u00E9 \U0001F469\u200D\u2764\u200D\U0001F48B \u03A3\u039F\u03A3");
+
+    REQUIRE(s.Substring(5, 1) == String(u8"\U0001F469\u200D\u2764\u200D\U0001F48B"));
+    REQUIRE(s.Substring(7) == String(u8"\u03A3\u039F\u03A3"));
+    REQUIRE(s.Substring(100).IsEmpty());
+
+    // code point indices: the ZWJ sequence is five of them
+    REQUIRE(s.IndexOf(String(u8"\u03A3")) == 11);
+    REQUIRE(s.IndexOf(String(u8"\u03A3"), 12) == 13);
+    REQUIRE(s.LastIndexOf(String(u8"\u03A3")) == 13);
+    REQUIRE(s.LastIndexOf(String(u8"\u03A3"), 12) == 11);
+    REQUIRE(s.IndexOf(String(u8"\u00E9\u00E9")) == -1);
+
+    // final sigma is decided from the bytes around it
+    REQUIRE(s.ToLower() == String(u8"caf\u00E9 \U0001F469\u200D\u2764\u200D\U0001F48B \u03C3\u03BF\u03C2"));
+    REQUIRE(String(u8"\u00E9").ToUpper() == String(u8"\u00C9"));
+    REQUIRE(s.GetCodePointsCount() == String::DecodeToCodePoints(s).Count());
+}
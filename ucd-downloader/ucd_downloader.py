@@ -6,6 +6,7 @@
 #  - src/text/UnicodeCase_special.hpp
 #  - src/text/UnicodeCase_props.hpp
 #  - src/text/UnicodeCase_utils.hpp
+#  - src/text/UnicodeCase_tries.hpp
 #
 # Baixa UnicodeData.txt e SpecialCasing.txt se não existirem.
 #
@@ -16,6 +17,8 @@ import sys
 import urllib.request
 from collections import defaultdict
 
+from ucd_trie import build_trie, write_trie, verify_trie
+
 # --- CONFIG ---
 UCD_BASE = "https://www.unicode.org/Public/UCD/latest/ucd"
 UNICODE_DATA = "UnicodeData.txt"
@@ -27,6 +30,17 @@ OUT_GEN = os.path.join(OUT_DIR, "UnicodeCase_generated.hpp")
 OUT_SPEC = os.path.join(OUT_DIR, "UnicodeCase_special.hpp")
 OUT_PROPS = os.path.join(OUT_DIR, "UnicodeCase_props.hpp")
 OUT_UTILS = os.path.join(OUT_DIR, "UnicodeCase_utils.hpp")
+OUT_TRIES = os.path.join(OUT_DIR, "UnicodeCase_tries.hpp")
+
+# UnicodeCase::GBP, in declaration order
+GBP_NAMES = ["Other", "CR", "LF", "Control", "Extend", "ZWJ", "SpacingMark", "Prepend",
+             "RegionalIndicator", "L", "V", "T", "LV", "LVT", "ExtendedPictographic"]
+GBP = {name: i for i, name in enumerate(GBP_NAMES)}
+
+# CASE_PROPS_TRIE bits: the GBP value in the low nibble, then the flags
+PROP_LETTER = 0x10
+PROP_CASED = 0x20
+PROP_SOFT_DOTTED = 0x40
 # ---------------
 
 def fetch_if_missing(name):
@@ -256,6 +270,68 @@ constexpr bool small_binsearch_has(const uint32_t* arr, std::size_t n, uint32_t
         out.write("\n} // namespace UnicodeCase\n")
     print("Wrote", OUT_PROPS)
 
+def grapheme_break_property(cp):
+    """
+    Grapheme_Cluster_Break as UnicodeCase::GetGBP classifies it: the same
+    ranges, tested in the same order.
+    """
+    if cp == 0x000D:
+        return GBP["CR"]
+    if cp == 0x000A:
+        return GBP["LF"]
+    if cp <= 0x001F or 0x007F <= cp <= 0x009F:
+        return GBP["Control"]
+    if cp == 0x200D:
+        return GBP["ZWJ"]
+    if (0x0300 <= cp <= 0x036F or 0x1AB0 <= cp <= 0x1AFF or 0x1DC0 <= cp <= 0x1DFF or
+            0x20D0 <= cp <= 0x20FF or 0xFE20 <= cp <= 0xFE2F):
+        return GBP["Extend"]
+    if 0x1F3FB <= cp <= 0x1F3FF:        # emoji modifiers
+        return GBP["Extend"]
+    if 0x1F1E6 <= cp <= 0x1F1FF:
+        return GBP["RegionalIndicator"]
+    if 0x0903 <= cp <= 0x093B:
+        return GBP["SpacingMark"]
+    if cp == 0x2764 or cp == 0x1F48B or 0x1F300 <= cp <= 0x1FAFF:
+        return GBP["ExtendedPictographic"]
+    return GBP["Other"]
+
+def build_case_props(letters_list, cased_list, soft_list):
+    """cp -> CASE_PROPS_TRIE value"""
+    props = {}
+    for cp in range(0x110000):
+        g = grapheme_break_property(cp)
+        if g:
+            props[cp] = g
+    for flag, cps in ((PROP_LETTER, letters_list), (PROP_CASED, cased_list), (PROP_SOFT_DOTTED, soft_list)):
+        for cp in cps:
+            props[cp] = props.get(cp, 0) | flag
+    return props
+
+def emit_tries_header(letters_list, cased_list, soft_list):
+    """
+    One trie for everything looked up per code point during case mapping and
+    grapheme segmentation (is_letter, is_cased, is_soft_dotted, GetGBP).
+    """
+    props = build_case_props(letters_list, cased_list, soft_list)
+    trie = build_trie(props)
+    verify_trie("CASE_PROPS_TRIE", trie, props)
+
+    os.makedirs(OUT_DIR, exist_ok=True)
+    with open(OUT_TRIES, "w", encoding="utf-8") as out:
+        out.write("// Auto-generated: UnicodeCase_tries.hpp\n")
+        out.write("// Generated by scripts/generate_unicode_case.py\n")
+        out.write("// Read with UnicodeTrie::Lookup; see ucd_trie.py for the layout\n\n")
+        out.write("#pragma once\n#include <cstdint>\n\nnamespace UnicodeCase {\n\n")
+        out.write("\t// low nibble: GBP value; bits above: properties\n")
+        out.write("\tstatic constexpr uint8_t PROP_GBP_MASK = 0x0F;\n")
+        out.write(f"\tstatic constexpr uint8_t PROP_LETTER = 0x{PROP_LETTER:02X};\n")
+        out.write(f"\tstatic constexpr uint8_t PROP_CASED = 0x{PROP_CASED:02X};\n")
+        out.write(f"\tstatic constexpr uint8_t PROP_SOFT_DOTTED = 0x{PROP_SOFT_DOTTED:02X};\n\n")
+        write_trie(out, "CASE_PROPS_TRIE", trie, "\t")
+        out.write("} // namespace UnicodeCase\n")
+    print("Wrote", OUT_TRIES)
+
 def emit_utils_header():
     """
     This header uses the generated arrays and special entries.
@@ -304,6 +380,7 @@ def main():
     emit_special_header(special_entries)
     emit_props_header(letters_list, cased_list, soft_list)
     emit_utils_header()
+    emit_tries_header(letters_list, cased_list, soft_list)
     print("All done. Headers are in", OUT_DIR)
 
 if __name__ == "__main__":
@@ -12,6 +12,8 @@ import os
 import sys
 import urllib.request
 
+from ucd_trie import build_trie, write_trie, verify_trie
+
 BASE_URL = "https://www.unicode.org/Public/UCD/latest/ucd/"
 
 FILES = {
@@ -22,6 +24,11 @@ FILES = {
 }
 
 OUT_FILE = "UnicodeNormalization_tables.hpp"
+QC_OUT_FILE = "UnicodeNormalization_quickcheck.hpp"
+TRIES_OUT_FILE = "UnicodeNormalization_tries.hpp"
+
+QC_PROPERTIES = ("NFC_QC", "NFD_QC", "NFKC_QC", "NFKD_QC")
+QC_VALUES = {"N": 1, "M": 2}   # Yes is the default and is not stored
 
 # ---------------- helpers ----------------
 def fetch_if_missing(name):
@@ -116,6 +123,29 @@ def parse_derived_normalization_props(path):
             excl.add(int(left, 16))
     return excl
 
+def parse_quick_check(path):
+    """
+    Parse DerivedNormalizationProps.txt for the quick check properties.
+    Returns dict prop -> dict cp -> value (1 = No, 2 = Maybe).
+    """
+    qc = {prop: {} for prop in QC_PROPERTIES}
+    for raw in read_lines(path):
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+        parts = [p.strip() for p in line.split(";")]
+        if len(parts) < 3 or parts[1] not in qc or parts[2] not in QC_VALUES:
+            continue
+        left = parts[0]
+        if ".." in left:
+            a_str, b_str = left.split("..", 1)
+            a = int(a_str, 16); b = int(b_str, 16)
+        else:
+            a = b = int(left, 16)
+        for cp in range(a, b+1):
+            qc[parts[1]][cp] = QC_VALUES[parts[2]]
+    return qc
+
 def parse_composition_exclusions_file(path):
     """
     Parse CompositionExclusions.txt (legacy).
@@ -215,6 +245,12 @@ def build_ccc_ranges(ccc_map):
     ranges.append((start, end, val))
     return ranges
 
+def build_quick_check_ranges(values):
+    """
+    Compress cp -> value into ranges (start, end, value), like build_ccc_ranges.
+    """
+    return build_ccc_ranges(values)
+
 def build_compose_pairs(decomp_map, ccc_map, comp_excl):
     """
     Build ALL canonical composition pairs per UAX #15:
@@ -332,6 +368,84 @@ def write_header(out_path,
 
     print("Wrote", out_path)
 
+def write_quick_check_header(out_path, qc):
+    """
+    One range table per quick check property, plus the first code point
+    that is not Yes: everything below it can be skipped without a lookup.
+    """
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("// AUTO-GENERATED. DO NOT EDIT.\n")
+        f.write("// Unicode Normalization quick check (UAX #15, DerivedNormalizationProps.txt) - generated by script\n\n")
+        f.write("#pragma once\n\n")
+        f.write("#include <cstdint>\n\n")
+        f.write("namespace UnicodeNormalization {\n\n")
+        f.write("// [start, end, value] for code points whose quick check is not Yes: 1 = No, 2 = Maybe\n\n")
+
+        for prop in QC_PROPERTIES:
+            ranges = build_quick_check_ranges(qc[prop])
+            first = ranges[0][0] if ranges else 0x110000
+            f.write(f"static constexpr uint32_t {prop}_FIRST = 0x{first:04X}u;\n")
+            f.write(f"static constexpr uint32_t {prop}_RANGES_COUNT = {len(ranges)}u;\n")
+            f.write(f"static constexpr CodePoint {prop}_RANGES[] = {{\n")
+            for s, e, v in ranges:
+                f.write(f"  0x{s:04X}, 0x{e:04X}, {v},\n")
+            f.write("};\n\n")
+
+        f.write("} // namespace UnicodeNormalization\n")
+
+    print("Wrote", out_path)
+
+def build_norm_tries(ccc_map, qc, comp_excl, decomp_keys, compose_keys):
+    """
+    Per code point lookups replacing the searches over the tables above:
+      CCC_TRIE        canonical combining class
+      NORM_FLAGS_TRIE quick check, 2 bits per form in QC_PROPERTIES order,
+                      bit 8 set for composition exclusions
+      DECOMP_TRIE     1 + index in DECOMP_KEYS, 0 when cp does not decompose
+      COMPOSE_TRIE    1 + index in COMPOSE_PAIRS of the first pair starting
+                      with cp (pairs are sorted, so those with the same first
+                      code point are contiguous), 0 when cp starts none
+    """
+    flags = {}
+    for shift, prop in enumerate(QC_PROPERTIES):
+        for cp, v in qc[prop].items():
+            flags[cp] = flags.get(cp, 0) | (v << (shift * 2))
+    for cp in comp_excl:
+        flags[cp] = flags.get(cp, 0) | 0x100
+
+    decomp = {cp: i + 1 for i, cp in enumerate(decomp_keys)}
+
+    compose = {}
+    for i, key in enumerate(compose_keys):
+        compose.setdefault(key >> 32, i + 1)
+
+    values = {
+        "CCC_TRIE": dict(ccc_map),
+        "NORM_FLAGS_TRIE": flags,
+        "DECOMP_TRIE": decomp,
+        "COMPOSE_TRIE": compose,
+    }
+    tries = {}
+    for name, v in values.items():
+        tries[name] = build_trie(v)
+        verify_trie(name, tries[name], v)
+    return tries
+
+def write_tries_header(out_path, tries):
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("// AUTO-GENERATED. DO NOT EDIT.\n")
+        f.write("// Unicode Normalization lookup tries (UAX #15) - generated by script\n")
+        f.write("// Read with UnicodeTrie::Lookup; see ucd_trie.py for the layout\n\n")
+        f.write("#pragma once\n\n")
+        f.write("#include <cstdint>\n\n")
+        f.write("namespace UnicodeNormalization {\n\n")
+        f.write("static constexpr uint16_t NORM_FLAG_EXCLUDED = 0x100u;\n\n")
+        for name, trie in tries.items():
+            write_trie(f, name, trie)
+        f.write("} // namespace UnicodeNormalization\n")
+
+    print("Wrote", out_path)
+
 # ---------------- verification helpers ----------------
 def check_presence(decomp_keys, decomp_flags, decomp_targets, target_cp):
     """
@@ -375,6 +489,11 @@ def main():
     comp_excl = comp_excl_dnp | comp_excl_file
     print(f"  total composition exclusions: {len(comp_excl)}")
 
+    print("Parsing DerivedNormalizationProps (quick check)...")
+    quick_check = parse_quick_check(FILES["DerivedNormalizationProps"])
+    for prop in QC_PROPERTIES:
+        print(f"  {prop}: {len(quick_check[prop])} code points not Yes")
+
     # parse normalization corrections and apply
     print("Parsing NormalizationCorrections...")
     corrections = parse_normalization_corrections(FILES["NormalizationCorrections"])
@@ -406,6 +525,11 @@ def main():
                  decomp_keys, decomp_offs, decomp_targets, decomp_flags,
                  comp_excl,
                  compose_keys, compose_results)
+    write_quick_check_header(QC_OUT_FILE, quick_check)
+
+    print("Building lookup tries...")
+    tries = build_norm_tries(ccc_map, quick_check, comp_excl, decomp_keys, compose_keys)
+    write_tries_header(TRIES_OUT_FILE, tries)
 
     # quick verification of previously failing cases
     print("\nVerification checks (quick):")
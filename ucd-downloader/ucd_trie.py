@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# ucd_trie.py
+# Three-stage lookup tables (tries) for per code point properties, shared by
+# ucd_downloader.py and ucd_normalization.py.
+#
+#   cp >> 10          -> STAGE1 -> a block of 32 entries in STAGE2
+#   (cp >> 5) & 31    -> STAGE2 -> a block of 32 values in STAGE3
+#   cp & 31           -> STAGE3 -> the value
+#
+# Identical blocks are stored once, so the planes and blocks where nothing is
+# assigned cost a single block. Lookup is UnicodeTrie::Lookup (UnicodeTrie.hpp).
+# The default value (unassigned code points, and anything above U+10FFFF) is 0.
+#
+# Requer Python 3.7+
+
+SHIFT1 = 10
+SHIFT2 = 5
+LIMIT = 0x110000
+
+def build_trie(values):
+    """
+    values: dict cp -> int (missing code points are 0).
+    Returns (stage1, stage2, stage3) as lists of ints.
+    """
+    stage3 = []
+    stage3_blocks = {}
+    stage2 = []
+    stage2_blocks = {}
+    stage1 = []
+
+    for hi in range(0, LIMIT, 1 << SHIFT1):
+        mids = []
+        for lo in range(hi, hi + (1 << SHIFT1), 1 << SHIFT2):
+            block = tuple(values.get(cp, 0) for cp in range(lo, lo + (1 << SHIFT2)))
+            idx = stage3_blocks.get(block)
+            if idx is None:
+                idx = len(stage3_blocks)
+                stage3_blocks[block] = idx
+                stage3.extend(block)
+            mids.append(idx)
+
+        mids = tuple(mids)
+        idx = stage2_blocks.get(mids)
+        if idx is None:
+            idx = len(stage2_blocks)
+            stage2_blocks[mids] = idx
+            stage2.extend(mids)
+        stage1.append(idx)
+
+    return stage1, stage2, stage3
+
+def lookup(trie, cp):
+    """Same walk as UnicodeTrie::Lookup, for verification."""
+    stage1, stage2, stage3 = trie
+    if cp >= LIMIT:
+        return 0
+    block = stage1[cp >> SHIFT1] << (SHIFT1 - SHIFT2)
+    values = stage2[block | ((cp >> SHIFT2) & ((1 << (SHIFT1 - SHIFT2)) - 1))] << SHIFT2
+    return stage3[values | (cp & ((1 << SHIFT2) - 1))]
+
+def index_type(values):
+    """Smallest unsigned C++ type holding every value."""
+    top = max(values) if values else 0
+    if top < (1 << 8):
+        return "uint8_t"
+    if top < (1 << 16):
+        return "uint16_t"
+    return "uint32_t"
+
+def trie_bytes(trie):
+    sizes = {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}
+    return sum(len(stage) * sizes[index_type(stage)] for stage in trie)
+
+def write_array(f, ctype, name, values, indent=""):
+    f.write(f"{indent}static constexpr {ctype} {name}[{len(values)}] = {{\n")
+    for i in range(0, len(values), 16):
+        row = ", ".join(str(v) for v in values[i:i + 16])
+        f.write(f"{indent}  {row},\n")
+    f.write(f"{indent}}};\n\n")
+
+def write_trie(f, name, trie, indent=""):
+    """
+    Emits NAME_STAGE1/2/3. Stage types are the smallest that fit, so call
+    sites go through UnicodeTrie::Lookup, which deduces them.
+    """
+    stage1, stage2, stage3 = trie
+    f.write(f"{indent}// {name}: {trie_bytes(trie)} bytes\n")
+    write_array(f, index_type(stage1), f"{name}_STAGE1", stage1, indent)
+    write_array(f, index_type(stage2), f"{name}_STAGE2", stage2, indent)
+    write_array(f, index_type(stage3), f"{name}_STAGE3", stage3, indent)
+
+def verify_trie(name, trie, values):
+    """Every code point must read back its value."""
+    for cp in range(LIMIT):
+        if lookup(trie, cp) != values.get(cp, 0):
+            raise RuntimeError(f"{name}: mismatch at U+{cp:04X}")
+    print(f"  {name}: {trie_bytes(trie)} bytes, verified")